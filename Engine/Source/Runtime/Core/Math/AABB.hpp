@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/Vector3.hpp"
+
+namespace Phanes::Core::Math
+{
+
+    // Axis aligned bounding box, defined by its minimum and maximum corner.
+
+    template<RealType T, bool S>
+    struct TAABB
+    {
+    public:
+        using Real = T;
+
+        /** Minimum corner */
+        TVector3<Real, S> min;
+
+        /** Maximum corner */
+        TVector3<Real, S> max;
+
+    public:
+        /** Default constructor */
+        TAABB() = default;
+
+        /**
+         * Construct box from minimum and maximum corner.
+         *
+         * @param(min) Minimum corner
+         * @param(max) Maximum corner
+         *
+         * @note min has to be smaller or equal to max in every component.
+         */
+
+        TAABB(const TVector3<Real, S>& min, const TVector3<Real, S>& max) : min(min), max(max) {};
+    };
+
+    // =================== //
+    //   TAABB operators   //
+    // =================== //
+
+    /**
+     * Tests two boxes for equality
+     *
+     * @param(b1) Box one
+     * @param(b2) Box two
+     *
+     * @return True, if same and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator== (const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        return (b1.min == b2.min && b1.max == b2.max);
+    }
+
+    /**
+     * Tests two boxes for inequality
+     *
+     * @param(b1) Box one
+     * @param(b2) Box two
+     *
+     * @return True, if not same and false, if same.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator!= (const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        return !(b1 == b2);
+    }
+
+    // =================== //
+    //   TAABB functions   //
+    // =================== //
+
+    /**
+     * Gets the center of a box.
+     *
+     * @param(b1) Box
+     *
+     * @return Center
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetCenter(const TAABB<T, S>& b1)
+    {
+        return (b1.min + b1.max) * (T)0.5;
+    }
+
+    /**
+     * Gets the half extents of a box.
+     *
+     * @param(b1) Box
+     *
+     * @return Half of the size along each axis
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetExtents(const TAABB<T, S>& b1)
+    {
+        return (b1.max - b1.min) * (T)0.5;
+    }
+
+    /**
+     * Tests if a point is inside a box (including the border).
+     *
+     * @param(b1) Box
+     * @param(p1) Point
+     *
+     * @return True, if inside and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool IsInside(const TAABB<T, S>& b1, const TVector3<T, S>& p1)
+    {
+        return (p1.x >= b1.min.x && p1.x <= b1.max.x &&
+                p1.y >= b1.min.y && p1.y <= b1.max.y &&
+                p1.z >= b1.min.z && p1.z <= b1.max.z);
+    }
+
+    /**
+     * Tests if two boxes overlap (touching counts as overlap).
+     *
+     * @param(b1) Box one
+     * @param(b2) Box two
+     *
+     * @return True, if overlapping and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool Intersects(const TAABB<T, S>& b1, const TAABB<T, S>& b2)
+    {
+        return (b1.min.x <= b2.max.x && b1.max.x >= b2.min.x &&
+                b1.min.y <= b2.max.y && b1.max.y >= b2.min.y &&
+                b1.min.z <= b2.max.z && b1.max.z >= b2.min.z);
+    }
+
+} // Phanes::Core::Math
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathFwd.h"
+
+#include <cstdio>
+#include <span>
+#include <vector>
+
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include "Core/Math/Detail/ArchiveDecl.inl"
+
+namespace Phanes::Core::Math {
+
+    // Binary archive of named arrays of TVector2 / 3 / 4, TMatrix3 / 4, TPlane and TQuaternion (float or double).
+    //
+    // Layout (version 1), all offsets in bytes from the start of the file:
+    //
+    //      Header      64 bytes: "PMAR", version (uint16), byte order (uint8, 1 = little, 2 = big endian),
+    //                  padding, number of arrays (uint32), padding, offset of the directory (uint64), padding.
+    //      Arrays      Elements exactly as in memory (stride is sizeof of the element type, vectors padded to four
+    //                  components). Every array starts at a multiple of 64 bytes.
+    //      Directory   64 bytes per array: name (32 chars, null terminated), offset (uint64), count (uint64),
+    //                  stride (uint32), type (uint16, Detail::archive_type), component size (uint8, 4 or 8), padding.
+    //
+    // The data keeps the byte order of the machine that wrote it, the header records it. MappedArchive::Get gives
+    // spans straight into the memory mapped file, if byte order and stride match the requested type. Aligned and
+    // unaligned types have the same layout, except TVector2<double> (16 bytes with SSE, 32 bytes without).
+    // MappedArchive::Read copies and converts in the other cases.
+
+
+    // Writes an archive. Arrays are streamed to the file as they are written, only the directory is kept in memory.
+
+    class ArchiveWriter
+    {
+    public:
+
+        ArchiveWriter() = default;
+
+        ArchiveWriter(const ArchiveWriter&) = delete;
+        ArchiveWriter& operator= (const ArchiveWriter&) = delete;
+
+        /// <summary>
+        /// Closes the archive.
+        /// </summary>
+        ~ArchiveWriter();
+
+        /// <summary>
+        /// Creates the file, an existing file is overwritten.
+        /// </summary>
+        /// <param name="path">Path of the archive</param>
+        /// <returns>True, if the file could be created.</returns>
+        bool Open(const char* path);
+
+        /// <summary>
+        /// Starts a new array. Its elements are appended with Write.
+        /// </summary>
+        /// <typeparam name="X">Type of the elements</typeparam>
+        /// <param name="name">Name of the array, at most 31 characters</param>
+        /// <returns>True on success, false if no file is open, an array is already started or the name is too long.</returns>
+        template<typename X>
+        bool Begin(const char* name);
+
+        /// <summary>
+        /// Appends count elements to the started array.
+        /// </summary>
+        /// <param name="v">Elements, of the type the array was started with</param>
+        /// <param name="count">Number of elements</param>
+        /// <returns>True, if the elements were written.</returns>
+        template<typename X>
+        bool Write(const X* v, size_t count);
+
+        /// <summary>
+        /// Finishes the started array.
+        /// </summary>
+        /// <returns>True, if an array was started.</returns>
+        bool End();
+
+        /// <summary>
+        /// Writes a whole array, Begin, Write and End in one call.
+        /// </summary>
+        /// <param name="name">Name of the array, at most 31 characters</param>
+        /// <param name="v">Elements</param>
+        /// <param name="count">Number of elements</param>
+        /// <returns>True on success.</returns>
+        template<typename X>
+        bool WriteArray(const char* name, const X* v, size_t count);
+
+        /// <summary>
+        /// Finishes a started array, writes the directory and the header and closes the file.
+        /// </summary>
+        /// <returns>True, if every write succeeded.</returns>
+        bool Close();
+
+        /// <summary>
+        /// Is a file open?
+        /// </summary>
+        bool IsOpen() const { return file != nullptr; }
+
+    private:
+
+        bool Pad();
+
+        std::FILE* file = nullptr;
+
+        std::vector<Detail::archive_entry> entries;
+
+        Detail::archive_entry current;
+
+        Phanes::Core::Types::uint64 pos = 0;
+
+        bool started = false;
+
+        bool failed = false;
+    };
+
+
+    // Read only, memory mapped archive.
+
+    class MappedArchive
+    {
+    public:
+
+        MappedArchive() = default;
+
+        MappedArchive(const MappedArchive&) = delete;
+        MappedArchive& operator= (const MappedArchive&) = delete;
+
+        /// <summary>
+        /// Unmaps the file.
+        /// </summary>
+        ~MappedArchive();
+
+        /// <summary>
+        /// Maps the file and validates the header and directory.
+        /// </summary>
+        /// <param name="path">Path of the archive</param>
+        /// <returns>True, if the file is a valid archive.</returns>
+        bool Open(const char* path);
+
+        /// <summary>
+        /// Unmaps the file. Spans returned by Get are invalid afterwards.
+        /// </summary>
+        void Close();
+
+        /// <summary>
+        /// Number of arrays.
+        /// </summary>
+        size_t Size() const { return entries.size(); }
+
+        /// <summary>
+        /// Name of array i.
+        /// </summary>
+        const char* Name(size_t i) const { return entries[i].name; }
+
+        /// <summary>
+        /// Number of elements of array i.
+        /// </summary>
+        size_t Count(size_t i) const { return (size_t)entries[i].count; }
+
+        /// <summary>
+        /// Is the data in the byte order of this machine?
+        /// </summary>
+        bool IsNative() const { return endian == Detail::archive_native_endian; }
+
+        /// <summary>
+        /// Gets an array without copying.
+        /// </summary>
+        /// <typeparam name="X">Type of the elements</typeparam>
+        /// <param name="name">Name of the array</param>
+        /// <returns>Elements in the mapped file. Empty, if there is no such array, the type or stride differs or the byte order is not native.</returns>
+        template<typename X>
+        std::span<const X> Get(const char* name) const;
+
+        /// <summary>
+        /// Copies an array, converting the byte order and stride if necessary.
+        /// </summary>
+        /// <typeparam name="X">Type of the elements</typeparam>
+        /// <param name="name">Name of the array</param>
+        /// <param name="r">Elements, resized to the size of the array</param>
+        /// <returns>True, if there is an array of the name and element type.</returns>
+        template<typename X>
+        bool Read(const char* name, std::vector<X>& r) const;
+
+    private:
+
+        template<typename X>
+        const Detail::archive_entry* Find(const char* name) const;
+
+        const Phanes::Core::Types::uint8* data = nullptr;
+
+        size_t size = 0;
+
+        std::vector<Detail::archive_entry> entries;
+
+        Detail::archive_endian endian = Detail::archive_native_endian;
+
+#ifdef P_WIN_BUILD
+        void* fileHandle = nullptr;
+
+        void* mappingHandle = nullptr;
+#endif
+    };
+
+} // Phanes::Core::Math
+
+#endif // !ARCHIVE_H
+
+#include "Core/Math/Vector2.hpp"
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Vector4.hpp"
+#include "Core/Math/Matrix3.hpp"
+#include "Core/Math/Matrix4.hpp"
+#include "Core/Math/Plane.hpp"
+#include "Core/Math/Quaternion.hpp"
+
+#include "Core/Math/Archive.inl"
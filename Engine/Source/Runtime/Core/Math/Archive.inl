@@ -0,0 +1,418 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/ArchiveDecl.inl"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef P_WIN_BUILD
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+
+namespace Phanes::Core::Math
+{
+    // ArchiveWriter
+
+    inline ArchiveWriter::~ArchiveWriter()
+    {
+        Close();
+    }
+
+    inline bool ArchiveWriter::Open(const char* path)
+    {
+        if (file)
+        {
+            return false;
+        }
+
+        file = std::fopen(path, "wb");
+
+        if (!file)
+        {
+            return false;
+        }
+
+        entries.clear();
+        pos = 0;
+        started = false;
+        failed = false;
+
+        // Placeholder, the header is written on Close when the directory offset is known.
+        Detail::archive_header h{};
+        failed = std::fwrite(&h, sizeof(h), 1, file) != 1;
+        pos = sizeof(h);
+
+        return !failed;
+    }
+
+    inline bool ArchiveWriter::Pad()
+    {
+        static constexpr Phanes::Core::Types::uint8 zero[Detail::archive_alignment] = {};
+
+        size_t n = (size_t)((Detail::archive_alignment - pos % Detail::archive_alignment) % Detail::archive_alignment);
+
+        if (n > 0 && std::fwrite(zero, 1, n, file) != n)
+        {
+            failed = true;
+        }
+
+        pos += n;
+
+        return !failed;
+    }
+
+    template<typename X>
+    bool ArchiveWriter::Begin(const char* name)
+    {
+        using Traits = Detail::archive_traits<X>;
+
+        size_t len = std::strlen(name);
+
+        if (!file || started || len >= sizeof(current.name))
+        {
+            return false;
+        }
+
+        if (!Pad())
+        {
+            return false;
+        }
+
+        current = Detail::archive_entry{};
+        std::memcpy(current.name, name, len);
+        current.offset = pos;
+        current.count = 0;
+        current.stride = (Phanes::Core::Types::uint32)sizeof(X);
+        current.type = Traits::Type;
+        current.componentSize = (Phanes::Core::Types::uint8)sizeof(typename Traits::Real);
+
+        started = true;
+
+        return true;
+    }
+
+    template<typename X>
+    bool ArchiveWriter::Write(const X* v, size_t count)
+    {
+        using Traits = Detail::archive_traits<X>;
+
+        if (!started || current.type != Traits::Type || current.stride != sizeof(X) || current.componentSize != sizeof(typename Traits::Real))
+        {
+            return false;
+        }
+
+        if (count > 0 && std::fwrite(v, sizeof(X), count, file) != count)
+        {
+            failed = true;
+            return false;
+        }
+
+        current.count += count;
+        pos += (Phanes::Core::Types::uint64)count * sizeof(X);
+
+        return true;
+    }
+
+    inline bool ArchiveWriter::End()
+    {
+        if (!started)
+        {
+            return false;
+        }
+
+        entries.push_back(current);
+        started = false;
+
+        return true;
+    }
+
+    template<typename X>
+    bool ArchiveWriter::WriteArray(const char* name, const X* v, size_t count)
+    {
+        return Begin<X>(name) && Write(v, count) && End();
+    }
+
+    inline bool ArchiveWriter::Close()
+    {
+        if (!file)
+        {
+            return false;
+        }
+
+        if (started)
+        {
+            End();
+        }
+
+        Pad();
+
+        Detail::archive_header h{};
+        std::memcpy(h.magic, "PMAR", 4);
+        h.version = Detail::archive_version;
+        h.endian = Detail::archive_native_endian;
+        h.count = (Phanes::Core::Types::uint32)entries.size();
+        h.directory = pos;
+
+        if (!entries.empty() && std::fwrite(entries.data(), sizeof(Detail::archive_entry), entries.size(), file) != entries.size())
+        {
+            failed = true;
+        }
+
+        if (std::fseek(file, 0, SEEK_SET) != 0 || std::fwrite(&h, sizeof(h), 1, file) != 1)
+        {
+            failed = true;
+        }
+
+        if (std::fclose(file) != 0)
+        {
+            failed = true;
+        }
+
+        file = nullptr;
+        entries.clear();
+
+        return !failed;
+    }
+
+
+    // MappedArchive
+
+    inline MappedArchive::~MappedArchive()
+    {
+        Close();
+    }
+
+    inline bool MappedArchive::Open(const char* path)
+    {
+        Close();
+
+#ifdef P_WIN_BUILD
+        HANDLE f = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (f == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+
+        if (!GetFileSizeEx(f, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(Detail::archive_header))
+        {
+            CloseHandle(f);
+            return false;
+        }
+
+        HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (!m)
+        {
+            CloseHandle(f);
+            return false;
+        }
+
+        const void* p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+
+        if (!p)
+        {
+            CloseHandle(m);
+            CloseHandle(f);
+            return false;
+        }
+
+        fileHandle = f;
+        mappingHandle = m;
+        data = (const Phanes::Core::Types::uint8*)p;
+        size = (size_t)fileSize.QuadPart;
+#else
+        int f = ::open(path, O_RDONLY);
+
+        if (f < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+
+        if (::fstat(f, &st) != 0 || st.st_size < (off_t)sizeof(Detail::archive_header))
+        {
+            ::close(f);
+            return false;
+        }
+
+        void* p = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, f, 0);
+
+        // The mapping stays valid after the descriptor is closed.
+        ::close(f);
+
+        if (p == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data = (const Phanes::Core::Types::uint8*)p;
+        size = (size_t)st.st_size;
+#endif
+
+        Detail::archive_header h;
+        std::memcpy(&h, data, sizeof(h));
+
+        if (std::memcmp(h.magic, "PMAR", 4) != 0 || (h.endian != Detail::archive_endian::Little && h.endian != Detail::archive_endian::Big))
+        {
+            Close();
+            return false;
+        }
+
+        endian = h.endian;
+
+        if (!IsNative())
+        {
+            h.version = Detail::archive_swap(h.version);
+            h.count = Detail::archive_swap(h.count);
+            h.directory = Detail::archive_swap(h.directory);
+        }
+
+        if (h.version != Detail::archive_version || h.directory > size || (size - h.directory) / sizeof(Detail::archive_entry) < h.count)
+        {
+            Close();
+            return false;
+        }
+
+        entries.resize(h.count);
+
+        if (h.count > 0)
+        {
+            std::memcpy(entries.data(), data + h.directory, h.count * sizeof(Detail::archive_entry));
+        }
+
+        for (Detail::archive_entry& e : entries)
+        {
+            if (!IsNative())
+            {
+                e.offset = Detail::archive_swap(e.offset);
+                e.count = Detail::archive_swap(e.count);
+                e.stride = Detail::archive_swap(e.stride);
+                e.type = Detail::archive_swap(e.type);
+            }
+
+            e.name[sizeof(e.name) - 1] = '\0';
+
+            bool valid = e.offset % Detail::archive_alignment == 0 && e.offset <= h.directory
+                && (e.componentSize == 4 || e.componentSize == 8)
+                && e.stride > 0 && e.stride % e.componentSize == 0
+                && e.count <= (h.directory - e.offset) / e.stride;
+
+            if (!valid)
+            {
+                Close();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline void MappedArchive::Close()
+    {
+        if (data)
+        {
+#ifdef P_WIN_BUILD
+            UnmapViewOfFile(data);
+            CloseHandle((HANDLE)mappingHandle);
+            CloseHandle((HANDLE)fileHandle);
+
+            mappingHandle = nullptr;
+            fileHandle = nullptr;
+#else
+            ::munmap((void*)data, size);
+#endif
+        }
+
+        data = nullptr;
+        size = 0;
+        entries.clear();
+        endian = Detail::archive_native_endian;
+    }
+
+    template<typename X>
+    const Detail::archive_entry* MappedArchive::Find(const char* name) const
+    {
+        using Traits = Detail::archive_traits<X>;
+
+        for (const Detail::archive_entry& e : entries)
+        {
+            if (e.type == Traits::Type && e.componentSize == sizeof(typename Traits::Real) && std::strcmp(e.name, name) == 0)
+            {
+                return &e;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename X>
+    std::span<const X> MappedArchive::Get(const char* name) const
+    {
+        const Detail::archive_entry* e = Find<X>(name);
+
+        if (!e || e->stride != sizeof(X) || !IsNative())
+        {
+            return {};
+        }
+
+        // Arrays start at multiples of 64 and the mapping is page aligned, so X is correctly aligned.
+        return std::span<const X>((const X*)(data + e->offset), (size_t)e->count);
+    }
+
+    template<typename X>
+    bool MappedArchive::Read(const char* name, std::vector<X>& r) const
+    {
+        using Real = typename Detail::archive_traits<X>::Real;
+
+        const Detail::archive_entry* e = Find<X>(name);
+
+        if (!e)
+        {
+            return false;
+        }
+
+        r.resize((size_t)e->count);
+
+        if (e->stride == sizeof(X) && IsNative())
+        {
+            std::memcpy((void*)r.data(), data + e->offset, r.size() * sizeof(X));
+            return true;
+        }
+
+        // Different stride (TVector2<double> with and without SIMD) or byte order.
+        size_t n = std::min((size_t)e->stride, sizeof(X));
+
+        for (size_t i = 0; i < r.size(); i++)
+        {
+            Phanes::Core::Types::uint8* dst = (Phanes::Core::Types::uint8*)&r[i];
+
+            std::memcpy(dst, data + e->offset + i * e->stride, n);
+            std::memset(dst + n, 0, sizeof(X) - n);
+
+            if (!IsNative())
+            {
+                Detail::archive_swap(dst, n, sizeof(Real));
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/AABB.hpp"
+#include "Core/Math/Ray.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#include <vector>
+
+#ifndef BVH_H
+#define BVH_H
+
+namespace Phanes::Core::Math
+{
+
+    // Node of a flattened bounding volume hierarchy. 32 bytes for float and 64 bytes for double, so a sibling pair
+    // shares one (float) or two (double) cache lines.
+    //
+    // Interior nodes have count == 0 and their children at first and first + 1.
+    // Leaves reference the primitives indices[first] to indices[first + count - 1] of their TBVH.
+
+    template<RealType T>
+    struct alignas(sizeof(T) * 8) TBVHNode
+    {
+    public:
+        using Real = T;
+
+        /** Minimum corner of the bounds */
+        Real min[3];
+
+        union
+        {
+            /** First child or first primitive index */
+            Phanes::Core::Types::uint32 first;
+
+            Real _pad0;
+        };
+
+        /** Maximum corner of the bounds */
+        Real max[3];
+
+        union
+        {
+            /** Number of primitives, 0 for interior nodes */
+            Phanes::Core::Types::uint32 count;
+
+            Real _pad1;
+        };
+
+    public:
+        /** True, if the node is a leaf */
+        FORCEINLINE bool IsLeaf() const { return count != 0; }
+    };
+
+
+    // Bounding volume hierarchy over primitive bounds. Built with a binned SAH, stored depth first with sibling pairs next
+    // to each other. Parents always come before their children.
+
+    template<RealType T>
+    struct TBVH
+    {
+    public:
+        using Real = T;
+
+        /** Maximum depth of the tree, which is also the size of the traversal stacks. */
+        static constexpr size_t MaxDepth = 64;
+
+        /** Maximum number of primitives per leaf */
+        static constexpr size_t MaxLeafSize = 8;
+
+        /** Number of SAH bins per axis */
+        static constexpr size_t Bins = 16;
+
+        /** Ranges with fewer primitives are never built on another thread */
+        static constexpr size_t ParallelThreshold = 4096;
+
+        /** Nodes, the root is nodes[0]. Empty if no primitives. */
+        std::vector<TBVHNode<Real>> nodes;
+
+        /** Primitive indices referenced by the leaves */
+        std::vector<Phanes::Core::Types::uint32> indices;
+
+    public:
+        /** Default constructor */
+        TBVH() = default;
+    };
+
+    // ================== //
+    //   TBVH functions   //
+    // ================== //
+
+    /**
+     * Builds a hierarchy with the binned surface area heuristic. Large subtrees are built in parallel.
+     *
+     * @param(bvh) Hierarchy, previous contents are discarded
+     * @param(bounds) Bounds of the primitives
+     * @param(count) Number of primitives
+     * @param(threads) Maximum number of threads, 0 for the number of hardware threads
+     */
+
+    template<RealType T, bool S>
+    void Build(TBVH<T>& bvh, const TAABB<T, S>* bounds, size_t count, size_t threads = 0);
+
+    /**
+     * Updates all node bounds after primitives moved, without changing the topology.
+     * Fast, but the quality degrades if primitives move far. Rebuild in that case.
+     *
+     * @param(bvh) Hierarchy
+     * @param(bounds) New bounds of the primitives, same count and order as in Build
+     */
+
+    template<RealType T, bool S>
+    void Refit(TBVH<T>& bvh, const TAABB<T, S>* bounds);
+
+    /**
+     * Casts a ray through the hierarchy. Nodes are visited front to back and skipped, once they start behind tMax.
+     *
+     * @param(bvh) Hierarchy
+     * @param(r1) Ray
+     * @param(tMax) Maximum parameter. Should be lowered by fn on every hit, so only closer primitives are tested afterwards.
+     * @param(fn) Called as bool fn(uint32 primitive, T& tMax) for every primitive in a leaf the ray enters. Returns true on a hit.
+     *
+     * @return True, if fn reported any hit.
+     */
+
+    template<RealType T, bool S, typename Fn>
+    bool RayCast(const TBVH<T>& bvh, const TRay<T, S>& r1, T& tMax, Fn&& fn);
+
+    /**
+     * Finds all leaves overlapping a box.
+     *
+     * @param(bvh) Hierarchy
+     * @param(b1) Box
+     * @param(fn) Called as void fn(uint32 primitive) for every primitive in a leaf overlapping the box.
+     *
+     * @note The primitives themselves are not tested against the box.
+     */
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TBVH<T>& bvh, const TAABB<T, S>& b1, Fn&& fn);
+
+} // Phanes::Core::Math
+
+#endif // BVH_H
+
+#include "Core/Math/BVH.inl"
@@ -0,0 +1,489 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/BVHDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <memory>
+#include <thread>
+
+
+namespace Phanes::Core::Math
+{
+    namespace Detail
+    {
+        // Temporary tree of the builder. Subtrees are built independently, so they can run on other threads,
+        // and are flattened afterwards.
+
+        template<RealType T>
+        struct bvh_build_node
+        {
+            T min[3];
+            T max[3];
+
+            Phanes::Core::Types::uint32 first = 0;
+            Phanes::Core::Types::uint32 count = 0;
+
+            std::unique_ptr<bvh_build_node<T>> left;
+            std::unique_ptr<bvh_build_node<T>> right;
+        };
+
+        template<RealType T>
+        struct bvh_builder
+        {
+            struct Box
+            {
+                T min[3] = { std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max() };
+                T max[3] = { -std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), -std::numeric_limits<T>::max() };
+
+                void Grow(const T* bmin, const T* bmax)
+                {
+                    for (int k = 0; k < 3; k++)
+                    {
+                        min[k] = (bmin[k] < min[k]) ? bmin[k] : min[k];
+                        max[k] = (bmax[k] > max[k]) ? bmax[k] : max[k];
+                    }
+                }
+
+                T HalfArea() const
+                {
+                    T dx = max[0] - min[0];
+                    T dy = max[1] - min[1];
+                    T dz = max[2] - min[2];
+
+                    return (dx < (T)0.0) ? (T)0.0 : dx * dy + dy * dz + dz * dx;
+                }
+            };
+
+            // Primitives are partitioned themselves instead of an index array, so every pass reads them in order.
+            struct Prim
+            {
+                T min[3];
+                T max[3];
+                T center[3];
+
+                Phanes::Core::Types::uint32 index;
+            };
+
+            std::vector<Prim> prims;
+
+            size_t parallelDepth;
+
+            std::unique_ptr<bvh_build_node<T>> BuildRange(size_t begin, size_t end, size_t depth)
+            {
+
+                auto node = std::make_unique<bvh_build_node<T>>();
+
+                Box bounds;
+                Box centers;
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    bounds.Grow(prims[i].min, prims[i].max);
+                    centers.Grow(prims[i].center, prims[i].center);
+                }
+
+                for (int k = 0; k < 3; k++)
+                {
+                    node->min[k] = bounds.min[k];
+                    node->max[k] = bounds.max[k];
+                }
+
+                size_t n = end - begin;
+
+                // Small ranges use fewer bins, the sweeps would cost more than the binning otherwise.
+                size_t bins = (n < TBVH<T>::Bins) ? n : TBVH<T>::Bins;
+
+                node->first = (Phanes::Core::Types::uint32)begin;
+                node->count = (Phanes::Core::Types::uint32)n;
+
+                if (n <= 2 || depth + 1 >= TBVH<T>::MaxDepth)
+                {
+                    return node;
+                }
+
+                // Binned SAH: cost = count left * area left + count right * area right, split at a bin border.
+                T bestCost = std::numeric_limits<T>::max();
+                int bestAxis = -1;
+                size_t bestBin = 0;
+
+                // All three axes are binned in one pass over the primitives.
+                Box binBounds[3][TBVH<T>::Bins];
+                size_t binCount[3][TBVH<T>::Bins] = {};
+                T scale[3];
+
+                for (int axis = 0; axis < 3; axis++)
+                {
+                    T extent = centers.max[axis] - centers.min[axis];
+                    scale[axis] = (extent > (T)0.0) ? (T)bins / extent : (T)0.0;
+                }
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    const T* c = prims[i].center;
+
+                    for (int axis = 0; axis < 3; axis++)
+                    {
+                        size_t b = Bin(c[axis], centers.min[axis], scale[axis], bins);
+
+                        binBounds[axis][b].Grow(prims[i].min, prims[i].max);
+                        binCount[axis][b]++;
+                    }
+                }
+
+                for (int axis = 0; axis < 3; axis++)
+                {
+                    if (scale[axis] == (T)0.0)
+                    {
+                        continue;
+                    }
+
+                    // Sweep from the right, then from the left.
+                    T rightArea[TBVH<T>::Bins];
+                    size_t rightCount[TBVH<T>::Bins];
+
+                    Box acc;
+                    size_t count = 0;
+
+                    for (size_t b = bins - 1; b > 0; b--)
+                    {
+                        acc.Grow(binBounds[axis][b].min, binBounds[axis][b].max);
+                        count += binCount[axis][b];
+
+                        rightArea[b] = acc.HalfArea();
+                        rightCount[b] = count;
+                    }
+
+                    acc = Box();
+                    count = 0;
+
+                    for (size_t b = 1; b < bins; b++)
+                    {
+                        acc.Grow(binBounds[axis][b - 1].min, binBounds[axis][b - 1].max);
+                        count += binCount[axis][b - 1];
+
+                        T cost = (T)count * acc.HalfArea() + (T)rightCount[b] * rightArea[b];
+
+                        if (count > 0 && rightCount[b] > 0 && cost < bestCost)
+                        {
+                            bestCost = cost;
+                            bestAxis = axis;
+                            bestBin = b;
+                        }
+                    }
+                }
+
+                size_t mid;
+
+                if (bestAxis >= 0)
+                {
+                    // Traversal costs as much as one primitive test.
+                    T leafCost = (T)n;
+                    T splitCost = (T)1.0 + bestCost / bounds.HalfArea();
+
+                    if (n <= TBVH<T>::MaxLeafSize && splitCost >= leafCost)
+                    {
+                        return node;
+                    }
+
+                    T minC = centers.min[bestAxis];
+                    T scale = (T)bins / (centers.max[bestAxis] - minC);
+
+                    mid = std::partition(prims.begin() + begin, prims.begin() + end, [&](const Prim& p)
+                        {
+                            return Bin(p.center[bestAxis], minC, scale, bins) < bestBin;
+                        }) - prims.begin();
+                }
+                else
+                {
+                    // All centroids coincide, so no split helps. Only keep leaves small.
+                    if (n <= TBVH<T>::MaxLeafSize)
+                    {
+                        return node;
+                    }
+
+                    mid = begin + n / 2;
+                }
+
+                node->count = 0;
+
+                if (depth < parallelDepth && n >= TBVH<T>::ParallelThreshold)
+                {
+                    auto left = std::async(std::launch::async, [this, begin, mid, depth]() { return BuildRange(begin, mid, depth + 1); });
+                    node->right = BuildRange(mid, end, depth + 1);
+                    node->left = left.get();
+                }
+                else
+                {
+                    node->left = BuildRange(begin, mid, depth + 1);
+                    node->right = BuildRange(mid, end, depth + 1);
+                }
+
+                return node;
+            }
+
+            static size_t Bin(T c, T minC, T scale, size_t bins)
+            {
+                // int, as float to size_t conversions are slow on x64.
+                int b = (int)((c - minC) * scale);
+                return (b < (int)bins) ? (size_t)b : bins - 1;
+            }
+
+            static void Flatten(std::vector<Phanes::Core::Math::TBVHNode<T>>& nodes, const bvh_build_node<T>* b, size_t slot)
+            {
+                Phanes::Core::Math::TBVHNode<T>& n = nodes[slot];
+
+                for (int k = 0; k < 3; k++)
+                {
+                    n.min[k] = b->min[k];
+                    n.max[k] = b->max[k];
+                }
+
+                n.first = b->first;
+                n.count = b->count;
+
+                if (b->count == 0)
+                {
+                    size_t children = nodes.size();
+                    nodes[slot].first = (Phanes::Core::Types::uint32)children;
+
+                    nodes.resize(children + 2);
+
+                    Flatten(nodes, b->left.get(), children);
+                    Flatten(nodes, b->right.get(), children + 1);
+                }
+            }
+        };
+    }
+
+
+    template<RealType T, bool S>
+    void Build(TBVH<T>& bvh, const TAABB<T, S>* bounds, size_t count, size_t threads)
+    {
+        bvh.nodes.clear();
+        bvh.indices.resize(count);
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        Detail::bvh_builder<T> builder;
+        builder.prims.resize(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            typename Detail::bvh_builder<T>::Prim& p = builder.prims[i];
+
+            p.min[0] = bounds[i].min.x;
+            p.min[1] = bounds[i].min.y;
+            p.min[2] = bounds[i].min.z;
+            p.max[0] = bounds[i].max.x;
+            p.max[1] = bounds[i].max.y;
+            p.max[2] = bounds[i].max.z;
+
+            for (int k = 0; k < 3; k++)
+            {
+                p.center[k] = (p.min[k] + p.max[k]) * (T)0.5;
+            }
+
+            p.index = (Phanes::Core::Types::uint32)i;
+        }
+
+        // Every level below parallelDepth doubles the number of tasks.
+        if (threads == 0)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        builder.parallelDepth = 0;
+        while (((size_t)1 << builder.parallelDepth) < threads)
+        {
+            builder.parallelDepth++;
+        }
+
+        std::unique_ptr<Detail::bvh_build_node<T>> root = builder.BuildRange(0, count, 0);
+
+        bvh.nodes.reserve(count * 2);
+        bvh.nodes.resize(1);
+        Detail::bvh_builder<T>::Flatten(bvh.nodes, root.get(), 0);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            bvh.indices[i] = builder.prims[i].index;
+        }
+    }
+
+    template<RealType T, bool S>
+    void Refit(TBVH<T>& bvh, const TAABB<T, S>* bounds)
+    {
+        // Children are stored after their parents, so one backwards pass sees every child before its parent.
+        for (size_t i = bvh.nodes.size(); i-- > 0;)
+        {
+            TBVHNode<T>& n = bvh.nodes[i];
+
+            if (n.IsLeaf())
+            {
+                const TAABB<T, S>& b = bounds[bvh.indices[n.first]];
+
+                n.min[0] = b.min.x; n.min[1] = b.min.y; n.min[2] = b.min.z;
+                n.max[0] = b.max.x; n.max[1] = b.max.y; n.max[2] = b.max.z;
+
+                for (size_t p = n.first + 1; p < n.first + n.count; p++)
+                {
+                    const TAABB<T, S>& bp = bounds[bvh.indices[p]];
+
+                    n.min[0] = Min(n.min[0], bp.min.x); n.max[0] = Max(n.max[0], bp.max.x);
+                    n.min[1] = Min(n.min[1], bp.min.y); n.max[1] = Max(n.max[1], bp.max.y);
+                    n.min[2] = Min(n.min[2], bp.min.z); n.max[2] = Max(n.max[2], bp.max.z);
+                }
+            }
+            else
+            {
+                const TBVHNode<T>& l = bvh.nodes[n.first];
+                const TBVHNode<T>& r = bvh.nodes[n.first + 1];
+
+                for (int k = 0; k < 3; k++)
+                {
+                    n.min[k] = Min(l.min[k], r.min[k]);
+                    n.max[k] = Max(l.max[k], r.max[k]);
+                }
+            }
+        }
+    }
+
+    template<RealType T, bool S, typename Fn>
+    bool RayCast(const TBVH<T>& bvh, const TRay<T, S>& r1, T& tMax, Fn&& fn)
+    {
+        using ray_node = Detail::compute_bvh_ray_node<T, SIMD::use_simd<T, 4, true>::value>;
+
+        if (bvh.nodes.empty())
+        {
+            return false;
+        }
+
+        alignas(32) T o[4] = { r1.origin.x, r1.origin.y, r1.origin.z, (T)0.0 };
+        alignas(32) T inv[4] = { (T)1.0 / r1.direction.x, (T)1.0 / r1.direction.y, (T)1.0 / r1.direction.z, (T)0.0 };
+
+        const TBVHNode<T>* nodes = bvh.nodes.data();
+
+        if (ray_node::map(nodes[0], o, inv, tMax) == std::numeric_limits<T>::infinity())
+        {
+            return false;
+        }
+
+        // Far children wait on the stack with their entry parameter, so they are dropped once a closer hit is found.
+        Phanes::Core::Types::uint32 stack[TBVH<T>::MaxDepth];
+        T stackT[TBVH<T>::MaxDepth];
+        size_t sp = 0;
+
+        Phanes::Core::Types::uint32 node = 0;
+        bool hit = false;
+
+        while (true)
+        {
+            const TBVHNode<T>& n = nodes[node];
+
+            if (n.IsLeaf())
+            {
+                for (Phanes::Core::Types::uint32 p = n.first; p < n.first + n.count; p++)
+                {
+                    hit |= fn(bvh.indices[p], tMax);
+                }
+            }
+            else
+            {
+                Phanes::Core::Types::uint32 nearChild = n.first;
+                Phanes::Core::Types::uint32 farChild = n.first + 1;
+
+                T tNear = ray_node::map(nodes[nearChild], o, inv, tMax);
+                T tFar = ray_node::map(nodes[farChild], o, inv, tMax);
+
+                if (tFar < tNear)
+                {
+                    std::swap(nearChild, farChild);
+                    std::swap(tNear, tFar);
+                }
+
+                if (tNear < tMax)
+                {
+                    if (tFar < tMax)
+                    {
+                        stack[sp] = farChild;
+                        stackT[sp] = tFar;
+                        sp++;
+                    }
+
+                    node = nearChild;
+                    continue;
+                }
+            }
+
+            do
+            {
+                if (sp == 0)
+                {
+                    return hit;
+                }
+
+                sp--;
+                node = stack[sp];
+            } while (stackT[sp] >= tMax);
+        }
+    }
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TBVH<T>& bvh, const TAABB<T, S>& b1, Fn&& fn)
+    {
+        using box_node = Detail::compute_bvh_box_node<T, SIMD::use_simd<T, 4, true>::value>;
+
+        if (bvh.nodes.empty())
+        {
+            return;
+        }
+
+        alignas(32) T bmin[4] = { b1.min.x, b1.min.y, b1.min.z, (T)0.0 };
+        alignas(32) T bmax[4] = { b1.max.x, b1.max.y, b1.max.z, (T)0.0 };
+
+        const TBVHNode<T>* nodes = bvh.nodes.data();
+
+        Phanes::Core::Types::uint32 stack[TBVH<T>::MaxDepth];
+        size_t sp = 0;
+
+        if (box_node::map(nodes[0], bmin, bmax))
+        {
+            stack[sp++] = 0;
+        }
+
+        while (sp > 0)
+        {
+            const TBVHNode<T>& n = nodes[stack[--sp]];
+
+            if (n.IsLeaf())
+            {
+                for (Phanes::Core::Types::uint32 p = n.first; p < n.first + n.count; p++)
+                {
+                    fn(bvh.indices[p]);
+                }
+            }
+            else
+            {
+                if (box_node::map(nodes[n.first], bmin, bmax))
+                {
+                    stack[sp++] = n.first;
+                }
+
+                if (box_node::map(nodes[n.first + 1], bmin, bmax))
+                {
+                    stack[sp++] = n.first + 1;
+                }
+            }
+        }
+    }
+}
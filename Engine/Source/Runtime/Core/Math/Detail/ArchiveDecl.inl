@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include <bit>
+#include <cstring>
+
+namespace Phanes::Core::Math::Detail
+{
+    // Type of the elements of an archive array. Stored in files, values must not change.
+
+    enum class archive_type : Phanes::Core::Types::uint16
+    {
+        Vector2     = 1,
+        Vector3     = 2,
+        Vector4     = 3,
+        Matrix3     = 4,
+        Matrix4     = 5,
+        Plane       = 6,
+        Quaternion  = 7
+    };
+
+    // Byte order of the data of an archive.
+
+    enum class archive_endian : Phanes::Core::Types::uint8
+    {
+        Little      = 1,
+        Big         = 2
+    };
+
+    constexpr archive_endian archive_native_endian = (std::endian::native == std::endian::little) ? archive_endian::Little : archive_endian::Big;
+
+    constexpr Phanes::Core::Types::uint16 archive_version = 1;
+
+    // Alignment of every array in the file, enough for all SIMD types.
+    constexpr size_t archive_alignment = 64;
+
+
+    // File header, at offset 0.
+
+    struct archive_header
+    {
+        char magic[4];
+        Phanes::Core::Types::uint16 version;
+        archive_endian endian;
+        Phanes::Core::Types::uint8 _pad0;
+        Phanes::Core::Types::uint32 count;
+        Phanes::Core::Types::uint32 _pad1;
+        Phanes::Core::Types::uint64 directory;
+        Phanes::Core::Types::uint8 _pad2[40];
+    };
+
+    // Directory entry of an array.
+
+    struct archive_entry
+    {
+        char name[32];
+        Phanes::Core::Types::uint64 offset;
+        Phanes::Core::Types::uint64 count;
+        Phanes::Core::Types::uint32 stride;
+        archive_type type;
+        Phanes::Core::Types::uint8 componentSize;
+        Phanes::Core::Types::uint8 _pad0;
+        Phanes::Core::Types::uint8 _pad1[8];
+    };
+
+    static_assert(sizeof(archive_header) == 64 && sizeof(archive_entry) == 64);
+
+
+    // Element types, that can be stored in archives.
+
+    template<typename X>
+    struct archive_traits {};
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TVector2<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Vector2;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TVector3<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Vector3;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TVector4<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Vector4;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TMatrix3<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Matrix3;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TMatrix4<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Matrix4;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TPlane<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Plane;
+    };
+
+    template<RealType T, bool S>
+    struct archive_traits<Phanes::Core::Math::TQuaternion<T, S>>
+    {
+        using Real = T;
+        static constexpr archive_type Type = archive_type::Quaternion;
+    };
+
+
+    // Reverses the byte order of every word of size bytes in data.
+
+    inline void archive_swap(void* data, size_t bytes, size_t size)
+    {
+        Phanes::Core::Types::uint8* p = (Phanes::Core::Types::uint8*)data;
+
+        for (size_t i = 0; i + size <= bytes; i += size)
+        {
+            for (size_t j = 0; j < size / 2; j++)
+            {
+                Phanes::Core::Types::uint8 t = p[i + j];
+                p[i + j] = p[i + size - 1 - j];
+                p[i + size - 1 - j] = t;
+            }
+        }
+    }
+
+    template<typename T>
+    T archive_swap(T v)
+    {
+        archive_swap(&v, sizeof(T), sizeof(T));
+        return v;
+    }
+}
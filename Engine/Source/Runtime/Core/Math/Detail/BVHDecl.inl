@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+#include <limits>
+
+namespace Phanes::Core::Math::Detail
+{
+    // ray vs. node, entry parameter or infinity on a miss
+    template<RealType T, bool S>
+    struct compute_bvh_ray_node {};
+
+    // box vs. node overlap
+    template<RealType T, bool S>
+    struct compute_bvh_box_node {};
+
+
+    template<RealType T>
+    struct compute_bvh_ray_node<T, false>
+    {
+        // o and inv hold origin and reciprocal direction in their first three elements.
+        static constexpr T map(const Phanes::Core::Math::TBVHNode<T>& n, const T* o, const T* inv, T tMax)
+        {
+            T tmin = (T)0.0;
+
+            for (int k = 0; k < 3; k++)
+            {
+                T t0 = (n.min[k] - o[k]) * inv[k];
+                T t1 = (n.max[k] - o[k]) * inv[k];
+
+                T lo = (t0 < t1) ? t0 : t1;
+                T hi = (t0 > t1) ? t0 : t1;
+                tmin = (lo > tmin) ? lo : tmin;
+                tMax = (hi < tMax) ? hi : tMax;
+            }
+
+            return (tmin <= tMax) ? tmin : std::numeric_limits<T>::infinity();
+        }
+    };
+
+    template<RealType T>
+    struct compute_bvh_box_node<T, false>
+    {
+        static constexpr bool map(const Phanes::Core::Math::TBVHNode<T>& n, const T* bmin, const T* bmax)
+        {
+            return (n.min[0] <= bmax[0] && bmin[0] <= n.max[0] &&
+                    n.min[1] <= bmax[1] && bmin[1] <= n.max[1] &&
+                    n.min[2] <= bmax[2] && bmin[2] <= n.max[2]);
+        }
+    };
+}
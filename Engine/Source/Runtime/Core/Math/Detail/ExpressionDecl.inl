@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // Register operations of lazy expressions over aligned vectors (load / store / splat / add / sub / mul / div).
+    // Vectors without SIMD are evaluated component by component (Lane()) and do not use these.
+
+    template<RealType T, bool S>
+    struct compute_expr {};
+
+
+    struct expr_add
+    {
+        template<typename T>
+        static constexpr T Lane(T a, T b)
+        {
+            return a + b;
+        }
+
+        template<typename C, typename R>
+        static FORCEINLINE R Reg(R a, R b)
+        {
+            return C::add(a, b);
+        }
+    };
+
+    struct expr_sub
+    {
+        template<typename T>
+        static constexpr T Lane(T a, T b)
+        {
+            return a - b;
+        }
+
+        template<typename C, typename R>
+        static FORCEINLINE R Reg(R a, R b)
+        {
+            return C::sub(a, b);
+        }
+    };
+
+    struct expr_mul
+    {
+        template<typename T>
+        static constexpr T Lane(T a, T b)
+        {
+            return a * b;
+        }
+
+        template<typename C, typename R>
+        static FORCEINLINE R Reg(R a, R b)
+        {
+            return C::mul(a, b);
+        }
+    };
+
+    struct expr_div
+    {
+        template<typename T>
+        static constexpr T Lane(T a, T b)
+        {
+            return a / b;
+        }
+
+        template<typename C, typename R>
+        static FORCEINLINE R Reg(R a, R b)
+        {
+            return C::div(a, b);
+        }
+    };
+
+
+    template<typename V>
+    struct expr_vector_traits {};
+
+    template<RealType T, bool S>
+    struct expr_vector_traits<Phanes::Core::Math::TVector3<T, S>>
+    {
+        static constexpr bool Aligned = S;
+        static constexpr size_t Dim = 3;
+    };
+
+    template<RealType T, bool S>
+    struct expr_vector_traits<Phanes::Core::Math::TVector4<T, S>>
+    {
+        static constexpr bool Aligned = S;
+        static constexpr size_t Dim = 4;
+    };
+
+    template<typename V>
+    using expr_compute = compute_expr<typename V::Real, true>;
+}
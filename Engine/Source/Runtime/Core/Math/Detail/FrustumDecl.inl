@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+namespace Phanes::Core::Math::Detail
+{
+    // culls an array of boxes, one visibility bit per box
+    template<RealType T, bool S>
+    struct compute_frustum_batch_aabb {};
+
+    // culls an array of spheres, one visibility bit per sphere
+    template<RealType T, bool S>
+    struct compute_frustum_batch_sphere {};
+
+
+    template<RealType T>
+    struct compute_frustum_batch_aabb<T, false>
+    {
+        static constexpr size_t map(const TFrustum<T, false>& f, const TAABB<T, false>* b, size_t n, Phanes::Core::Types::uint32* visible)
+        {
+            size_t count = 0;
+
+            for (size_t i = 0; i < n; i += 32)
+            {
+                Phanes::Core::Types::uint32 word = 0;
+
+                for (size_t k = 0; k < 32 && i + k < n; k++)
+                {
+                    if (IsVisible(f, b[i + k]))
+                    {
+                        word |= 1u << k;
+                        count++;
+                    }
+                }
+
+                visible[i / 32] = word;
+            }
+
+            return count;
+        }
+    };
+
+    template<RealType T>
+    struct compute_frustum_batch_sphere<T, false>
+    {
+        static constexpr size_t map(const TFrustum<T, false>& f, const TSphere<T, false>* s, size_t n, Phanes::Core::Types::uint32* visible)
+        {
+            size_t count = 0;
+
+            for (size_t i = 0; i < n; i += 32)
+            {
+                Phanes::Core::Types::uint32 word = 0;
+
+                for (size_t k = 0; k < 32 && i + k < n; k++)
+                {
+                    if (IsVisible(f, s[i + k]))
+                    {
+                        word |= 1u << k;
+                        count++;
+                    }
+                }
+
+                visible[i / 32] = word;
+            }
+
+            return count;
+        }
+    };
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // Scalar conversions. The maps are templates over the alignment of the vectors, so SIMD builds without F16C can
+    // derive their <T, true> specializations from these.
+
+    template<RealType T, bool S>
+    struct compute_half_pack {};
+
+    template<RealType T, bool S>
+    struct compute_half_unpack {};
+
+    template<RealType T, bool S>
+    struct compute_half2_pack {};
+
+    template<RealType T, bool S>
+    struct compute_half2_unpack {};
+
+    template<RealType T, bool S>
+    struct compute_half3_pack {};
+
+    template<RealType T, bool S>
+    struct compute_half3_unpack {};
+
+    template<RealType T, bool S>
+    struct compute_half4_pack {};
+
+    template<RealType T, bool S>
+    struct compute_half4_unpack {};
+
+
+
+    template<RealType T>
+    struct compute_half_pack<T, false>
+    {
+        static constexpr void map(Phanes::Core::Types::uint16* r, const T* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = FloatToHalf((float)v[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half_unpack<T, false>
+    {
+        static constexpr void map(T* r, const Phanes::Core::Types::uint16* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = (T)HalfToFloat(v[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half2_pack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::THalfVector2<T>* r, const Phanes::Core::Math::TVector2<T, S>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = FloatToHalf((float)v[i].x);
+                r[i].y = FloatToHalf((float)v[i].y);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half2_unpack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>* r, const Phanes::Core::Math::THalfVector2<T>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = (T)HalfToFloat(v[i].x);
+                r[i].y = (T)HalfToFloat(v[i].y);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half3_pack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::THalfVector3<T>* r, const Phanes::Core::Math::TVector3<T, S>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = FloatToHalf((float)v[i].x);
+                r[i].y = FloatToHalf((float)v[i].y);
+                r[i].z = FloatToHalf((float)v[i].z);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half3_unpack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>* r, const Phanes::Core::Math::THalfVector3<T>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = Phanes::Core::Math::TVector3<T, S>((T)HalfToFloat(v[i].x), (T)HalfToFloat(v[i].y), (T)HalfToFloat(v[i].z));
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half4_pack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::THalfVector4<T>* r, const Phanes::Core::Math::TVector4<T, S>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = FloatToHalf((float)v[i].x);
+                r[i].y = FloatToHalf((float)v[i].y);
+                r[i].z = FloatToHalf((float)v[i].z);
+                r[i].w = FloatToHalf((float)v[i].w);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_half4_unpack<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>* r, const Phanes::Core::Math::THalfVector4<T>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = Phanes::Core::Math::TVector4<T, S>((T)HalfToFloat(v[i].x), (T)HalfToFloat(v[i].y), (T)HalfToFloat(v[i].z), (T)HalfToFloat(v[i].w));
+            }
+        }
+    };
+}
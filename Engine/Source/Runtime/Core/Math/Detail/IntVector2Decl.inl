@@ -261,14 +261,14 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector2<T, false>& r, const Phanes::Core::Math::TIntVector2<T, false>& v1, const Phanes::Core::Math::TIntVector2<T, false>& v2)
         {
-            r.x = v1.x << v2.x;
-            r.y = v1.y << v2.y;
+            r.x = ShiftLeft(v1.x, v2.x);
+            r.y = ShiftLeft(v1.y, v2.y);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector2<T, false>& r, const Phanes::Core::Math::TIntVector2<T, false>& v1, const T s)
         {
-            r.x = v1.x << s;
-            r.y = v1.y << s;
+            r.x = ShiftLeft(v1.x, s);
+            r.y = ShiftLeft(v1.y, s);
         }
     };
 
@@ -277,14 +277,14 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector2<T, false>& r, const Phanes::Core::Math::TIntVector2<T, false>& v1, const Phanes::Core::Math::TIntVector2<T, false>& v2)
         {
-            r.x = v1.x >> v2.x;
-            r.y = v1.y >> v2.y;
+            r.x = ShiftRight(v1.x, v2.x);
+            r.y = ShiftRight(v1.y, v2.y);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector2<T, false>& r, const Phanes::Core::Math::TIntVector2<T, false>& v1, const T s)
         {
-            r.x = v1.x >> s;
-            r.y = v1.y >> s;
+            r.x = ShiftRight(v1.x, s);
+            r.y = ShiftRight(v1.y, s);
         }
     };
 
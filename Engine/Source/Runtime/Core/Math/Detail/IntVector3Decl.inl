@@ -297,16 +297,16 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector3<T, false>& r, const Phanes::Core::Math::TIntVector3<T, false>& v1, const Phanes::Core::Math::TIntVector3<T, false>& v2)
         {
-            r.x = v1.x << v2.x;
-            r.y = v1.y << v2.y;
-            r.z = v1.z << v2.z;
+            r.x = ShiftLeft(v1.x, v2.x);
+            r.y = ShiftLeft(v1.y, v2.y);
+            r.z = ShiftLeft(v1.z, v2.z);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector3<T, false>& r, const Phanes::Core::Math::TIntVector3<T, false>& v1, T s)
         {
-            r.x = v1.x << s;
-            r.y = v1.y << s;
-            r.z = v1.z << s;
+            r.x = ShiftLeft(v1.x, s);
+            r.y = ShiftLeft(v1.y, s);
+            r.z = ShiftLeft(v1.z, s);
         }
     };
 
@@ -315,16 +315,16 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector3<T, false>& r, const Phanes::Core::Math::TIntVector3<T, false>& v1, const Phanes::Core::Math::TIntVector3<T, false>& v2)
         {
-            r.x = v1.x >> v2.x;
-            r.y = v1.y >> v2.y;
-            r.z = v1.z >> v2.z;
+            r.x = ShiftRight(v1.x, v2.x);
+            r.y = ShiftRight(v1.y, v2.y);
+            r.z = ShiftRight(v1.z, v2.z);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector3<T, false>& r, const Phanes::Core::Math::TIntVector3<T, false>& v1, T s)
         {
-            r.x = v1.x >> s;
-            r.y = v1.y >> s;
-            r.z = v1.z >> s;
+            r.x = ShiftRight(v1.x, s);
+            r.y = ShiftRight(v1.y, s);
+            r.z = ShiftRight(v1.z, s);
         }
     };
 
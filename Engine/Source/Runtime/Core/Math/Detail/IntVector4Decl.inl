@@ -317,18 +317,18 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector4<T, false>& r, const Phanes::Core::Math::TIntVector4<T, false>& v1, const Phanes::Core::Math::TIntVector4<T, false>& v2)
         {
-            r.x = v1.x << v2.x;
-            r.y = v1.y << v2.y;
-            r.z = v1.z << v2.z;
-            r.w = v1.w << v2.w;
+            r.x = ShiftLeft(v1.x, v2.x);
+            r.y = ShiftLeft(v1.y, v2.y);
+            r.z = ShiftLeft(v1.z, v2.z);
+            r.w = ShiftLeft(v1.w, v2.w);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector4<T, false>& r, const Phanes::Core::Math::TIntVector4<T, false>& v1, T s)
         {
-            r.x = v1.x << s;
-            r.y = v1.y << s;
-            r.z = v1.z << s;
-            r.w = v1.w << s;
+            r.x = ShiftLeft(v1.x, s);
+            r.y = ShiftLeft(v1.y, s);
+            r.z = ShiftLeft(v1.z, s);
+            r.w = ShiftLeft(v1.w, s);
         }
     };
 
@@ -337,18 +337,18 @@ namespace Phanes::Core::Math::Detail
     {
         static constexpr void map(Phanes::Core::Math::TIntVector4<T, false>& r, const Phanes::Core::Math::TIntVector4<T, false>& v1, const Phanes::Core::Math::TIntVector4<T, false>& v2)
         {
-            r.x = v1.x >> v2.x;
-            r.y = v1.y >> v2.y;
-            r.z = v1.z >> v2.z;
-            r.w = v1.w >> v2.w;
+            r.x = ShiftRight(v1.x, v2.x);
+            r.y = ShiftRight(v1.y, v2.y);
+            r.z = ShiftRight(v1.z, v2.z);
+            r.w = ShiftRight(v1.w, v2.w);
         }
 
         static constexpr void map(Phanes::Core::Math::TIntVector4<T, false>& r, const Phanes::Core::Math::TIntVector4<T, false>& v1, T s)
         {
-            r.x = v1.x >> s;
-            r.y = v1.y >> s;
-            r.z = v1.z >> s;
-            r.w = v1.w >> s;
+            r.x = ShiftRight(v1.x, s);
+            r.y = ShiftRight(v1.y, s);
+            r.z = ShiftRight(v1.z, s);
+            r.w = ShiftRight(v1.w, s);
         }
     };
 
@@ -359,7 +359,172 @@ namespace Phanes::Core::Math::Detail
         {
             r.x = ~v1.x;
             r.y = ~v1.y;
+            r.z = ~v1.z;
+            r.w = ~v1.w;
         }
     };
-}
 
+
+    // Batch operations over arrays of vectors. The generic version applies the operation vector by vector,
+    // SIMD backends specialize it, where one register can hold more than one vector.
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_add
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_add<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_add<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_sub
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_sub<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_sub<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_mul
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_mul<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_mul<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_and
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_and<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_and<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_or
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_or<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_or<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_xor
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_xor<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_xor<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_left_shift
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_left_shift<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_left_shift<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+
+    template<IntType T, bool S>
+    struct compute_ivec4_batch_right_shift
+    {
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, const Phanes::Core::Math::TIntVector4<T, S>* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_right_shift<T, S>::map(r[i], v1[i], v2[i]);
+            }
+        }
+
+        static constexpr void map(Phanes::Core::Math::TIntVector4<T, S>* r, const Phanes::Core::Math::TIntVector4<T, S>* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                compute_ivec4_right_shift<T, S>::map(r[i], v1[i], s);
+            }
+        }
+    };
+}
\ No newline at end of file
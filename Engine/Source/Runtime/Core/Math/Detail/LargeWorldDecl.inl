@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // T and S are the type of the render space vectors, the maps are templates over the alignment of the world
+    // positions (always double).
+
+    template<RealType T, bool S>
+    struct compute_world_to_render {};
+
+    template<RealType T, bool S>
+    struct compute_render_rebase {};
+
+
+
+    template<RealType T>
+    struct compute_world_to_render<T, false>
+    {
+        template<bool SR, bool SW>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, SR>* r, const Phanes::Core::Math::TVector3<double, SW>* v,
+                                  const Phanes::Core::Math::TVector3<double, SW>& origin, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                // Subtract in double, the difference is small enough for T.
+                r[i] = Phanes::Core::Math::TVector3<T, SR>((T)(v[i].x - origin.x), (T)(v[i].y - origin.y), (T)(v[i].z - origin.z));
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_render_rebase<T, false>
+    {
+        template<bool SR>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, SR>* r, const Phanes::Core::Math::TVector3<T, SR>& delta, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x += delta.x;
+                r[i].y += delta.y;
+                r[i].z += delta.z;
+            }
+        }
+    };
+}
@@ -11,43 +11,149 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_mat3_mul {};
 
+    template<RealType T, bool S>
+    struct compute_mat3_det {};
+
+    template<RealType T, bool S>
+    struct compute_mat3_inv {};
+
+    // inverse transpose, e.g. for normal matrices
+    template<RealType T, bool S>
+    struct compute_mat3_inv_transpose {};
+
+    // inverse transpose over arrays
+    template<RealType T, bool S>
+    struct compute_mat3_batch_inv_transpose {};
+
 
 
     template<RealType T>
     struct compute_mat3_transpose<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TMatrix3<T, false>& r, const TMatrix3<T, false>& m1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TMatrix3<T, S>& r, const TMatrix3<T, S>& m1)
         {
-            r = TMatrix3<T, false>(m1(0, 0), m1(1, 0), m1(2, 0),
-                                   m1(0, 1), m1(1, 1), m1(2, 1),
-                                   m1(0, 2), m1(1, 2), m1(2, 2)
-                                   );
+            r = TMatrix3<T, S>(m1(0, 0), m1(1, 0), m1(2, 0),
+                               m1(0, 1), m1(1, 1), m1(2, 1),
+                               m1(0, 2), m1(1, 2), m1(2, 2)
+                               );
         }
     };
 
     template<RealType T>
     struct compute_mat3_mul<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TMatrix3<T, false>& r, const TMatrix3<T, false>& m1, const TMatrix3<T, false>& m2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TMatrix3<T, S>& r, const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
         {
-            r(0, 0) = m1(0, 0) * m2(0, 0) + m1(0, 1) * m2(1, 0) + m1(0, 2) * m2(2, 0);
-            r(0, 1) = m1(0, 0) * m2(0, 1) + m1(0, 1) * m2(1, 1) + m1(0, 2) * m2(2, 1);
-            r(0, 2) = m1(0, 0) * m2(0, 2) + m1(0, 1) * m2(1, 2) + m1(0, 2) * m2(2, 2);
+            r = TMatrix3<T, S>(m1(0, 0) * m2(0, 0) + m1(0, 1) * m2(1, 0) + m1(0, 2) * m2(2, 0),
+                               m1(0, 0) * m2(0, 1) + m1(0, 1) * m2(1, 1) + m1(0, 2) * m2(2, 1),
+                               m1(0, 0) * m2(0, 2) + m1(0, 1) * m2(1, 2) + m1(0, 2) * m2(2, 2),
 
-            r(1, 0) = m1(1, 0) * m2(0, 0) + m1(1, 1) * m2(1, 0) + m1(1, 2) * m2(2, 0);
-            r(1, 1) = m1(1, 0) * m2(0, 1) + m1(1, 1) * m2(1, 1) + m1(1, 2) * m2(2, 1);
-            r(1, 2) = m1(1, 0) * m2(0, 2) + m1(1, 1) * m2(1, 2) + m1(1, 2) * m2(2, 2);
+                               m1(1, 0) * m2(0, 0) + m1(1, 1) * m2(1, 0) + m1(1, 2) * m2(2, 0),
+                               m1(1, 0) * m2(0, 1) + m1(1, 1) * m2(1, 1) + m1(1, 2) * m2(2, 1),
+                               m1(1, 0) * m2(0, 2) + m1(1, 1) * m2(1, 2) + m1(1, 2) * m2(2, 2),
 
-            r(2, 0) = m1(2, 0) * m2(0, 0) + m1(2, 1) * m2(1, 0) + m1(2, 2) * m2(2, 0);
-            r(2, 1) = m1(2, 0) * m2(0, 1) + m1(2, 1) * m2(1, 1) + m1(2, 2) * m2(2, 1);
-            r(2, 2) = m1(2, 0) * m2(0, 2) + m1(2, 1) * m2(1, 2) + m1(2, 2) * m2(2, 2);
+                               m1(2, 0) * m2(0, 0) + m1(2, 1) * m2(1, 0) + m1(2, 2) * m2(2, 0),
+                               m1(2, 0) * m2(0, 1) + m1(2, 1) * m2(1, 1) + m1(2, 2) * m2(2, 1),
+                               m1(2, 0) * m2(0, 2) + m1(2, 1) * m2(1, 2) + m1(2, 2) * m2(2, 2));
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const TMatrix3<T, false>& m1, const TVector3<T, false>& v)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const TMatrix3<T, S>& m1, const TVector3<T, S>& v)
         {
             r.x = m1(0, 0) * v.x + m1(0, 1) * v.y + m1(0, 2) * v.z;
             r.y = m1(1, 0) * v.x + m1(1, 1) * v.y + m1(1, 2) * v.z;
             r.z = m1(2, 0) * v.x + m1(2, 1) * v.y + m1(2, 2) * v.z;
+            r.w = (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_det<T, false>
+    {
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TMatrix3<T, S>& m1)
+        {
+            return   m1(0, 0) * (m1(1, 1) * m1(2, 2) - m1(1, 2) * m1(2, 1))
+                   - m1(0, 1) * (m1(1, 0) * m1(2, 2) - m1(1, 2) * m1(2, 0))
+                   + m1(0, 2) * (m1(1, 0) * m1(2, 1) - m1(1, 1) * m1(2, 0));
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_inv<T, false>
+    {
+        static constexpr bool map(Phanes::Core::Math::TMatrix3<T, false>& r, const Phanes::Core::Math::TMatrix3<T, false>& m1)
+        {
+            // Rows of the inverse, scaled by the determinant.
+            TVector3<T, false> r0 = CrossP(m1.c1, m1.c2);
+            TVector3<T, false> r1 = CrossP(m1.c2, m1.c0);
+            TVector3<T, false> r2 = CrossP(m1.c0, m1.c1);
+
+            T det = DotP(m1.c0, r0);
+
+            if (det == (T)0.0)
+            {
+                return false;
+            }
+
+            T _1_det = (T)1.0 / det;
+
+            r = TMatrix3<T, false>(r0.x * _1_det, r0.y * _1_det, r0.z * _1_det,
+                                   r1.x * _1_det, r1.y * _1_det, r1.z * _1_det,
+                                   r2.x * _1_det, r2.y * _1_det, r2.z * _1_det);
+
+            return true;
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_inv_transpose<T, false>
+    {
+        static constexpr bool map(Phanes::Core::Math::TMatrix3<T, false>& r, const Phanes::Core::Math::TMatrix3<T, false>& m1)
+        {
+            // The rows of the inverse are the columns of the inverse transpose.
+            TVector3<T, false> r0 = CrossP(m1.c1, m1.c2);
+            TVector3<T, false> r1 = CrossP(m1.c2, m1.c0);
+            TVector3<T, false> r2 = CrossP(m1.c0, m1.c1);
+
+            T det = DotP(m1.c0, r0);
+
+            if (det == (T)0.0)
+            {
+                return false;
+            }
+
+            T _1_det = (T)1.0 / det;
+
+            r.c0 = r0 * _1_det;
+            r.c1 = r1 * _1_det;
+            r.c2 = r2 * _1_det;
+
+            return true;
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat3_batch_inv_transpose<T, false>
+    {
+        static constexpr bool map(Phanes::Core::Math::TMatrix3<T, false>* r, const Phanes::Core::Math::TMatrix3<T, false>* m, size_t n)
+        {
+            bool invertible = true;
+
+            for (size_t i = 0; i < n; i++)
+            {
+                if (!compute_mat3_inv_transpose<T, false>::map(r[i], m[i]))
+                {
+                    r[i] = TMatrix3<T, false>(TVector3<T, false>((T)0.0, (T)0.0, (T)0.0),
+                                              TVector3<T, false>((T)0.0, (T)0.0, (T)0.0),
+                                              TVector3<T, false>((T)0.0, (T)0.0, (T)0.0));
+                    invertible = false;
+                }
+            }
+
+            return invertible;
         }
     };
-}
\ No newline at end of file
+}
@@ -17,21 +17,36 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_mat4_mul {};
 
+    template<RealType T, bool S>
+    struct compute_mat4_transform_points {};
+
+    template<RealType T, bool S>
+    struct compute_mat4_transform_dirs {};
+
+    template<RealType T, bool S>
+    struct compute_mat4_transform {};
+
+    template<RealType T, bool S>
+    struct compute_mat4_soa_transform {};
+
 
     template<RealType T>
     struct compute_mat4_det<T, false>
     {
-        static constexpr T map(const Phanes::Core::Math::TMatrix4<T, false>& m)
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TMatrix4<T, S>& m)
         {
-            const TVector3<T, false>& a = reinterpret_cast<const TVector3<T, false>&>(m[0]);
-            const TVector3<T, false>& b = reinterpret_cast<const TVector3<T, false>&>(m[1]);
-            const TVector3<T, false>& c = reinterpret_cast<const TVector3<T, false>&>(m[2]);
-            const TVector3<T, false>& d = reinterpret_cast<const TVector3<T, false>&>(m[3]);
-
-            const float& x = m(3, 0);
-            const float& y = m(3, 1);
-            const float& z = m(3, 2);
-            const float& w = m(3, 3);
+            // Copies instead of casts of the columns, so this also works in constant expressions. Scalar vectors for
+            // either S: the SIMD inverses test this determinant, so every backend rejects the same matrices.
+            const TVector3<T, false> a(m.c0.x, m.c0.y, m.c0.z);
+            const TVector3<T, false> b(m.c1.x, m.c1.y, m.c1.z);
+            const TVector3<T, false> c(m.c2.x, m.c2.y, m.c2.z);
+            const TVector3<T, false> d(m.c3.x, m.c3.y, m.c3.z);
+
+            const T x = m.c0.w;
+            const T y = m.c1.w;
+            const T z = m.c2.w;
+            const T w = m.c3.w;
 
             TVector3<T, false> s = CrossP(a, b);
             TVector3<T, false> t = CrossP(c, d);
@@ -52,23 +67,25 @@ namespace Phanes::Core::Math::Detail
             const TVector3<T, false>& c = reinterpret_cast<const TVector3<T, false>&>(m[2]);
             const TVector3<T, false>& d = reinterpret_cast<const TVector3<T, false>&>(m[3]);
             
-            const float& x = m(3, 0);
-            const float& y = m(3, 1);
-            const float& z = m(3, 2);
-            const float& w = m(3, 3);
+            const T& x = m(3, 0);
+            const T& y = m(3, 1);
+            const T& z = m(3, 2);
+            const T& w = m(3, 3);
 
             TVector3<T, false> s = CrossP(a, b);
             TVector3<T, false> t = CrossP(c, d);
             TVector3<T, false> u = a * y - b * x;
             TVector3<T, false> v = c * w - d * z;
 
-            float _1_det = (T)1.0 / (DotP(s, v) + DotP(t, u));
+            T det = DotP(s, v) + DotP(t, u);
 
-            if (_1_det == (T)0.0)
+            if (det == (T)0.0)
             {
                 return false;
             }
 
+            T _1_det = (T)1.0 / det;
+
             s *= _1_det;
             t *= _1_det;
             u *= _1_det;
@@ -91,42 +108,45 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_mat4_transpose<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TMatrix4<T, false>& r, const Phanes::Core::Math::TMatrix4<T, false>& m)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TMatrix4<T, S>& r, const Phanes::Core::Math::TMatrix4<T, S>& m)
         {
-            r = Phanes::Core::Math::TMatrix4<T, false>(m(0, 0), m(1, 0), m(2, 0), m(3, 0),
-                                                       m(0, 1), m(1, 1), m(2, 1), m(3, 1),
-                                                       m(0, 2), m(1, 2), m(2, 2), m(3, 2),
-                                                       m(0, 3), m(1, 3), m(2, 3), m(3, 3));
+            r = Phanes::Core::Math::TMatrix4<T, S>(m(0, 0), m(1, 0), m(2, 0), m(3, 0),
+                                                   m(0, 1), m(1, 1), m(2, 1), m(3, 1),
+                                                   m(0, 2), m(1, 2), m(2, 2), m(3, 2),
+                                                   m(0, 3), m(1, 3), m(2, 3), m(3, 3));
         }
     };
 
     template<RealType T>
     struct compute_mat4_mul<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TMatrix4<T, false>& r, const Phanes::Core::Math::TMatrix4<T, false>& m1, const Phanes::Core::Math::TMatrix4<T, false>& m2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TMatrix4<T, S>& r, const Phanes::Core::Math::TMatrix4<T, S>& m1, const Phanes::Core::Math::TMatrix4<T, S>& m2)
         {
-            r(0, 0) = m1(0, 0) * m2(0, 0) + m1(0, 1) * m2(1, 0) + m1(0, 2) * m2(2, 0) + m1(0, 3) * m2(3, 0);
-            r(0, 1) = m1(0, 0) * m2(0, 1) + m1(0, 1) * m2(1, 1) + m1(0, 2) * m2(2, 1) + m1(0, 3) * m2(3, 1);
-            r(0, 2) = m1(0, 0) * m2(0, 2) + m1(0, 1) * m2(1, 2) + m1(0, 2) * m2(2, 2) + m1(0, 3) * m2(3, 2);
-            r(0, 3) = m1(0, 0) * m2(0, 3) + m1(0, 1) * m2(1, 3) + m1(0, 2) * m2(2, 3) + m1(0, 3) * m2(3, 3);
-            
-            r(1, 0) = m1(1, 0) * m2(0, 0) + m1(1, 1) * m2(1, 0) + m1(1, 2) * m2(2, 0) + m1(1, 3) * m2(3, 0);
-            r(1, 1) = m1(1, 0) * m2(0, 1) + m1(1, 1) * m2(1, 1) + m1(1, 2) * m2(2, 1) + m1(1, 3) * m2(3, 1);
-            r(1, 2) = m1(1, 0) * m2(0, 2) + m1(1, 1) * m2(1, 2) + m1(1, 2) * m2(2, 2) + m1(1, 3) * m2(3, 2);
-            r(1, 3) = m1(1, 0) * m2(0, 3) + m1(1, 1) * m2(1, 3) + m1(1, 2) * m2(2, 3) + m1(1, 3) * m2(3, 3);
-
-            r(2, 0) = m1(2, 0) * m2(0, 0) + m1(2, 1) * m2(1, 0) + m1(2, 2) * m2(2, 0) + m1(2, 3) * m2(3, 0);
-            r(2, 1) = m1(2, 0) * m2(0, 1) + m1(2, 1) * m2(1, 1) + m1(2, 2) * m2(2, 1) + m1(2, 3) * m2(3, 1);
-            r(2, 2) = m1(2, 0) * m2(0, 2) + m1(2, 1) * m2(1, 2) + m1(2, 2) * m2(2, 2) + m1(2, 3) * m2(3, 2);
-            r(2, 3) = m1(2, 0) * m2(0, 3) + m1(2, 1) * m2(1, 3) + m1(2, 2) * m2(2, 3) + m1(2, 3) * m2(3, 3);
-            
-            r(3, 0) = m1(3, 0) * m2(0, 0) + m1(3, 1) * m2(1, 0) + m1(3, 2) * m2(2, 0) + m1(3, 3) * m2(3, 0);
-            r(3, 1) = m1(3, 0) * m2(0, 1) + m1(3, 1) * m2(1, 1) + m1(3, 2) * m2(2, 1) + m1(3, 3) * m2(3, 1);
-            r(3, 2) = m1(3, 0) * m2(0, 2) + m1(3, 1) * m2(1, 2) + m1(3, 2) * m2(2, 2) + m1(3, 3) * m2(3, 2);
-            r(3, 3) = m1(3, 0) * m2(0, 3) + m1(3, 1) * m2(1, 3) + m1(3, 2) * m2(2, 3) + m1(3, 3) * m2(3, 3);
+            r = TMatrix4<T, S>(m1(0, 0) * m2(0, 0) + m1(0, 1) * m2(1, 0) + m1(0, 2) * m2(2, 0) + m1(0, 3) * m2(3, 0),
+                               m1(0, 0) * m2(0, 1) + m1(0, 1) * m2(1, 1) + m1(0, 2) * m2(2, 1) + m1(0, 3) * m2(3, 1),
+                               m1(0, 0) * m2(0, 2) + m1(0, 1) * m2(1, 2) + m1(0, 2) * m2(2, 2) + m1(0, 3) * m2(3, 2),
+                               m1(0, 0) * m2(0, 3) + m1(0, 1) * m2(1, 3) + m1(0, 2) * m2(2, 3) + m1(0, 3) * m2(3, 3),
+
+                               m1(1, 0) * m2(0, 0) + m1(1, 1) * m2(1, 0) + m1(1, 2) * m2(2, 0) + m1(1, 3) * m2(3, 0),
+                               m1(1, 0) * m2(0, 1) + m1(1, 1) * m2(1, 1) + m1(1, 2) * m2(2, 1) + m1(1, 3) * m2(3, 1),
+                               m1(1, 0) * m2(0, 2) + m1(1, 1) * m2(1, 2) + m1(1, 2) * m2(2, 2) + m1(1, 3) * m2(3, 2),
+                               m1(1, 0) * m2(0, 3) + m1(1, 1) * m2(1, 3) + m1(1, 2) * m2(2, 3) + m1(1, 3) * m2(3, 3),
+
+                               m1(2, 0) * m2(0, 0) + m1(2, 1) * m2(1, 0) + m1(2, 2) * m2(2, 0) + m1(2, 3) * m2(3, 0),
+                               m1(2, 0) * m2(0, 1) + m1(2, 1) * m2(1, 1) + m1(2, 2) * m2(2, 1) + m1(2, 3) * m2(3, 1),
+                               m1(2, 0) * m2(0, 2) + m1(2, 1) * m2(1, 2) + m1(2, 2) * m2(2, 2) + m1(2, 3) * m2(3, 2),
+                               m1(2, 0) * m2(0, 3) + m1(2, 1) * m2(1, 3) + m1(2, 2) * m2(2, 3) + m1(2, 3) * m2(3, 3),
+
+                               m1(3, 0) * m2(0, 0) + m1(3, 1) * m2(1, 0) + m1(3, 2) * m2(2, 0) + m1(3, 3) * m2(3, 0),
+                               m1(3, 0) * m2(0, 1) + m1(3, 1) * m2(1, 1) + m1(3, 2) * m2(2, 1) + m1(3, 3) * m2(3, 1),
+                               m1(3, 0) * m2(0, 2) + m1(3, 1) * m2(1, 2) + m1(3, 2) * m2(2, 2) + m1(3, 3) * m2(3, 2),
+                               m1(3, 0) * m2(0, 3) + m1(3, 1) * m2(1, 3) + m1(3, 2) * m2(2, 3) + m1(3, 3) * m2(3, 3));
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TMatrix4<T, false>& m1, const Phanes::Core::Math::TVector4<T, false>& v)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TMatrix4<T, S>& m1, const Phanes::Core::Math::TVector4<T, S>& v)
         {
             r.x = m1(0, 0) * v.x + m1(0, 1) * v.y + m1(0, 2) * v.z + m1(0, 3) * v.w;
             r.y = m1(1, 0) * v.x + m1(1, 1) * v.y + m1(1, 2) * v.z + m1(1, 3) * v.w;
@@ -134,4 +154,73 @@ namespace Phanes::Core::Math::Detail
             r.w = m1(3, 0) * v.x + m1(3, 1) * v.y + m1(3, 2) * v.z + m1(3, 3) * v.w;
         }
     };
-}
\ No newline at end of file
+
+    template<RealType T>
+    struct compute_mat4_transform_points<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>* r, const Phanes::Core::Math::TMatrix4<T, false>& m, const Phanes::Core::Math::TVector3<T, false>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T x = v[i].x;
+                T y = v[i].y;
+                T z = v[i].z;
+
+                r[i].x = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3);
+                r[i].y = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3);
+                r[i].z = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_transform_dirs<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>* r, const Phanes::Core::Math::TMatrix4<T, false>& m, const Phanes::Core::Math::TVector3<T, false>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T x = v[i].x;
+                T y = v[i].y;
+                T z = v[i].z;
+
+                r[i].x = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z;
+                r[i].y = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z;
+                r[i].z = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_transform<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector4<T, false>* r, const Phanes::Core::Math::TMatrix4<T, false>& m, const Phanes::Core::Math::TVector4<T, false>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                Phanes::Core::Math::TVector4<T, false> tmp = v[i];
+                compute_mat4_mul<T, false>::map(r[i], m, tmp);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_mat4_soa_transform<T, false>
+    {
+        // w is 1 for points and 0 for directions.
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3SoA<T>& r, const Phanes::Core::Math::TMatrix4<T, S>& m, const Phanes::Core::Math::TVector3SoA<T>& v, T w)
+        {
+            for (size_t i = 0; i < v.Size(); i++)
+            {
+                T x = v.x[i];
+                T y = v.y[i];
+                T z = v.z[i];
+
+                r.x[i] = m(0, 0) * x + m(0, 1) * y + m(0, 2) * z + m(0, 3) * w;
+                r.y[i] = m(1, 0) * x + m(1, 1) * y + m(1, 2) * z + m(1, 3) * w;
+                r.z[i] = m(2, 0) * x + m(2, 1) * y + m(2, 2) * z + m(2, 3) * w;
+            }
+        }
+    };
+}
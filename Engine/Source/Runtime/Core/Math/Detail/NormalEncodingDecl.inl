@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Phanes::Core::Math::Detail
+{
+    // The maps are templates over the encoded type (TOctNormal16 / TOctNormal8, signed or unsigned integers) and the
+    // alignment of the vectors, so SIMD specializations can take over single formats and derive the rest.
+
+    template<RealType T, bool S>
+    struct compute_oct_pack {};
+
+    template<RealType T, bool S>
+    struct compute_oct_unpack {};
+
+    template<RealType T, bool S>
+    struct compute_norm_pack {};
+
+    template<RealType T, bool S>
+    struct compute_norm_unpack {};
+
+
+
+    template<RealType T>
+    struct compute_oct_pack<T, false>
+    {
+        template<typename O, bool S>
+        static inline void map(O* r, const Phanes::Core::Math::TVector3<T, S>* v, size_t n)
+        {
+            using I = decltype(O::x);
+            constexpr T scale = (T)std::numeric_limits<I>::max();
+
+            for (size_t i = 0; i < n; i++)
+            {
+                T sum = std::abs(v[i].x) + std::abs(v[i].y) + std::abs(v[i].z);
+                T inv = (sum > (T)0.0) ? (T)1.0 / sum : (T)0.0;
+                T u = v[i].x * inv;
+                T w = v[i].y * inv;
+
+                // Fold the lower half over the diagonals.
+                if (v[i].z < (T)0.0)
+                {
+                    T fu = ((T)1.0 - std::abs(w)) * std::copysign((T)1.0, u);
+                    T fw = ((T)1.0 - std::abs(u)) * std::copysign((T)1.0, w);
+                    u = fu;
+                    w = fw;
+                }
+
+                r[i].x = (I)std::nearbyint(u * scale);
+                r[i].y = (I)std::nearbyint(w * scale);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_oct_unpack<T, false>
+    {
+        template<typename O, bool S>
+        static inline void map(Phanes::Core::Math::TVector3<T, S>* r, const O* v, size_t n)
+        {
+            constexpr T scale = (T)std::numeric_limits<decltype(O::x)>::max();
+
+            for (size_t i = 0; i < n; i++)
+            {
+                T u = std::max((T)v[i].x / scale, (T)-1.0);
+                T w = std::max((T)v[i].y / scale, (T)-1.0);
+                T z = (T)1.0 - std::abs(u) - std::abs(w);
+                T t = std::max(-z, (T)0.0);
+
+                u -= std::copysign(t, u);
+                w -= std::copysign(t, w);
+
+                T inv = (T)1.0 / std::sqrt(u * u + w * w + z * z);
+                r[i] = Phanes::Core::Math::TVector3<T, S>(u * inv, w * inv, z * inv);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_norm_pack<T, false>
+    {
+        // Signed integers are SNORM, unsigned UNORM.
+        template<typename I>
+        static inline void map(I* r, const T* v, size_t n)
+        {
+            constexpr T lo = std::is_signed_v<I> ? (T)-1.0 : (T)0.0;
+            constexpr T scale = (T)std::numeric_limits<I>::max();
+
+            for (size_t i = 0; i < n; i++)
+            {
+                T s = (v[i] == v[i]) ? std::clamp(v[i], lo, (T)1.0) : (T)0.0;
+                r[i] = (I)std::nearbyint(s * scale);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_norm_unpack<T, false>
+    {
+        template<typename I>
+        static inline void map(T* r, const I* v, size_t n)
+        {
+            constexpr T lo = std::is_signed_v<I> ? (T)-1.0 : (T)0.0;
+            constexpr T scale = (T)std::numeric_limits<I>::max();
+
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = std::max((T)v[i] / scale, lo);
+            }
+        }
+    };
+}
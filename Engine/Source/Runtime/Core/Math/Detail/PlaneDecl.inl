@@ -19,6 +19,10 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_plane_div {};
 
+    // transform by TTransform
+    template<RealType T, bool S>
+    struct compute_plane_transform {};
+
     
 
     template<RealType T>
@@ -104,4 +108,21 @@ namespace Phanes::Core::Math::Detail
             r.comp = pl1.comp / s;
         }
     };
-}
\ No newline at end of file
+
+    template<RealType T>
+    struct compute_plane_transform<T, false>
+    {
+        static constexpr void map(TPlane<T, false>& r, const TPlane<T, false>& pl1, const TTransform<T, false>& tr)
+        {
+            // Normals transform with the inverse transpose of scale and rotation: n' = q * (n / s).
+            // The base point n * d is moved like any other point.
+            TVector3<T, false> n = tr.rotation * TVector3<T, false>(pl1.x / tr.scale.x, pl1.y / tr.scale.y, pl1.z / tr.scale.z);
+            NormalizeV(n);
+
+            T d = DotP(n, TransformPoint(tr, TVector3<T, false>(pl1.x * pl1.d, pl1.y * pl1.d, pl1.z * pl1.d)));
+
+            r.normal = n;
+            r.d = d;
+        }
+    };
+}
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+namespace Phanes::Core::Math::Detail
+{
+    template<RealType T, bool S>
+    struct construct_quat {};
+
+    // from euler angles (yaw, pitch, roll)
+    template<RealType T, bool S>
+    struct construct_quat_euler {};
+
+    template<RealType T, bool S>
+    struct compute_quat_add {};
+
+    template<RealType T, bool S>
+    struct compute_quat_sub {};
+
+    // Hamilton product / scale
+    template<RealType T, bool S>
+    struct compute_quat_mul {};
+
+    template<RealType T, bool S>
+    struct compute_quat_div {};
+
+    template<RealType T, bool S>
+    struct compute_quat_eq {};
+
+    template<RealType T, bool S>
+    struct compute_quat_ieq {};
+
+    // dot product
+    template<RealType T, bool S>
+    struct compute_quat_dotp {};
+
+    // conjugate
+    template<RealType T, bool S>
+    struct compute_quat_conj {};
+
+    // inverse
+    template<RealType T, bool S>
+    struct compute_quat_inv {};
+
+    // normalize
+    template<RealType T, bool S>
+    struct compute_quat_norm {};
+
+    // rotate vector
+    template<RealType T, bool S>
+    struct compute_quat_rotate {};
+
+    // normalized lerp
+    template<RealType T, bool S>
+    struct compute_quat_nlerp {};
+
+    // spherical lerp
+    template<RealType T, bool S>
+    struct compute_quat_slerp {};
+
+    // spherical lerp over arrays
+    template<RealType T, bool S>
+    struct compute_quat_batch_slerp {};
+
+
+    template<RealType T>
+    struct construct_quat<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, T x, T y, T z, T w)
+        {
+            r.x = x;
+            r.y = y;
+            r.z = z;
+            r.w = w;
+        }
+
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v, T w)
+        {
+            r.x = v.x;
+            r.y = v.y;
+            r.z = v.z;
+            r.w = w;
+        }
+
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v)
+        {
+            r.x = v.x;
+            r.y = v.y;
+            r.z = v.z;
+            r.w = v.w;
+        }
+
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const T* comp)
+        {
+            memcpy(r.data, comp, 4 * sizeof(T));
+        }
+    };
+
+    template<RealType T>
+    struct construct_quat_euler<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& euler_angels)
+        {
+            T cy = cos(euler_angels.x * (T)0.5);
+            T sy = sin(euler_angels.x * (T)0.5);
+            T cp = cos(euler_angels.y * (T)0.5);
+            T sp = sin(euler_angels.y * (T)0.5);
+            T cr = cos(euler_angels.z * (T)0.5);
+            T sr = sin(euler_angels.z * (T)0.5);
+
+            r.x = sr * cp * cy - cr * sp * sy;
+            r.y = cr * sp * cy + sr * cp * sy;
+            r.z = cr * cp * sy - sr * sp * cy;
+            r.w = cr * cp * cy + sr * sp * sy;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_add<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            r.x = q1.x + q2.x;
+            r.y = q1.y + q2.y;
+            r.z = q1.z + q2.z;
+            r.w = q1.w + q2.w;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_sub<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            r.x = q1.x - q2.x;
+            r.y = q1.y - q2.y;
+            r.z = q1.z - q2.z;
+            r.w = q1.w - q2.w;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_mul<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            // Copies, as r may alias q1 or q2.
+            T x = q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y;
+            T y = q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x;
+            T z = q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w;
+            T w = q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z;
+
+            r.x = x;
+            r.y = y;
+            r.z = z;
+            r.w = w;
+        }
+
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, T s)
+        {
+            r.x = q1.x * s;
+            r.y = q1.y * s;
+            r.z = q1.z * s;
+            r.w = q1.w * s;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_div<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, T s)
+        {
+            s = (T)1.0 / s;
+
+            r.x = q1.x * s;
+            r.y = q1.y * s;
+            r.z = q1.z * s;
+            r.w = q1.w * s;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_eq<T, false>
+    {
+        static constexpr bool map(const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            return (Phanes::Core::Math::Abs(q1.x - q2.x) < P_FLT_INAC &&
+                    Phanes::Core::Math::Abs(q1.y - q2.y) < P_FLT_INAC &&
+                    Phanes::Core::Math::Abs(q1.z - q2.z) < P_FLT_INAC &&
+                    Phanes::Core::Math::Abs(q1.w - q2.w) < P_FLT_INAC);
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_ieq<T, false>
+    {
+        static constexpr bool map(const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            return (Phanes::Core::Math::Abs(q1.x - q2.x) > P_FLT_INAC ||
+                    Phanes::Core::Math::Abs(q1.y - q2.y) > P_FLT_INAC ||
+                    Phanes::Core::Math::Abs(q1.z - q2.z) > P_FLT_INAC ||
+                    Phanes::Core::Math::Abs(q1.w - q2.w) > P_FLT_INAC);
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_dotp<T, false>
+    {
+        static constexpr T map(const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2)
+        {
+            return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_conj<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1)
+        {
+            r.x = -q1.x;
+            r.y = -q1.y;
+            r.z = -q1.z;
+            r.w = q1.w;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_inv<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1)
+        {
+            T s = (T)1.0 / (q1.x * q1.x + q1.y * q1.y + q1.z * q1.z + q1.w * q1.w);
+
+            r.x = -q1.x * s;
+            r.y = -q1.y * s;
+            r.z = -q1.z * s;
+            r.w = q1.w * s;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_norm<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1)
+        {
+            T s = (T)1.0 / sqrt(q1.x * q1.x + q1.y * q1.y + q1.z * q1.z + q1.w * q1.w);
+
+            r.x = q1.x * s;
+            r.y = q1.y * s;
+            r.z = q1.z * s;
+            r.w = q1.w * s;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_rotate<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q, const Phanes::Core::Math::TVector3<T, false>& v)
+        {
+            // v' = v + w * t + u x t, with t = 2 * (u x v)
+            T tx = 2 * (q.y * v.z - q.z * v.y);
+            T ty = 2 * (q.z * v.x - q.x * v.z);
+            T tz = 2 * (q.x * v.y - q.y * v.x);
+
+            T x = v.x + q.w * tx + (q.y * tz - q.z * ty);
+            T y = v.y + q.w * ty + (q.z * tx - q.x * tz);
+            T z = v.z + q.w * tz + (q.x * ty - q.y * tx);
+
+            r.x = x;
+            r.y = y;
+            r.z = z;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_nlerp<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2, T t)
+        {
+            // Shortest path: q and -q describe the same rotation.
+            T t1 = (T)1.0 - t;
+            T t2 = (compute_quat_dotp<T, false>::map(q1, q2) < 0) ? -t : t;
+
+            r.x = q1.x * t1 + q2.x * t2;
+            r.y = q1.y * t1 + q2.y * t2;
+            r.z = q1.z * t1 + q2.z * t2;
+            r.w = q1.w * t1 + q2.w * t2;
+
+            compute_quat_norm<T, false>::map(r, r);
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_slerp<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& q1, const Phanes::Core::Math::TQuaternion<T, false>& q2, T t)
+        {
+            T cosTheta = compute_quat_dotp<T, false>::map(q1, q2);
+            T sign = (T)1.0;
+
+            if (cosTheta < 0)
+            {
+                cosTheta = -cosTheta;
+                sign = (T)-1.0;
+            }
+
+            // Almost parallel, sin(theta) is close to zero.
+            if (cosTheta > (T)1.0 - P_FLT_INAC)
+            {
+                compute_quat_nlerp<T, false>::map(r, q1, q2, t);
+                return;
+            }
+
+            T theta = acos(cosTheta);
+            T invSin = (T)1.0 / sin(theta);
+
+            T t1 = sin(((T)1.0 - t) * theta) * invSin;
+            T t2 = sin(t * theta) * invSin * sign;
+
+            r.x = q1.x * t1 + q2.x * t2;
+            r.y = q1.y * t1 + q2.y * t2;
+            r.z = q1.z * t1 + q2.z * t2;
+            r.w = q1.w * t1 + q2.w * t2;
+        }
+    };
+
+    template<RealType T>
+    struct compute_quat_batch_slerp<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TQuaternion<T, false>* r, const Phanes::Core::Math::TQuaternion<T, false>* q1, const Phanes::Core::Math::TQuaternion<T, false>* q2, T t, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                compute_quat_slerp<T, false>::map(r[i], q1[i], q2[i], t);
+            }
+        }
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+#include <limits>
+
+namespace Phanes::Core::Math::Detail
+{
+    // packet vs. box (slab test)
+    template<RealType T, size_t L, bool S>
+    struct compute_packet_aabb {};
+
+    // packet vs. plane
+    template<RealType T, size_t L, bool S>
+    struct compute_packet_plane {};
+
+    // packet vs. sphere
+    template<RealType T, size_t L, bool S>
+    struct compute_packet_sphere {};
+
+
+    template<RealType T, size_t L>
+    struct compute_packet_aabb<T, L, false>
+    {
+        static constexpr Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<T, L>& p, T minX, T minY, T minZ, T maxX, T maxY, T maxZ, T* t)
+        {
+            const T bmin[3] = { minX, minY, minZ };
+            const T bmax[3] = { maxX, maxY, maxZ };
+
+            Phanes::Core::Types::uint32 mask = 0;
+
+            for (size_t i = 0; i < L; i++)
+            {
+                const T o[3] = { p.ox[i], p.oy[i], p.oz[i] };
+                const T inv[3] = { p.ix[i], p.iy[i], p.iz[i] };
+
+                T tmin = (T)0.0;
+                T tmax = std::numeric_limits<T>::infinity();
+
+                for (int k = 0; k < 3; k++)
+                {
+                    T t0 = (bmin[k] - o[k]) * inv[k];
+                    T t1 = (bmax[k] - o[k]) * inv[k];
+
+                    // Comparisons with NaN (origin on a slab of a parallel ray) keep the current interval, as _mm_min_ps / _mm_max_ps do.
+                    T lo = (t0 < t1) ? t0 : t1;
+                    T hi = (t0 > t1) ? t0 : t1;
+                    tmin = (lo > tmin) ? lo : tmin;
+                    tmax = (hi < tmax) ? hi : tmax;
+                }
+
+                t[i] = tmin;
+                mask |= (Phanes::Core::Types::uint32)(tmin <= tmax) << i;
+            }
+
+            return mask;
+        }
+    };
+
+    template<RealType T, size_t L>
+    struct compute_packet_plane<T, L, false>
+    {
+        static constexpr Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<T, L>& p, T nx, T ny, T nz, T d, T* t)
+        {
+            Phanes::Core::Types::uint32 mask = 0;
+
+            for (size_t i = 0; i < L; i++)
+            {
+                T denom = nx * p.dx[i] + ny * p.dy[i] + nz * p.dz[i];
+                t[i] = (d - (nx * p.ox[i] + ny * p.oy[i] + nz * p.oz[i])) / denom;
+
+                mask |= (Phanes::Core::Types::uint32)(Abs(denom) > P_FLT_INAC && t[i] >= (T)0.0) << i;
+            }
+
+            return mask;
+        }
+    };
+
+    template<RealType T, size_t L>
+    struct compute_packet_sphere<T, L, false>
+    {
+        static constexpr Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<T, L>& p, T cx, T cy, T cz, T radius, T* t)
+        {
+            Phanes::Core::Types::uint32 mask = 0;
+
+            for (size_t i = 0; i < L; i++)
+            {
+                // |o + t * v - c|^2 = r^2  ->  a * t^2 + 2 * b * t + c = 0
+                T ocx = p.ox[i] - cx;
+                T ocy = p.oy[i] - cy;
+                T ocz = p.oz[i] - cz;
+
+                T a = p.dx[i] * p.dx[i] + p.dy[i] * p.dy[i] + p.dz[i] * p.dz[i];
+                T b = ocx * p.dx[i] + ocy * p.dy[i] + ocz * p.dz[i];
+                T c = ocx * ocx + ocy * ocy + ocz * ocz - radius * radius;
+
+                T disc = b * b - a * c;
+                T sq = sqrt((disc > (T)0.0) ? disc : (T)0.0);
+
+                // Far root, if the origin is inside the sphere.
+                T t0 = (-b - sq) / a;
+                T t1 = (-b + sq) / a;
+                t[i] = (t0 >= (T)0.0) ? t0 : t1;
+
+                mask |= (Phanes::Core::Types::uint32)(disc >= (T)0.0 && t1 >= (T)0.0) << i;
+            }
+
+            return mask;
+        }
+    };
+}
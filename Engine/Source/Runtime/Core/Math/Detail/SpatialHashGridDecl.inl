@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+#include <cmath>
+
+namespace Phanes::Core::Math::Detail
+{
+    // Cell coordinates are clamped to [-2^20, 2^20 - 1], so three of them fit into a 63 bit key.
+    constexpr int grid_cell_min = -(1 << 20);
+    constexpr int grid_cell_max = (1 << 20) - 1;
+
+    // position to cell, floor(p * invCellSize), clamped (NaN goes to the lowest cell)
+    template<RealType T, bool S>
+    struct compute_grid_cell {};
+
+
+    template<RealType T>
+    struct compute_grid_cell<T, false>
+    {
+        static constexpr int cell(T v, T invCellSize)
+        {
+            T f = std::floor(v * invCellSize);
+            f = (f > (T)grid_cell_min) ? f : (T)grid_cell_min;
+            f = (f < (T)grid_cell_max) ? f : (T)grid_cell_max;
+
+            return (int)f;
+        }
+
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TIntVector3<int, S>* r, const Phanes::Core::Math::TVector3<T, S>* v, T invCellSize, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = cell(v[i].x, invCellSize);
+                r[i].y = cell(v[i].y, invCellSize);
+                r[i].z = cell(v[i].z, invCellSize);
+                r[i].w = 0;
+            }
+        }
+    };
+
+
+    // Key of a cell, ordered by z, then y, then x.
+    constexpr Phanes::Core::Types::uint64 grid_key(int x, int y, int z)
+    {
+        return ((Phanes::Core::Types::uint64)(z - grid_cell_min) << 42) |
+               ((Phanes::Core::Types::uint64)(y - grid_cell_min) << 21) |
+               (Phanes::Core::Types::uint64)(x - grid_cell_min);
+    }
+
+    // Fibonacci hashing, the table size is 2^(64 - shift).
+    constexpr size_t grid_hash(Phanes::Core::Types::uint64 key, int shift)
+    {
+        return (size_t)((key * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+}
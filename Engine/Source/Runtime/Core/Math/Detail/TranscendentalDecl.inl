@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // Kernels over plain arrays of any length, no alignment or padding required.
+
+    template<RealType T, bool S>
+    struct compute_soa_sin {};
+
+    template<RealType T, bool S>
+    struct compute_soa_cos {};
+
+    template<RealType T, bool S>
+    struct compute_soa_sincos {};
+
+
+
+    template<RealType T>
+    struct compute_soa_sin<T, false>
+    {
+        static constexpr void map(T* r, const T* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = std::sin(v[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_soa_cos<T, false>
+    {
+        static constexpr void map(T* r, const T* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = std::cos(v[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_soa_sincos<T, false>
+    {
+        static constexpr void map(T* s, T* c, const T* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T a = v[i];
+                s[i] = std::sin(a);
+                c[i] = std::cos(a);
+            }
+        }
+    };
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+#include "Core/Math/Detail/QuaternionDecl.inl"
+
+namespace Phanes::Core::Math::Detail
+{
+    template<RealType T, bool S>
+    struct construct_transform {};
+
+    // composition
+    template<RealType T, bool S>
+    struct compute_transform_mul {};
+
+    // inverse
+    template<RealType T, bool S>
+    struct compute_transform_inv {};
+
+    // transform point
+    template<RealType T, bool S>
+    struct compute_transform_point {};
+
+    // transform direction
+    template<RealType T, bool S>
+    struct compute_transform_dir {};
+
+    // to transformation matrix
+    template<RealType T, bool S>
+    struct compute_transform_to_mat4 {};
+
+
+    template<RealType T>
+    struct construct_transform<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TTransform<T, false>& r, const Phanes::Core::Math::TQuaternion<T, false>& rotation, const Phanes::Core::Math::TVector3<T, false>& translation, const Phanes::Core::Math::TVector3<T, false>& scale)
+        {
+            r.rotation = rotation;
+            r.translation = translation;
+            r.scale = scale;
+        }
+    };
+
+    template<RealType T>
+    struct compute_transform_mul<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TTransform<T, false>& r, const Phanes::Core::Math::TTransform<T, false>& tr1, const Phanes::Core::Math::TTransform<T, false>& tr2)
+        {
+            // t = t1 + q1 * (s1 * t2). Copies, as r may alias tr1 or tr2.
+            Phanes::Core::Math::TVector3<T, false> t;
+            t.x = tr1.scale.x * tr2.translation.x;
+            t.y = tr1.scale.y * tr2.translation.y;
+            t.z = tr1.scale.z * tr2.translation.z;
+            compute_quat_rotate<T, false>::map(t, tr1.rotation, t);
+
+            T sx = tr1.scale.x * tr2.scale.x;
+            T sy = tr1.scale.y * tr2.scale.y;
+            T sz = tr1.scale.z * tr2.scale.z;
+
+            compute_quat_mul<T, false>::map(r.rotation, tr1.rotation, tr2.rotation);
+
+            r.translation.x = tr1.translation.x + t.x;
+            r.translation.y = tr1.translation.y + t.y;
+            r.translation.z = tr1.translation.z + t.z;
+
+            r.scale.x = sx;
+            r.scale.y = sy;
+            r.scale.z = sz;
+        }
+    };
+
+    template<RealType T>
+    struct compute_transform_inv<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TTransform<T, false>& r, const Phanes::Core::Math::TTransform<T, false>& tr)
+        {
+            // q' = conj(q), s' = 1 / s, t' = -(s' * (q' * t))
+            compute_quat_conj<T, false>::map(r.rotation, tr.rotation);
+
+            r.scale.x = (T)1.0 / tr.scale.x;
+            r.scale.y = (T)1.0 / tr.scale.y;
+            r.scale.z = (T)1.0 / tr.scale.z;
+
+            compute_quat_rotate<T, false>::map(r.translation, r.rotation, tr.translation);
+
+            r.translation.x *= -r.scale.x;
+            r.translation.y *= -r.scale.y;
+            r.translation.z *= -r.scale.z;
+        }
+    };
+
+    template<RealType T>
+    struct compute_transform_point<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TTransform<T, false>& tr, const Phanes::Core::Math::TVector3<T, false>& p)
+        {
+            r.x = p.x * tr.scale.x;
+            r.y = p.y * tr.scale.y;
+            r.z = p.z * tr.scale.z;
+
+            compute_quat_rotate<T, false>::map(r, tr.rotation, r);
+
+            r.x += tr.translation.x;
+            r.y += tr.translation.y;
+            r.z += tr.translation.z;
+        }
+    };
+
+    template<RealType T>
+    struct compute_transform_dir<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TTransform<T, false>& tr, const Phanes::Core::Math::TVector3<T, false>& v)
+        {
+            r.x = v.x * tr.scale.x;
+            r.y = v.y * tr.scale.y;
+            r.z = v.z * tr.scale.z;
+
+            compute_quat_rotate<T, false>::map(r, tr.rotation, r);
+        }
+    };
+
+    template<RealType T>
+    struct compute_transform_to_mat4<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TMatrix4<T, false>& r, const Phanes::Core::Math::TTransform<T, false>& tr)
+        {
+            const Phanes::Core::Math::TQuaternion<T, false>& q = tr.rotation;
+
+            T xx = q.x * q.x;
+            T yy = q.y * q.y;
+            T zz = q.z * q.z;
+            T xy = q.x * q.y;
+            T xz = q.x * q.z;
+            T yz = q.y * q.z;
+            T wx = q.w * q.x;
+            T wy = q.w * q.y;
+            T wz = q.w * q.z;
+
+            // Columns of the rotation matrix, scaled per axis.
+            r.data[0][0] = ((T)1.0 - (T)2.0 * (yy + zz)) * tr.scale.x;
+            r.data[0][1] = (T)2.0 * (xy + wz) * tr.scale.x;
+            r.data[0][2] = (T)2.0 * (xz - wy) * tr.scale.x;
+            r.data[0][3] = (T)0.0;
+
+            r.data[1][0] = (T)2.0 * (xy - wz) * tr.scale.y;
+            r.data[1][1] = ((T)1.0 - (T)2.0 * (xx + zz)) * tr.scale.y;
+            r.data[1][2] = (T)2.0 * (yz + wx) * tr.scale.y;
+            r.data[1][3] = (T)0.0;
+
+            r.data[2][0] = (T)2.0 * (xz + wy) * tr.scale.z;
+            r.data[2][1] = (T)2.0 * (yz - wx) * tr.scale.z;
+            r.data[2][2] = ((T)1.0 - (T)2.0 * (xx + yy)) * tr.scale.z;
+            r.data[2][3] = (T)0.0;
+
+            r.data[3][0] = tr.translation.x;
+            r.data[3][1] = tr.translation.y;
+            r.data[3][2] = tr.translation.z;
+            r.data[3][3] = (T)1.0;
+        }
+    };
+}
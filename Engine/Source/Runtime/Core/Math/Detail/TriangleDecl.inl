@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathCommon.hpp"
+
+namespace Phanes::Core::Math::Detail
+{
+    // nearest hit of a ray in a triangle array
+    template<RealType T, bool S>
+    struct compute_ray_triangles {};
+
+
+    template<RealType T>
+    struct compute_ray_triangles<T, false>
+    {
+        static constexpr bool map(Phanes::Core::Math::TTriangleHit<T>& hit, const Phanes::Core::Math::TTriangleSoA<T>& tris,
+                                  T ox, T oy, T oz, T dx, T dy, T dz, T tMax)
+        {
+            bool found = false;
+
+            for (size_t i = 0; i < tris.Size(); i++)
+            {
+                // Moller-Trumbore: p = d x e2, s = o - v0, q = s x e1
+                T e1x = tris.e1[0][i], e1y = tris.e1[1][i], e1z = tris.e1[2][i];
+                T e2x = tris.e2[0][i], e2y = tris.e2[1][i], e2z = tris.e2[2][i];
+
+                T px = dy * e2z - dz * e2y;
+                T py = dz * e2x - dx * e2z;
+                T pz = dx * e2y - dy * e2x;
+
+                T inv = (T)1.0 / (e1x * px + e1y * py + e1z * pz);
+
+                T sx = ox - tris.v0[0][i];
+                T sy = oy - tris.v0[1][i];
+                T sz = oz - tris.v0[2][i];
+
+                T u = (sx * px + sy * py + sz * pz) * inv;
+
+                T qx = sy * e1z - sz * e1y;
+                T qy = sz * e1x - sx * e1z;
+                T qz = sx * e1y - sy * e1x;
+
+                T v = (dx * qx + dy * qy + dz * qz) * inv;
+                T t = (e2x * qx + e2y * qy + e2z * qz) * inv;
+
+                if (u >= (T)0.0 && v >= (T)0.0 && u + v <= (T)1.0 && t >= (T)0.0 && t < tMax)
+                {
+                    tMax = t;
+
+                    hit.t = t;
+                    hit.u = u;
+                    hit.v = v;
+                    hit.index = i;
+                    found = true;
+                }
+            }
+
+            return found;
+        }
+    };
+}
@@ -51,28 +51,32 @@ namespace Phanes::Core::Math::Detail
     struct construct_vec2<T, false>
     {
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& v1, const TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& v1, const TVector2<T, S>& v2)
         {
             v1.x = v2.x;
             v1.y = v2.y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             v1.x = s;
             v1.y = s;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& v1, T x, T y)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& v1, T x, T y)
         {
             v1.x = x;
             v1.y = y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& v1, const T* comp)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& v1, const T* comp)
         {
             v1.x = comp[0];
             v1.y = comp[1];
@@ -84,14 +88,16 @@ namespace Phanes::Core::Math::Detail
     struct compute_vec2_add<T, false>
     {
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, const Phanes::Core::Math::TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, const Phanes::Core::Math::TVector2<T, S>& v2)
         {
             r.x = v1.x + v2.x;
             r.y = v1.y + v2.y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             r.x = v1.x + s;
             r.y = v1.y + s;
@@ -103,20 +109,23 @@ namespace Phanes::Core::Math::Detail
     struct compute_vec2_sub<T, false>
     {
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, const Phanes::Core::Math::TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, const Phanes::Core::Math::TVector2<T, S>& v2)
         {
             r.x = v1.x - v2.x;
             r.y = v1.y - v2.y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             r.x = v1.x - s;
             r.y = v1.y - s;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, T s, const Phanes::Core::Math::TVector2<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, T s, const Phanes::Core::Math::TVector2<T, S>& v1)
         {
             r.x = s - v1.x;
             r.y = s - v1.y;
@@ -128,14 +137,16 @@ namespace Phanes::Core::Math::Detail
     struct compute_vec2_mul<T, false>
     {
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, const Phanes::Core::Math::TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, const Phanes::Core::Math::TVector2<T, S>& v2)
         {
             r.x = v1.x * v2.x;
             r.y = v1.y * v2.y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             r.x = v1.x * s;
             r.y = v1.y * s;
@@ -147,14 +158,16 @@ namespace Phanes::Core::Math::Detail
     struct compute_vec2_div<T, false>
     {
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, const Phanes::Core::Math::TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, const Phanes::Core::Math::TVector2<T, S>& v2)
         {
             r.x = v1.x / v2.x;
             r.y = v1.y / v2.y;
         }
 
         
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             s = (T)1.0 / s;
 
@@ -162,7 +175,8 @@ namespace Phanes::Core::Math::Detail
             r.y = v1.y * s;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector2<T, false>& r, T s, const Phanes::Core::Math::TVector2<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector2<T, S>& r, T s, const Phanes::Core::Math::TVector2<T, S>& v1)
         {
             r.x = s / v1.x;
             r.y = s / v1.y;
@@ -225,7 +239,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec2_dotp<T, false>
     {
-        static constexpr T map(const Phanes::Core::Math::TVector2<T, false>& v1, const Phanes::Core::Math::TVector2<T, false>& v2)
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TVector2<T, S>& v1, const Phanes::Core::Math::TVector2<T, S>& v2)
         {
             return v1.x * v2.x + v1.y * v2.y;
         }
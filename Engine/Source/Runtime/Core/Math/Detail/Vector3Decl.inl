@@ -44,6 +44,18 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_vec3_mag {};
 
+    // Magnitude with FastInvSqrt
+    template<RealType T, bool S>
+    struct compute_vec3_fast_mag {};
+
+    // Angle between two vectors
+    template<RealType T, bool S>
+    struct compute_vec3_angle {};
+
+    // Normalization with FastInvSqrt
+    template<RealType T, bool S>
+    struct compute_vec3_fast_norm {};
+
     // dot product
     template<RealType T, bool S>
     struct compute_vec3_dotp {};
@@ -69,12 +81,17 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct construct_vec3<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const TVector3<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const TVector3<T, S>& v1)
         {
-            memcpy(r.data, v1.data, 4 * sizeof(T));
+            r.x = v1.x;
+            r.y = v1.y;
+            r.z = v1.z;
+            r.w = v1.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, T s)
         {
             r.x = s;
             r.y = s;
@@ -82,7 +99,8 @@ namespace Phanes::Core::Math::Detail
             r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, T x, T y, T z)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, T x, T y, T z)
         {
             r.x = x;
             r.y = y;
@@ -90,7 +108,8 @@ namespace Phanes::Core::Math::Detail
             r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v1, T s)
         {
             r.x = v1.x;
             r.y = v1.y;
@@ -99,9 +118,12 @@ namespace Phanes::Core::Math::Detail
         }
 
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const T* comp)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const T* comp)
         {
-            memcpy(r.data, comp, 3 * sizeof(T));
+            r.x = comp[0];
+            r.y = comp[1];
+            r.z = comp[2];
             r.w = (T)0.0;
         }
     };
@@ -109,18 +131,24 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_add<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             r.x = v1.x + v2.x;
             r.y = v1.y + v2.y;
             r.z = v1.z + v2.z;
+
+            // w is written as well, results have to be fully initialized in constant expressions.
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, T s)
         {
             r.x = v1.x + s;
             r.y = v1.y + s;
             r.z = v1.z + s;
+            r.w = (T)0.0;
         }
     };
 
@@ -128,25 +156,31 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_sub<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             r.x = v1.x - v2.x;
             r.y = v1.y - v2.y;
             r.z = v1.z - v2.z;
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, T s)
         {
             r.x = v1.x - s;
             r.y = v1.y - s;
             r.z = v1.z - s;
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, T s, const Phanes::Core::Math::TVector3<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, T s, const Phanes::Core::Math::TVector3<T, S>& v1)
         {
             r.x = s - v1.x;
             r.y = s - v1.y;
             r.z = s - v1.z;
+            r.w = (T)0.0;
         }
     };
 
@@ -154,18 +188,22 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_mul<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             r.x = v1.x * v2.x;
             r.y = v1.y * v2.y;
             r.z = v1.z * v2.z;
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, T s)
         {
             r.x = v1.x * s;
             r.y = v1.y * s;
             r.z = v1.z * s;
+            r.w = (T)0.0;
         }
     };
 
@@ -173,34 +211,41 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_div<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             r.x = v1.x / v2.x;
             r.y = v1.y / v2.y;
             r.z = v1.z / v2.z;
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v1, T s)
         {
             s = (T)1.0 / s;
 
             r.x = v1.x * s;
             r.y = v1.y * s;
             r.z = v1.z * s;
+            r.w = (T)0.0;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, T s, const Phanes::Core::Math::TVector3<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, T s, const Phanes::Core::Math::TVector3<T, S>& v1)
         {
             r.x = s / v1.x;
             r.y = s / v1.y;
             r.z = s / v1.z;
+            r.w = (T)0.0;
         }
     };
 
     template<RealType T>
     struct compute_vec3_eq<T, false>
     {
-        static constexpr bool map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr bool map(const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             return (Phanes::Core::Math::Abs(v1.x - v2.x) < P_FLT_INAC &&
                 Phanes::Core::Math::Abs(v1.y - v2.y) < P_FLT_INAC &&
@@ -211,7 +256,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_ieq<T, false>
     {
-        static constexpr bool map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr bool map(const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             return (Phanes::Core::Math::Abs(v1.x - v2.x) > P_FLT_INAC ||
                 Phanes::Core::Math::Abs(v1.y - v2.y) > P_FLT_INAC ||
@@ -244,13 +290,15 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec3_cross_p<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false> v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>& r, const Phanes::Core::Math::TVector3<T, S> v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             // V1 has to be copied, as otherwise changes to r affect calculation -> r is v1.
 
             r.x = (v1.y * v2.z) - (v1.z * v2.y);
             r.y = (v1.z * v2.x) - (v1.x * v2.z);
             r.z = (v1.x * v2.y) - (v1.y * v2.x);
+            r.w = (T)0.0;
         }
     };
 
@@ -265,9 +313,54 @@ namespace Phanes::Core::Math::Detail
     };
 
     template<RealType T>
-    struct compute_vec3_dotp<T, false>
+    struct compute_vec3_angle<T, false>
     {
         static constexpr T map(const Phanes::Core::Math::TVector3<T, false>& v1, const Phanes::Core::Math::TVector3<T, false>& v2)
+        {
+            return acos(compute_vec3_dotp<T, false>::map(v1, v2) / (compute_vec3_mag<T, false>::map(v1) * compute_vec3_mag<T, false>::map(v2)));
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_fast_mag<T, false>
+    {
+        // A magnitude needs no division, the refined variant takes the square root directly.
+        template<bool R>
+        static inline T map(const Phanes::Core::Math::TVector3<T, false>& v1)
+        {
+            T sqr = v1.x * v1.x + v1.y * v1.y + v1.z * v1.z;
+
+            if constexpr (R)
+            {
+                return sqrt(sqr);
+            }
+
+            return (sqr > (T)0.0) ? sqr * Phanes::Core::Math::FastInvSqrt<false>(sqr) : (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_fast_norm<T, false>
+    {
+        // Vectors shorter than P_FLT_INAC are returned unchanged, like Normalize does.
+        template<bool R>
+        static inline void map(Phanes::Core::Math::TVector3<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v1)
+        {
+            T sqr = v1.x * v1.x + v1.y * v1.y + v1.z * v1.z;
+            T s = (sqr < (T)(P_FLT_INAC * P_FLT_INAC)) ? (T)1.0 : Phanes::Core::Math::FastInvSqrt<R>(sqr);
+
+            r.x = v1.x * s;
+            r.y = v1.y * s;
+            r.z = v1.z * s;
+            r.w = (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3_dotp<T, false>
+    {
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TVector3<T, S>& v1, const Phanes::Core::Math::TVector3<T, S>& v2)
         {
             return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
         }
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    template<RealType T, bool S>
+    struct compute_vec3soa_dotp {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_mag {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_norm {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_fast_norm {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_cross_p {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_gather {};
+
+    template<RealType T, bool S>
+    struct compute_vec3soa_scatter {};
+
+
+
+    template<RealType T>
+    struct compute_vec3soa_dotp<T, false>
+    {
+        static constexpr void map(T* r, const Phanes::Core::Math::TVector3SoA<T>& v1, const Phanes::Core::Math::TVector3SoA<T>& v2, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_mag<T, false>
+    {
+        static constexpr void map(T* r, const Phanes::Core::Math::TVector3SoA<T>& v1, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_norm<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3SoA<T>& r, const Phanes::Core::Math::TVector3SoA<T>& v1, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T mag = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i]);
+                T s = (mag < P_FLT_INAC) ? (T)1.0 : (T)1.0 / mag;
+
+                r.x[i] = v1.x[i] * s;
+                r.y[i] = v1.y[i] * s;
+                r.z[i] = v1.z[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_fast_norm<T, false>
+    {
+        static inline void map(Phanes::Core::Math::TVector3SoA<T>& r, const Phanes::Core::Math::TVector3SoA<T>& v1, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T sqr = v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i];
+                T s = (sqr < (T)(P_FLT_INAC * P_FLT_INAC)) ? (T)1.0 : Phanes::Core::Math::FastInvSqrt(sqr);
+
+                r.x[i] = v1.x[i] * s;
+                r.y[i] = v1.y[i] * s;
+                r.z[i] = v1.z[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_cross_p<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector3SoA<T>& r, const Phanes::Core::Math::TVector3SoA<T>& v1, const Phanes::Core::Math::TVector3SoA<T>& v2, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T x = v1.y[i] * v2.z[i] - v1.z[i] * v2.y[i];
+                T y = v1.z[i] * v2.x[i] - v1.x[i] * v2.z[i];
+                T z = v1.x[i] * v2.y[i] - v1.y[i] * v2.x[i];
+
+                r.x[i] = x;
+                r.y[i] = y;
+                r.z[i] = z;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_gather<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3SoA<T>& r, const Phanes::Core::Math::TVector3<T, S>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r.x[i] = v[i].x;
+                r.y[i] = v[i].y;
+                r.z[i] = v[i].z;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec3soa_scatter<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector3<T, S>* r, const Phanes::Core::Math::TVector3SoA<T>& v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = v.x[i];
+                r[i].y = v.y[i];
+                r[i].z = v.z[i];
+            }
+        }
+    };
+}
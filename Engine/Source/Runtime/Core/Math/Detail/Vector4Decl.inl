@@ -39,6 +39,18 @@ namespace Phanes::Core::Math::Detail
     template<RealType T, bool S>
     struct compute_vec4_mag {};
 
+    // Magnitude with FastInvSqrt
+    template<RealType T, bool S>
+    struct compute_vec4_fast_mag {};
+
+    // Angle between two vectors
+    template<RealType T, bool S>
+    struct compute_vec4_angle {};
+
+    // Normalization with FastInvSqrt
+    template<RealType T, bool S>
+    struct compute_vec4_fast_norm {};
+
     // dot product
     template<RealType T, bool S>
     struct compute_vec4_dotp {};
@@ -63,13 +75,17 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct construct_vec4<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const TVector4<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const TVector4<T, S>& v1)
         {
-            
-            memcpy(r.data, v1.data, 4 * sizeof(T));
+            r.x = v1.x;
+            r.y = v1.y;
+            r.z = v1.z;
+            r.w = v1.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, T s)
         {
             r.x = s;
             r.y = s;
@@ -77,7 +93,8 @@ namespace Phanes::Core::Math::Detail
             r.w = s;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, T x, T y, T z, T w)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, T x, T y, T z, T w)
         {
             r.x = x;
             r.y = y;
@@ -85,7 +102,8 @@ namespace Phanes::Core::Math::Detail
             r.w = w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector2<T, false>& v2, const Phanes::Core::Math::TVector2<T, false>& v3)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector2<T, S>& v2, const Phanes::Core::Math::TVector2<T, S>& v3)
         {
             r.x = v2.x;
             r.y = v2.y;
@@ -93,7 +111,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v3.y;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector3<T, false>& v, T w)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector3<T, S>& v, T w)
         {
             r.x = v.x;
             r.y = v.y;
@@ -101,16 +120,21 @@ namespace Phanes::Core::Math::Detail
             r.w = w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const T* comp)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const T* comp)
         {
-            memcpy(r.data, comp, 4 * sizeof(T));
+            r.x = comp[0];
+            r.y = comp[1];
+            r.z = comp[2];
+            r.w = comp[3];
         }
     };
 
     template<RealType T>
     struct compute_vec4_add<T, false>
     { 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             r.x = v1.x + v2.x;
             r.y = v1.y + v2.y;
@@ -118,7 +142,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w + v2.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, T s)
         {
             r.x = v1.x + s;
             r.y = v1.y + s;
@@ -131,7 +156,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec4_sub<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             r.x = v1.x - v2.x;
             r.y = v1.y - v2.y;
@@ -139,7 +165,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w - v2.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, T s)
         {
             r.x = v1.x - s;
             r.y = v1.y - s;
@@ -147,7 +174,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w - s;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, T s, const Phanes::Core::Math::TVector4<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, T s, const Phanes::Core::Math::TVector4<T, S>& v1)
         {
             r.x = s - v1.x;
             r.y = s - v1.y;
@@ -160,7 +188,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec4_mul<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             r.x = v1.x * v2.x;
             r.y = v1.y * v2.y;
@@ -168,7 +197,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w * v2.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, T s)
         {
             r.x = v1.x * s;
             r.y = v1.y * s;
@@ -181,7 +211,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec4_div<T, false>
     {
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             r.x = v1.x / v2.x;
             r.y = v1.y / v2.y;
@@ -189,7 +220,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w / v2.w;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1, T s)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, const Phanes::Core::Math::TVector4<T, S>& v1, T s)
         {
             s = (T)1.0 / s;
 
@@ -199,7 +231,8 @@ namespace Phanes::Core::Math::Detail
             r.w = v1.w * s;
         }
 
-        static constexpr void map(Phanes::Core::Math::TVector4<T, false>& r, T s, const Phanes::Core::Math::TVector4<T, false>& v1)
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>& r, T s, const Phanes::Core::Math::TVector4<T, S>& v1)
         {
             r.x = s / v1.x;
             r.y = s / v1.y;
@@ -211,7 +244,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec4_eq<T, false>
     {
-        static constexpr bool map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr bool map(const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             return (Phanes::Core::Math::Abs(v1.x - v2.x) < P_FLT_INAC &&
                     Phanes::Core::Math::Abs(v1.y - v2.y) < P_FLT_INAC &&
@@ -223,7 +257,8 @@ namespace Phanes::Core::Math::Detail
     template<RealType T>
     struct compute_vec4_ieq<T, false>
     {
-        static constexpr bool map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        template<bool S>
+        static constexpr bool map(const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             return (Phanes::Core::Math::Abs(v1.x - v2.x) > P_FLT_INAC ||
                     Phanes::Core::Math::Abs(v1.y - v2.y) > P_FLT_INAC ||
@@ -267,9 +302,54 @@ namespace Phanes::Core::Math::Detail
     };
 
     template<RealType T>
-    struct compute_vec4_dotp<T, false>
+    struct compute_vec4_angle<T, false>
     {
         static constexpr T map(const Phanes::Core::Math::TVector4<T, false>& v1, const Phanes::Core::Math::TVector4<T, false>& v2)
+        {
+            return acos(compute_vec4_dotp<T, false>::map(v1, v2) / (compute_vec4_mag<T, false>::map(v1) * compute_vec4_mag<T, false>::map(v2)));
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_fast_mag<T, false>
+    {
+        // A magnitude needs no division, the refined variant takes the square root directly.
+        template<bool R>
+        static inline T map(const Phanes::Core::Math::TVector4<T, false>& v1)
+        {
+            T sqr = v1.x * v1.x + v1.y * v1.y + v1.z * v1.z + v1.w * v1.w;
+
+            if constexpr (R)
+            {
+                return sqrt(sqr);
+            }
+
+            return (sqr > (T)0.0) ? sqr * Phanes::Core::Math::FastInvSqrt<false>(sqr) : (T)0.0;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_fast_norm<T, false>
+    {
+        // Vectors shorter than P_FLT_INAC are returned unchanged, like Normalize does.
+        template<bool R>
+        static inline void map(Phanes::Core::Math::TVector4<T, false>& r, const Phanes::Core::Math::TVector4<T, false>& v1)
+        {
+            T sqr = v1.x * v1.x + v1.y * v1.y + v1.z * v1.z + v1.w * v1.w;
+            T s = (sqr < (T)(P_FLT_INAC * P_FLT_INAC)) ? (T)1.0 : Phanes::Core::Math::FastInvSqrt<R>(sqr);
+
+            r.x = v1.x * s;
+            r.y = v1.y * s;
+            r.z = v1.z * s;
+            r.w = v1.w * s;
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4_dotp<T, false>
+    {
+        template<bool S>
+        static constexpr T map(const Phanes::Core::Math::TVector4<T, S>& v1, const Phanes::Core::Math::TVector4<T, S>& v2)
         {
             return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
         }
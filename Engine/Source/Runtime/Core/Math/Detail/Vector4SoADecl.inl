@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+namespace Phanes::Core::Math::Detail
+{
+    // Kernels on single streams, shared by TVector3SoA and TVector4SoA.
+
+    template<RealType T, bool S>
+    struct compute_soa_add {};
+
+    template<RealType T, bool S>
+    struct compute_soa_sub {};
+
+    template<RealType T, bool S>
+    struct compute_soa_scale {};
+
+    template<RealType T, bool S>
+    struct compute_soa_lerp {};
+
+
+    template<RealType T, bool S>
+    struct compute_vec4soa_dotp {};
+
+    template<RealType T, bool S>
+    struct compute_vec4soa_mag {};
+
+    template<RealType T, bool S>
+    struct compute_vec4soa_norm {};
+
+    template<RealType T, bool S>
+    struct compute_vec4soa_gather {};
+
+    template<RealType T, bool S>
+    struct compute_vec4soa_scatter {};
+
+
+
+    template<RealType T>
+    struct compute_soa_add<T, false>
+    {
+        static constexpr void map(T* r, const T* v1, const T* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = v1[i] + v2[i];
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_soa_sub<T, false>
+    {
+        static constexpr void map(T* r, const T* v1, const T* v2, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = v1[i] - v2[i];
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_soa_scale<T, false>
+    {
+        static constexpr void map(T* r, const T* v1, T s, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = v1[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_soa_lerp<T, false>
+    {
+        static constexpr void map(T* r, const T* v1, const T* v2, T t, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = ((T)1.0 - t) * v1[i] + t * v2[i];
+            }
+        }
+    };
+
+
+    template<RealType T>
+    struct compute_vec4soa_dotp<T, false>
+    {
+        static constexpr void map(T* r, const Phanes::Core::Math::TVector4SoA<T>& v1, const Phanes::Core::Math::TVector4SoA<T>& v2, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4soa_mag<T, false>
+    {
+        static constexpr void map(T* r, const Phanes::Core::Math::TVector4SoA<T>& v1, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i] + v1.w[i] * v1.w[i]);
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4soa_norm<T, false>
+    {
+        static constexpr void map(Phanes::Core::Math::TVector4SoA<T>& r, const Phanes::Core::Math::TVector4SoA<T>& v1, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                T mag = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i] + v1.w[i] * v1.w[i]);
+                T s = (mag < P_FLT_INAC) ? (T)1.0 : (T)1.0 / mag;
+
+                r.x[i] = v1.x[i] * s;
+                r.y[i] = v1.y[i] * s;
+                r.z[i] = v1.z[i] * s;
+                r.w[i] = v1.w[i] * s;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4soa_gather<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4SoA<T>& r, const Phanes::Core::Math::TVector4<T, S>* v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r.x[i] = v[i].x;
+                r.y[i] = v[i].y;
+                r.z[i] = v[i].z;
+                r.w[i] = v[i].w;
+            }
+        }
+    };
+
+    template<RealType T>
+    struct compute_vec4soa_scatter<T, false>
+    {
+        template<bool S>
+        static constexpr void map(Phanes::Core::Math::TVector4<T, S>* r, const Phanes::Core::Math::TVector4SoA<T>& v, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                r[i].x = v.x[i];
+                r[i].y = v.y[i];
+                r[i].z = v.z[i];
+                r[i].w = v.w[i];
+            }
+        }
+    };
+}
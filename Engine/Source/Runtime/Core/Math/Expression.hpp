@@ -0,0 +1,357 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#include <concepts>
+#include <type_traits>
+
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+namespace Phanes::Core::Math::Detail
+{
+    // Operations of TExprBinary, defined in Detail/ExpressionDecl.inl.
+
+    struct expr_add;
+    struct expr_sub;
+    struct expr_mul;
+    struct expr_div;
+}
+
+namespace Phanes::Core::Math {
+
+    // Opt-in lazy evaluation (expression templates) for TVector3 / TVector4 and TMatrix3 / TMatrix4.
+    //
+    // Lazy(x) wraps a vector or matrix by reference. Operators with a wrapped operand build an expression instead of
+    // computing temporaries, the expression is evaluated in one pass when it is converted to the vector / matrix type:
+    //
+    //      Vector4Reg r = Lazy(a) * s + Lazy(b) * t - c;       One pass over the components (registers with SIMD).
+    //      Vector4 p = Lazy(proj) * view * model * v;          Three matrix vector products, no matrix products.
+    //      Matrix4 m = Lazy(proj) * view * model;              Same as the eager product.
+    //
+    // Element-wise expressions give the same results as the eager operators, unless the compiler contracts to FMA:
+    // with -mfma and GCC's default -ffp-contract=fast the per-component loop of unaligned vectors is fused differently
+    // than the eager operators and results can differ in the last bit. FMA=true builds pass -ffp-contract=off.
+    //
+    // A chain of matrix products that ends in a vector is evaluated right to left (A * (B * (C * v))) and can differ
+    // from the eager result by rounding. Chains that end in a matrix are multiplied left to right like the eager
+    // operators: computing them column by column through matrix vector products does not save work and measured slower.
+    //
+    // Optimized builds compile element-wise expressions to the same code as the eager operators. Unoptimized builds
+    // pay a function call per node, which costs more than the saved temporaries (BenchExpressions in MathBench).
+    //
+    // Expressions hold references to their operands: convert them in the statement that builds them and do not keep
+    // them in auto variables.
+
+    template<typename E>
+    concept VectorExpression = E::IsVectorExpression;
+
+    template<typename E>
+    concept MatrixExpression = E::IsMatrixExpression;
+
+
+    // ======================= //
+    //   Vector expressions    //
+    // ======================= //
+
+    /// <summary>
+    /// Vector operand of an expression.
+    /// </summary>
+    /// <typeparam name="V">TVector3 or TVector4</typeparam>
+    template<typename V>
+    struct TExprVector
+    {
+        static constexpr bool IsVectorExpression = true;
+
+        using Result = V;
+        using Real = typename V::Real;
+
+        const V& v;
+
+        constexpr TExprVector(const V& v) : v(v) {};
+
+        /// <summary>
+        /// Evaluates component i of the expression (vectors without SIMD).
+        /// </summary>
+        Real Lane(size_t i) const;
+
+        /// <summary>
+        /// Evaluates the expression into a register (aligned vectors, Detail::compute_expr).
+        /// </summary>
+        auto Reg() const;
+
+        operator Result() const;
+    };
+
+    /// <summary>
+    /// Scalar operand of an expression, used for all components.
+    /// </summary>
+    /// <typeparam name="V">Vector type of the expression</typeparam>
+    template<typename V>
+    struct TExprScalar
+    {
+        static constexpr bool IsVectorExpression = true;
+
+        using Result = V;
+        using Real = typename V::Real;
+
+        Real s;
+
+        constexpr TExprScalar(Real s) : s(s) {};
+
+        /// <summary>
+        /// Evaluates component i of the expression (vectors without SIMD).
+        /// </summary>
+        Real Lane(size_t i) const;
+
+        /// <summary>
+        /// Evaluates the expression into a register (aligned vectors, Detail::compute_expr).
+        /// </summary>
+        auto Reg() const;
+
+        operator Result() const;
+    };
+
+    /// <summary>
+    /// Component-wise operation of two expressions.
+    /// </summary>
+    /// <typeparam name="Op">Operation (Detail::expr_add, ...)</typeparam>
+    /// <typeparam name="L">Left expression</typeparam>
+    /// <typeparam name="R">Right expression</typeparam>
+    template<typename Op, VectorExpression L, VectorExpression R>
+    struct TExprBinary
+    {
+        static_assert(std::is_same_v<typename L::Result, typename R::Result>, "Operands of an expression must have the same vector type.");
+
+        static constexpr bool IsVectorExpression = true;
+
+        using Result = typename L::Result;
+        using Real = typename L::Real;
+
+        L l;
+        R r;
+
+        constexpr TExprBinary(const L& l, const R& r) : l(l), r(r) {};
+
+        /// <summary>
+        /// Evaluates component i of the expression (vectors without SIMD).
+        /// </summary>
+        Real Lane(size_t i) const;
+
+        /// <summary>
+        /// Evaluates the expression into a register (aligned vectors, Detail::compute_expr).
+        /// </summary>
+        auto Reg() const;
+
+        operator Result() const;
+    };
+
+    /// <summary>
+    /// Expression type of an operand x of an expression of type E. Expressions are taken as they are, vectors by
+    /// reference and scalars are broadcast.
+    /// </summary>
+    template<typename E, typename X>
+    using TExprOperand = std::conditional_t<VectorExpression<X>, X,
+                         std::conditional_t<std::is_arithmetic_v<X>, TExprScalar<typename E::Result>, TExprVector<X>>>;
+
+    /// <summary>
+    /// Evaluates a vector expression.
+    /// </summary>
+    /// <param name="e">Expression</param>
+    /// <returns>Computed vector.</returns>
+    template<VectorExpression E>
+    typename E::Result Evaluate(const E& e);
+
+
+    // ======================= //
+    //   Matrix expressions    //
+    // ======================= //
+
+    /// <summary>
+    /// Matrix operand of a product chain.
+    /// </summary>
+    /// <typeparam name="M">TMatrix3 or TMatrix4</typeparam>
+    template<typename M>
+    struct TExprMatrix
+    {
+        static constexpr bool IsMatrixExpression = true;
+
+        using Result = M;
+        using Column = std::remove_cvref_t<decltype(std::declval<const M&>().c0)>;
+
+        const M& m;
+
+        constexpr TExprMatrix(const M& m) : m(m) {};
+
+        /// <summary>
+        /// Multiplies the matrix with v.
+        /// </summary>
+        Column MulVec(const Column& v) const;
+
+        /// <summary>
+        /// The matrix.
+        /// </summary>
+        const M& Get() const;
+
+        operator Result() const;
+    };
+
+    /// <summary>
+    /// Product of two matrix expressions, l * r.
+    /// </summary>
+    template<MatrixExpression L, MatrixExpression R>
+    struct TExprProduct
+    {
+        static_assert(std::is_same_v<typename L::Result, typename R::Result>, "Factors of a product must have the same matrix type.");
+
+        static constexpr bool IsMatrixExpression = true;
+
+        using Result = typename L::Result;
+        using Column = typename L::Column;
+
+        L l;
+        R r;
+
+        constexpr TExprProduct(const L& l, const R& r) : l(l), r(r) {};
+
+        /// <summary>
+        /// Multiplies the product with v, l * (r * v).
+        /// </summary>
+        Column MulVec(const Column& v) const;
+
+        /// <summary>
+        /// Computes the product, (l * r).
+        /// </summary>
+        Result Get() const;
+
+        operator Result() const;
+    };
+
+    /// <summary>
+    /// Evaluates a matrix product chain.
+    /// </summary>
+    /// <param name="e">Expression</param>
+    /// <returns>Computed matrix.</returns>
+    template<MatrixExpression E>
+    typename E::Result Evaluate(const E& e);
+
+
+    // ============ //
+    //   Lazy       //
+    // ============ //
+
+    template<RealType T, bool S>
+    constexpr TExprVector<TVector3<T, S>> Lazy(const TVector3<T, S>& v)
+    {
+        return TExprVector<TVector3<T, S>>(v);
+    }
+
+    template<RealType T, bool S>
+    constexpr TExprVector<TVector4<T, S>> Lazy(const TVector4<T, S>& v)
+    {
+        return TExprVector<TVector4<T, S>>(v);
+    }
+
+    template<RealType T, bool S>
+    constexpr TExprMatrix<TMatrix3<T, S>> Lazy(const TMatrix3<T, S>& m)
+    {
+        return TExprMatrix<TMatrix3<T, S>>(m);
+    }
+
+    template<RealType T, bool S>
+    constexpr TExprMatrix<TMatrix4<T, S>> Lazy(const TMatrix4<T, S>& m)
+    {
+        return TExprMatrix<TMatrix4<T, S>>(m);
+    }
+
+
+    // ======================= //
+    //   Expression operators  //
+    // ======================= //
+
+    // At least one operand is an expression. The other one can be an expression, a vector of the same type or a scalar.
+
+    template<VectorExpression L, typename R>
+    constexpr auto operator+ (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_add, L, TExprOperand<L, R>>(l, TExprOperand<L, R>(r));
+    }
+
+    template<typename L, VectorExpression R> requires (!VectorExpression<L>)
+    constexpr auto operator+ (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_add, TExprOperand<R, L>, R>(TExprOperand<R, L>(l), r);
+    }
+
+    template<VectorExpression L, typename R>
+    constexpr auto operator- (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_sub, L, TExprOperand<L, R>>(l, TExprOperand<L, R>(r));
+    }
+
+    template<typename L, VectorExpression R> requires (!VectorExpression<L>)
+    constexpr auto operator- (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_sub, TExprOperand<R, L>, R>(TExprOperand<R, L>(l), r);
+    }
+
+    template<VectorExpression L, typename R>
+    constexpr auto operator* (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_mul, L, TExprOperand<L, R>>(l, TExprOperand<L, R>(r));
+    }
+
+    template<typename L, VectorExpression R> requires (!VectorExpression<L>)
+    constexpr auto operator* (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_mul, TExprOperand<R, L>, R>(TExprOperand<R, L>(l), r);
+    }
+
+    template<VectorExpression L, typename R>
+    constexpr auto operator/ (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_div, L, TExprOperand<L, R>>(l, TExprOperand<L, R>(r));
+    }
+
+    template<typename L, VectorExpression R> requires (!VectorExpression<L>)
+    constexpr auto operator/ (const L& l, const R& r)
+    {
+        return TExprBinary<Detail::expr_div, TExprOperand<R, L>, R>(TExprOperand<R, L>(l), r);
+    }
+
+    // Matrix products. A column vector on the right ends the chain and is computed right away.
+
+    template<MatrixExpression L, MatrixExpression R>
+    constexpr TExprProduct<L, R> operator* (const L& l, const R& r)
+    {
+        return TExprProduct<L, R>(l, r);
+    }
+
+    template<MatrixExpression L>
+    constexpr TExprProduct<L, TExprMatrix<typename L::Result>> operator* (const L& l, const typename L::Result& m)
+    {
+        return TExprProduct<L, TExprMatrix<typename L::Result>>(l, TExprMatrix<typename L::Result>(m));
+    }
+
+    template<MatrixExpression R>
+    constexpr TExprProduct<TExprMatrix<typename R::Result>, R> operator* (const typename R::Result& m, const R& r)
+    {
+        return TExprProduct<TExprMatrix<typename R::Result>, R>(TExprMatrix<typename R::Result>(m), r);
+    }
+
+    template<MatrixExpression L>
+    typename L::Column operator* (const L& l, const typename L::Column& v);
+
+} // Phanes::Core::Math
+
+#endif // !EXPRESSION_H
+
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Vector4.hpp"
+#include "Core/Math/Matrix3.hpp"
+#include "Core/Math/Matrix4.hpp"
+
+#include "Core/Math/Expression.inl"
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/ExpressionDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+
+namespace Phanes::Core::Math
+{
+    // TExprVector
+
+    template<typename V>
+    typename V::Real TExprVector<V>::Lane(size_t i) const
+    {
+        return v.data[i];
+    }
+
+    template<typename V>
+    auto TExprVector<V>::Reg() const
+    {
+        return Detail::expr_compute<V>::load(v);
+    }
+
+    template<typename V>
+    TExprVector<V>::operator V() const
+    {
+        return v;
+    }
+
+
+    // TExprScalar
+
+    template<typename V>
+    typename V::Real TExprScalar<V>::Lane(size_t) const
+    {
+        return s;
+    }
+
+    template<typename V>
+    auto TExprScalar<V>::Reg() const
+    {
+        return Detail::expr_compute<V>::splat(s);
+    }
+
+    template<typename V>
+    TExprScalar<V>::operator V() const
+    {
+        return Evaluate(*this);
+    }
+
+
+    // TExprBinary
+
+    template<typename Op, VectorExpression L, VectorExpression R>
+    typename L::Real TExprBinary<Op, L, R>::Lane(size_t i) const
+    {
+        if constexpr (std::is_same_v<Op, Detail::expr_div> && std::is_same_v<R, TExprScalar<Result>>)
+        {
+            // Like the eager operator, which multiplies with the reciprocal without SIMD.
+            return l.Lane(i) * ((Real)1.0 / r.s);
+        }
+        else
+        {
+            return Op::Lane(l.Lane(i), r.Lane(i));
+        }
+    }
+
+    template<typename Op, VectorExpression L, VectorExpression R>
+    auto TExprBinary<Op, L, R>::Reg() const
+    {
+        return Op::template Reg<Detail::expr_compute<Result>>(l.Reg(), r.Reg());
+    }
+
+    template<typename Op, VectorExpression L, VectorExpression R>
+    TExprBinary<Op, L, R>::operator typename L::Result() const
+    {
+        return Evaluate(*this);
+    }
+
+    template<VectorExpression E>
+    typename E::Result Evaluate(const E& e)
+    {
+        using V = typename E::Result;
+
+        V r;
+
+        if constexpr (Detail::expr_vector_traits<V>::Aligned)
+        {
+            Detail::expr_compute<V>::store(r, e.Reg());
+        }
+        else
+        {
+            // One pass over the components.
+            for (size_t i = 0; i < Detail::expr_vector_traits<V>::Dim; i++)
+            {
+                r.data[i] = e.Lane(i);
+            }
+
+            if constexpr (Detail::expr_vector_traits<V>::Dim == 3)
+            {
+                r.w = (typename E::Real)0.0;
+            }
+        }
+
+        return r;
+    }
+
+
+    // TExprMatrix
+
+    template<typename M>
+    typename TExprMatrix<M>::Column TExprMatrix<M>::MulVec(const Column& v) const
+    {
+        return m * v;
+    }
+
+    template<typename M>
+    const M& TExprMatrix<M>::Get() const
+    {
+        return m;
+    }
+
+    template<typename M>
+    TExprMatrix<M>::operator M() const
+    {
+        return m;
+    }
+
+
+    // TExprProduct
+
+    template<MatrixExpression L, MatrixExpression R>
+    typename L::Column TExprProduct<L, R>::MulVec(const Column& v) const
+    {
+        return l.MulVec(r.MulVec(v));
+    }
+
+    template<MatrixExpression L, MatrixExpression R>
+    typename L::Result TExprProduct<L, R>::Get() const
+    {
+        return l.Get() * r.Get();
+    }
+
+    template<MatrixExpression L, MatrixExpression R>
+    TExprProduct<L, R>::operator typename L::Result() const
+    {
+        return Get();
+    }
+
+    template<MatrixExpression E>
+    typename E::Result Evaluate(const E& e)
+    {
+        return e.Get();
+    }
+
+    template<MatrixExpression L>
+    typename L::Column operator* (const L& l, const typename L::Column& v)
+    {
+        return l.MulVec(v);
+    }
+}
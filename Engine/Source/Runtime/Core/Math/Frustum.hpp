@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/AABB.hpp"
+#include "Core/Math/Matrix4.hpp"
+#include "Core/Math/Plane.hpp"
+#include "Core/Math/Sphere.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+namespace Phanes::Core::Math
+{
+
+    // View frustum, described by six planes with normals pointing inwards.
+    // A point p is inside, if PointDistance(plane, p) >= 0 for all planes.
+
+    template<RealType T, bool S>
+    struct TFrustum
+    {
+    public:
+        using Real = T;
+
+        /** Planes in the order left, right, bottom, top, near, far. */
+        TPlane<Real, S> planes[6];
+
+    public:
+        /** Default constructor */
+        TFrustum() = default;
+
+        /**
+         * Extracts the frustum planes from a view projection matrix (Gribb / Hartmann).
+         *
+         * @param(m) View projection matrix (column vectors, clip = m * p)
+         * @param(zeroToOne) True, if clip space depth is in [0, w] (Vulkan / D3D) and false, if in [-w, w] (OpenGL)
+         *
+         * @note The planes are normalized.
+         */
+
+        explicit TFrustum(const TMatrix4<Real, S>& m, bool zeroToOne = true);
+    };
+
+    // ====================== //
+    //   TFrustum functions   //
+    // ====================== //
+
+    /**
+     * Tests if a point is inside the frustum.
+     *
+     * @param(f) Frustum
+     * @param(p1) Point
+     *
+     * @return True, if inside and false, if not.
+     */
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TVector3<T, S>& p1);
+
+    /**
+     * Tests if a box is (partly) inside the frustum.
+     *
+     * @param(f) Frustum
+     * @param(b1) Box
+     *
+     * @return False, if the box is fully outside of one plane.
+     * @note Conservative: boxes outside the frustum near its corners can still be reported as visible.
+     */
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TAABB<T, S>& b1);
+
+    /**
+     * Tests if a sphere is (partly) inside the frustum.
+     *
+     * @param(f) Frustum
+     * @param(s1) Sphere
+     *
+     * @return False, if the sphere is fully outside of one plane.
+     * @note Conservative: spheres outside the frustum near its corners can still be reported as visible.
+     */
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TSphere<T, S>& s1);
+
+    /**
+     * Culls an array of boxes. With SIMD four (SSE) or eight (AVX) boxes are tested against all planes at once.
+     *
+     * @param(f) Frustum
+     * @param(b) Boxes
+     * @param(count) Number of boxes
+     * @param(visible) Bit mask with (count + 31) / 32 words. Bit i (visible[i / 32] >> (i % 32)) is set, if box i is visible.
+     *
+     * @return Number of visible boxes.
+     */
+
+    template<RealType T, bool S>
+    size_t IsVisible(const TFrustum<T, S>& f, const TAABB<T, S>* b, size_t count, Phanes::Core::Types::uint32* visible);
+
+    /**
+     * Culls an array of spheres. With SIMD four (SSE) or eight (AVX) spheres are tested against all planes at once.
+     *
+     * @param(f) Frustum
+     * @param(s) Spheres
+     * @param(count) Number of spheres
+     * @param(visible) Bit mask with (count + 31) / 32 words. Bit i (visible[i / 32] >> (i % 32)) is set, if sphere i is visible.
+     *
+     * @return Number of visible spheres.
+     */
+
+    template<RealType T, bool S>
+    size_t IsVisible(const TFrustum<T, S>& f, const TSphere<T, S>* s, size_t count, Phanes::Core::Types::uint32* visible);
+
+} // Phanes::Core::Math
+
+#endif // FRUSTUM_H
+
+#include "Core/Math/Frustum.inl"
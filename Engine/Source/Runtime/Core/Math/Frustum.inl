@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/FrustumDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+namespace Phanes::Core::Math
+{
+    template<RealType T, bool S>
+    TFrustum<T, S>::TFrustum(const TMatrix4<Real, S>& m, bool zeroToOne)
+    {
+        // Row i of m gives clip coordinate i. Inside is -w <= x <= w, -w <= y <= w and 0 (or -w) <= z <= w, so every plane
+        // is a * x + b * y + c * z + e >= 0 with (a, b, c, e) = row 3 +/- another row, i.e. normal (a, b, c) and d = -e.
+        constexpr int row[6] = { 0, 0, 1, 1, 2, 2 };
+        constexpr T sign[6] = { (T)1.0, (T)-1.0, (T)1.0, (T)-1.0, (T)1.0, (T)-1.0 };
+
+        for (int i = 0; i < 6; i++)
+        {
+            T w = (i == 4 && zeroToOne) ? (T)0.0 : (T)1.0;
+
+            T a = w * m(3, 0) + sign[i] * m(row[i], 0);
+            T b = w * m(3, 1) + sign[i] * m(row[i], 1);
+            T c = w * m(3, 2) + sign[i] * m(row[i], 2);
+            T e = w * m(3, 3) + sign[i] * m(row[i], 3);
+
+            T invLength = (T)1.0 / sqrt(a * a + b * b + c * c);
+
+            planes[i] = TPlane<T, S>(a * invLength, b * invLength, c * invLength, -e * invLength);
+        }
+    }
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TVector3<T, S>& p1)
+    {
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            if (pl.x * p1.x + pl.y * p1.y + pl.z * p1.z < pl.d)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TAABB<T, S>& b1)
+    {
+        // Distance of the corner furthest along the normal: n * center + |n| * extents.
+        T cx = (b1.min.x + b1.max.x) * (T)0.5;
+        T cy = (b1.min.y + b1.max.y) * (T)0.5;
+        T cz = (b1.min.z + b1.max.z) * (T)0.5;
+        T ex = (b1.max.x - b1.min.x) * (T)0.5;
+        T ey = (b1.max.y - b1.min.y) * (T)0.5;
+        T ez = (b1.max.z - b1.min.z) * (T)0.5;
+
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            if (pl.x * cx + pl.y * cy + pl.z * cz + Abs(pl.x) * ex + Abs(pl.y) * ey + Abs(pl.z) * ez < pl.d)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<RealType T, bool S>
+    bool IsVisible(const TFrustum<T, S>& f, const TSphere<T, S>& s1)
+    {
+        for (const TPlane<T, S>& pl : f.planes)
+        {
+            if (pl.x * s1.x + pl.y * s1.y + pl.z * s1.z + s1.radius < pl.d)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<RealType T, bool S>
+    size_t IsVisible(const TFrustum<T, S>& f, const TAABB<T, S>* b, size_t count, Phanes::Core::Types::uint32* visible)
+    {
+        return Detail::compute_frustum_batch_aabb<T, S>::map(f, b, count, visible);
+    }
+
+    template<RealType T, bool S>
+    size_t IsVisible(const TFrustum<T, S>& f, const TSphere<T, S>* s, size_t count, Phanes::Core::Types::uint32* visible)
+    {
+        return Detail::compute_frustum_batch_sphere<T, S>::map(f, s, count, visible);
+    }
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#include <bit>
+#include <span>
+#include <type_traits>
+
+#ifndef HALF_VECTOR_H
+#define HALF_VECTOR_H
+
+namespace Phanes::Core::Math {
+
+    // Half precision (IEEE 754 binary16) storage of 2D, 3D and 4D vectors.
+    //
+    // Half vectors are for storage only (vertex streams, animation tracks, ...), there is no arithmetic on them. They hold
+    // 2, 3 or 4 halfs (4, 6 or 8 bytes) instead of the 16 or 32 bytes of TVector2 / 3 / 4 and are converted with Pack and
+    // Unpack. Builds with P_F16C__ (and the dispatch tier AVX2) convert with F16C, all others use FloatToHalf and
+    // HalfToFloat, which give the same bits.
+    //
+    // Half has 11 significant bits, 65504 is the largest finite value and 2^-24 the smallest subnormal. Larger values pack
+    // to infinity. T is the type the vector unpacks to, doubles are rounded to float first.
+
+    /// <summary>
+    /// Converts a float to half precision. Rounds to nearest even, values beyond 65504 become infinity, NaN stays NaN (quiet).
+    /// </summary>
+    /// <param name="f">Value</param>
+    /// <returns>Bits of the half</returns>
+    constexpr Phanes::Core::Types::uint16 FloatToHalf(float f)
+    {
+        Phanes::Core::Types::uint32 b = std::bit_cast<Phanes::Core::Types::uint32>(f);
+        Phanes::Core::Types::uint32 sign = (b >> 16) & 0x8000u;
+        Phanes::Core::Types::uint32 a = b & 0x7FFFFFFFu;
+
+        // Inf and NaN, the quiet bit is set like vcvtps2ph does.
+        if (a >= 0x7F800000u)
+        {
+            return (Phanes::Core::Types::uint16)(sign | 0x7C00u | ((a > 0x7F800000u) ? (0x0200u | ((a >> 13) & 0x03FFu)) : 0u));
+        }
+
+        // 65520 and above round to infinity.
+        if (a >= 0x477FF000u)
+        {
+            return (Phanes::Core::Types::uint16)(sign | 0x7C00u);
+        }
+
+        // Below 2^-14 the result is subnormal: mantissa * 2^(e - 126) in units of 2^-24.
+        if (a < 0x38800000u)
+        {
+            Phanes::Core::Types::uint32 e = a >> 23;
+            if (e < 102)
+            {
+                return (Phanes::Core::Types::uint16)sign;
+            }
+
+            Phanes::Core::Types::uint32 m = (a & 0x007FFFFFu) | 0x00800000u;
+            Phanes::Core::Types::uint32 shift = 126 - e;
+            Phanes::Core::Types::uint32 h = m >> shift;
+            Phanes::Core::Types::uint32 rem = m & ((1u << shift) - 1);
+            Phanes::Core::Types::uint32 halfway = 1u << (shift - 1);
+
+            h += (rem > halfway || (rem == halfway && (h & 1))) ? 1 : 0;
+            return (Phanes::Core::Types::uint16)(sign | h);
+        }
+
+        // Rebias the exponent, a carry out of the mantissa moves into the exponent.
+        Phanes::Core::Types::uint32 h = (a - 0x38000000u) >> 13;
+        Phanes::Core::Types::uint32 rem = a & 0x1FFFu;
+
+        h += (rem > 0x1000u || (rem == 0x1000u && (h & 1))) ? 1 : 0;
+        return (Phanes::Core::Types::uint16)(sign | h);
+    }
+
+    /// <summary>
+    /// Converts a half to float. Exact, NaN stays NaN (quiet).
+    /// </summary>
+    /// <param name="h">Bits of the half</param>
+    /// <returns>Value</returns>
+    constexpr float HalfToFloat(Phanes::Core::Types::uint16 h)
+    {
+        Phanes::Core::Types::uint32 sign = (Phanes::Core::Types::uint32)(h & 0x8000u) << 16;
+        Phanes::Core::Types::uint32 e = (h >> 10) & 0x1Fu;
+        Phanes::Core::Types::uint32 m = h & 0x03FFu;
+
+        if (e == 0x1F)
+        {
+            return std::bit_cast<float>(sign | 0x7F800000u | (m << 13) | (m ? 0x00400000u : 0u));
+        }
+
+        if (e == 0)
+        {
+            // Subnormal (or zero): m * 2^-24, exact in float.
+            float f = (float)m * 5.9604644775390625e-8f;
+            return sign ? -f : f;
+        }
+
+        return std::bit_cast<float>(sign | ((e + 112) << 23) | (m << 13));
+    }
+
+
+    // 2D half vector (x, y)
+
+    template<RealType T>
+    struct THalfVector2 {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// X component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 x;
+
+        /// <summary>
+        /// Y component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 y;
+
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        THalfVector2() = default;
+
+        /// <summary>
+        /// Packs v.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        template<bool S>
+        explicit THalfVector2(const TVector2<T, S>& v);
+
+        /// <summary>
+        /// Unpacks the vector.
+        /// </summary>
+        /// <typeparam name="S">Result is aligned?</typeparam>
+        template<bool S = false>
+        TVector2<T, S> Get() const;
+    };
+
+    // 3D half vector (x, y, z)
+
+    template<RealType T>
+    struct THalfVector3 {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// X component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 x;
+
+        /// <summary>
+        /// Y component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 y;
+
+        /// <summary>
+        /// Z component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 z;
+
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        THalfVector3() = default;
+
+        /// <summary>
+        /// Packs v.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        template<bool S>
+        explicit THalfVector3(const TVector3<T, S>& v);
+
+        /// <summary>
+        /// Unpacks the vector, straight into a register for aligned vectors.
+        /// </summary>
+        /// <typeparam name="S">Result is aligned?</typeparam>
+        template<bool S = false>
+        TVector3<T, S> Get() const;
+    };
+
+    // 4D half vector (x, y, z, w)
+
+    template<RealType T>
+    struct THalfVector4 {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// X component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 x;
+
+        /// <summary>
+        /// Y component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 y;
+
+        /// <summary>
+        /// Z component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 z;
+
+        /// <summary>
+        /// W component (half bits)
+        /// </summary>
+        Phanes::Core::Types::uint16 w;
+
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        THalfVector4() = default;
+
+        /// <summary>
+        /// Packs v.
+        /// </summary>
+        /// <param name="v">Vector</param>
+        template<bool S>
+        explicit THalfVector4(const TVector4<T, S>& v);
+
+        /// <summary>
+        /// Unpacks the vector, straight into a register for aligned vectors.
+        /// </summary>
+        /// <typeparam name="S">Result is aligned?</typeparam>
+        template<bool S = false>
+        TVector4<T, S> Get() const;
+    };
+
+
+    // ======================== //
+    //   THalfVector operators  //
+    // ======================== //
+
+    /// <summary>
+    /// Bitwise equality. +0 and -0 differ, NaNs with the same bits are equal.
+    /// </summary>
+    template<RealType T>
+    constexpr bool operator== (const THalfVector2<T>& v1, const THalfVector2<T>& v2)
+    {
+        return v1.x == v2.x && v1.y == v2.y;
+    }
+
+    /// <summary>
+    /// Bitwise equality. +0 and -0 differ, NaNs with the same bits are equal.
+    /// </summary>
+    template<RealType T>
+    constexpr bool operator== (const THalfVector3<T>& v1, const THalfVector3<T>& v2)
+    {
+        return v1.x == v2.x && v1.y == v2.y && v1.z == v2.z;
+    }
+
+    /// <summary>
+    /// Bitwise equality. +0 and -0 differ, NaNs with the same bits are equal.
+    /// </summary>
+    template<RealType T>
+    constexpr bool operator== (const THalfVector4<T>& v1, const THalfVector4<T>& v2)
+    {
+        return v1.x == v2.x && v1.y == v2.y && v1.z == v2.z && v1.w == v2.w;
+    }
+
+
+    // ============================ //
+    //   Pack / Unpack (batches)    //
+    // ============================ //
+
+    /// <summary>
+    /// Converts v to half precision, e.g. a stream of a TVector3SoA.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Halfs, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Values</param>
+    template<RealType T>
+    void Pack(std::span<Phanes::Core::Types::uint16> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Converts halfs back to T.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Values, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Halfs</param>
+    template<RealType T>
+    void Unpack(std::span<T> r, std::span<const Phanes::Core::Types::uint16> v);
+
+    /// <summary>
+    /// Packs count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count half vectors</param>
+    /// <param name="v">Array of vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Pack(THalfVector2<T>* r, const TVector2<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Packs count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count half vectors</param>
+    /// <param name="v">Array of vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Pack(THalfVector3<T>* r, const TVector3<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Packs count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count half vectors</param>
+    /// <param name="v">Array of vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Pack(THalfVector4<T>* r, const TVector4<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Unpacks count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count vectors</param>
+    /// <param name="v">Array of half vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Unpack(TVector2<T, S>* r, const THalfVector2<T>* v, size_t count);
+
+    /// <summary>
+    /// Unpacks count vectors. w of the result is zero.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count vectors</param>
+    /// <param name="v">Array of half vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const THalfVector3<T>* v, size_t count);
+
+    /// <summary>
+    /// Unpacks count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count vectors</param>
+    /// <param name="v">Array of half vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Unpack(TVector4<T, S>* r, const THalfVector4<T>* v, size_t count);
+
+} // Phanes::Core::Math
+
+#endif // !HALF_VECTOR_H
+
+#include "Core/Math/Vector2.hpp"
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Vector4.hpp"
+
+#include "Core/Math/HalfVector.inl"
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/HalfVectorDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <algorithm>
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(THalfVector2<float>) == 4 && sizeof(THalfVector3<float>) == 6 && sizeof(THalfVector4<float>) == 8);
+
+    template<RealType T>
+    template<bool S>
+    THalfVector2<T>::THalfVector2(const TVector2<T, S>& v)
+    {
+        Detail::compute_half2_pack<T, S>::map(this, &v, 1);
+    }
+
+    template<RealType T>
+    template<bool S>
+    TVector2<T, S> THalfVector2<T>::Get() const
+    {
+        TVector2<T, S> r;
+        Detail::compute_half2_unpack<T, S>::map(&r, this, 1);
+        return r;
+    }
+
+    template<RealType T>
+    template<bool S>
+    THalfVector3<T>::THalfVector3(const TVector3<T, S>& v)
+    {
+        Detail::compute_half3_pack<T, S>::map(this, &v, 1);
+    }
+
+    template<RealType T>
+    template<bool S>
+    TVector3<T, S> THalfVector3<T>::Get() const
+    {
+        TVector3<T, S> r;
+        Detail::compute_half3_unpack<T, S>::map(&r, this, 1);
+        return r;
+    }
+
+    template<RealType T>
+    template<bool S>
+    THalfVector4<T>::THalfVector4(const TVector4<T, S>& v)
+    {
+        Detail::compute_half4_pack<T, S>::map(this, &v, 1);
+    }
+
+    template<RealType T>
+    template<bool S>
+    TVector4<T, S> THalfVector4<T>::Get() const
+    {
+        TVector4<T, S> r;
+        Detail::compute_half4_unpack<T, S>::map(&r, this, 1);
+        return r;
+    }
+
+
+    template<RealType T>
+    void Pack(std::span<Phanes::Core::Types::uint16> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_half_pack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void Unpack(std::span<T> r, std::span<const Phanes::Core::Types::uint16> v)
+    {
+        Detail::compute_half_unpack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T, bool S>
+    void Pack(THalfVector2<T>* r, const TVector2<T, S>* v, size_t count)
+    {
+        Detail::compute_half2_pack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Pack(THalfVector3<T>* r, const TVector3<T, S>* v, size_t count)
+    {
+        Detail::compute_half3_pack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Pack(THalfVector4<T>* r, const TVector4<T, S>* v, size_t count)
+    {
+        Detail::compute_half4_pack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Unpack(TVector2<T, S>* r, const THalfVector2<T>* v, size_t count)
+    {
+        Detail::compute_half2_unpack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const THalfVector3<T>* v, size_t count)
+    {
+        Detail::compute_half3_unpack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Unpack(TVector4<T, S>* r, const THalfVector4<T>* v, size_t count)
+    {
+        Detail::compute_half4_unpack<T, S>::map(r, v, count);
+    }
+}
@@ -9,6 +9,12 @@
 #include "Core/Math/Vector3.hpp"
 #include "Core/Math/Vector4.hpp"
 
+#include "Core/Math/Vector3SoA.hpp"
+#include "Core/Math/Vector4SoA.hpp"
+#include "Core/Math/HalfVector.hpp"
+#include "Core/Math/NormalEncoding.hpp"
+#include "Core/Math/LargeWorld.hpp"
+
 #include "Core/Math/IntVector2.hpp"
 #include "Core/Math/IntVector3.hpp"
 #include "Core/Math/IntVector4.hpp"
@@ -23,13 +29,32 @@
 #include "Core/Math/Matrix3.hpp"
 #include "Core/Math/Matrix4.hpp"
 
+// --- Rotations -----------------------
+
+#include "Core/Math/Quaternion.hpp"
+#include "Core/Math/Transform.hpp"
+
 // --- Other Math ----------------------
 
 #include "Core/Math/Plane.hpp"   
 #include "Core/Math/Line.hpp"   
+#include "Core/Math/Triangle.hpp"
+
+// --- Bounds and culling -------------
+
+#include "Core/Math/AABB.hpp"
+#include "Core/Math/Sphere.hpp"
+#include "Core/Math/Frustum.hpp"
+#include "Core/Math/RayPacket.hpp"
+#include "Core/Math/BVH.hpp"
+#include "Core/Math/SpatialHashGrid.hpp"
 
 
 // --- Misc -----------------
 
 #include "Core/Math/MathTypeConversion.hpp"
 #include "Core/Math/MathUnitConversion.hpp"
+#include "Core/Math/Transcendental.hpp"
+#include "Core/Math/Expression.hpp"
+
+// Archive.hpp is included on its own: the memory mapping pulls in <windows.h> / the POSIX headers.
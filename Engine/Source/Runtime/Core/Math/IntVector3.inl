@@ -383,14 +383,14 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector3<T, S>& operator++(TIntVector3<T, S>& v1)
     {
-        Detail::compute_ivec3_inc<T, S>::map(v1);
+        Detail::compute_ivec3_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<IntType T, bool S>
     TIntVector3<T, S>& operator--(TIntVector3<T, S>& v1)
     {
-        Detail::compute_ivec3_inc<T, S>::map(v1);
+        Detail::compute_ivec3_dec<T, S>::map(v1, v1);
         return v1;
     }
 
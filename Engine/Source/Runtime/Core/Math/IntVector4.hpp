@@ -630,6 +630,171 @@ namespace Phanes::Core::Math {
         return (abs(DotP(v1, v2)) == 0);
     }
 
+
+    // ==================== //
+    //   Batch operations   //
+    // ==================== //
+
+    /// <summary>
+    /// Adds count vectors component wise: r[i] = v1[i] + v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchAdd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Adds count vectors and a scalar: r[i] = v1[i] + s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchAdd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Subtracts count vectors component wise: r[i] = v1[i] - v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchSub(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Subtracts count vectors and a scalar: r[i] = v1[i] - s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchSub(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Multiplies count vectors component wise: r[i] = v1[i] * v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchMul(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Multiplies count vectors and a scalar: r[i] = v1[i] * s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchMul(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Bitwise and of count vectors component wise: r[i] = v1[i] & v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchAnd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Bitwise and of count vectors and a scalar: r[i] = v1[i] & s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchAnd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Bitwise or of count vectors component wise: r[i] = v1[i] | v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchOr(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Bitwise or of count vectors and a scalar: r[i] = v1[i] | s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchOr(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Bitwise xor of count vectors component wise: r[i] = v1[i] ^ v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchXor(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Bitwise xor of count vectors and a scalar: r[i] = v1[i] ^ s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchXor(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Left shift of count vectors component wise: r[i] = v1[i] << v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchLeftShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Left shift of count vectors and a scalar: r[i] = v1[i] << s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchLeftShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
+    /// <summary>
+    /// Right shift of count vectors component wise: r[i] = v1[i] >> v2[i].
+    /// </summary>
+    /// <param name="r">Result array, may alias v1 or v2.</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchRightShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count);
+
+    /// <summary>
+    /// Right shift of count vectors and a scalar: r[i] = v1[i] >> s.
+    /// </summary>
+    /// <param name="r">Result array, may alias v1.</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    /// <param name="count">Number of vectors</param>
+    template<IntType T, bool S>
+    void BatchRightShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count);
+
 } // phanes::core::math::coretypes
 
 
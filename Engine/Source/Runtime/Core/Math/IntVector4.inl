@@ -382,14 +382,14 @@ namespace Phanes::Core::Math
     template<IntType T, bool S>
     TIntVector4<T, S>& operator++(TIntVector4<T, S>& v1)
     {
-        Detail::compute_ivec4_inc<T, S>::map(v1);
+        Detail::compute_ivec4_inc<T, S>::map(v1, v1);
         return v1;
     }
 
     template<IntType T, bool S>
     TIntVector4<T, S>& operator--(TIntVector4<T, S>& v1)
     {
-        Detail::compute_ivec4_inc<T, S>::map(v1);
+        Detail::compute_ivec4_dec<T, S>::map(v1, v1);
         return v1;
     }
 
@@ -404,4 +404,103 @@ namespace Phanes::Core::Math
     {
         return --v1;
     }
+
+
+    // Batch operations
+
+    template<IntType T, bool S>
+    void BatchAdd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_add<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchAdd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_add<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchSub(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_sub<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchSub(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_sub<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchMul(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_mul<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchMul(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_mul<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchAnd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_and<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchAnd(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_and<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchOr(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_or<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchOr(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_or<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchXor(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_xor<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchXor(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_xor<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchLeftShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_left_shift<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchLeftShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_left_shift<T, S>::map(r, v1, s, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchRightShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, const TIntVector4<T, S>* v2, size_t count)
+    {
+        Detail::compute_ivec4_batch_right_shift<T, S>::map(r, v1, v2, count);
+    }
+
+    template<IntType T, bool S>
+    void BatchRightShift(TIntVector4<T, S>* r, const TIntVector4<T, S>* v1, T s, size_t count)
+    {
+        Detail::compute_ivec4_batch_right_shift<T, S>::map(r, v1, s, count);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#ifndef LARGE_WORLD_H
+#define LARGE_WORLD_H
+
+namespace Phanes::Core::Math {
+
+    // Large world coordinates.
+    //
+    // Floats resolve about 1 cm at 100 km from the origin and 1 m at 10000 km. Worlds larger than that keep positions in
+    // double (WorldPosition, TVector3<double, S>) and render relative to an origin near the camera, in float:
+    //
+    //      origin = SnapOrigin(camera, 1024.0);
+    //      ToRenderSpace(renderPositions, worldPositions, count, origin);      Subtract in double, convert to float.
+    //
+    // When the camera moves far enough, the origin moves and render space arrays are shifted with Rebase instead of
+    // converting them again. Rebase adds (from - to) in float and rounds once per move, arrays that are rebased many
+    // times should be converted from the world positions again now and then.
+    //
+    // The batch conversion is SSE2 (cvtpd2ps) in SSE builds and AVX (vcvtpd2ps ymm) in AVX builds, for both aligned and
+    // unaligned world positions. It needs aligned render space vectors (TVector3<float, true>), all others use the
+    // scalar path.
+
+    /// <summary>
+    /// Converts a world position into render space.
+    /// </summary>
+    /// <typeparam name="SR">Result is aligned?</typeparam>
+    /// <param name="p">World position</param>
+    /// <param name="origin">Origin of render space</param>
+    /// <returns>p - origin in float.</returns>
+    template<bool SR = SIMD::use_simd<float, 3, true>::value, bool SW>
+    TVector3<float, SR> ToRenderSpace(const TVector3<double, SW>& p, const TVector3<double, SW>& origin);
+
+    /// <summary>
+    /// Converts count world positions into render space.
+    /// </summary>
+    /// <typeparam name="SR">Result is aligned?</typeparam>
+    /// <typeparam name="SW">World positions are aligned?</typeparam>
+    /// <param name="r">Array of at least count render space positions</param>
+    /// <param name="p">Array of world positions</param>
+    /// <param name="count">Number of positions</param>
+    /// <param name="origin">Origin of render space</param>
+    template<bool SR, bool SW>
+    void ToRenderSpace(TVector3<float, SR>* r, const TVector3<double, SW>* p, size_t count, const TVector3<double, SW>& origin);
+
+    /// <summary>
+    /// Converts a render space position back into world space.
+    /// </summary>
+    /// <param name="v">Render space position</param>
+    /// <param name="origin">Origin of render space</param>
+    /// <returns>v + origin in double.</returns>
+    template<bool SR, bool SW>
+    TVector3<double, SW> ToWorldSpace(const TVector3<float, SR>& v, const TVector3<double, SW>& origin);
+
+    /// <summary>
+    /// Moves count render space positions from one origin to another, r + (from - to).
+    /// </summary>
+    /// <typeparam name="SR">Render space positions are aligned?</typeparam>
+    /// <param name="r">Array of render space positions, relative to from</param>
+    /// <param name="count">Number of positions</param>
+    /// <param name="from">Current origin</param>
+    /// <param name="to">New origin</param>
+    template<bool SR, bool SW>
+    void Rebase(TVector3<float, SR>* r, size_t count, const TVector3<double, SW>& from, const TVector3<double, SW>& to);
+
+    /// <summary>
+    /// Snaps a position to a grid, for origins that only move in steps. With a power of two cell size the difference
+    /// between two snapped origins is exact in float (up to 2^24 cells).
+    /// </summary>
+    /// <param name="p">Position, e.g. of the camera</param>
+    /// <param name="cellSize">Size of grid cells</param>
+    /// <returns>Nearest grid point.</returns>
+    template<bool SW>
+    TVector3<double, SW> SnapOrigin(const TVector3<double, SW>& p, double cellSize);
+
+} // Phanes::Core::Math
+
+#endif // !LARGE_WORLD_H
+
+#include "Core/Math/Vector3.hpp"
+
+#include "Core/Math/LargeWorld.inl"
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/LargeWorldDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <cmath>
+
+
+namespace Phanes::Core::Math
+{
+    template<bool SR, bool SW>
+    TVector3<float, SR> ToRenderSpace(const TVector3<double, SW>& p, const TVector3<double, SW>& origin)
+    {
+        TVector3<float, SR> r;
+        Detail::compute_world_to_render<float, SR>::map(&r, &p, origin, 1);
+        return r;
+    }
+
+    template<bool SR, bool SW>
+    void ToRenderSpace(TVector3<float, SR>* r, const TVector3<double, SW>* p, size_t count, const TVector3<double, SW>& origin)
+    {
+        Detail::compute_world_to_render<float, SR>::map(r, p, origin, count);
+    }
+
+    template<bool SR, bool SW>
+    TVector3<double, SW> ToWorldSpace(const TVector3<float, SR>& v, const TVector3<double, SW>& origin)
+    {
+        return TVector3<double, SW>(origin.x + (double)v.x, origin.y + (double)v.y, origin.z + (double)v.z);
+    }
+
+    template<bool SR, bool SW>
+    void Rebase(TVector3<float, SR>* r, size_t count, const TVector3<double, SW>& from, const TVector3<double, SW>& to)
+    {
+        // Difference of the origins in double, only the sum is rounded.
+        TVector3<float, SR> delta = ToRenderSpace<SR>(from, to);
+        Detail::compute_render_rebase<float, SR>::map(r, delta, count);
+    }
+
+    template<bool SW>
+    TVector3<double, SW> SnapOrigin(const TVector3<double, SW>& p, double cellSize)
+    {
+        return TVector3<double, SW>(std::round(p.x / cellSize) * cellSize, std::round(p.y / cellSize) * cellSize, std::round(p.z / cellSize) * cellSize);
+    }
+}
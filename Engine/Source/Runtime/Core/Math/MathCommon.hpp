@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Core/Math/MathPCH.h"
+#include "Core/Math/SIMD/Platform.h"
+
+#if P_SSE__
+#   include <xmmintrin.h>
+#endif
 
 #define P_FLT_INAC_LARGE		0.0001f						// large float inaccuracy (1*10^-4);
 #define P_FLT_INAC				0.00001f					// float inaccuracy (1*10^-5);
@@ -102,35 +107,109 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Calculates the reciprocal of the square root of n using the algorithm of A Quake III
+     * Approximates the reciprocal of the square root of n.
      * 
-     * @param n Number to calculate
+     * @param(n) Number, must be greater than zero
      * 
-     * @return Inverse square root of n 
+     * @return Approximated inverse square root of n
      * 
-     * @note a simple 1.0f / sqrtf(x) is faster than this algorithm. Use for research purpose only.
+     * @note Float uses the SSE estimate (rsqrtss), max. relative error 1.5 * 2^-12 (6144 ULP). Refine (default) adds one
+     *       Newton-Raphson step, which brings it down to 4 ULP. Double and FPU builds compute 1 / sqrt(n) exactly.
      */
 
+    template<bool Refine = true, typename T>
+    inline T FastInvSqrt(T n)
+    {
+#if P_SSE__
+        if constexpr (std::is_same_v<T, float>)
+        {
+            float r = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(n)));
+
+            if constexpr (Refine)
+            {
+                r = r * (1.5f - 0.5f * n * r * r);
+            }
+
+            return r;
+        }
+#endif
+        return (T)1.0 / sqrt(n);
+    }
 
-    template<typename T>
-    float FastInvSqrt(T n)
+    /**
+     * Approximates the reciprocal of n.
+     * 
+     * @param(n) Number, must not be zero
+     * 
+     * @return Approximated 1 / n
+     * 
+     * @note Float uses the SSE estimate (rcpss), max. relative error 1.5 * 2^-12 (6144 ULP). Refine (default) adds one
+     *       Newton-Raphson step, which brings it down to 4 ULP. Double and FPU builds compute 1 / n exactly.
+     */
+
+    template<bool Refine = true, typename T>
+    inline T FastRecip(T n)
     {
-        int i = *(int*)&n;
-        float x2 = n * 0.5f;
+#if P_SSE__
+        if constexpr (std::is_same_v<T, float>)
+        {
+            float r = _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(n)));
+
+            if constexpr (Refine)
+            {
+                r = r * (2.0f - n * r);
+            }
+
+            return r;
+        }
+#endif
+        return (T)1.0 / n;
+    }
 
-        i = 0x5f3759df - (i >> 1);
-        n = *(float*)&i;
-        n = n * (1.5f - (x2 * n * n));
+    /**
+     * Shifts v left by count bits like the SIMD variable shifts (vpsllvd / vpsllvq).
+     *
+     * @param(v) Integer
+     * @param(count) Number of bits, taken as unsigned
+     *
+     * @return v << count, 0 if count is not in [0, bits of T)
+     */
 
-        return n;
+    template<typename T>
+    constexpr T ShiftLeft(T v, T count)
+    {
+        using U = std::make_unsigned_t<T>;
+        return ((U)count < sizeof(T) * 8) ? (T)((U)v << count) : (T)0;
     }
 
+    /**
+     * Shifts v right by count bits like the SIMD variable shifts (vpsravd / vpsrlvq). Signed integers shift arithmetically.
+     *
+     * @param(v) Integer
+     * @param(count) Number of bits, taken as unsigned
+     *
+     * @return v >> count. If count is not in [0, bits of T), all bits are the sign of v (signed) or 0 (unsigned).
+     */
 
+    template<typename T>
+    constexpr T ShiftRight(T v, T count)
+    {
+        using U = std::make_unsigned_t<T>;
+        if constexpr (std::is_signed_v<T>)
+        {
+            return (T)(v >> (((U)count < sizeof(T) * 8) ? count : (T)(sizeof(T) * 8 - 1)));
+        }
+        else
+        {
+            return ((U)count < sizeof(T) * 8) ? (T)(v >> count) : (T)0;
+        }
+    }
 
     template<typename T>
-    inline T Abs(T s)
+    constexpr T Abs(T s)
     {
-        return abs(s);
+        // Unqualified abs() may resolve to int abs(int) and truncate floating point values.
+        return (s < (T)0) ? -s : s;
     }
 
     template<typename T>
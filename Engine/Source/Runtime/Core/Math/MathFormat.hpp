@@ -0,0 +1,210 @@
+#pragma once
+
+// ============================================= //
+//     fmt / spdlog formatters for math types    //
+//												 //
+//	 @ref [FILE]MathTypeConversion				 //
+// ============================================= //
+
+// Lets spdlog (and fmt::format) write math types straight into their buffers, without building std::string:
+//
+//      PENGINE_LOG_TRACE("model: {}", m);            Same text as ToString(m).
+//      PENGINE_LOG_TRACE("p: {:.3f}", p);            The format spec is applied to every component.
+//
+// The layout is the same as ToString: "(x, y, z)" for vectors, planes ("(x, y, z, d)") and quaternions
+// ("(x, y, z, w)"), matrices row by row "([m00, m01], [m10, m11])".
+//
+// Uses the fmt spdlog is configured with (bundled, external or std::format with SPDLOG_USE_STD_FORMAT).
+
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathTypeConversion.hpp"
+
+#include <type_traits>
+
+#if __has_include(<spdlog/fmt/fmt.h>)
+#   include <spdlog/fmt/fmt.h>
+#else
+#   include <fmt/format.h>
+#endif
+
+#ifndef MATH_FORMAT_H
+#define MATH_FORMAT_H
+
+#ifdef SPDLOG_USE_STD_FORMAT
+#   define P_MATH_FMT_NAMESPACE std
+#else
+#   define P_MATH_FMT_NAMESPACE fmt
+#endif
+
+
+namespace Phanes::Core::Math::Detail
+{
+    /// <summary>
+    /// Base of the formatters. Parses the format spec of T and writes every component with it. An empty spec writes
+    /// reals like ToString (fixed, six decimals).
+    /// </summary>
+    /// <typeparam name="T">Type of the components</typeparam>
+    template<typename T>
+    struct math_formatter : P_MATH_FMT_NAMESPACE::formatter<T>
+    {
+        bool plain = false;
+
+        template<typename ParseContext>
+        constexpr auto parse(ParseContext& ctx)
+        {
+            plain = (ctx.begin() == ctx.end() || *ctx.begin() == '}');
+            return P_MATH_FMT_NAMESPACE::formatter<T>::parse(ctx);
+        }
+
+        template<typename FormatContext>
+        auto Put(FormatContext& ctx) const
+        {
+            return [this, &ctx](auto out, T v) {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    if (plain)
+                    {
+                        return P_MATH_FMT_NAMESPACE::format_to(out, "{:f}", v);
+                    }
+                }
+
+                ctx.advance_to(out);
+                return P_MATH_FMT_NAMESPACE::formatter<T>::format(v, ctx);
+            };
+        }
+    };
+}
+
+
+namespace P_MATH_FMT_NAMESPACE
+{
+    // ======================= //
+    //   Vectors               //
+    // ======================= //
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TVector2<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TVector2<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y);
+        }
+    };
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TVector3<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TVector3<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y, v.z);
+        }
+    };
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TVector4<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TVector4<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y, v.z, v.w);
+        }
+    };
+
+    template<Phanes::Core::Math::IntType T, bool S>
+    struct formatter<Phanes::Core::Math::TIntVector2<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TIntVector2<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y);
+        }
+    };
+
+    template<Phanes::Core::Math::IntType T, bool S>
+    struct formatter<Phanes::Core::Math::TIntVector3<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TIntVector3<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y, v.z);
+        }
+    };
+
+    template<Phanes::Core::Math::IntType T, bool S>
+    struct formatter<Phanes::Core::Math::TIntVector4<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TIntVector4<T, S>& v, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), v.x, v.y, v.z, v.w);
+        }
+    };
+
+
+    // ======================= //
+    //   Matrices              //
+    // ======================= //
+
+    template<Phanes::Core::Math::RealType T>
+    struct formatter<Phanes::Core::Math::TMatrix2<T>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TMatrix2<T>& m, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_matrix<2, 2>(ctx.out(), this->Put(ctx), m);
+        }
+    };
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TMatrix3<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TMatrix3<T, S>& m, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_matrix<3, 3>(ctx.out(), this->Put(ctx), m);
+        }
+    };
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TMatrix4<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TMatrix4<T, S>& m, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_matrix<4, 4>(ctx.out(), this->Put(ctx), m);
+        }
+    };
+
+
+    // ======================= //
+    //   Plane, Quaternion     //
+    // ======================= //
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TPlane<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TPlane<T, S>& pl, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), pl.x, pl.y, pl.z, pl.d);
+        }
+    };
+
+    template<Phanes::Core::Math::RealType T, bool S>
+    struct formatter<Phanes::Core::Math::TQuaternion<T, S>> : Phanes::Core::Math::Detail::math_formatter<T>
+    {
+        template<typename FormatContext>
+        auto format(const Phanes::Core::Math::TQuaternion<T, S>& q, FormatContext& ctx) const
+        {
+            return Phanes::Core::Math::Detail::format_tuple(ctx.out(), this->Put(ctx), q.x, q.y, q.z, q.w);
+        }
+    };
+}
+
+#undef P_MATH_FMT_NAMESPACE
+
+#endif // !MATH_FORMAT_H
@@ -34,9 +34,6 @@ namespace Phanes::Core::Math
 	template <RealType T>
 	struct TLine;
 
-	template <RealType T>
-	struct TTransform;
-
 	template <RealType T>
 	struct TPoint2;
 
@@ -61,6 +58,9 @@ namespace Phanes::Core::Math
 	template <RealType T, bool S>
 	struct TQuaternion;
 
+	template <RealType T, bool S>
+	struct TTransform;
+
 	template <RealType T, bool S>
 	struct TMatrix3;
 
@@ -76,6 +76,27 @@ namespace Phanes::Core::Math
 	template <RealType T, bool S>
 	struct TVector4;
 
+	template <RealType T>
+	struct TVector3SoA;
+
+	template <RealType T>
+	struct TVector4SoA;
+
+	template <RealType T>
+	struct THalfVector2;
+
+	template <RealType T>
+	struct THalfVector3;
+
+	template <RealType T>
+	struct THalfVector4;
+
+	template <RealType T>
+	struct TOctNormal16;
+
+	template <RealType T>
+	struct TOctNormal8;
+
 	template <IntType T, bool S>
 	struct TIntVector2;
 
@@ -88,9 +109,42 @@ namespace Phanes::Core::Math
 	template <RealType T, bool S>
 	struct TPlane;
 
+	template <RealType T>
+	struct TPlaneHit;
+
 	template <RealType T, bool S>
 	struct TRay;
 
+	template <RealType T, bool S>
+	struct TAABB;
+
+	template <RealType T, bool S>
+	struct TSphere;
+
+	template <RealType T, bool S>
+	struct TFrustum;
+
+	template <RealType T, size_t L>
+	struct TRayPacket;
+
+	template <RealType T, bool S>
+	struct TTriangle;
+
+	template <RealType T>
+	struct TTriangleHit;
+
+	template <RealType T>
+	struct TTriangleSoA;
+
+	template <RealType T>
+	struct TBVHNode;
+
+	template <RealType T>
+	struct TBVH;
+
+	template <RealType T>
+	struct TSpatialHashGrid;
+
 	/**
      * Specific instantiation of forward declarations.
      */
@@ -145,6 +199,11 @@ namespace Phanes::Core::Math
 	using LongVector3 = TIntVector3<long, false>;
 	using Vector3l = TIntVector3<long, false>;
 
+	using IntVector3Reg = TIntVector3<int, SIMD::use_simd<int, 3, true>::value>;
+	using Vector3Regi = TIntVector3<int, SIMD::use_simd<int, 3, true>::value>;
+	using LongVector3Reg = TIntVector3<Phanes::Core::Types::int64, SIMD::use_simd<Phanes::Core::Types::int64, 3, true>::value>;
+	using Vector3Regl = TIntVector3<Phanes::Core::Types::int64, SIMD::use_simd<Phanes::Core::Types::int64, 3, true>::value>;
+
 	// IntVetor4
 
 	using IntVector4 = TIntVector4<int, false>;
@@ -152,6 +211,11 @@ namespace Phanes::Core::Math
 	using LongVector4 = TIntVector4<long, false>;
 	using Vector4l = TIntVector4<long, false>;
 
+	using IntVector4Reg = TIntVector4<int, SIMD::use_simd<int, 4, true>::value>;
+	using Vector4Regi = TIntVector4<int, SIMD::use_simd<int, 4, true>::value>;
+	using LongVector4Reg = TIntVector4<Phanes::Core::Types::int64, SIMD::use_simd<Phanes::Core::Types::int64, 4, true>::value>;
+	using Vector4Regl = TIntVector4<Phanes::Core::Types::int64, SIMD::use_simd<Phanes::Core::Types::int64, 4, true>::value>;
+
 	// Vector2
 
 	using Vector2 = TVector2<float, false>;
@@ -173,6 +237,10 @@ namespace Phanes::Core::Math
 	using Vector3Regd = TVector3<double, SIMD::use_simd<double, 3, true>::value>;
 	using Vector3Regf64 = TVector3<double, SIMD::use_simd<double, 3, true>::value>;
 
+	// Large world positions (see LargeWorld.hpp)
+
+	using WorldPosition = TVector3<double, SIMD::use_simd<double, 3, true>::value>;
+
 	// Vector4
 
 	using Vector4 = TVector4<float, false>;
@@ -184,6 +252,37 @@ namespace Phanes::Core::Math
 	using Vector4Regd = TVector4<double, SIMD::use_simd<double, 4, true>::value>;
 	using Vector4Regf64 = TVector4<double, SIMD::use_simd<double, 4, true>::value>;
 
+	// Vector3SoA
+
+	using Vector3SoA = TVector3SoA<float>;
+	using Vector3SoAf = TVector3SoA<float>;
+	using Vector3SoAd = TVector3SoA<double>;
+
+	// Vector4SoA
+
+	using Vector4SoA = TVector4SoA<float>;
+	using Vector4SoAf = TVector4SoA<float>;
+	using Vector4SoAd = TVector4SoA<double>;
+
+	// THalfVector2 / 3 / 4
+
+	using HalfVector2 = THalfVector2<float>;
+	using HalfVector2d = THalfVector2<double>;
+
+	using HalfVector3 = THalfVector3<float>;
+	using HalfVector3d = THalfVector3<double>;
+
+	using HalfVector4 = THalfVector4<float>;
+	using HalfVector4d = THalfVector4<double>;
+
+	// TOctNormal16 / 8
+
+	using OctNormal16 = TOctNormal16<float>;
+	using OctNormal16d = TOctNormal16<double>;
+
+	using OctNormal8 = TOctNormal8<float>;
+	using OctNormal8d = TOctNormal8<double>;
+
 	// Matrix2
 
 	using Matrix2 = TMatrix2<float>;
@@ -207,10 +306,31 @@ namespace Phanes::Core::Math
 	using Matrix4f = TMatrix4<float, false>;
 	using Matrix4d = TMatrix4<double, false>;
 
-	using Matrix4Reg = TMatrix3<float, SIMD::use_simd<float, 4, true>::value>;
-	using Matrix4Regf = TMatrix3<float, SIMD::use_simd<float, 4, true>::value>;
-	using Matrix4Regd = TMatrix3<double, SIMD::use_simd<double, 4, true>::value>;
-	using Matrix4Regf64 = TMatrix3<double, SIMD::use_simd<double, 4, true>::value>;
+	using Matrix4Reg = TMatrix4<float, SIMD::use_simd<float, 4, true>::value>;
+	using Matrix4Regf = TMatrix4<float, SIMD::use_simd<float, 4, true>::value>;
+	using Matrix4Regd = TMatrix4<double, SIMD::use_simd<double, 4, true>::value>;
+	using Matrix4Regf64 = TMatrix4<double, SIMD::use_simd<double, 4, true>::value>;
+
+	// Quaternion
+
+	using Quaternion = TQuaternion<float, false>;
+	using Quaternionf = TQuaternion<float, false>;
+	using Quaterniond = TQuaternion<double, false>;
+
+	using QuaternionReg = TQuaternion<float, SIMD::use_simd<float, 4, true>::value>;
+	using QuaternionRegf = TQuaternion<float, SIMD::use_simd<float, 4, true>::value>;
+	using QuaternionRegd = TQuaternion<double, SIMD::use_simd<double, 4, true>::value>;
+	using QuaternionRegf64 = TQuaternion<double, SIMD::use_simd<double, 4, true>::value>;
+
+	// Transform (no plain "Transform" alias, as it would collide with the Transform functions)
+
+	using Transformf = TTransform<float, false>;
+	using Transformd = TTransform<double, false>;
+
+	using TransformReg = TTransform<float, SIMD::use_simd<float, 4, true>::value>;
+	using TransformRegf = TTransform<float, SIMD::use_simd<float, 4, true>::value>;
+	using TransformRegd = TTransform<double, SIMD::use_simd<double, 4, true>::value>;
+	using TransformRegf64 = TTransform<double, SIMD::use_simd<double, 4, true>::value>;
 
 	// TPlane
 
@@ -219,7 +339,73 @@ namespace Phanes::Core::Math
 	using Planed = TPlane<double, false>;
 
 	using PlaneReg = TPlane<float, SIMD::use_simd<float, 4, true>::value>;
-	using PlaneRegd = TPlane<float, SIMD::use_simd<double, 4, true>::value>;
+	using PlaneRegd = TPlane<double, SIMD::use_simd<double, 4, true>::value>;
+
+	using PlaneHit = TPlaneHit<float>;
+	using PlaneHitd = TPlaneHit<double>;
+
+	// TAABB
+
+	using AABB = TAABB<float, false>;
+	using AABBf = TAABB<float, false>;
+	using AABBd = TAABB<double, false>;
+
+	using AABBReg = TAABB<float, SIMD::use_simd<float, 4, true>::value>;
+	using AABBRegd = TAABB<double, SIMD::use_simd<double, 4, true>::value>;
+
+	// TSphere
+
+	using Sphere = TSphere<float, false>;
+	using Spheref = TSphere<float, false>;
+	using Sphered = TSphere<double, false>;
+
+	using SphereReg = TSphere<float, SIMD::use_simd<float, 4, true>::value>;
+	using SphereRegd = TSphere<double, SIMD::use_simd<double, 4, true>::value>;
+
+	// TFrustum
+
+	using Frustum = TFrustum<float, false>;
+	using Frustumf = TFrustum<float, false>;
+	using Frustumd = TFrustum<double, false>;
+
+	using FrustumReg = TFrustum<float, SIMD::use_simd<float, 4, true>::value>;
+	using FrustumRegd = TFrustum<double, SIMD::use_simd<double, 4, true>::value>;
+
+	// TRayPacket
+
+	using RayPacket4 = TRayPacket<float, 4>;
+	using RayPacket8 = TRayPacket<float, 8>;
+	using RayPacket4d = TRayPacket<double, 4>;
+
+	// TTriangle
+
+	using Triangle = TTriangle<float, false>;
+	using Trianglef = TTriangle<float, false>;
+	using Triangled = TTriangle<double, false>;
+
+	using TriangleReg = TTriangle<float, SIMD::use_simd<float, 4, true>::value>;
+	using TriangleRegd = TTriangle<double, SIMD::use_simd<double, 4, true>::value>;
+
+	using TriangleHit = TTriangleHit<float>;
+	using TriangleHitd = TTriangleHit<double>;
+
+	// TTriangleSoA
+
+	using TriangleSoA = TTriangleSoA<float>;
+	using TriangleSoAf = TTriangleSoA<float>;
+	using TriangleSoAd = TTriangleSoA<double>;
+
+	// TBVH
+
+	using BVH = TBVH<float>;
+	using BVHf = TBVH<float>;
+	using BVHd = TBVH<double>;
+
+	// TSpatialHashGrid
+
+	using SpatialHashGrid = TSpatialHashGrid<float>;
+	using SpatialHashGridf = TSpatialHashGrid<float>;
+	using SpatialHashGridd = TSpatialHashGrid<double>;
 
 } // namespace Phanes::Core::Math
 
@@ -20,11 +20,106 @@
 #include "Core/Math/IntVector2.hpp"
 #include "Core/Math/IntVector3.hpp"
 #include "Core/Math/IntVector4.hpp"
+#include "Core/Math/Plane.hpp"
+#include "Core/Math/Quaternion.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <limits>
 
 #ifndef MATH_TYPE_CONVERSION_H
 #define MATH_TYPE_CONVERSION_H
 
 
+namespace Phanes::Core::Math::Detail
+{
+    // Text layout of the math types, shared by ToString and the fmt formatters (MathFormat.hpp).
+    // Vectors are written as "(x, y, z)", matrices row by row as "([m00, m01], [m10, m11])".
+    // put(out, c) writes one component to the output iterator out and returns the advanced iterator.
+
+    template<typename It>
+    It format_literal(It out, const char* s)
+    {
+        while (*s)
+        {
+            *out++ = *s++;
+        }
+        return out;
+    }
+
+    template<typename It, typename Put, typename C0, typename... C>
+    It format_tuple(It out, const Put& put, const C0& c0, const C&... c)
+    {
+        *out++ = '(';
+        out = put(out, c0);
+
+        ((out = format_literal(out, ", "), out = put(out, c)), ...);
+
+        *out++ = ')';
+        return out;
+    }
+
+    template<int R, int C, typename It, typename Put, typename M>
+    It format_matrix(It out, const Put& put, const M& m)
+    {
+        *out++ = '(';
+
+        for (int i = 0; i < R; i++)
+        {
+            out = format_literal(out, (i == 0) ? "[" : "], [");
+
+            for (int j = 0; j < C; j++)
+            {
+                if (j != 0)
+                {
+                    out = format_literal(out, ", ");
+                }
+                out = put(out, m(i, j));
+            }
+        }
+
+        return format_literal(out, "])");
+    }
+
+    // Writes a component like std::to_string: fixed with six decimals for floating point types.
+
+    template<typename T>
+    struct format_to_chars
+    {
+        template<typename It>
+        It operator()(It out, T v) const
+        {
+            // Enough for the longest fixed notation of T.
+            char buf[std::numeric_limits<T>::max_exponent10 + std::numeric_limits<T>::digits10 + 16];
+            std::to_chars_result r;
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                r = std::to_chars(buf, buf + sizeof(buf), v, std::chars_format::fixed, 6);
+            }
+            else
+            {
+                r = std::to_chars(buf, buf + sizeof(buf), v);
+            }
+
+            return std::copy(buf, r.ptr, out);
+        }
+    };
+
+    // Formats into one string, reserved for typical component lengths, so ToString usually allocates once.
+
+    template<typename T, typename Fn>
+    std::string format_string(size_t components, Fn&& fn)
+    {
+        std::string r;
+        r.reserve(components * 14 + 8);
+
+        fn(std::back_inserter(r), format_to_chars<T>());
+        return r;
+    }
+}
+
 namespace Phanes::Core::Math {
 
     // =================================================== //
@@ -58,65 +153,73 @@ namespace Phanes::Core::Math {
     //   ToString   //
     // ============ //
 
+    // Components are written like std::to_string. To log math types without building strings, use the fmt
+    // formatters in MathFormat.hpp.
+
     template<RealType T, bool S>
     std::string ToString(const TVector2<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ")";
+        return Detail::format_string<T>(2, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y); });
     }
 
     template<IntType T, bool S>
     std::string ToString(const TIntVector2<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ")";
+        return Detail::format_string<T>(2, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y); });
     }
 
     template<RealType T, bool S>
     std::string ToString(const TVector3<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ", " + ToString(v.z) + ")";
+        return Detail::format_string<T>(3, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y, v.z); });
     }
 
     template<IntType T, bool S>
     std::string ToString(const TIntVector3<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ", " + ToString(v.z) + ")";
+        return Detail::format_string<T>(3, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y, v.z); });
     }
 
     template<RealType T, bool S>
     std::string ToString(const TVector4<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ", " + ToString(v.z) + ", " + ToString(v.w) + ")";
+        return Detail::format_string<T>(4, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y, v.z, v.w); });
     }
 
     template<IntType T, bool S>
     std::string ToString(const TIntVector4<T, S>& v)
     {
-        return "(" + ToString(v.x) + ", " + ToString(v.y) + ", " + ToString(v.z) + ", " + ToString(v.w) + ")";
+        return Detail::format_string<T>(4, [&](auto out, const auto& put) { Detail::format_tuple(out, put, v.x, v.y, v.z, v.w); });
     }
 
     template<RealType T>
     std::string ToString(const TMatrix2<T>& m)
     {
-        return "([" + ToString(m(0, 0)) + ", " + ToString(m(0, 1)) + "], [" + 
-                      ToString(m(1, 0)) + ", " + ToString(m(1, 1)) + "])";
+        return Detail::format_string<T>(4, [&](auto out, const auto& put) { Detail::format_matrix<2, 2>(out, put, m); });
     }
 
     template<RealType T, bool S>
     std::string ToString(const TMatrix3<T, S>& m)
     {
-        return "([" + ToString(m(0, 0)) + ", " + ToString(m(0, 1)) + ", " + ToString(m(0, 2)) + "], [" + 
-                      ToString(m(1, 0)) + ", " + ToString(m(1, 1)) + ", " + ToString(m(1, 2)) + "], [" + 
-                      ToString(m(2, 0)) + ", " + ToString(m(2, 1)) + ", " + ToString(m(2, 2)) + "])";
+        return Detail::format_string<T>(9, [&](auto out, const auto& put) { Detail::format_matrix<3, 3>(out, put, m); });
     }
 
-
     template<RealType T, bool S>
     std::string ToString(const TMatrix4<T, S>& m)
     {
-        return "([" + ToString(m(0, 0)) + ", " + ToString(m(0, 1)) + ", " + ToString(m(0, 2)) + ", " + ToString(m(0, 3)) + "], [" + 
-                      ToString(m(1, 0)) + ", " + ToString(m(1, 1)) + ", " + ToString(m(1, 2)) + ", " + ToString(m(1, 3)) + "], [" + 
-                      ToString(m(2, 0)) + ", " + ToString(m(2, 1)) + ", " + ToString(m(2, 2)) + ", " + ToString(m(2, 3)) + "], [" +
-                      ToString(m(3, 0)) + ", " + ToString(m(3, 1)) + ", " + ToString(m(3, 2)) + ", " + ToString(m(3, 3)) + "])";
+        return Detail::format_string<T>(16, [&](auto out, const auto& put) { Detail::format_matrix<4, 4>(out, put, m); });
+    }
+
+    template<RealType T, bool S>
+    std::string ToString(const TPlane<T, S>& pl)
+    {
+        return Detail::format_string<T>(4, [&](auto out, const auto& put) { Detail::format_tuple(out, put, pl.x, pl.y, pl.z, pl.d); });
+    }
+
+    template<RealType T, bool S>
+    std::string ToString(const TQuaternion<T, S>& q)
+    {
+        return Detail::format_string<T>(4, [&](auto out, const auto& put) { Detail::format_tuple(out, put, q.x, q.y, q.z, q.w); });
     }
 
 }
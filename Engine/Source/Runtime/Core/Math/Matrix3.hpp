@@ -6,6 +6,9 @@
 #include "Core/Math/MathFwd.h"
 #include "Core/Math/Vector3.hpp"
 
+#include <optional>
+#include <type_traits>
+
 #ifndef MATRIX3_H
 #define MATRIX3_H
 
@@ -50,11 +53,11 @@ namespace Phanes::Core::Math {
 
         TMatrix3() = default;
         
-        TMatrix3(TMatrix3<T, S>&& m)
+        constexpr TMatrix3(TMatrix3<T, S>&& m)
             : c0(std::move(m.c0)), c1(std::move(m.c1)), c2(std::move(m.c2))
         {};
 
-        TMatrix3(const TMatrix3<T, S>& m)
+        constexpr TMatrix3(const TMatrix3<T, S>& m)
             : c0(m.c0), c1(m.c1), c2(m.c2)
         {};
 
@@ -64,7 +67,7 @@ namespace Phanes::Core::Math {
          * @param(fields) 2D Array with row major order.
          */
 
-        TMatrix3(T fields[3][3])
+        constexpr TMatrix3(T fields[3][3])
         {
             this->c0 = TVector3<T, S>(fields[0][0], fields[1][0], fields[2][0]);
             this->c1 = TVector3<T, S>(fields[0][1], fields[1][1], fields[2][1]);
@@ -83,7 +86,7 @@ namespace Phanes::Core::Math {
          * @note nXY = n[Row][Col]
          */
 
-        TMatrix3(T n00, T n01, T n02,
+        constexpr TMatrix3(T n00, T n01, T n02,
                  T n10, T n11, T n12,
                  T n20, T n21, T n22)
         {
@@ -99,14 +102,14 @@ namespace Phanes::Core::Math {
          * @param(v2) Column one
          */
 
-        TMatrix3(const TVector3<T, S>& v1, const TVector3<T, S>& v2, const TVector3<T, S> v3)
+        constexpr TMatrix3(const TVector3<T, S>& v1, const TVector3<T, S>& v2, const TVector3<T, S> v3)
         {
             this->c0 = v1;
             this->c1 = v2;
             this->c2 = v3;
         }
 
-        TMatrix3<T, S>& operator= (TMatrix3<T, S>&& m)
+        constexpr TMatrix3<T, S>& operator= (TMatrix3<T, S>&& m)
         {
             if (this != &m)
             {
@@ -117,7 +120,7 @@ namespace Phanes::Core::Math {
             return *this;
         }
 
-        TMatrix3<T, S>& operator= (const TMatrix3<T, S>& m)
+        constexpr TMatrix3<T, S>& operator= (const TMatrix3<T, S>& m)
         {
             if (this != &m)
             {
@@ -130,13 +133,24 @@ namespace Phanes::Core::Math {
 
     public:
 
-        FORCEINLINE T operator() (int n, int m) const
+        FORCEINLINE constexpr T operator() (int n, int m) const
         {
+            if (std::is_constant_evaluated())
+            {
+                // data is never the active member in constant expressions, go through the columns.
+                const TVector3<T, S>& c = (m == 0) ? c0 : (m == 1) ? c1 : c2;
+                return (n == 0) ? c.x : (n == 1) ? c.y : c.z;
+            }
             return this->data[m][n];
         }
 
-        FORCEINLINE T& operator() (int n, int m)
+        FORCEINLINE constexpr T& operator() (int n, int m)
         {
+            if (std::is_constant_evaluated())
+            {
+                TVector3<T, S>& c = (m == 0) ? c0 : (m == 1) ? c1 : c2;
+                return (n == 0) ? c.x : (n == 1) ? c.y : c.z;
+            }
             return this->data[m][n];
         }
 
@@ -165,7 +179,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator+= (TMatrix3<T, S>& m1, T s)
+    constexpr TMatrix3<T, S>& operator+= (TMatrix3<T, S>& m1, T s)
     {
         m1.c0 += s;
         m1.c1 += s;
@@ -182,7 +196,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator+= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S>& operator+= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         m1.c0 += m2.c0;
         m1.c1 += m2.c1;
@@ -199,7 +213,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator-= (TMatrix3<T, S>& m1, T s)
+    constexpr TMatrix3<T, S>& operator-= (TMatrix3<T, S>& m1, T s)
     {
         m1.c0 -= s;
         m1.c1 -= s;
@@ -216,7 +230,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator-= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S>& operator-= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         m1.c0 -= m2.c0;
         m1.c1 -= m2.c1;
@@ -233,7 +247,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, T s)
+    constexpr TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, T s)
     {
         m1.c0 *= s;
         m1.c1 *= s;
@@ -250,7 +264,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
+    constexpr TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
 
     /**
      * Multiply matrix with scalar
@@ -260,7 +274,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator/= (TMatrix3<T, S>& m1, T s)
+    constexpr TMatrix3<T, S>& operator/= (TMatrix3<T, S>& m1, T s)
     {
         s = (T)1.0 / s;
         m1.c0 *= s;
@@ -278,7 +292,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator/= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S>& operator/= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         m1.c0 /= m2.c0;
         m1.c1 /= m2.c1;
@@ -295,7 +309,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator+ (const TMatrix3<T, S>& m, T s)
+    constexpr TMatrix3<T, S> operator+ (const TMatrix3<T, S>& m, T s)
     {
         return TMatrix3<T, S>(m.c0 + s,
                               m.c1 + s,
@@ -310,7 +324,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator+ (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S> operator+ (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         return TMatrix3<T, S>(m1.c0 + m2.c0,
                               m1.c1 + m2.c1,
@@ -325,7 +339,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator- (const TMatrix3<T, S>& m, T s)
+    constexpr TMatrix3<T, S> operator- (const TMatrix3<T, S>& m, T s)
     {
         return TMatrix3<T, S>(m.c0 - s,
                               m.c1 - s,
@@ -340,7 +354,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator- (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S> operator- (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         return TMatrix3<T, S>(m1.c0 - m2.c0,
                               m1.c1 - m2.c1,
@@ -355,7 +369,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m, float s)
+    constexpr TMatrix3<T, S> operator* (const TMatrix3<T, S>& m, float s)
     {
         return TMatrix3<T, S>(m.c0 * s,
                               m.c1 * s,
@@ -370,7 +384,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator/ (const TMatrix3<T, S>& m, float s)
+    constexpr TMatrix3<T, S> operator/ (const TMatrix3<T, S>& m, float s)
     {
         s = (T)1.0 / s;
         return TMatrix3<T, S>(m.c0 * s,
@@ -386,10 +400,10 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
+    constexpr TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2);
 
     template<RealType T, bool S>
-    TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v);
+    constexpr TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v);
 
     /**
      * Compare matrix with other matrix.
@@ -399,7 +413,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    bool operator== (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr bool operator== (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         return (m1.c0 == m2.c0 && m1.c1 == m2.c1 && m1.c2 == m2.c2);
     }
@@ -412,7 +426,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    bool operator!= (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr bool operator!= (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         return (m1.c0 != m2.c0 || m1.c1 != m2.c1 || m1.c2 != m2.c2);
     }
@@ -429,12 +443,7 @@ namespace Phanes::Core::Math {
      */
     
     template<RealType T, bool S>
-    T Determinant(const TMatrix3<T, S>& m1)
-    {
-        return   m1(0, 0) * (m1(1, 1) * m1(2, 2) - m1(1, 2) * m1(2, 1))
-               - m1(0, 1) * (m1(1, 0) * m1(2, 2) - m1(1, 2) * m1(2, 0))
-               + m1(0, 2) * (m1(1, 0) * m1(2, 1) - m1(1, 1) * m1(2, 0));
-    }
+    constexpr T Determinant(const TMatrix3<T, S>& m1);
 
     /**
      * Calculate inverse of 3x3 Matrix
@@ -447,29 +456,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    bool InverseV(TMatrix3<T, S>& m1)
-    {
-        // Rows of inversed matrix
-        TVector3<T, S> r0 = CrossP(m1.c1, m1.c2);
-        TVector3<T, S> r1 = CrossP(m1.c2, m1.c0);
-        TVector3<T, S> r2 = CrossP(m1.c0, m1.c1);
-
-        T _1_det = (T)1.0 / Determinant(m1);
-
-        if (_1_det == (T)0.0)
-        {
-            return false;
-        }
-
-        // Store matrix transposed
-        m1 = TMatrix3<T, S>(r0.x, r0.y, r0.z,
-                            r1.x, r1.y, r1.z,
-                            r2.x, r2.y, r2.z);
-
-        m1 *= _1_det;
-
-        return true;
-    }
+    bool InverseV(TMatrix3<T, S>& m1);
 
     /**
      * Get transpose of matrix.
@@ -480,7 +467,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& TransposeV(TMatrix3<T, S>& m1);
+    constexpr TMatrix3<T, S>& TransposeV(TMatrix3<T, S>& m1);
 
 
     // =============== //
@@ -494,30 +481,54 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    bool Inverse(const TMatrix3<T, S>& m1, Ref<TMatrix3<T, S>> r)
-    {
-        // r is a row-major matrix.
-        TMatrix3<T, S> row;
-        row[0] = CrossP(m1.c1, m1.c2);
-        row[1] = CrossP(m1.c2, m1.c0);
-        row[2] = CrossP(m1.c0, m1.c1);
+    bool Inverse(const TMatrix3<T, S>& m1, Ref<TMatrix3<T, S>> r);
 
-        T _1_det = (T)1.0 / Determinant(m1);
+    /**
+     * Calculate inverse of 3x3 Matrix
+     *
+     * @param(m1) Matrix
+     *
+     * @return Inverse, or nothing if m1 is singular.
+     */
 
-        if (Phanes::Core::Math::Equals(_1_det, (T)0.0))
-        {
-            return false;
-        }
+    template<RealType T, bool S>
+    std::optional<TMatrix3<T, S>> Inverse(const TMatrix3<T, S>& m1);
 
-        row *= _1_det;
+    /**
+     * Calculate inverse transpose of 3x3 Matrix, e.g. the normal matrix of a transformation.
+     *
+     * @param(m1) Matrix
+     * @param(r) Inverse transpose
+     *
+     * @note Returns false and leaves r unchanged, if m1 is singular.
+     */
 
-        // Store matrix transposed.
-        (*r).data[0][0] = row.data[0][0]; (*r).data[1][0] = row.data[0][1]; (*r).data[2][0] = row.data[0][2];
-        (*r).data[0][1] = row.data[1][0]; (*r).data[1][1] = row.data[1][1]; (*r).data[2][1] = row.data[1][2];
-        (*r).data[0][2] = row.data[2][0]; (*r).data[1][2] = row.data[2][1]; (*r).data[2][2] = row.data[2][2];
+    template<RealType T, bool S>
+    bool InverseTranspose(const TMatrix3<T, S>& m1, Ref<TMatrix3<T, S>> r);
 
-        return true;
-    }
+    /**
+     * Calculate inverse transpose of 3x3 Matrix, e.g. the normal matrix of a transformation.
+     *
+     * @param(m1) Matrix
+     *
+     * @return Inverse transpose, or nothing if m1 is singular.
+     */
+
+    template<RealType T, bool S>
+    std::optional<TMatrix3<T, S>> InverseTranspose(const TMatrix3<T, S>& m1);
+
+    /**
+     * Calculate inverse transpose of count matrices.
+     *
+     * @param(r) Inverse transposes, may alias m
+     * @param(m) Matrices
+     * @param(count) Number of matrices
+     *
+     * @note Singular matrices result in a zero matrix. Returns false, if any matrix was singular.
+     */
+
+    template<RealType T, bool S>
+    bool InverseTranspose(TMatrix3<T, S>* r, const TMatrix3<T, S>* m, size_t count);
 
     /**
      * Get transpose of matrix.
@@ -528,7 +539,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TMatrix3<T, S> Transpose(const TMatrix3<T, S>& m1);
+    constexpr TMatrix3<T, S> Transpose(const TMatrix3<T, S>& m1);
     
     /**
      * Checks if matrix is an identity matrix.
@@ -7,45 +7,139 @@
 
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
 
+#include <optional>
+#include <type_traits>
+
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    TMatrix3<T, S>& TransposeV(TMatrix3<T, S>& m)
+    constexpr T Determinant(const TMatrix3<T, S>& m1)
+    {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_mat3_det<T, false>::map(m1);
+        }
+        return Detail::compute_mat3_det<T, S>::map(m1);
+    }
+
+    template<RealType T, bool S>
+    bool InverseV(TMatrix3<T, S>& m1)
+    {
+        return Detail::compute_mat3_inv<T, S>::map(m1, m1);
+    }
+
+    template<RealType T, bool S>
+    bool Inverse(const TMatrix3<T, S>& m1, Ref<TMatrix3<T, S>> r)
+    {
+        return Detail::compute_mat3_inv<T, S>::map(*r, m1);
+    }
+
+    template<RealType T, bool S>
+    std::optional<TMatrix3<T, S>> Inverse(const TMatrix3<T, S>& m1)
+    {
+        TMatrix3<T, S> r;
+        if (Detail::compute_mat3_inv<T, S>::map(r, m1))
+        {
+            return r;
+        }
+        return std::nullopt;
+    }
+
+    template<RealType T, bool S>
+    bool InverseTranspose(const TMatrix3<T, S>& m1, Ref<TMatrix3<T, S>> r)
+    {
+        return Detail::compute_mat3_inv_transpose<T, S>::map(*r, m1);
+    }
+
+    template<RealType T, bool S>
+    std::optional<TMatrix3<T, S>> InverseTranspose(const TMatrix3<T, S>& m1)
+    {
+        TMatrix3<T, S> r;
+        if (Detail::compute_mat3_inv_transpose<T, S>::map(r, m1))
+        {
+            return r;
+        }
+        return std::nullopt;
+    }
+
+    template<RealType T, bool S>
+    bool InverseTranspose(TMatrix3<T, S>* r, const TMatrix3<T, S>* m, size_t count)
+    {
+        return Detail::compute_mat3_batch_inv_transpose<T, S>::map(r, m, count);
+    }
+
+    template<RealType T, bool S>
+    constexpr TMatrix3<T, S>& TransposeV(TMatrix3<T, S>& m)
     {
-        Detail::compute_mat3_transpose<T, S>::map(m, m);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat3_transpose<T, false>::map(m, m);
+        }
+        else
+        {
+            Detail::compute_mat3_transpose<T, S>::map(m, m);
+        }
         return m;
     }
 
     template<RealType T, bool S>
-    TMatrix3<T, S> Transpose(const TMatrix3<T, S>& m)
+    constexpr TMatrix3<T, S> Transpose(const TMatrix3<T, S>& m)
     {
         TMatrix3<T, S> r;
-        Detail::compute_mat3_transpose<T, S>::map(r, m);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat3_transpose<T, false>::map(r, m);
+        }
+        else
+        {
+            Detail::compute_mat3_transpose<T, S>::map(r, m);
+        }
         return r;
         
     }
 
     template<RealType T, bool S>
-    TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S>& operator*= (TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         TMatrix3<T, S> r;
-        Detail::compute_mat3_mul<T, S>::map(r, m1, m2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat3_mul<T, false>::map(r, m1, m2);
+        }
+        else
+        {
+            Detail::compute_mat3_mul<T, S>::map(r, m1, m2);
+        }
         return (m1 = r);
     }
 
     template<RealType T, bool S>
-    TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
+    constexpr TMatrix3<T, S> operator* (const TMatrix3<T, S>& m1, const TMatrix3<T, S>& m2)
     {
         TMatrix3<T, S> r;
-        Detail::compute_mat3_mul<T, S>::map(r, m1, m2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat3_mul<T, false>::map(r, m1, m2);
+        }
+        else
+        {
+            Detail::compute_mat3_mul<T, S>::map(r, m1, m2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v)
+    constexpr TVector3<T, S> operator* (const TMatrix3<T, S>& m1, const TVector3<T, S>& v)
     {
         TVector3<T, S> r;
-        Detail::compute_mat3_mul<T, S>::map(r, m1, v);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat3_mul<T, false>::map(r, m1, v);
+        }
+        else
+        {
+            Detail::compute_mat3_mul<T, S>::map(r, m1, v);
+        }
         return r;
     }
 }
\ No newline at end of file
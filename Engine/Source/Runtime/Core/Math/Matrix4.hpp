@@ -6,6 +6,10 @@
 #include "Core/Math/MathFwd.h"
 #include "Core/Math/Vector4.hpp"
 
+#include <optional>
+#include <span>
+#include <type_traits>
+
 #ifndef MATRIX4_H
 #define MATRIX4_H
 
@@ -42,7 +46,7 @@ namespace Phanes::Core::Math {
 		/// Move constructor
 		/// </summary>
 		/// <param name="v"></param>
-		TMatrix4(TMatrix4<T, S>&& m)
+		constexpr TMatrix4(TMatrix4<T, S>&& m)
 			: c0(std::move(m.c0)), c1(std::move(m.c1)), c2(std::move(m.c2)), c3(std::move(m.c3))
 		{};
 
@@ -50,17 +54,17 @@ namespace Phanes::Core::Math {
 		/// Copy constructor
 		/// </summary>
 		/// <param name="v"></param>
-		TMatrix4(const TMatrix4<T, S>& m)
+		constexpr TMatrix4(const TMatrix4<T, S>& m)
 			: c0(m.c0), c1(m.c1), c2(m.c2), c3(m.c3)
 		{};
 
 		/// <summary>
 		/// Construct matrix with values.
 		/// </summary>
-		TMatrix4(float n00, float n01, float n02, float n03,
-				 float n10, float n11, float n12, float n13,
-				 float n20, float n21, float n22, float n23,
-				 float n30, float n31, float n32, float n33)
+		constexpr TMatrix4(T n00, T n01, T n02, T n03,
+				 T n10, T n11, T n12, T n13,
+				 T n20, T n21, T n22, T n23,
+				 T n30, T n31, T n32, T n33)
 		{
 			this->c0 = TVector4<T, S>(n00, n10, n20, n30);
 			this->c1 = TVector4<T, S>(n01, n11, n21, n31);
@@ -71,7 +75,7 @@ namespace Phanes::Core::Math {
 		/// <summary>
 		/// Construct matrix from columns.
 		/// </summary>
-		TMatrix4(const TVector4<T, S>& v0, const TVector4<T, S>& v1, const TVector4<T, S>& v2, const TVector4<T, S>& v3)
+		constexpr TMatrix4(const TVector4<T, S>& v0, const TVector4<T, S>& v1, const TVector4<T, S>& v2, const TVector4<T, S>& v3)
 		{
 			this->c0 = v0;
 			this->c1 = v1;
@@ -83,7 +87,7 @@ namespace Phanes::Core::Math {
 		/// Construct matrix from field of values.
 		/// </summary>
 		/// <param name="field"></param>
-		explicit TMatrix4(T field[4][4])
+		explicit constexpr TMatrix4(T field[4][4])
 		{
 			this->c0 = TVector4(field[0]);
 			this->c1 = TVector4(field[1]);
@@ -91,7 +95,7 @@ namespace Phanes::Core::Math {
 			this->c3 = TVector4(field[3]);
 		}
 
-		TMatrix4<T, S>& operator= (TMatrix4<T, S>&& m)
+		constexpr TMatrix4<T, S>& operator= (TMatrix4<T, S>&& m)
 		{
 			if (this != &m)
 			{
@@ -103,7 +107,7 @@ namespace Phanes::Core::Math {
 			return *this;
 		}
 
-		TMatrix4<T, S>& operator= (const TMatrix4<T, S>& m)
+		constexpr TMatrix4<T, S>& operator= (const TMatrix4<T, S>& m)
 		{
 			if (this != &m)
 			{
@@ -117,8 +121,14 @@ namespace Phanes::Core::Math {
 
 	public:
 
-		FORCEINLINE T& operator() (int n, int m)
+		FORCEINLINE constexpr T& operator() (int n, int m)
 		{
+			if (std::is_constant_evaluated())
+			{
+				// data is never the active member in constant expressions, go through the columns.
+				TVector4<T, S>& c = (m == 0) ? c0 : (m == 1) ? c1 : (m == 2) ? c2 : c3;
+				return (n == 0) ? c.x : (n == 1) ? c.y : (n == 2) ? c.z : c.w;
+			}
 			return this->data[m][n];
 		}
 		FORCEINLINE TVector4<T, S>& operator[] (int m)
@@ -126,8 +136,13 @@ namespace Phanes::Core::Math {
 			return (*reinterpret_cast<TVector4<T, S>*>(this->data[m]));
 		}
 
-		FORCEINLINE const T& operator() (int n, int m) const
+		FORCEINLINE constexpr const T& operator() (int n, int m) const
 		{
+			if (std::is_constant_evaluated())
+			{
+				const TVector4<T, S>& c = (m == 0) ? c0 : (m == 1) ? c1 : (m == 2) ? c2 : c3;
+				return (n == 0) ? c.x : (n == 1) ? c.y : (n == 2) ? c.z : c.w;
+			}
 			return this->data[m][n];
 		}
 		FORCEINLINE const TVector4<T, S>& operator[] (int m) const
@@ -141,7 +156,7 @@ namespace Phanes::Core::Math {
 	// ==================== //
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator+= (TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S>& operator+= (TMatrix4<T, S>& m1, T s)
 	{
 		m1.c0 += s;
 		m1.c1 += s;
@@ -152,7 +167,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator+= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr TMatrix4<T, S>& operator+= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		m1.c0 += m2.c0;
 		m1.c1 += m2.c1;
@@ -163,7 +178,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator-= (TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S>& operator-= (TMatrix4<T, S>& m1, T s)
 	{
 		m1.c0 -= s;
 		m1.c1 -= s;
@@ -174,7 +189,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator-= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr TMatrix4<T, S>& operator-= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		m1.c0 -= m2.c0;
 		m1.c1 -= m2.c1;
@@ -185,7 +200,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, T s)
 	{
 		m1.c0 *= s;
 		m1.c1 *= s;
@@ -197,10 +212,10 @@ namespace Phanes::Core::Math {
 
 	// Matrix multiplication
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
+	constexpr TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& operator/= (TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S>& operator/= (TMatrix4<T, S>& m1, T s)
 	{
 		s = (T)1.0 / s;
 		m1.c0 *= s;
@@ -212,7 +227,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator+ (const TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S> operator+ (const TMatrix4<T, S>& m1, T s)
 	{
 		return TMatrix4<T, S>(m1.c0 + s,
 							  m1.c1 + s,
@@ -222,7 +237,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator+ (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr TMatrix4<T, S> operator+ (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		return TMatrix4<T, S>(m1.c0 + m2.c0,
 							  m1.c1 + m2.c1,
@@ -232,7 +247,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator- (const TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S> operator- (const TMatrix4<T, S>& m1, T s)
 	{
 		return TMatrix4<T, S>(m1.c0 - s,
 							  m1.c1 - s,
@@ -242,7 +257,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator- (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr TMatrix4<T, S> operator- (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		return TMatrix4<T, S>(m1.c0 - m2.c0,
 							  m1.c1 - m2.c1,
@@ -252,7 +267,7 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, T s)
 	{
 		return TMatrix4<T, S>(m1.c0 * s,
 						      m1.c1 * s,
@@ -262,10 +277,10 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
+	constexpr TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2);
 
 	template<RealType T, bool S>
-	TMatrix4<T, S> operator/ (const TMatrix4<T, S>& m1, T s)
+	constexpr TMatrix4<T, S> operator/ (const TMatrix4<T, S>& m1, T s)
 	{
 		s = (T)1.0 / s;
 		return TMatrix4<T, S>(m1.c0 * s,
@@ -276,16 +291,16 @@ namespace Phanes::Core::Math {
 	}
 
 	template<RealType T, bool S>
-	TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v);
+	constexpr TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v);
 
 	template<RealType T, bool S>
-	bool operator== (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr bool operator== (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		return (m1.c0 == m2.c0 && m1.c1 == m2.c1 && m1.c2 == m2.c2 && m1.c3 == m2.c3);
 	}
 
 	template<RealType T, bool S>
-	bool operator!= (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+	constexpr bool operator!= (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
 	{
 		return (m1.c0 != m2.c0 || m1.c1 != m2.c1 || m1.c2 != m2.c2 || m1.c3 != m2.c3);
 	}
@@ -296,13 +311,13 @@ namespace Phanes::Core::Math {
 	// ================================ //
 
 	template<RealType T, bool S>
-	T Determinant(const TMatrix4<T, S>& m);
+	constexpr T Determinant(const TMatrix4<T, S>& m);
 
 	template<RealType T, bool S>
 	bool InverseV(TMatrix4<T, S>& a);
 
 	template<RealType T, bool S>
-	TMatrix4<T, S>& TransposeV(TMatrix4<T, S>& a);
+	constexpr TMatrix4<T, S>& TransposeV(TMatrix4<T, S>& a);
 
 
 	// =============== //
@@ -313,8 +328,16 @@ namespace Phanes::Core::Math {
 	template<RealType T, bool S>
 	bool Inverse(const TMatrix4<T, S>& m, Ref<TMatrix4<T, S>> r);
 
+	/// <summary>
+	/// Calculates the inverse of m.
+	/// </summary>
+	/// <param name="m">Matrix</param>
+	/// <returns>Inverse, or nothing if m is singular.</returns>
+	template<RealType T, bool S>
+	std::optional<TMatrix4<T, S>> Inverse(const TMatrix4<T, S>& m);
+
 	template<RealType T, bool S>
-	TMatrix4<T, S> Transpose(const TMatrix4<T, S>& a);
+	constexpr TMatrix4<T, S> Transpose(const TMatrix4<T, S>& a);
 
 	template<RealType T, bool S>
 	FORCEINLINE bool IsIdentityMatrix(const TMatrix4<T, S>& m1)
@@ -326,6 +349,64 @@ namespace Phanes::Core::Math {
 	}
 
 
+	// ====================== //
+	//   Batch transforms   //
+	// ====================== //
+
+	/// <summary>
+	/// Transforms points (w = 1) by m. Stops after min(v.size(), r.size()) points. r may alias v.
+	/// </summary>
+	/// <param name="m">Transformation matrix</param>
+	/// <param name="v">Points</param>
+	/// <param name="r">Transformed points</param>
+	template<RealType T, bool S>
+	void TransformPoints(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector3<T, S>>> v, std::type_identity_t<std::span<TVector3<T, S>>> r);
+
+	/// <summary>
+	/// Transforms directions (w = 0) by m, so the translation is ignored. Stops after min(v.size(), r.size()) directions. r may alias v.
+	/// </summary>
+	/// <param name="m">Transformation matrix</param>
+	/// <param name="v">Directions</param>
+	/// <param name="r">Transformed directions</param>
+	template<RealType T, bool S>
+	void TransformDirections(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector3<T, S>>> v, std::type_identity_t<std::span<TVector3<T, S>>> r);
+
+	/// <summary>
+	/// Transforms 4D vectors by m. Stops after min(v.size(), r.size()) vectors. r may alias v.
+	/// </summary>
+	/// <param name="m">Transformation matrix</param>
+	/// <param name="v">Vectors</param>
+	/// <param name="r">Transformed vectors</param>
+	template<RealType T, bool S>
+	void Transform(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector4<T, S>>> v, std::type_identity_t<std::span<TVector4<T, S>>> r);
+
+	/// <summary>
+	/// Calculates the inverses of m. Stops after min(m.size(), r.size()) matrices. r may alias m.
+	/// </summary>
+	/// <param name="m">Matrices</param>
+	/// <param name="r">Inverses, singular matrices result in a zero matrix</param>
+	/// <returns>True, if no matrix was singular.</returns>
+	template<RealType T, bool S>
+	bool Inverse(std::span<const TMatrix4<T, S>> m, std::type_identity_t<std::span<TMatrix4<T, S>>> r);
+
+	/// <summary>
+	/// Transforms points (w = 1) stored as structure of arrays. r is resized to the size of v and may alias v.
+	/// </summary>
+	/// <param name="m">Transformation matrix</param>
+	/// <param name="v">Points</param>
+	/// <param name="r">Transformed points</param>
+	template<RealType T, bool S>
+	void TransformPoints(const TMatrix4<T, S>& m, const TVector3SoA<T>& v, TVector3SoA<T>& r);
+
+	/// <summary>
+	/// Transforms directions (w = 0) stored as structure of arrays. r is resized to the size of v and may alias v.
+	/// </summary>
+	/// <param name="m">Transformation matrix</param>
+	/// <param name="v">Directions</param>
+	/// <param name="r">Transformed directions</param>
+	template<RealType T, bool S>
+	void TransformDirections(const TMatrix4<T, S>& m, const TVector3SoA<T>& v, TVector3SoA<T>& r);
+
 } // Phanes::Core::Math
 
 
@@ -7,14 +7,21 @@
 
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
 
+#include <algorithm>
 #include <iostream>
+#include <optional>
+#include <type_traits>
 
 
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    T Determinant(const TMatrix4<T, S>& m)
+    constexpr T Determinant(const TMatrix4<T, S>& m)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_mat4_det<T, false>::map(m);
+        }
         return Detail::compute_mat4_det<T, S>::map(m);
     }
 
@@ -25,9 +32,16 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S>& TransposeV(TMatrix4<T, S>& a)
+    constexpr TMatrix4<T, S>& TransposeV(TMatrix4<T, S>& a)
     {
-        Detail::compute_mat4_transpose<T, S>::map(a, a);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat4_transpose<T, false>::map(a, a);
+        }
+        else
+        {
+            Detail::compute_mat4_transpose<T, S>::map(a, a);
+        }
         return a;
     }
 
@@ -38,34 +52,126 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S> Transpose(TMatrix4<T, S>& a)
+    std::optional<TMatrix4<T, S>> Inverse(const TMatrix4<T, S>& m)
     {
         TMatrix4<T, S> r;
-        Detail::compute_mat4_transpose<T, S>::map(r, a);
+        if (Detail::compute_mat4_inv<T, S>::map(r, m))
+        {
+            return r;
+        }
+        return std::nullopt;
+    }
+
+    template<RealType T, bool S>
+    constexpr TMatrix4<T, S> Transpose(const TMatrix4<T, S>& a)
+    {
+        TMatrix4<T, S> r;
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat4_transpose<T, false>::map(r, a);
+        }
+        else
+        {
+            Detail::compute_mat4_transpose<T, S>::map(r, a);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+    constexpr TMatrix4<T, S>& operator*= (TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
     {
         TMatrix4<T, S> r;
-        Detail::compute_mat4_mul<T, S>::map(r, m1, m2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat4_mul<T, false>::map(r, m1, m2);
+        }
+        else
+        {
+            Detail::compute_mat4_mul<T, S>::map(r, m1, m2);
+        }
         return (m1 = r);
     }
 
     template<RealType T, bool S>
-    TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
+    constexpr TMatrix4<T, S> operator* (const TMatrix4<T, S>& m1, const TMatrix4<T, S>& m2)
     {
         TMatrix4<T, S> r;
-        Detail::compute_mat4_mul<T, S>::map(r, m1, m2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat4_mul<T, false>::map(r, m1, m2);
+        }
+        else
+        {
+            Detail::compute_mat4_mul<T, S>::map(r, m1, m2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v)
+    constexpr TVector4<T, S> operator* (const TMatrix4<T, S>& m1, const TVector4<T, S>& v)
     {
         TVector4<T, S> r;
-        Detail::compute_mat4_mul<T, S>::map(r, m1, v);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_mat4_mul<T, false>::map(r, m1, v);
+        }
+        else
+        {
+            Detail::compute_mat4_mul<T, S>::map(r, m1, v);
+        }
         return r;
     }
+
+    template<RealType T, bool S>
+    void TransformPoints(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector3<T, S>>> v, std::type_identity_t<std::span<TVector3<T, S>>> r)
+    {
+        Detail::compute_mat4_transform_points<T, S>::map(r.data(), m, v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T, bool S>
+    void TransformDirections(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector3<T, S>>> v, std::type_identity_t<std::span<TVector3<T, S>>> r)
+    {
+        Detail::compute_mat4_transform_dirs<T, S>::map(r.data(), m, v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T, bool S>
+    void Transform(const TMatrix4<T, S>& m, std::type_identity_t<std::span<const TVector4<T, S>>> v, std::type_identity_t<std::span<TVector4<T, S>>> r)
+    {
+        Detail::compute_mat4_transform<T, S>::map(r.data(), m, v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T, bool S>
+    bool Inverse(std::span<const TMatrix4<T, S>> m, std::type_identity_t<std::span<TMatrix4<T, S>>> r)
+    {
+        const size_t n = std::min(m.size(), r.size());
+        bool invertible = true;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!Detail::compute_mat4_inv<T, S>::map(r[i], m[i]))
+            {
+                r[i] = TMatrix4<T, S>((T)0.0, (T)0.0, (T)0.0, (T)0.0,
+                                      (T)0.0, (T)0.0, (T)0.0, (T)0.0,
+                                      (T)0.0, (T)0.0, (T)0.0, (T)0.0,
+                                      (T)0.0, (T)0.0, (T)0.0, (T)0.0);
+                invertible = false;
+            }
+        }
+
+        return invertible;
+    }
+
+    template<RealType T, bool S>
+    void TransformPoints(const TMatrix4<T, S>& m, const TVector3SoA<T>& v, TVector3SoA<T>& r)
+    {
+        r.Resize(v.Size());
+        Detail::compute_mat4_soa_transform<T, SIMD::use_simd<T, 4, true>::value>::map(r, m, v, (T)1.0);
+    }
+
+    template<RealType T, bool S>
+    void TransformDirections(const TMatrix4<T, S>& m, const TVector3SoA<T>& v, TVector3SoA<T>& r)
+    {
+        r.Resize(v.Size());
+        Detail::compute_mat4_soa_transform<T, SIMD::use_simd<T, 4, true>::value>::map(r, m, v, (T)0.0);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#include <span>
+#include <type_traits>
+
+#ifndef NORMAL_ENCODING_H
+#define NORMAL_ENCODING_H
+
+namespace Phanes::Core::Math {
+
+    // Compressed unit vectors (normals, tangents, directions) and SNORM / UNORM integer formats.
+    //
+    // Octahedral encoding projects the unit sphere onto the octahedron |x| + |y| + |z| = 1, folds the lower half over
+    // the diagonals and stores the resulting square as two SNORM integers. Decoded vectors are normalized. Round trip error
+    // (all backends): TOctNormal16 (4 bytes) at most 6.5e-5 rad (0.004 deg), TOctNormal8 (2 bytes) at most 0.017 rad (1 deg).
+    //
+    // SNORM: round(clamp(v, -1, 1) * max), decoded max(i / max, -1). UNORM: round(clamp(v, 0, 1) * max), decoded i / max.
+    // Rounding is to nearest even and NaN encodes to 0, like the GPU formats (D3D / Vulkan).
+    //
+    // T is the type the formats decode to.
+
+    // Octahedral unit vector, 2 x 16 bit SNORM
+
+    template<RealType T>
+    struct TOctNormal16 {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// First octahedral coordinate
+        /// </summary>
+        Phanes::Core::Types::int16 x;
+
+        /// <summary>
+        /// Second octahedral coordinate
+        /// </summary>
+        Phanes::Core::Types::int16 y;
+
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        TOctNormal16() = default;
+
+        /// <summary>
+        /// Encodes the direction of v. v must not be zero, zero encodes (0, 0, 1).
+        /// </summary>
+        /// <param name="v">Vector, does not need to be normalized</param>
+        template<bool S>
+        explicit TOctNormal16(const TVector3<T, S>& v);
+
+        /// <summary>
+        /// Decodes the unit vector.
+        /// </summary>
+        /// <typeparam name="S">Result is aligned?</typeparam>
+        template<bool S = false>
+        TVector3<T, S> Get() const;
+    };
+
+    // Octahedral unit vector, 2 x 8 bit SNORM
+
+    template<RealType T>
+    struct TOctNormal8 {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// First octahedral coordinate
+        /// </summary>
+        Phanes::Core::Types::int8 x;
+
+        /// <summary>
+        /// Second octahedral coordinate
+        /// </summary>
+        Phanes::Core::Types::int8 y;
+
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        TOctNormal8() = default;
+
+        /// <summary>
+        /// Encodes the direction of v. v must not be zero, zero encodes (0, 0, 1).
+        /// </summary>
+        /// <param name="v">Vector, does not need to be normalized</param>
+        template<bool S>
+        explicit TOctNormal8(const TVector3<T, S>& v);
+
+        /// <summary>
+        /// Decodes the unit vector.
+        /// </summary>
+        /// <typeparam name="S">Result is aligned?</typeparam>
+        template<bool S = false>
+        TVector3<T, S> Get() const;
+    };
+
+
+    template<RealType T>
+    constexpr bool operator== (const TOctNormal16<T>& v1, const TOctNormal16<T>& v2)
+    {
+        return v1.x == v2.x && v1.y == v2.y;
+    }
+
+    template<RealType T>
+    constexpr bool operator== (const TOctNormal8<T>& v1, const TOctNormal8<T>& v2)
+    {
+        return v1.x == v2.x && v1.y == v2.y;
+    }
+
+
+    // ======================== //
+    //   Octahedral (batches)   //
+    // ======================== //
+
+    /// <summary>
+    /// Encodes the directions of count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count encoded normals</param>
+    /// <param name="v">Array of vectors, do not need to be normalized</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Pack(TOctNormal16<T>* r, const TVector3<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Encodes the directions of count vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count encoded normals</param>
+    /// <param name="v">Array of vectors, do not need to be normalized</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Pack(TOctNormal8<T>* r, const TVector3<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Decodes count unit vectors. w of the result is zero.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count vectors</param>
+    /// <param name="v">Array of encoded normals</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const TOctNormal16<T>* v, size_t count);
+
+    /// <summary>
+    /// Decodes count unit vectors. w of the result is zero.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least count vectors</param>
+    /// <param name="v">Array of encoded normals</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const TOctNormal8<T>* v, size_t count);
+
+
+    // ====================== //
+    //   SNORM / UNORM        //
+    // ====================== //
+
+    /// <summary>
+    /// Encodes v as 16 bit SNORM (-1 to 1 in steps of 1 / 32767).
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Values, clamped to [-1, 1]</param>
+    template<RealType T>
+    void PackSNorm(std::span<Phanes::Core::Types::int16> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Encodes v as 8 bit SNORM (-1 to 1 in steps of 1 / 127).
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Values, clamped to [-1, 1]</param>
+    template<RealType T>
+    void PackSNorm(std::span<Phanes::Core::Types::int8> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Encodes v as 16 bit UNORM (0 to 1 in steps of 1 / 65535).
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Values, clamped to [0, 1]</param>
+    template<RealType T>
+    void PackUNorm(std::span<Phanes::Core::Types::uint16> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Encodes v as 8 bit UNORM (0 to 1 in steps of 1 / 255).
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Values, clamped to [0, 1]</param>
+    template<RealType T>
+    void PackUNorm(std::span<Phanes::Core::Types::uint8> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Decodes 16 bit SNORM values.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Encoded values</param>
+    template<RealType T>
+    void UnpackSNorm(std::span<T> r, std::span<const Phanes::Core::Types::int16> v);
+
+    /// <summary>
+    /// Decodes 8 bit SNORM values.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Encoded values</param>
+    template<RealType T>
+    void UnpackSNorm(std::span<T> r, std::span<const Phanes::Core::Types::int8> v);
+
+    /// <summary>
+    /// Decodes 16 bit UNORM values.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Encoded values</param>
+    template<RealType T>
+    void UnpackUNorm(std::span<T> r, std::span<const Phanes::Core::Types::uint16> v);
+
+    /// <summary>
+    /// Decodes 8 bit UNORM values.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Result, stops after min(v.size(), r.size()) elements</param>
+    /// <param name="v">Encoded values</param>
+    template<RealType T>
+    void UnpackUNorm(std::span<T> r, std::span<const Phanes::Core::Types::uint8> v);
+
+} // Phanes::Core::Math
+
+#endif // !NORMAL_ENCODING_H
+
+#include "Core/Math/Vector3.hpp"
+
+#include "Core/Math/NormalEncoding.inl"
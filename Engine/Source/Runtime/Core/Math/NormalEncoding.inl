@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/NormalEncodingDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <algorithm>
+
+
+namespace Phanes::Core::Math
+{
+    static_assert(sizeof(TOctNormal16<float>) == 4 && sizeof(TOctNormal8<float>) == 2);
+
+    template<RealType T>
+    template<bool S>
+    TOctNormal16<T>::TOctNormal16(const TVector3<T, S>& v)
+    {
+        Detail::compute_oct_pack<T, S>::map(this, &v, 1);
+    }
+
+    template<RealType T>
+    template<bool S>
+    TVector3<T, S> TOctNormal16<T>::Get() const
+    {
+        TVector3<T, S> r;
+        Detail::compute_oct_unpack<T, S>::map(&r, this, 1);
+        return r;
+    }
+
+    template<RealType T>
+    template<bool S>
+    TOctNormal8<T>::TOctNormal8(const TVector3<T, S>& v)
+    {
+        Detail::compute_oct_pack<T, S>::map(this, &v, 1);
+    }
+
+    template<RealType T>
+    template<bool S>
+    TVector3<T, S> TOctNormal8<T>::Get() const
+    {
+        TVector3<T, S> r;
+        Detail::compute_oct_unpack<T, S>::map(&r, this, 1);
+        return r;
+    }
+
+
+    template<RealType T, bool S>
+    void Pack(TOctNormal16<T>* r, const TVector3<T, S>* v, size_t count)
+    {
+        Detail::compute_oct_pack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Pack(TOctNormal8<T>* r, const TVector3<T, S>* v, size_t count)
+    {
+        Detail::compute_oct_pack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const TOctNormal16<T>* v, size_t count)
+    {
+        Detail::compute_oct_unpack<T, S>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Unpack(TVector3<T, S>* r, const TOctNormal8<T>* v, size_t count)
+    {
+        Detail::compute_oct_unpack<T, S>::map(r, v, count);
+    }
+
+
+    template<RealType T>
+    void PackSNorm(std::span<Phanes::Core::Types::int16> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_norm_pack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void PackSNorm(std::span<Phanes::Core::Types::int8> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_norm_pack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void PackUNorm(std::span<Phanes::Core::Types::uint16> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_norm_pack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void PackUNorm(std::span<Phanes::Core::Types::uint8> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_norm_pack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void UnpackSNorm(std::span<T> r, std::span<const Phanes::Core::Types::int16> v)
+    {
+        Detail::compute_norm_unpack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void UnpackSNorm(std::span<T> r, std::span<const Phanes::Core::Types::int8> v)
+    {
+        Detail::compute_norm_unpack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void UnpackUNorm(std::span<T> r, std::span<const Phanes::Core::Types::uint16> v)
+    {
+        Detail::compute_norm_unpack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void UnpackUNorm(std::span<T> r, std::span<const Phanes::Core::Types::uint8> v)
+    {
+        Detail::compute_norm_unpack<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+}
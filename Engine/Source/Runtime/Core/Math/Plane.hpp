@@ -1,8 +1,5 @@
 #pragma once
 
-
-// TODO: Transform
-
 #include "Core/Math/Boilerplate.h"
 #include "Core/Math/MathFwd.h"
 
@@ -10,6 +7,11 @@
 #include "Core/Math/Ray.hpp"
 #include "Core/Math/Vector3.hpp"
 
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <type_traits>
+
 namespace Phanes::Core::Math {
 
     // Plane in 3D space, defined as:  P: ax + by + cz = d;
@@ -24,23 +26,14 @@ namespace Phanes::Core::Math {
         {
             struct
             {
-                union
-                {
-                    struct
-                    {
-                        /** X Part of the normal. */
-                        Real x;
-                
-                        /** Y Part of the normal. */
-                        Real y;
+                /** X Part of the normal. */
+                Real x;
 
-                        /** Z Part of the normal. */
-                        Real z;
-                    };
+                /** Y Part of the normal. */
+                Real y;
 
-                    TVector3<Real, S> normal;
-
-                };
+                /** Z Part of the normal. */
+                Real z;
 
                 /// <summary>
                 /// Scalar component of plane
@@ -48,6 +41,11 @@ namespace Phanes::Core::Math {
                 Real d;
             };
 
+            /// <summary>
+            /// Normal of the plane. TVector3 is padded to four components, its last component aliases d.
+            /// </summary>
+            TVector3<Real, S> normal;
+
             /// <summary>
             /// Vector containing all components of vector (x, y, z and d).
             /// </summary>
@@ -105,6 +103,24 @@ namespace Phanes::Core::Math {
     };
 
 
+    // Result of a line or ray plane test. The point is base + t * direction (origin + t * direction for rays).
+
+    template<RealType T>
+    struct TPlaneHit
+    {
+        /** Point of intersection, only meaningful if hit is true */
+        TVector3<T, false> point;
+
+        /** Line / ray parameter of the point */
+        T t;
+
+        /** True, if the plane is hit */
+        bool hit;
+
+        constexpr explicit operator bool() const { return hit; }
+    };
+
+
     // ======================== //
     //   Operators for TPlane   //
     // ======================== //
@@ -424,11 +440,11 @@ namespace Phanes::Core::Math {
     template<RealType T>
     TPlane<T, false> PlaneNormalizeV(TPlane<T, false>& pl1)
     {
-        T normVec = SqrMagnitude(pl1);
+        T normVec = SqrMagnitude(pl1.normal);
 
         T scale = (normVec > P_FLT_INAC) ? (T)1.0 / sqrt(normVec) : 1.0f;
 
-        pl1.normal *= scale; pl1.d *= scale;
+        pl1.comp *= scale;
 
         return pl1;
     }
@@ -444,7 +460,7 @@ namespace Phanes::Core::Math {
     template<RealType T>
     TPlane<T, false> PlaneNormalize(TPlane<T, false>& pl1)
     {
-        T normVec = SqrMagnitude(pl1);
+        T normVec = SqrMagnitude(pl1.normal);
 
         T scale = (normVec > P_FLT_INAC) ? (T)1.0 / sqrt(normVec) : 1.0f;
 
@@ -462,9 +478,9 @@ namespace Phanes::Core::Math {
     template<RealType T>
     TPlane<T, false> PlaneUnsafeNormalizeV(TPlane<T, false>& pl1)
     {
-        T scale = (T)1.0 / Magnitude(pl1);
+        T scale = (T)1.0 / Magnitude(pl1.normal);
 
-        pl1.normal *= scale; pl1.d *= scale;
+        pl1.comp *= scale;
 
         return pl1;
     }
@@ -482,7 +498,47 @@ namespace Phanes::Core::Math {
     template<RealType T>
     TPlane<T, false> PlaneUnsafeNormalize(TPlane<T, false>& pl1)
     {
-        T scale = (T)1.0 / Magnitude(pl1);
+        T scale = (T)1.0 / Magnitude(pl1.normal);
+
+        return TPlane<T, false>(pl1.normal * scale, pl1.d * scale);
+    }
+
+    /**
+     * Normalizes plane with FastInvSqrt.
+     *
+     * @param(pl1) Plane
+     *
+     * @note R refines the estimate with one Newton-Raphson step. See FastInvSqrt for the error bounds.
+     */
+
+    template<bool R = true, RealType T>
+    TPlane<T, false> PlaneFastNormalizeV(TPlane<T, false>& pl1)
+    {
+        T normVec = SqrMagnitude(pl1.normal);
+
+        T scale = (normVec > P_FLT_INAC) ? FastInvSqrt<R>(normVec) : (T)1.0;
+
+        pl1.comp *= scale;
+
+        return pl1;
+    }
+
+    /**
+     * Normalizes plane with FastInvSqrt.
+     *
+     * @param(pl1) Plane
+     *
+     * @return Normalized plane
+     *
+     * @note R refines the estimate with one Newton-Raphson step. See FastInvSqrt for the error bounds.
+     */
+
+    template<bool R = true, RealType T>
+    TPlane<T, false> PlaneFastNormalize(const TPlane<T, false>& pl1)
+    {
+        T normVec = SqrMagnitude(pl1.normal);
+
+        T scale = (normVec > P_FLT_INAC) ? FastInvSqrt<R>(normVec) : (T)1.0;
 
         return TPlane<T, false>(pl1.normal * scale, pl1.d * scale);
     }
@@ -533,10 +589,10 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T>
-    TPlane<T, false> FlipV(const TPlane<T, false>& pl1)
+    TPlane<T, false> FlipV(TPlane<T, false>& pl1)
     {
-        pl1.normal = -pl1.normal;
-        pl1.d      = -pl1.d;
+        pl1.comp = -pl1.comp;
+        return pl1;
     }
 
 
@@ -557,31 +613,29 @@ namespace Phanes::Core::Math {
     /**
      * Transform plane with Transform
      * 
-     * @param(pl) Plane
+     * @param(pl) Plane (normalized)
      * @param(tr) Transform
+     *
+     * @return Transformed plane.
+     * @note The normal of the transformed plane is normalized.
      */
 
-    template<RealType T>
-    FORCEINLINE TPlane<T, false> TransformV(TPlane<T, false>& pl, const TTransform<T>& tr)
-    {
-        // TODO: Do with operator*
-    }
+    template<RealType T, bool S>
+    TPlane<T, S>& TransformV(TPlane<T, S>& pl, const TTransform<T, S>& tr);
 
 
     /**
      * Transform plane with Transform
      *
-     * @param(pl) Plane
+     * @param(pl) Plane (normalized)
      * @param(tr) Transform
      * 
      * @return Transformed plane.
+     * @note The normal of the transformed plane is normalized.
      */
 
-    template<RealType T>
-    FORCEINLINE TPlane<T, false> Transform(const TPlane<T, false>& pl, const TTransform<T>& tr)
-    {
-        // TODO: Do with operator*
-    }
+    template<RealType T, bool S>
+    TPlane<T, S> Transform(const TPlane<T, S>& pl, const TTransform<T, S>& tr);
 
     /**
      * Calculates distance bewteen point and plane.
@@ -818,6 +872,32 @@ namespace Phanes::Core::Math {
         return (Equals(DotP(pl1.normal, p1), p1.d));
     }
 
+    /**
+     * Intersects two planes.
+     * 
+     * @param(pl1) Plane one
+     * @param(pl2) Plane two
+     * @param(threshold) Threshold for parallel planes.
+     * 
+     * @return Line of intersection with normalized direction and the point closest to the origin as base, or nothing if the planes are parallel.
+     */
+
+    template<RealType T>
+    std::optional<TLine<T>> PlanesIntersect2(const TPlane<T, false>& pl1, const TPlane<T, false>& pl2, T threshold = P_FLT_INAC)
+    {
+        TVector3<T, false> dirLine = CrossP(pl1.normal, pl2.normal);
+        T det = SqrMagnitude(dirLine);
+
+        if (det > threshold)
+        {
+            TLine<T> interLine(dirLine, (CrossP(pl2.normal, dirLine) * pl1.d + CrossP(dirLine, pl1.normal) * pl2.d) / det);
+            NormalizeV(interLine);
+            return interLine;
+        }
+
+        return std::nullopt;
+    }
+
     /**
      * Tests whether two planes intersect. Sets line to intersection-line if true.
      * 
@@ -827,24 +907,48 @@ namespace Phanes::Core::Math {
      * @param(threshold) Threshold for parallel planes.
      * 
      * @return True, if planes intersect, false, if not.
+     *
+     * @note Writes to *interLine, which has to be allocated by the caller.
      */
 
     template<RealType T>
     bool PlanesIntersect2(const TPlane<T, false>& pl1, const TPlane<T, false>& pl2, Ref<TLine<T>> interLine, T threshold = P_FLT_INAC)
     {
-        TVector3<T, false> dirLine = CrossP(pl1.normal, pl2.normal);
-        T det = SqrMagnitude(dirLine);
+        std::optional<TLine<T>> l = PlanesIntersect2(pl1, pl2, threshold);
 
-        if (abs(det) > P_FLT_INAC)
+        if (l)
         {
-            interLine = MakeRef<TLine<T>>(dirLine, (CrossP(dirLine, pl2.normal) * pl1.d + CrossP(dirLine, pl1.normal) * pl2.d) / det);
-            NormalizeV(interLine);
+            *interLine = *l;
             return true;
         }
-        
+
         return false;
     }
 
+    /**
+     * Intersects three planes.
+     *
+     * @param(pl1) Plane one
+     * @param(pl2) Plane two
+     * @param(pl3) Plane three
+     * @param(threshold) Threshold for parallel planes.
+     *
+     * @return Point of intersection, or nothing if two of the planes are parallel.
+     */
+
+    template<RealType T>
+    std::optional<TVector3<T, false>> PlanesIntersect3(const TPlane<T, false>& pl1, const TPlane<T, false>& pl2, const TPlane<T, false>& pl3, T threshold = P_FLT_INAC)
+    {
+        T det = DotP(CrossP(pl1.normal, pl2.normal), pl3.normal);
+
+        if (Abs(det) > threshold)
+        {
+            return (CrossP(pl2.normal, pl3.normal) * pl1.d + CrossP(pl3.normal, pl1.normal) * pl2.d + CrossP(pl1.normal, pl2.normal) * pl3.d) / det;
+        }
+
+        return std::nullopt;
+    }
+
     /**
      * Tests whether three planes intersect. Sets line to intersection-line if true.
      *
@@ -855,16 +959,18 @@ namespace Phanes::Core::Math {
      * @param(threshold) Threshold for parallel planes.
      *
      * @return True, if all planes intersect, false, if not.
+     *
+     * @note Writes to *interPoint, which has to be allocated by the caller.
      */
 
     template<RealType T>
     bool PlanesIntersect3(const TPlane<T, false>& pl1, const TPlane<T, false>& pl2, const TPlane<T, false>& pl3, Ref<TVector3<T, false>> interPoint, T threshold = P_FLT_INAC)
     {
-        T det = DotP(CrossP(pl1.normal, pl2.normal), pl3.normal);
+        std::optional<TVector3<T, false>> p = PlanesIntersect3(pl1, pl2, pl3, threshold);
 
-        if (abs(det) > P_FLT_INAC)
+        if (p)
         {
-            interPoint = MakeRef<TVector3<T, false>>((CrossP(pl3.normal, pl2.normal) * pl1.d + CrossP(pl1.normal, pl3.normal) * pl2.d) / det);
+            *interPoint = *p;
             return true;
         }
 
@@ -901,6 +1007,24 @@ namespace Phanes::Core::Math {
         return p1 - PointDistance(pl1, p1) * pl1.normal;
     }
 
+    /**
+     * Calculates the intersection point, of a line with a plane, if there is one
+     *
+     * @param(pl1) Plane
+     * @param(l1) Line
+     * 
+     * @return Intersection. hit is false, if the line is parallel to the plane.
+     */
+
+    template<RealType T>
+    TPlaneHit<T> LineIntersect(const TPlane<T, false>& pl1, const TLine<T>& l1)
+    {
+        T dotProduct = DotP(l1.direction, pl1.normal);
+        T t = (pl1.d - DotP(pl1.normal, l1.base)) / dotProduct;
+
+        return TPlaneHit<T>{ l1.base + l1.direction * t, t, Abs(dotProduct) > P_FLT_INAC };
+    }
+
     /**
      * Calculates the intersection point, of a line with a plane, if there is one
      *
@@ -909,20 +1033,64 @@ namespace Phanes::Core::Math {
      * @param(p1) Point
      * 
      * @return True, if they intersect, false if not.
+     *
+     * @note Writes to *p1, which has to be allocated by the caller.
      */
 
     template<RealType T>
     bool LineIntersect(const TPlane<T, false>& pl1, const TLine<T>& l1, Ref<TVector3<T, false>> p1)
     {
-        T dotProduct = DotP(l1.normal, pl1.normal);
+        TPlaneHit<T> h = LineIntersect(pl1, l1);
 
-        if (abs(dotProduct) > P_FLT_INAC)
+        if (h.hit)
         {
-            p1 = MakeRef<TVector3<T, false>>(l1.base - l1.normal * (DotP(l1.normal * p1.base) / dotProduct));
-            return true;
+            *p1 = h.point;
         }
 
-        return false;
+        return h.hit;
+    }
+
+    /**
+     * Intersects lines with a plane. Stops after min(l.size(), r.size()) lines.
+     *
+     * @param(pl1) Plane
+     * @param(l) Lines
+     * @param(r) Intersections
+     *
+     * @return Number of lines, that intersect the plane.
+     */
+
+    template<RealType T>
+    size_t LineIntersect(const TPlane<T, false>& pl1, std::type_identity_t<std::span<const TLine<T>>> l, std::type_identity_t<std::span<TPlaneHit<T>>> r)
+    {
+        const size_t n = std::min(l.size(), r.size());
+        size_t hits = 0;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            r[i] = LineIntersect(pl1, l[i]);
+            hits += r[i].hit;
+        }
+
+        return hits;
+    }
+
+    /**
+     * Calculates, the intersection point, of a plane and a ray.
+     * 
+     * @param(pl1) Plane
+     * @param(r1) Ray
+     * 
+     * @return Intersection. hit is false, if the ray is parallel to the plane or points away from it.
+     */
+
+    template<RealType T>
+    TPlaneHit<T> RayIntersect(const TPlane<T, false>& pl1, const TRay<T, false>& r1)
+    {
+        T pr = DotP(pl1.normal, r1.direction);
+        T t = (pl1.d - DotP(pl1.normal, r1.origin)) / pr;
+
+        return TPlaneHit<T>{ PointAt(r1, t), t, Abs(pr) > P_FLT_INAC && t >= (T)0.0 };
     }
 
     /**
@@ -933,21 +1101,46 @@ namespace Phanes::Core::Math {
      * @param(p1) Intersection point
      * 
      * @return True, if they intersect, false if not.
+     *
+     * @note Writes to *p1, which has to be allocated by the caller.
      */
 
     template<RealType T>
     bool RayIntersect(const TPlane<T, false>& pl1, const TRay<T, false>& r1, Ref<TVector3<T, false>> p1)
     {
-        T pr = DotP(pl1.normal, Normalize(r1.direction));
-        T parameter = DotP((GetOrigin(pl1) - r1.origin), pl1.normal) / pr;
+        TPlaneHit<T> h = RayIntersect(pl1, r1);
 
-        if (p1 > P_FLT_INAC && parameter >= 0)
+        if (h.hit)
         {
-            p1 = MakeRef<TVector3<T, false>>(PointAt(r1, parameter));
-            return true;
+            *p1 = h.point;
         }
 
-        return false;
+        return h.hit;
+    }
+
+    /**
+     * Intersects rays with a plane. Stops after min(r1.size(), r.size()) rays.
+     *
+     * @param(pl1) Plane
+     * @param(r1) Rays
+     * @param(r) Intersections
+     *
+     * @return Number of rays, that hit the plane.
+     */
+
+    template<RealType T>
+    size_t RayIntersect(const TPlane<T, false>& pl1, std::type_identity_t<std::span<const TRay<T, false>>> r1, std::type_identity_t<std::span<TPlaneHit<T>>> r)
+    {
+        const size_t n = std::min(r1.size(), r.size());
+        size_t hits = 0;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            r[i] = RayIntersect(pl1, r1[i]);
+            hits += r[i].hit;
+        }
+
+        return hits;
     }
 
 } // Phanes::Core::Math
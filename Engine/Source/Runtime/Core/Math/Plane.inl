@@ -40,14 +40,14 @@ namespace Phanes::Core::Math
     template<RealType T, bool S>
     TPlane<T, S> operator+=(TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        Detail::compute_plane_add(pl1, pl1, pl2);
+        Detail::compute_plane_add<T, S>::map(pl1, pl1, pl2);
         return pl1;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator+=(TPlane<T, S>& pl1, T s)
     {
-        Detail::compute_plane_add(pl1, pl1, s);
+        Detail::compute_plane_add<T, S>::map(pl1, pl1, s);
         return pl1;
     }
 
@@ -55,7 +55,7 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator+(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_add(r, pl1, pl2);
+        Detail::compute_plane_add<T, S>::map(r, pl1, pl2);
         return r;
     }
 
@@ -63,21 +63,21 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator+(const TPlane<T, S>& pl1, T s)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_add(r, pl1, s);
+        Detail::compute_plane_add<T, S>::map(r, pl1, s);
         return r;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator-=(TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        Detail::compute_plane_sub(pl1, pl1, pl2);
+        Detail::compute_plane_sub<T, S>::map(pl1, pl1, pl2);
         return pl1;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator-=(TPlane<T, S>& pl1, T s)
     {
-        Detail::compute_plane_sub(pl1, pl1, s);
+        Detail::compute_plane_sub<T, S>::map(pl1, pl1, s);
         return pl1;
     }
 
@@ -85,7 +85,7 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator-(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_sub(r, pl1, pl2);
+        Detail::compute_plane_sub<T, S>::map(r, pl1, pl2);
         return r;
     }
 
@@ -93,21 +93,21 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator-(const TPlane<T, S>& pl1, T s)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_sub(r, pl1, s);
+        Detail::compute_plane_sub<T, S>::map(r, pl1, s);
         return r;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator*=(TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        Detail::compute_plane_mul(pl1, pl1, pl2);
+        Detail::compute_plane_mul<T, S>::map(pl1, pl1, pl2);
         return pl1;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator*=(TPlane<T, S>& pl1, T s)
     {
-        Detail::compute_plane_mul(pl1, pl1, s);
+        Detail::compute_plane_mul<T, S>::map(pl1, pl1, s);
         return pl1;
     }
 
@@ -115,7 +115,7 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator*(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_mul(r, pl1, pl2);
+        Detail::compute_plane_mul<T, S>::map(r, pl1, pl2);
         return r;
     }
 
@@ -123,21 +123,21 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator*(const TPlane<T, S>& pl1, T s)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_mul(r, pl1, s);
+        Detail::compute_plane_mul<T, S>::map(r, pl1, s);
         return r;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator/=(TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
-        Detail::compute_plane_div(pl1, pl1, pl2);
+        Detail::compute_plane_div<T, S>::map(pl1, pl1, pl2);
         return pl1;
     }
 
     template<RealType T, bool S>
     TPlane<T, S> operator/=(TPlane<T, S>& pl1, T s)
     {
-        Detail::compute_plane_div(pl1, pl1, s);
+        Detail::compute_plane_div<T, S>::map(pl1, pl1, s);
         return pl1;
     }
 
@@ -145,7 +145,7 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator/(const TPlane<T, S>& pl1, const TPlane<T, S>& pl2)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_sub(r, pl1, pl2);
+        Detail::compute_plane_div<T, S>::map(r, pl1, pl2);
         return r;
     }
 
@@ -153,7 +153,22 @@ namespace Phanes::Core::Math
     TPlane<T, S> operator/(const TPlane<T, S>& pl1, T s)
     {
         TPlane<T, S> r;
-        Detail::compute_plane_sub(r, pl1, s);
+        Detail::compute_plane_div<T, S>::map(r, pl1, s);
         return r;
     }
-}
\ No newline at end of file
+
+    template<RealType T, bool S>
+    TPlane<T, S>& TransformV(TPlane<T, S>& pl, const TTransform<T, S>& tr)
+    {
+        Detail::compute_plane_transform<T, S>::map(pl, pl, tr);
+        return pl;
+    }
+
+    template<RealType T, bool S>
+    TPlane<T, S> Transform(const TPlane<T, S>& pl, const TTransform<T, S>& tr)
+    {
+        TPlane<T, S> r;
+        Detail::compute_plane_transform<T, S>::map(r, pl, tr);
+        return r;
+    }
+}
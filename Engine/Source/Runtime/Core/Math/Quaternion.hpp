@@ -7,13 +7,21 @@
 #include "Core/Math/SIMD/Storage.h"
 #include "Core/Math/Vector3.hpp"
 #include "Core/Math/Vector4.hpp"
+#include "Core/Math/Matrix3.hpp"
+#include "Core/Math/Matrix4.hpp"
+
+#include <type_traits>
 
 #ifndef QUATERNION_H
 #	define QUATERNION_H
 
+#	define PIdentityQuaternion(type, aligned) Phanes::Core::Math::TQuaternion<type, aligned>(0, 0, 0, 1)
+
 namespace Phanes::Core::Math
 {
-	// Quaternion
+	// Quaternion (x, y, z) + w, where w is the scalar part.
+	// Rotations are described by unit quaternions.
+
 	template <RealType T, bool S>
 	struct TQuaternion
 	{
@@ -24,10 +32,25 @@ namespace Phanes::Core::Math
 		{
 			struct
 			{
-				float x;
-				float y;
-				float z;
-				float w;
+				/// <summary>
+				/// X component of vector part
+				/// </summary>
+				Real x;
+
+				/// <summary>
+				/// Y component of vector part
+				/// </summary>
+				Real y;
+
+				/// <summary>
+				/// Z component of vector part
+				/// </summary>
+				Real z;
+
+				/// <summary>
+				/// Scalar part
+				/// </summary>
+				Real w;
 			};
 			union
 			{
@@ -69,17 +92,446 @@ namespace Phanes::Core::Math
 		explicit TQuaternion(const Real* comp);
 
 		/**
-		 * Construct from euler angles (yaw, pitch, roll)
+		 * Construct from euler angles in radians (x = yaw, y = pitch, z = roll).
+		 *
+		 * @note Yaw rotates around the z axis, pitch around the y axis and roll around the x axis. The rotations are applied in the order roll, pitch, yaw.
 		 */
 		explicit TQuaternion(const TVector3<Real, S>& euler_angels);
 
 		/**
-		 * Construct from Transformation
+		 * Construct from the rotation of a transform.
+		 */
+		explicit TQuaternion(const TTransform<Real, S>& t);
+
+		/**
+		 * Construct from rotation matrix.
+		 *
+		 * @note The matrix is assumed to be orthonormal.
 		 */
+		explicit TQuaternion(const TMatrix3<Real, S>& m);
 
-		explicit TQuaternion(const TTransform<Real>& t);
+		/**
+		 * Construct from the rotation part (upper 3x3) of a transformation matrix.
+		 *
+		 * @note The rotation part is assumed to be orthonormal (no scale).
+		 */
 		explicit TQuaternion(const TMatrix4<Real, S>& t);
 	};
+
+
+	// ======================== //
+	//   TQuaternion operators  //
+	// ======================== //
+
+	/// <summary>
+	/// Hamilton product. Applies the rotation of q2, then the rotation of q1.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& operator*=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Scales quaternion.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <param name="s">Scalar</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& operator*=(TQuaternion<T, S>& q1, T s);
+
+	/// <summary>
+	/// Divides quaternion by scalar.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <param name="s">Scalar</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& operator/=(TQuaternion<T, S>& q1, T s);
+
+	/// <summary>
+	/// Componentwise addition.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& operator+=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Componentwise substraction.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& operator-=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Hamilton product. Applies the rotation of q2, then the rotation of q1.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>Product of q1 and q2</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Scales quaternion.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <param name="s">Scalar</param>
+	/// <returns>Scaled quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, T s);
+
+	/// <summary>
+	/// Scales quaternion.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="s">Scalar</param>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Scaled quaternion</returns>
+	template <RealType T, bool S>
+	FORCEINLINE TQuaternion<T, S> operator*(T s, const TQuaternion<T, S>& q1)
+	{
+		return q1 * s;
+	}
+
+	/// <summary>
+	/// Divides quaternion by scalar.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <param name="s">Scalar</param>
+	/// <returns>Divided quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> operator/(const TQuaternion<T, S>& q1, T s);
+
+	/// <summary>
+	/// Rotates vector by q. q has to be normalized.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q">Rotation</param>
+	/// <param name="v">Vector</param>
+	/// <returns>Rotated vector</returns>
+	template <RealType T, bool S>
+	TVector3<T, S> operator*(const TQuaternion<T, S>& q, const TVector3<T, S>& v);
+
+	/// <summary>
+	/// Componentwise addition.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>Sum of q1 and q2</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> operator+(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Componentwise substraction.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>Difference of q1 and q2</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> operator-(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Negates all components. -q describes the same rotation as q.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Negated quaternion</returns>
+	template <RealType T, bool S>
+	FORCEINLINE TQuaternion<T, S> operator-(const TQuaternion<T, S>& q1)
+	{
+		return q1 * (T)-1.0;
+	}
+
+	/// <summary>
+	/// Tests two quaternions for equality.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>True if equal, false if not.</returns>
+	/// <remarks>Compares the components. q and -q describe the same rotation but are not equal.</remarks>
+	template <RealType T, bool S>
+	bool operator==(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Tests two quaternions for inequality.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>True if inequal, false if not.</returns>
+	template <RealType T, bool S>
+	bool operator!=(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+
+	// ========================= //
+	//   TQuaternion functions   //
+	// ========================= //
+
+	/// <summary>
+	/// Creates a rotation around an axis.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="axis">Normalized rotation axis</param>
+	/// <param name="angle">Angle in radians</param>
+	/// <returns>Unit quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> FromAxisAngle(const TVector3<T, S>& axis, T angle);
+
+	/// <summary>
+	/// Dot product of two quaternions.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion one</param>
+	/// <param name="q2">Quaternion two</param>
+	/// <returns>Dot product</returns>
+	template <RealType T, bool S>
+	T DotP(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2);
+
+	/// <summary>
+	/// Get magnitude of quaternion.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Magnitude</returns>
+	template <RealType T, bool S>
+	FORCEINLINE T Magnitude(const TQuaternion<T, S>& q1)
+	{
+		return sqrt(DotP(q1, q1));
+	}
+
+	/// <summary>
+	/// Get square of magnitude of quaternion.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Square of magnitude</returns>
+	template <RealType T, bool S>
+	FORCEINLINE T SqrMagnitude(const TQuaternion<T, S>& q1)
+	{
+		return DotP(q1, q1);
+	}
+
+	/// <summary>
+	/// Tests if quaternion is normalized.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <param name="threshold">Allowed inaccuracy</param>
+	/// <returns>True if normalized, false if not.</returns>
+	template <RealType T, bool S>
+	FORCEINLINE bool IsNormalized(const TQuaternion<T, S>& q1, T threshold = P_FLT_INAC)
+	{
+		return (abs(SqrMagnitude(q1) - (T)1.0) < threshold);
+	}
+
+	/// <summary>
+	/// Normalizes a quaternion. Quaternions with a magnitude smaller than P_FLT_INAC are returned as is.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Normalized quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> Normalize(const TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Normalizes a quaternion. Quaternions with a magnitude smaller than P_FLT_INAC are left as is.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& NormalizeV(TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Normalizes a quaternion.
+	/// </summary>
+	/// <remarks>Doesn't check for zero quaternion.</remarks>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Normalized quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> UnsafeNormalize(const TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Conjugates a quaternion (-x, -y, -z, w). The conjugate of a unit quaternion is its inverse.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Conjugate of q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> Conjugate(const TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Conjugates a quaternion (-x, -y, -z, w).
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& ConjugateV(TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Inverts a quaternion.
+	/// </summary>
+	/// <remarks>Doesn't check for zero quaternion. Use Conjugate for unit quaternions.</remarks>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>Inverse of q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> Inverse(const TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Inverts a quaternion.
+	/// </summary>
+	/// <remarks>Doesn't check for zero quaternion.</remarks>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Quaternion</param>
+	/// <returns>q1</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S>& InverseV(TQuaternion<T, S>& q1);
+
+	/// <summary>
+	/// Rotates vector by q. q has to be normalized.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q">Rotation</param>
+	/// <param name="v">Vector</param>
+	/// <returns>Rotated vector</returns>
+	template <RealType T, bool S>
+	TVector3<T, S> Rotate(const TQuaternion<T, S>& q, const TVector3<T, S>& v);
+
+	/// <summary>
+	/// Rotates vector by q. q has to be normalized.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="v">Vector</param>
+	/// <param name="q">Rotation</param>
+	/// <returns>v</returns>
+	template <RealType T, bool S>
+	TVector3<T, S>& RotateV(TVector3<T, S>& v, const TQuaternion<T, S>& q);
+
+	/// <summary>
+	/// Linearly interpolates q1 to q2 and normalizes the result. Takes the shortest path.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Starting rotation</param>
+	/// <param name="q2">Destination rotation</param>
+	/// <param name="t">0.0 to 1.0 interpolation value</param>
+	/// <returns>Interpolated unit quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> NLerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t);
+
+	/// <summary>
+	/// Spherically interpolates q1 to q2 with constant angular velocity. Takes the shortest path.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Starting rotation (normalized)</param>
+	/// <param name="q2">Destination rotation (normalized)</param>
+	/// <param name="t">0.0 to 1.0 interpolation value</param>
+	/// <returns>Interpolated unit quaternion</returns>
+	template <RealType T, bool S>
+	TQuaternion<T, S> Slerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t);
+
+	/// <summary>
+	/// Spherically interpolates q1 to q2 with constant angular velocity. Takes the shortest path.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q1">Starting rotation (normalized)</param>
+	/// <param name="q2">Destination rotation (normalized)</param>
+	/// <param name="t">Interpolation value</param>
+	/// <returns>Interpolated unit quaternion</returns>
+	/// <remarks>Does not clamp t between 0.0 and 1.0.</remarks>
+	template <RealType T, bool S>
+	TQuaternion<T, S> SlerpUnclamped(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t);
+
+	/// <summary>
+	/// Spherically interpolates q1[i] to q2[i] for all quaternions, e.g. to blend two animation poses.
+	/// </summary>
+	/// <remarks>
+	/// The SIMD backends evaluate the slerp weights with a polynomial instead of acos / sin (see PhanesBatchSSE.hpp),
+	/// the results differ from Slerp by less than 1e-4.
+	/// </remarks>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="r">Array of at least count quaternions, may alias q1 or q2</param>
+	/// <param name="q1">Starting rotations (normalized)</param>
+	/// <param name="q2">Destination rotations (normalized)</param>
+	/// <param name="t">0.0 to 1.0 interpolation value</param>
+	/// <param name="count">Number of quaternions</param>
+	template <RealType T, bool S>
+	void Slerp(TQuaternion<T, S>* r, const TQuaternion<T, S>* q1, const TQuaternion<T, S>* q2, std::type_identity_t<T> t, size_t count);
+
+	/// <summary>
+	/// Converts a unit quaternion to a rotation matrix.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q">Rotation (normalized)</param>
+	/// <returns>Rotation matrix</returns>
+	template <RealType T, bool S>
+	TMatrix3<T, S> ToMatrix3(const TQuaternion<T, S>& q);
+
+	/// <summary>
+	/// Converts a unit quaternion to a transformation matrix without translation.
+	/// </summary>
+	/// <typeparam name="T">Type of quaternion</typeparam>
+	/// <typeparam name="S">Quaternion is aligned?</typeparam>
+	/// <param name="q">Rotation (normalized)</param>
+	/// <returns>Transformation matrix</returns>
+	template <RealType T, bool S>
+	TMatrix4<T, S> ToMatrix4(const TQuaternion<T, S>& q);
+
 } // namespace Phanes::Core::Math
 
 #endif // QUATERNION_H
+
+#include "Core/Math/Quaternion.inl"
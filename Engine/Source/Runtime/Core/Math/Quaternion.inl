@@ -0,0 +1,328 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/QuaternionDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <type_traits>
+
+namespace Phanes::Core::Math
+{
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TVector4<T, S>& v)
+    {
+        Detail::construct_quat<T, S>::map(*this, v);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(Real _x, Real _y, Real _z, Real _w)
+    {
+        Detail::construct_quat<T, S>::map(*this, _x, _y, _z, _w);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TVector3<Real, S>& v, Real _w)
+    {
+        Detail::construct_quat<T, S>::map(*this, v, _w);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const Real* comp)
+    {
+        Detail::construct_quat<T, S>::map(*this, comp);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TVector3<Real, S>& euler_angels)
+    {
+        Detail::construct_quat_euler<T, S>::map(*this, euler_angels);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TMatrix3<Real, S>& m)
+    {
+        // Picks the largest of w, x, y, z as divisor to stay numerically stable.
+        T trace = m(0, 0) + m(1, 1) + m(2, 2);
+
+        if (trace > 0)
+        {
+            T s = sqrt(trace + (T)1.0) * (T)2.0;
+            Detail::construct_quat<T, S>::map(*this, (m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, (T)0.25 * s);
+        }
+        else if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2))
+        {
+            T s = sqrt((T)1.0 + m(0, 0) - m(1, 1) - m(2, 2)) * (T)2.0;
+            Detail::construct_quat<T, S>::map(*this, (T)0.25 * s, (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+        }
+        else if (m(1, 1) > m(2, 2))
+        {
+            T s = sqrt((T)1.0 + m(1, 1) - m(0, 0) - m(2, 2)) * (T)2.0;
+            Detail::construct_quat<T, S>::map(*this, (m(0, 1) + m(1, 0)) / s, (T)0.25 * s, (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+        }
+        else
+        {
+            T s = sqrt((T)1.0 + m(2, 2) - m(0, 0) - m(1, 1)) * (T)2.0;
+            Detail::construct_quat<T, S>::map(*this, (m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, (T)0.25 * s, (m(1, 0) - m(0, 1)) / s);
+        }
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TMatrix4<Real, S>& t)
+        : TQuaternion(TMatrix3<T, S>(t(0, 0), t(0, 1), t(0, 2),
+                                     t(1, 0), t(1, 1), t(1, 2),
+                                     t(2, 0), t(2, 1), t(2, 2)))
+    {}
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>::TQuaternion(const TTransform<Real, S>& t)
+        : TQuaternion(t.rotation)
+    {}
+
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& operator*=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_mul<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& operator*=(TQuaternion<T, S>& q1, T s)
+    {
+        Detail::compute_quat_mul<T, S>::map(q1, q1, s);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& operator/=(TQuaternion<T, S>& q1, T s)
+    {
+        Detail::compute_quat_div<T, S>::map(q1, q1, s);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& operator+=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_add<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& operator-=(TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        Detail::compute_quat_sub<T, S>::map(q1, q1, q2);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_mul<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator*(const TQuaternion<T, S>& q1, T s)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_mul<T, S>::map(r, q1, s);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator/(const TQuaternion<T, S>& q1, T s)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_div<T, S>::map(r, q1, s);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> operator*(const TQuaternion<T, S>& q, const TVector3<T, S>& v)
+    {
+        TVector3<T, S> r;
+        Detail::compute_quat_rotate<T, S>::map(r, q, v);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator+(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_add<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> operator-(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_sub<T, S>::map(r, q1, q2);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    bool operator==(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return Detail::compute_quat_eq<T, S>::map(q1, q2);
+    }
+
+    template<RealType T, bool S>
+    bool operator!=(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return Detail::compute_quat_ieq<T, S>::map(q1, q2);
+    }
+
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> FromAxisAngle(const TVector3<T, S>& axis, T angle)
+    {
+        return TQuaternion<T, S>(axis * (T)sin(angle * (T)0.5), (T)cos(angle * (T)0.5));
+    }
+
+    template<RealType T, bool S>
+    T DotP(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2)
+    {
+        return Detail::compute_quat_dotp<T, S>::map(q1, q2);
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Normalize(const TQuaternion<T, S>& q1)
+    {
+        if (SqrMagnitude(q1) < P_FLT_INAC)
+        {
+            return q1;
+        }
+
+        TQuaternion<T, S> r;
+        Detail::compute_quat_norm<T, S>::map(r, q1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& NormalizeV(TQuaternion<T, S>& q1)
+    {
+        if (SqrMagnitude(q1) >= P_FLT_INAC)
+        {
+            Detail::compute_quat_norm<T, S>::map(q1, q1);
+        }
+
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> UnsafeNormalize(const TQuaternion<T, S>& q1)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_norm<T, S>::map(r, q1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Conjugate(const TQuaternion<T, S>& q1)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_conj<T, S>::map(r, q1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& ConjugateV(TQuaternion<T, S>& q1)
+    {
+        Detail::compute_quat_conj<T, S>::map(q1, q1);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Inverse(const TQuaternion<T, S>& q1)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_inv<T, S>::map(r, q1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S>& InverseV(TQuaternion<T, S>& q1)
+    {
+        Detail::compute_quat_inv<T, S>::map(q1, q1);
+        return q1;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> Rotate(const TQuaternion<T, S>& q, const TVector3<T, S>& v)
+    {
+        TVector3<T, S> r;
+        Detail::compute_quat_rotate<T, S>::map(r, q, v);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S>& RotateV(TVector3<T, S>& v, const TQuaternion<T, S>& q)
+    {
+        Detail::compute_quat_rotate<T, S>::map(v, q, v);
+        return v;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> NLerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_nlerp<T, S>::map(r, q1, q2, Clamp(t, (T)0.0, (T)1.0));
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> Slerp(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_slerp<T, S>::map(r, q1, q2, Clamp(t, (T)0.0, (T)1.0));
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TQuaternion<T, S> SlerpUnclamped(const TQuaternion<T, S>& q1, const TQuaternion<T, S>& q2, T t)
+    {
+        TQuaternion<T, S> r;
+        Detail::compute_quat_slerp<T, S>::map(r, q1, q2, t);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    void Slerp(TQuaternion<T, S>* r, const TQuaternion<T, S>* q1, const TQuaternion<T, S>* q2, std::type_identity_t<T> t, size_t count)
+    {
+        Detail::compute_quat_batch_slerp<T, S>::map(r, q1, q2, Clamp(t, (T)0.0, (T)1.0), count);
+    }
+
+    template<RealType T, bool S>
+    TMatrix3<T, S> ToMatrix3(const TQuaternion<T, S>& q)
+    {
+        T xx = q.x * q.x;
+        T yy = q.y * q.y;
+        T zz = q.z * q.z;
+        T xy = q.x * q.y;
+        T xz = q.x * q.z;
+        T yz = q.y * q.z;
+        T wx = q.w * q.x;
+        T wy = q.w * q.y;
+        T wz = q.w * q.z;
+
+        return TMatrix3<T, S>((T)1.0 - (T)2.0 * (yy + zz), (T)2.0 * (xy - wz), (T)2.0 * (xz + wy),
+                              (T)2.0 * (xy + wz), (T)1.0 - (T)2.0 * (xx + zz), (T)2.0 * (yz - wx),
+                              (T)2.0 * (xz - wy), (T)2.0 * (yz + wx), (T)1.0 - (T)2.0 * (xx + yy));
+    }
+
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToMatrix4(const TQuaternion<T, S>& q)
+    {
+        TMatrix3<T, S> m = ToMatrix3(q);
+
+        return TMatrix4<T, S>(m(0, 0), m(0, 1), m(0, 2), (T)0.0,
+                              m(1, 0), m(1, 1), m(1, 2), (T)0.0,
+                              m(2, 0), m(2, 1), m(2, 2), (T)0.0,
+                              (T)0.0, (T)0.0, (T)0.0, (T)1.0);
+    }
+}
@@ -24,10 +24,10 @@ namespace Phanes::Core::Math
         TRay() = default;
 
         /** Copy constructor */
-        TRay(const TRay<Real, S>& r) : direction(r.direction), origin(r.origin) {};
+        TRay(const TRay<Real, S>& r) = default;
 
         /** Move constructor */
-        TRay(TRay<Real, S>&& r) : direction(std::move(r.direction)), origin(std::move(r.origin)) {};
+        TRay(TRay<Real, S>&& r) = default;
 
         /**
          * Construct ray from origin and direction.
@@ -36,7 +36,13 @@ namespace Phanes::Core::Math
          * @param(origin) Origin
          */
 
-        TRay(const TVector3<Real, S>& direction, const TVector3<Real, S>& origin) : direction(direction), origin(origin) {};
+        TRay(const TVector3<Real, S>& direction, const TVector3<Real, S>& origin) : origin(origin), direction(direction) {};
+
+        /** Copy assignment */
+        TRay<Real, S>& operator= (const TRay<Real, S>& r) = default;
+
+        /** Move assignment */
+        TRay<Real, S>& operator= (TRay<Real, S>&& r) = default;
 
     };
 
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/AABB.hpp"
+#include "Core/Math/Plane.hpp"
+#include "Core/Math/Ray.hpp"
+#include "Core/Math/Sphere.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#ifndef RAYPACKET_H
+#define RAYPACKET_H
+
+namespace Phanes::Core::Math
+{
+
+    // Packet of L rays stored as structure of arrays (L = p + t * v per lane).
+    // The intersection tests process all lanes at once with SSE (L = 4) or AVX (L = 8).
+
+    template<RealType T, size_t L>
+    struct TRayPacket
+    {
+        static_assert(L == 4 || L == 8, "TRayPacket supports 4 or 8 lanes.");
+
+    public:
+        using Real = T;
+
+        /** Number of rays */
+        static constexpr size_t Lanes = L;
+
+        /** Origins */
+        alignas(32) Real ox[L];
+        alignas(32) Real oy[L];
+        alignas(32) Real oz[L];
+
+        /** Directions */
+        alignas(32) Real dx[L];
+        alignas(32) Real dy[L];
+        alignas(32) Real dz[L];
+
+        /** Reciprocal directions, used by the slab test. Kept in sync by Set. */
+        alignas(32) Real ix[L];
+        alignas(32) Real iy[L];
+        alignas(32) Real iz[L];
+
+    public:
+        /** Default constructor */
+        TRayPacket() = default;
+
+        /**
+         * Construct packet from L rays.
+         *
+         * @param(rays) Array of L rays
+         */
+
+        template<bool S>
+        explicit TRayPacket(const TRay<Real, S>* rays)
+        {
+            for (size_t i = 0; i < L; i++)
+            {
+                Set(i, rays[i]);
+            }
+        }
+
+        /**
+         * Writes ray i.
+         *
+         * @param(i) Lane
+         * @param(r) Ray
+         */
+
+        template<bool S>
+        void Set(size_t i, const TRay<Real, S>& r)
+        {
+            ox[i] = r.origin.x;
+            oy[i] = r.origin.y;
+            oz[i] = r.origin.z;
+
+            dx[i] = r.direction.x;
+            dy[i] = r.direction.y;
+            dz[i] = r.direction.z;
+
+            ix[i] = (Real)1.0 / r.direction.x;
+            iy[i] = (Real)1.0 / r.direction.y;
+            iz[i] = (Real)1.0 / r.direction.z;
+        }
+
+        /**
+         * Reads ray i.
+         *
+         * @param(i) Lane
+         *
+         * @return Ray
+         */
+
+        template<bool S = false>
+        TRay<Real, S> Get(size_t i) const
+        {
+            return TRay<Real, S>(TVector3<Real, S>(dx[i], dy[i], dz[i]), TVector3<Real, S>(ox[i], oy[i], oz[i]));
+        }
+    };
+
+    // ======================== //
+    //   TRayPacket functions   //
+    // ======================== //
+
+    /**
+     * Intersects all rays of a packet with a box (slab test).
+     *
+     * @param(b1) Box
+     * @param(p) Ray packet
+     * @param(t) Array of L parameters. Lane i holds the entry parameter of ray i, or 0 if its origin is inside the box.
+     *
+     * @return Hit mask, bit i is set if ray i hits the box at t[i] >= 0.
+     * @note t[i] is undefined for lanes without a hit.
+     */
+
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TAABB<T, S>& b1, const TRayPacket<T, L>& p, T* t);
+
+    /**
+     * Intersects all rays of a packet with a plane.
+     *
+     * @param(pl1) Plane
+     * @param(p) Ray packet
+     * @param(t) Array of L parameters, lane i holds the parameter of the hit of ray i.
+     *
+     * @return Hit mask, bit i is set if ray i hits the plane at t[i] >= 0.
+     * @note Rays parallel to the plane never hit. t[i] is undefined for lanes without a hit.
+     */
+
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TPlane<T, S>& pl1, const TRayPacket<T, L>& p, T* t);
+
+    /**
+     * Intersects all rays of a packet with a sphere.
+     *
+     * @param(s1) Sphere
+     * @param(p) Ray packet
+     * @param(t) Array of L parameters. Lane i holds the parameter of the first hit of ray i in front of its origin.
+     *
+     * @return Hit mask, bit i is set if ray i hits the sphere at t[i] >= 0.
+     * @note t[i] is undefined for lanes without a hit.
+     */
+
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TSphere<T, S>& s1, const TRayPacket<T, L>& p, T* t);
+
+} // Phanes::Core::Math
+
+#endif // RAYPACKET_H
+
+#include "Core/Math/RayPacket.inl"
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/RayPacketDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+namespace Phanes::Core::Math
+{
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TAABB<T, S>& b1, const TRayPacket<T, L>& p, T* t)
+    {
+        return Detail::compute_packet_aabb<T, L, SIMD::use_simd<T, 4, true>::value>::map(p, b1.min.x, b1.min.y, b1.min.z, b1.max.x, b1.max.y, b1.max.z, t);
+    }
+
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TPlane<T, S>& pl1, const TRayPacket<T, L>& p, T* t)
+    {
+        return Detail::compute_packet_plane<T, L, SIMD::use_simd<T, 4, true>::value>::map(p, pl1.x, pl1.y, pl1.z, pl1.d, t);
+    }
+
+    template<RealType T, size_t L, bool S>
+    Phanes::Core::Types::uint32 RayIntersect(const TSphere<T, S>& s1, const TRayPacket<T, L>& p, T* t)
+    {
+        return Detail::compute_packet_sphere<T, L, SIMD::use_simd<T, 4, true>::value>::map(p, s1.x, s1.y, s1.z, s1.radius, t);
+    }
+}
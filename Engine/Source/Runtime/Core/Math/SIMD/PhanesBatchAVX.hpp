@@ -0,0 +1,1098 @@
+#pragma once
+
+#include <immintrin.h>
+
+#include <cmath>
+#include <cstring>
+
+#ifndef PHANES_BATCH_AVX_HPP
+#	define PHANES_BATCH_AVX_HPP
+
+// AVX batch kernels, eight floats per register. Every kernel carries P_TARGET_AVX, so dispatch builds can compile
+// them next to the SSE baseline (see PhanesDispatch.hpp).
+
+namespace Phanes::Core::Math::SIMD::AVX
+{
+	/// <summary>
+	/// a * b + c, fused in FMA builds (P_FMA__).
+	/// </summary>
+	P_TARGET_AVX inline __m256 madd(const __m256 a, const __m256 b, const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// a * b - c, fused in FMA builds (P_FMA__).
+	/// </summary>
+	P_TARGET_AVX inline __m256 msub(const __m256 a, const __m256 b, const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fmsub_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// c - a * b, fused in FMA builds (P_FMA__).
+	/// </summary>
+	P_TARGET_AVX inline __m256 nmadd(const __m256 a, const __m256 b, const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fnmadd_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+#	endif
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] + v2[i]. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void soa_add(float* r, const float* v1, const float* v2, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 8)
+		{
+			_mm256_store_ps(r + i, _mm256_add_ps(_mm256_load_ps(v1 + i), _mm256_load_ps(v2 + i)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - v2[i]. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void soa_sub(float* r, const float* v1, const float* v2, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 8)
+		{
+			_mm256_store_ps(r + i, _mm256_sub_ps(_mm256_load_ps(v1 + i), _mm256_load_ps(v2 + i)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * s. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void soa_scale(float* r, const float* v1, float s, size_t n)
+	{
+		__m256 vs = _mm256_set1_ps(s);
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			_mm256_store_ps(r + i, _mm256_mul_ps(_mm256_load_ps(v1 + i), vs));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = (1 - t) * v1[i] + t * v2[i]. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void soa_lerp(float* r, const float* v1, const float* v2, float t, size_t n)
+	{
+		__m256 vt = _mm256_set1_ps(t);
+		__m256 vt1 = _mm256_set1_ps(1.0f - t);
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 tmp = _mm256_mul_ps(_mm256_load_ps(v1 + i), vt1);
+			_mm256_store_ps(r + i, madd(_mm256_load_ps(v2 + i), vt, tmp));
+		}
+	}
+
+	/// <summary>
+	/// Recomputes the lanes of vec8_sincos with |v| &gt; 8192 with libm.
+	/// </summary>
+	P_TARGET_AVX P_NOINLINE inline void vec8_sincos_libm(const __m256 v, __m256& s, __m256& c, int mask)
+	{
+		alignas(32) float tv[8], ts[8], tc[8];
+		_mm256_store_ps(tv, v);
+		_mm256_store_ps(ts, s);
+		_mm256_store_ps(tc, c);
+
+		for (int k = 0; k < 8; k++)
+		{
+			if (mask & (1 << k))
+			{
+				ts[k] = std::sin(tv[k]);
+				tc[k] = std::cos(tv[k]);
+			}
+		}
+
+		s = _mm256_load_ps(ts);
+		c = _mm256_load_ps(tc);
+	}
+
+	/// <summary>
+	/// Computes sine and cosine of eight floats, the eight lane version of SIMD::vec4_sincos. Max. error 2 ULP for
+	/// |v| &lt;= 8192, libm above.
+	/// </summary>
+	P_TARGET_AVX inline void vec8_sincos(const __m256 v, __m256& s, __m256& c)
+	{
+		// v = q * pi/2 + r with |r| <= pi/4, pi/2 in four parts.
+		__m256 q = _mm256_round_ps(_mm256_mul_ps(v, _mm256_set1_ps(0.636619772f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256 r = nmadd(q, _mm256_set1_ps(1.5703125f), v);
+		r = nmadd(q, _mm256_set1_ps(4.837512969970703125e-4f), r);
+		r = nmadd(q, _mm256_set1_ps(7.549533620476723e-8f), r);
+		r = nmadd(q, _mm256_set1_ps(2.5633440682570896e-12f), r);
+
+		__m256 z = _mm256_mul_ps(r, r);
+
+		__m256 ps = madd(_mm256_set1_ps(-1.9515295891e-4f), z, _mm256_set1_ps(8.3321608736e-3f));
+		ps = madd(ps, z, _mm256_set1_ps(-1.6666654611e-1f));
+		ps = madd(_mm256_mul_ps(ps, z), r, r);
+
+		__m256 pc = madd(_mm256_set1_ps(2.443315711809948e-5f), z, _mm256_set1_ps(-1.388731625493765e-3f));
+		pc = madd(pc, z, _mm256_set1_ps(4.166664568298827e-2f));
+		pc = madd(_mm256_mul_ps(pc, z), z, nmadd(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+		// q mod 4 in floats, AVX has no 256-bit integer instructions.
+		__m256 q4 = nmadd(_mm256_set1_ps(4.0f), _mm256_floor_ps(_mm256_mul_ps(q, _mm256_set1_ps(0.25f))), q);
+
+		__m256 q1 = _mm256_cmp_ps(q4, _mm256_set1_ps(1.0f), _CMP_EQ_OQ);
+		__m256 q2 = _mm256_cmp_ps(q4, _mm256_set1_ps(2.0f), _CMP_EQ_OQ);
+		__m256 q3 = _mm256_cmp_ps(q4, _mm256_set1_ps(3.0f), _CMP_EQ_OQ);
+
+		__m256 swap = _mm256_or_ps(q1, q3);
+		__m256 ssign = _mm256_and_ps(_mm256_or_ps(q2, q3), _mm256_set1_ps(-0.0f));
+		__m256 csign = _mm256_and_ps(_mm256_or_ps(q1, q2), _mm256_set1_ps(-0.0f));
+
+		s = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, swap), ssign);
+		c = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, swap), csign);
+
+		int large = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), v), _mm256_set1_ps(8192.0f), _CMP_GT_OQ));
+
+		if (large != 0)
+		{
+			vec8_sincos_libm(v, s, c, large);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = sin(v[i]). Any n, unaligned arrays.
+	/// </summary>
+	P_TARGET_AVX inline void soa_sin(float* r, const float* v, size_t n)
+	{
+		size_t i = 0;
+		__m256 vs, vc;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			vec8_sincos(_mm256_loadu_ps(v + i), vs, vc);
+			_mm256_storeu_ps(r + i, vs);
+		}
+
+		if (i < n)
+		{
+			alignas(32) float tmp[8] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			vec8_sincos(_mm256_load_ps(tmp), vs, vc);
+			_mm256_store_ps(tmp, vs);
+			std::memcpy(r + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = cos(v[i]). Any n, unaligned arrays.
+	/// </summary>
+	P_TARGET_AVX inline void soa_cos(float* r, const float* v, size_t n)
+	{
+		size_t i = 0;
+		__m256 vs, vc;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			vec8_sincos(_mm256_loadu_ps(v + i), vs, vc);
+			_mm256_storeu_ps(r + i, vc);
+		}
+
+		if (i < n)
+		{
+			alignas(32) float tmp[8] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			vec8_sincos(_mm256_load_ps(tmp), vs, vc);
+			_mm256_store_ps(tmp, vc);
+			std::memcpy(r + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// s[i] = sin(v[i]), c[i] = cos(v[i]). Any n, unaligned arrays.
+	/// </summary>
+	P_TARGET_AVX inline void soa_sincos(float* s, float* c, const float* v, size_t n)
+	{
+		size_t i = 0;
+		__m256 vs, vc;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			vec8_sincos(_mm256_loadu_ps(v + i), vs, vc);
+			_mm256_storeu_ps(s + i, vs);
+			_mm256_storeu_ps(c + i, vc);
+		}
+
+		if (i < n)
+		{
+			alignas(32) float tmp[8] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			vec8_sincos(_mm256_load_ps(tmp), vs, vc);
+
+			_mm256_store_ps(tmp, vs);
+			std::memcpy(s + i, tmp, (n - i) * sizeof(float));
+			_mm256_store_ps(tmp, vc);
+			std::memcpy(c + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// Dot products of the first n vectors of v1 and v2.
+	/// </summary>
+	P_TARGET_AVX inline void vec4soa_dotp(float* r,
+										const Phanes::Core::Math::TVector4SoA<float>& v1,
+										const Phanes::Core::Math::TVector4SoA<float>& v2,
+										size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 dot = _mm256_mul_ps(_mm256_load_ps(v1.x + i), _mm256_load_ps(v2.x + i));
+			dot = madd(_mm256_load_ps(v1.y + i), _mm256_load_ps(v2.y + i), dot);
+			dot = madd(_mm256_load_ps(v1.z + i), _mm256_load_ps(v2.z + i), dot);
+			dot = madd(_mm256_load_ps(v1.w + i), _mm256_load_ps(v2.w + i), dot);
+
+			_mm256_storeu_ps(r + i, dot);
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+		}
+	}
+
+	/// <summary>
+	/// Magnitudes of the first n vectors of v1.
+	/// </summary>
+	P_TARGET_AVX inline void vec4soa_mag(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 x = _mm256_load_ps(v1.x + i);
+			__m256 y = _mm256_load_ps(v1.y + i);
+			__m256 z = _mm256_load_ps(v1.z + i);
+			__m256 w = _mm256_load_ps(v1.w + i);
+
+			__m256 dot = _mm256_mul_ps(x, x);
+			dot = madd(y, y, dot);
+			dot = madd(z, z, dot);
+			dot = madd(w, w, dot);
+
+			_mm256_storeu_ps(r + i, _mm256_sqrt_ps(dot));
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i] + v1.w[i] * v1.w[i]);
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void vec4soa_norm(Phanes::Core::Math::TVector4SoA<float>& r,
+										const Phanes::Core::Math::TVector4SoA<float>& v1,
+										size_t n)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 inac = _mm256_set1_ps(P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 x = _mm256_load_ps(v1.x + i);
+			__m256 y = _mm256_load_ps(v1.y + i);
+			__m256 z = _mm256_load_ps(v1.z + i);
+			__m256 w = _mm256_load_ps(v1.w + i);
+
+			__m256 dot = _mm256_mul_ps(x, x);
+			dot = madd(y, y, dot);
+			dot = madd(z, z, dot);
+			dot = madd(w, w, dot);
+
+			__m256 mag = _mm256_sqrt_ps(dot);
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m256 s = _mm256_blendv_ps(one, _mm256_div_ps(one, mag), _mm256_cmp_ps(mag, inac, _CMP_GE_OQ));
+
+			_mm256_store_ps(r.x + i, _mm256_mul_ps(x, s));
+			_mm256_store_ps(r.y + i, _mm256_mul_ps(y, s));
+			_mm256_store_ps(r.z + i, _mm256_mul_ps(z, s));
+			_mm256_store_ps(r.w + i, _mm256_mul_ps(w, s));
+		}
+	}
+
+	/// <summary>
+	/// Dot products of the first n vectors of v1 and v2.
+	/// </summary>
+	P_TARGET_AVX inline void vec3soa_dotp(float* r,
+										const Phanes::Core::Math::TVector3SoA<float>& v1,
+										const Phanes::Core::Math::TVector3SoA<float>& v2,
+										size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 dot = _mm256_mul_ps(_mm256_load_ps(v1.x + i), _mm256_load_ps(v2.x + i));
+			dot = madd(_mm256_load_ps(v1.y + i), _mm256_load_ps(v2.y + i), dot);
+			dot = madd(_mm256_load_ps(v1.z + i), _mm256_load_ps(v2.z + i), dot);
+
+			_mm256_storeu_ps(r + i, dot);
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+		}
+	}
+
+	/// <summary>
+	/// Magnitudes of the first n vectors of v1.
+	/// </summary>
+	P_TARGET_AVX inline void vec3soa_mag(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 x = _mm256_load_ps(v1.x + i);
+			__m256 y = _mm256_load_ps(v1.y + i);
+			__m256 z = _mm256_load_ps(v1.z + i);
+
+			__m256 dot = _mm256_mul_ps(x, x);
+			dot = madd(y, y, dot);
+			dot = madd(z, z, dot);
+
+			_mm256_storeu_ps(r + i, _mm256_sqrt_ps(dot));
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i]);
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void vec3soa_norm(Phanes::Core::Math::TVector3SoA<float>& r,
+										const Phanes::Core::Math::TVector3SoA<float>& v1,
+										size_t n)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 inac = _mm256_set1_ps(P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 x = _mm256_load_ps(v1.x + i);
+			__m256 y = _mm256_load_ps(v1.y + i);
+			__m256 z = _mm256_load_ps(v1.z + i);
+
+			__m256 dot = _mm256_mul_ps(x, x);
+			dot = madd(y, y, dot);
+			dot = madd(z, z, dot);
+
+			__m256 mag = _mm256_sqrt_ps(dot);
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m256 s = _mm256_blendv_ps(one, _mm256_div_ps(one, mag), _mm256_cmp_ps(mag, inac, _CMP_GE_OQ));
+
+			_mm256_store_ps(r.x + i, _mm256_mul_ps(x, s));
+			_mm256_store_ps(r.y + i, _mm256_mul_ps(y, s));
+			_mm256_store_ps(r.z + i, _mm256_mul_ps(z, s));
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors with the refined rsqrt estimate. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void vec3soa_fast_norm(Phanes::Core::Math::TVector3SoA<float>& r,
+											 const Phanes::Core::Math::TVector3SoA<float>& v1,
+											 size_t n)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 half = _mm256_set1_ps(0.5f);
+		__m256 threeHalves = _mm256_set1_ps(1.5f);
+		__m256 inac = _mm256_set1_ps(P_FLT_INAC * P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 x = _mm256_load_ps(v1.x + i);
+			__m256 y = _mm256_load_ps(v1.y + i);
+			__m256 z = _mm256_load_ps(v1.z + i);
+
+			__m256 dot = _mm256_mul_ps(x, x);
+			dot = madd(y, y, dot);
+			dot = madd(z, z, dot);
+
+			// One Newton-Raphson step: e * (1.5 - 0.5 * dot * e * e)
+			__m256 e = _mm256_rsqrt_ps(dot);
+			e = _mm256_mul_ps(e, nmadd(_mm256_mul_ps(_mm256_mul_ps(half, dot), e), e, threeHalves));
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m256 s = _mm256_blendv_ps(one, e, _mm256_cmp_ps(dot, inac, _CMP_GE_OQ));
+
+			_mm256_store_ps(r.x + i, _mm256_mul_ps(x, s));
+			_mm256_store_ps(r.y + i, _mm256_mul_ps(y, s));
+			_mm256_store_ps(r.z + i, _mm256_mul_ps(z, s));
+		}
+	}
+
+	/// <summary>
+	/// Cross products of n vectors. n is a multiple of 8.
+	/// </summary>
+	P_TARGET_AVX inline void vec3soa_cross_p(Phanes::Core::Math::TVector3SoA<float>& r,
+											const Phanes::Core::Math::TVector3SoA<float>& v1,
+											const Phanes::Core::Math::TVector3SoA<float>& v2,
+											size_t n)
+	{
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 x1 = _mm256_load_ps(v1.x + i);
+			__m256 y1 = _mm256_load_ps(v1.y + i);
+			__m256 z1 = _mm256_load_ps(v1.z + i);
+			__m256 x2 = _mm256_load_ps(v2.x + i);
+			__m256 y2 = _mm256_load_ps(v2.y + i);
+			__m256 z2 = _mm256_load_ps(v2.z + i);
+
+			// Not fused, so the cross product of parallel vectors stays exactly zero.
+			_mm256_store_ps(r.x + i, _mm256_sub_ps(_mm256_mul_ps(y1, z2), _mm256_mul_ps(z1, y2)));
+			_mm256_store_ps(r.y + i, _mm256_sub_ps(_mm256_mul_ps(z1, x2), _mm256_mul_ps(x1, z2)));
+			_mm256_store_ps(r.z + i, _mm256_sub_ps(_mm256_mul_ps(x1, y2), _mm256_mul_ps(y1, x2)));
+		}
+	}
+
+	/// <summary>
+	/// Transforms all vectors of v by the rows m[0..3], m[4..7] and m[8..11] of a 3x4 matrix. The last column is the translation, already scaled by w.
+	/// </summary>
+	P_TARGET_AVX inline void mat4_soa_transform(Phanes::Core::Math::TVector3SoA<float>& r,
+												const float* m,
+												const Phanes::Core::Math::TVector3SoA<float>& v)
+	{
+		__m256 m00 = _mm256_set1_ps(m[0]);
+		__m256 m01 = _mm256_set1_ps(m[1]);
+		__m256 m02 = _mm256_set1_ps(m[2]);
+		__m256 m10 = _mm256_set1_ps(m[4]);
+		__m256 m11 = _mm256_set1_ps(m[5]);
+		__m256 m12 = _mm256_set1_ps(m[6]);
+		__m256 m20 = _mm256_set1_ps(m[8]);
+		__m256 m21 = _mm256_set1_ps(m[9]);
+		__m256 m22 = _mm256_set1_ps(m[10]);
+
+		__m256 t0 = _mm256_set1_ps(m[3]);
+		__m256 t1 = _mm256_set1_ps(m[7]);
+		__m256 t2 = _mm256_set1_ps(m[11]);
+
+		for (size_t i = 0; i < v.PaddedSize(); i += 8)
+		{
+			__m256 x = _mm256_load_ps(v.x + i);
+			__m256 y = _mm256_load_ps(v.y + i);
+			__m256 z = _mm256_load_ps(v.z + i);
+
+			_mm256_store_ps(r.x + i, _mm256_add_ps(madd(m00, x, _mm256_mul_ps(m01, y)), madd(m02, z, t0)));
+			_mm256_store_ps(r.y + i, _mm256_add_ps(madd(m10, x, _mm256_mul_ps(m11, y)), madd(m12, z, t1)));
+			_mm256_store_ps(r.z + i, _mm256_add_ps(madd(m20, x, _mm256_mul_ps(m21, y)), madd(m22, z, t2)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = transpose(inverse(m[i])) for n matrices, two per register. Singular matrices give a zero matrix.
+	/// </summary>
+	/// <returns>False, if any matrix was singular.</returns>
+	P_TARGET_AVX inline bool mat3_batch_inv_transpose(Phanes::Core::Math::TMatrix3<float, true>* r,
+													  const Phanes::Core::Math::TMatrix3<float, true>* m,
+													  size_t n)
+	{
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 zero = _mm256_setzero_ps();
+		__m256 invertible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		size_t i = 0;
+
+		for (; i + 2 <= n; i += 2)
+		{
+			// Column k of m[i] in the low lane, of m[i + 1] in the high lane.
+			__m256 c0 = _mm256_insertf128_ps(_mm256_castps128_ps256(m[i].c0.data), m[i + 1].c0.data, 1);
+			__m256 c1 = _mm256_insertf128_ps(_mm256_castps128_ps256(m[i].c1.data), m[i + 1].c1.data, 1);
+			__m256 c2 = _mm256_insertf128_ps(_mm256_castps128_ps256(m[i].c2.data), m[i + 1].c2.data, 1);
+
+			// Cross products as in SSE::mat3_batch_inv_transpose, the shuffles stay within each 128-bit lane. Not fused,
+			// so the determinant of a matrix with parallel columns stays exactly zero.
+			__m256 c0_yzx = _mm256_permute_ps(c0, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256 c1_yzx = _mm256_permute_ps(c1, _MM_SHUFFLE(3, 0, 2, 1));
+			__m256 c2_yzx = _mm256_permute_ps(c2, _MM_SHUFFLE(3, 0, 2, 1));
+
+			__m256 r0 = _mm256_sub_ps(_mm256_mul_ps(c1, c2_yzx), _mm256_mul_ps(c1_yzx, c2));
+			__m256 r1 = _mm256_sub_ps(_mm256_mul_ps(c2, c0_yzx), _mm256_mul_ps(c2_yzx, c0));
+			__m256 r2 = _mm256_sub_ps(_mm256_mul_ps(c0, c1_yzx), _mm256_mul_ps(c0_yzx, c1));
+
+			r0 = _mm256_permute_ps(r0, _MM_SHUFFLE(3, 0, 2, 1));
+			r1 = _mm256_permute_ps(r1, _MM_SHUFFLE(3, 0, 2, 1));
+			r2 = _mm256_permute_ps(r2, _MM_SHUFFLE(3, 0, 2, 1));
+
+			__m256 det = _mm256_dp_ps(c0, r0, 0x7F);
+
+			__m256 mask = _mm256_cmp_ps(det, zero, _CMP_NEQ_UQ);
+			__m256 _1_det = _mm256_and_ps(_mm256_div_ps(one, det), mask);
+			invertible = _mm256_and_ps(invertible, mask);
+
+			r0 = _mm256_mul_ps(r0, _1_det);
+			r1 = _mm256_mul_ps(r1, _1_det);
+			r2 = _mm256_mul_ps(r2, _1_det);
+
+			r[i].c0.data = _mm256_castps256_ps128(r0);
+			r[i].c1.data = _mm256_castps256_ps128(r1);
+			r[i].c2.data = _mm256_castps256_ps128(r2);
+			r[i + 1].c0.data = _mm256_extractf128_ps(r0, 1);
+			r[i + 1].c1.data = _mm256_extractf128_ps(r1, 1);
+			r[i + 1].c2.data = _mm256_extractf128_ps(r2, 1);
+		}
+
+		bool tail = (i < n) ? SSE::mat3_batch_inv_transpose(r + i, m + i, n - i) : true;
+
+		return _mm256_movemask_ps(invertible) == 0xFF && tail;
+	}
+
+	/// <summary>
+	/// r[i] = slerp(q1[i], q2[i], t) for n quaternions, eight per iteration. Same polynomial as SSE::quat_batch_slerp.
+	/// </summary>
+	P_TARGET_AVX inline void quat_batch_slerp(Phanes::Core::Math::TQuaternion<float, true>* r,
+											  const Phanes::Core::Math::TQuaternion<float, true>* q1,
+											  const Phanes::Core::Math::TQuaternion<float, true>* q2,
+											  float t,
+											  size_t n)
+	{
+		float d = 1.0f - t;
+
+		__m256 kt[8];
+		__m256 kd[8];
+
+		for (int k = 0; k < 8; k++)
+		{
+			kt[k] = _mm256_set1_ps(SSE::quat_slerp_u[k] * t * t - SSE::quat_slerp_v[k]);
+			kd[k] = _mm256_set1_ps(SSE::quat_slerp_u[k] * d * d - SSE::quat_slerp_v[k]);
+		}
+
+		__m256 one = _mm256_set1_ps(1.0f);
+		__m256 vt = _mm256_set1_ps(t);
+		__m256 vd = _mm256_set1_ps(d);
+
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			// Two quaternions per register.
+			__m256 a01 = _mm256_loadu_ps(&q1[i].x);
+			__m256 a23 = _mm256_loadu_ps(&q1[i + 2].x);
+			__m256 a45 = _mm256_loadu_ps(&q1[i + 4].x);
+			__m256 a67 = _mm256_loadu_ps(&q1[i + 6].x);
+
+			__m256 b01 = _mm256_loadu_ps(&q2[i].x);
+			__m256 b23 = _mm256_loadu_ps(&q2[i + 2].x);
+			__m256 b45 = _mm256_loadu_ps(&q2[i + 4].x);
+			__m256 b67 = _mm256_loadu_ps(&q2[i + 6].x);
+
+			// (dot0, dot2, dot4, dot6 | dot1, dot3, dot5, dot7)
+			__m256 cosTheta = _mm256_hadd_ps(_mm256_hadd_ps(_mm256_mul_ps(a01, b01), _mm256_mul_ps(a23, b23)),
+											 _mm256_hadd_ps(_mm256_mul_ps(a45, b45), _mm256_mul_ps(a67, b67)));
+
+			__m256 sign = _mm256_and_ps(cosTheta, _mm256_set1_ps(-0.0f));
+			__m256 xm1 = _mm256_sub_ps(_mm256_xor_ps(cosTheta, sign), one);
+
+			__m256 ft = one;
+			__m256 fd = one;
+
+			for (int k = 7; k >= 0; k--)
+			{
+				ft = madd(_mm256_mul_ps(kt[k], xm1), ft, one);
+				fd = madd(_mm256_mul_ps(kd[k], xm1), fd, one);
+			}
+
+			__m256 wt = _mm256_xor_ps(_mm256_mul_ps(vt, ft), sign);
+			__m256 wd = _mm256_mul_ps(vd, fd);
+
+			// Broadcasting element k of each 128-bit lane gives the weights of the pair (2k, 2k + 1).
+			_mm256_storeu_ps(&r[i].x, madd(a01, _mm256_permute_ps(wd, 0x00), _mm256_mul_ps(b01, _mm256_permute_ps(wt, 0x00))));
+			_mm256_storeu_ps(&r[i + 2].x, madd(a23, _mm256_permute_ps(wd, 0x55), _mm256_mul_ps(b23, _mm256_permute_ps(wt, 0x55))));
+			_mm256_storeu_ps(&r[i + 4].x, madd(a45, _mm256_permute_ps(wd, 0xAA), _mm256_mul_ps(b45, _mm256_permute_ps(wt, 0xAA))));
+			_mm256_storeu_ps(&r[i + 6].x, madd(a67, _mm256_permute_ps(wd, 0xFF), _mm256_mul_ps(b67, _mm256_permute_ps(wt, 0xFF))));
+		}
+
+		if (i < n)
+		{
+			SSE::quat_batch_slerp(r + i, q1 + i, q2 + i, t, n - i);
+		}
+	}
+
+	/// <summary>
+	/// Loads eight 16 byte elements, stride floats apart, and transposes them. Lane i of x, y, z and w belongs to element i.
+	/// </summary>
+	P_TARGET_AVX inline void load_transpose8(const float* p, size_t stride, __m256& x, __m256& y, __m256& z, __m256& w)
+	{
+		__m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(p)), _mm_load_ps(p + 4 * stride), 1);
+		__m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(p + stride)), _mm_load_ps(p + 5 * stride), 1);
+		__m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(p + 2 * stride)), _mm_load_ps(p + 6 * stride), 1);
+		__m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(p + 3 * stride)), _mm_load_ps(p + 7 * stride), 1);
+
+		// _MM_TRANSPOSE4_PS in both 128-bit lanes.
+		__m256 t0 = _mm256_unpacklo_ps(r0, r1);
+		__m256 t1 = _mm256_unpackhi_ps(r0, r1);
+		__m256 t2 = _mm256_unpacklo_ps(r2, r3);
+		__m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+		x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		w = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	/// <summary>
+	/// Tests eight boxes against planes prepared by SSE::frustum_prepare.
+	/// </summary>
+	/// <returns>Visibility bits of the eight boxes.</returns>
+	P_TARGET_AVX inline int frustum_aabb8(const float* pl, const Phanes::Core::Math::TAABB<float, true>* b)
+	{
+		__m256 lx, ly, lz, lw, hx, hy, hz, hw;
+		load_transpose8(&b[0].min.x, 8, lx, ly, lz, lw);
+		load_transpose8(&b[0].max.x, 8, hx, hy, hz, hw);
+
+		// Twice center and extents, compared against 2 * d: n * c + |n| * e >= d.
+		__m256 cx = _mm256_add_ps(lx, hx);
+		__m256 cy = _mm256_add_ps(ly, hy);
+		__m256 cz = _mm256_add_ps(lz, hz);
+		__m256 ex = _mm256_sub_ps(hx, lx);
+		__m256 ey = _mm256_sub_ps(hy, ly);
+		__m256 ez = _mm256_sub_ps(hz, lz);
+
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		for (int k = 0; k < 6; k++, pl += 8)
+		{
+			__m256 dist = madd(_mm256_broadcast_ss(pl + 2), cz, madd(_mm256_broadcast_ss(pl), cx, _mm256_mul_ps(_mm256_broadcast_ss(pl + 1), cy)));
+			dist = _mm256_add_ps(dist, madd(_mm256_broadcast_ss(pl + 6), ez, madd(_mm256_broadcast_ss(pl + 4), ex, _mm256_mul_ps(_mm256_broadcast_ss(pl + 5), ey))));
+
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_broadcast_ss(pl + 7), _CMP_GE_OQ));
+		}
+
+		return _mm256_movemask_ps(inside);
+	}
+
+	/// <summary>
+	/// Tests eight spheres against planes prepared by SSE::frustum_prepare.
+	/// </summary>
+	/// <returns>Visibility bits of the eight spheres.</returns>
+	P_TARGET_AVX inline int frustum_sphere8(const float* pl, const Phanes::Core::Math::TSphere<float, true>* s)
+	{
+		__m256 cx, cy, cz, r;
+		load_transpose8(&s[0].x, 4, cx, cy, cz, r);
+
+		__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		// n * c + r >= d
+		for (int k = 0; k < 6; k++, pl += 8)
+		{
+			__m256 dist = _mm256_add_ps(madd(_mm256_broadcast_ss(pl), cx, _mm256_mul_ps(_mm256_broadcast_ss(pl + 1), cy)),
+										madd(_mm256_broadcast_ss(pl + 2), cz, r));
+
+			inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_broadcast_ss(pl + 3), _CMP_GE_OQ));
+		}
+
+		return _mm256_movemask_ps(inside);
+	}
+
+	/// <summary>
+	/// Culls n boxes, eight per iteration. Sets bit i of visible, if box i is visible.
+	/// </summary>
+	/// <returns>Number of visible boxes.</returns>
+	P_TARGET_AVX inline size_t frustum_cull_aabbs(const Phanes::Core::Math::TFrustum<float, true>& f,
+												  const Phanes::Core::Math::TAABB<float, true>* b,
+												  size_t n,
+												  Phanes::Core::Types::uint32* visible)
+	{
+		alignas(16) float pl[48];
+		SSE::frustum_prepare(pl, f);
+
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			unsigned int mask = frustum_aabb8(pl, b + i);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		if (i < n)
+		{
+			// Pads the tail with copies of the last box, the extra bits are masked off.
+			Phanes::Core::Math::TAABB<float, true> tail[8];
+
+			for (size_t k = 0; k < 8; k++)
+			{
+				tail[k] = b[(i + k < n) ? i + k : n - 1];
+			}
+
+			unsigned int mask = frustum_aabb8(pl, tail) & ((1u << (n - i)) - 1);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		return count;
+	}
+
+	/// <summary>
+	/// Culls n spheres, eight per iteration. Sets bit i of visible, if sphere i is visible.
+	/// </summary>
+	/// <returns>Number of visible spheres.</returns>
+	P_TARGET_AVX inline size_t frustum_cull_spheres(const Phanes::Core::Math::TFrustum<float, true>& f,
+													const Phanes::Core::Math::TSphere<float, true>* s,
+													size_t n,
+													Phanes::Core::Types::uint32* visible)
+	{
+		alignas(16) float pl[48];
+		SSE::frustum_prepare(pl, f);
+
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			unsigned int mask = frustum_sphere8(pl, s + i);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		if (i < n)
+		{
+			// Pads the tail with copies of the last sphere, the extra bits are masked off.
+			Phanes::Core::Math::TSphere<float, true> tail[8];
+
+			for (size_t k = 0; k < 8; k++)
+			{
+				tail[k] = s[(i + k < n) ? i + k : n - 1];
+			}
+
+			unsigned int mask = frustum_sphere8(pl, tail) & ((1u << (n - i)) - 1);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		return count;
+	}
+
+	/// <summary>
+	/// Nearest hit of one ray in a triangle array, eight triangles per iteration (Moller-Trumbore).
+	/// </summary>
+	/// <returns>True, if any triangle is hit at 0 <= t < tMax.</returns>
+	P_TARGET_AVX inline bool ray_triangles(Phanes::Core::Math::TTriangleHit<float>& hit,
+										   const Phanes::Core::Math::TTriangleSoA<float>& tris,
+										   float ox, float oy, float oz,
+										   float dx, float dy, float dz,
+										   float tMax)
+	{
+		const __m256 rox = _mm256_set1_ps(ox);
+		const __m256 roy = _mm256_set1_ps(oy);
+		const __m256 roz = _mm256_set1_ps(oz);
+		const __m256 rdx = _mm256_set1_ps(dx);
+		const __m256 rdy = _mm256_set1_ps(dy);
+		const __m256 rdz = _mm256_set1_ps(dz);
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+
+		__m256 bt = _mm256_set1_ps(tMax);
+		__m256 bu = zero;
+		__m256 bv = zero;
+		__m256 bi = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+		size_t n = tris.PaddedSize();
+
+		for (size_t i = 0; i < n; i += 8)
+		{
+			__m256 e1x = _mm256_load_ps(tris.e1[0] + i);
+			__m256 e1y = _mm256_load_ps(tris.e1[1] + i);
+			__m256 e1z = _mm256_load_ps(tris.e1[2] + i);
+			__m256 e2x = _mm256_load_ps(tris.e2[0] + i);
+			__m256 e2y = _mm256_load_ps(tris.e2[1] + i);
+			__m256 e2z = _mm256_load_ps(tris.e2[2] + i);
+
+			__m256 px = msub(rdy, e2z, _mm256_mul_ps(rdz, e2y));
+			__m256 py = msub(rdz, e2x, _mm256_mul_ps(rdx, e2z));
+			__m256 pz = msub(rdx, e2y, _mm256_mul_ps(rdy, e2x));
+
+			__m256 inv = _mm256_div_ps(one, madd(e1z, pz, madd(e1x, px, _mm256_mul_ps(e1y, py))));
+
+			__m256 sx = _mm256_sub_ps(rox, _mm256_load_ps(tris.v0[0] + i));
+			__m256 sy = _mm256_sub_ps(roy, _mm256_load_ps(tris.v0[1] + i));
+			__m256 sz = _mm256_sub_ps(roz, _mm256_load_ps(tris.v0[2] + i));
+
+			__m256 u = _mm256_mul_ps(madd(sz, pz, madd(sx, px, _mm256_mul_ps(sy, py))), inv);
+
+			__m256 qx = msub(sy, e1z, _mm256_mul_ps(sz, e1y));
+			__m256 qy = msub(sz, e1x, _mm256_mul_ps(sx, e1z));
+			__m256 qz = msub(sx, e1y, _mm256_mul_ps(sy, e1x));
+
+			__m256 v = _mm256_mul_ps(madd(rdz, qz, madd(rdx, qx, _mm256_mul_ps(rdy, qy))), inv);
+			__m256 t = _mm256_mul_ps(madd(e2z, qz, madd(e2x, qx, _mm256_mul_ps(e2y, qy))), inv);
+
+			__m256 mask = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ), _mm256_cmp_ps(v, zero, _CMP_GE_OQ)),
+										_mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ),
+													  _mm256_and_ps(_mm256_cmp_ps(t, zero, _CMP_GE_OQ), _mm256_cmp_ps(t, bt, _CMP_LT_OQ))));
+
+			bt = _mm256_blendv_ps(bt, t, mask);
+			bu = _mm256_blendv_ps(bu, u, mask);
+			bv = _mm256_blendv_ps(bv, v, mask);
+			bi = _mm256_blendv_ps(bi, _mm256_castsi256_ps(_mm256_set1_epi32((int)i)), mask);
+		}
+
+		alignas(32) float t[8];
+		alignas(32) float u[8];
+		alignas(32) float v[8];
+		alignas(32) int base[8];
+
+		_mm256_store_ps(t, bt);
+		_mm256_store_ps(u, bu);
+		_mm256_store_ps(v, bv);
+		_mm256_store_ps((float*)base, bi);
+
+		return SSE::ray_triangles_reduce(hit, t, u, v, base, 8);
+	}
+} // namespace Phanes::Core::Math::SIMD::AVX
+
+#	if P_INTRINSICS == P_INTRINSICS_AVX || P_INTRINSICS == P_INTRINSICS_AVX2
+
+namespace Phanes::Core::Math::Detail
+{
+	// SoA streams are padded to eight lanes, so every kernel works on whole registers.
+
+	template <>
+	struct compute_soa_add<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_add(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sub<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_sub(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_scale<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, float s, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_scale(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_lerp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, float t, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_lerp(r, v1, v2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, const Phanes::Core::Math::TVector4SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec4soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec4soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<float>& r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec4soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec3soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec3soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec3soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_fast_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec3soa_fast_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_cross_p<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::vec3soa_cross_p(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_mat4_soa_transform<float, true>
+	{
+		template <bool S>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r,
+									const Phanes::Core::Math::TMatrix4<float, S>& m,
+									const Phanes::Core::Math::TVector3SoA<float>& v,
+									float w)
+		{
+			const float rows[12] = { m(0, 0), m(0, 1), m(0, 2), m(0, 3) * w,
+									 m(1, 0), m(1, 1), m(1, 2), m(1, 3) * w,
+									 m(2, 0), m(2, 1), m(2, 2), m(2, 3) * w };
+
+			Phanes::Core::Math::SIMD::AVX::mat4_soa_transform(r, rows, v);
+		}
+	};
+
+	template <>
+	struct compute_mat3_batch_inv_transpose<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>* r,
+									const Phanes::Core::Math::TMatrix3<float, true>* m,
+									size_t n)
+		{
+			return Phanes::Core::Math::SIMD::AVX::mat3_batch_inv_transpose(r, m, n);
+		}
+	};
+
+	template <>
+	struct compute_quat_batch_slerp<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>* r,
+									const Phanes::Core::Math::TQuaternion<float, true>* q1,
+									const Phanes::Core::Math::TQuaternion<float, true>* q2,
+									float t,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::quat_batch_slerp(r, q1, q2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_aabb<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TAABB<float, true>* b,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::AVX::frustum_cull_aabbs(f, b, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_sphere<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TSphere<float, true>* s,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::AVX::frustum_cull_spheres(f, s, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_ray_triangles<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TTriangleHit<float>& hit,
+									const Phanes::Core::Math::TTriangleSoA<float>& tris,
+									float ox, float oy, float oz,
+									float dx, float dy, float dz,
+									float tMax)
+		{
+			return Phanes::Core::Math::SIMD::AVX::ray_triangles(hit, tris, ox, oy, oz, dx, dy, dz, tMax);
+		}
+	};
+
+	template <>
+	struct compute_soa_sin<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_sin(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_cos<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_cos(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sincos<float, true>
+	{
+		static FORCEINLINE void map(float* s, float* c, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX::soa_sincos(s, c, v, n);
+		}
+	};
+} // namespace Phanes::Core::Math::Detail
+
+#	endif
+
+#endif // !PHANES_BATCH_AVX_HPP
@@ -0,0 +1,529 @@
+#pragma once
+
+#include <immintrin.h>
+
+#ifndef PHANES_BATCH_AVX2_HPP
+#	define PHANES_BATCH_AVX2_HPP
+
+// AVX2 int32 batch kernels over arrays of TIntVector4<int, true>. Every kernel carries P_TARGET_AVX2, so dispatch
+// builds can compile them next to the SSE baseline (see PhanesDispatch.hpp).
+
+namespace Phanes::Core::Math::SIMD::AVX2
+{
+	/// <summary>
+	/// r[i] = v1[i] + v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_add(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												const Phanes::Core::Math::TIntVector4<int, true>* v2,
+												size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_add_epi32(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_add<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] + s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_add_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_add_epi32(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_add<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_sub(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												const Phanes::Core::Math::TIntVector4<int, true>* v2,
+												size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_sub_epi32(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_sub<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_sub_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_sub_epi32(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_sub<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_mul(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												const Phanes::Core::Math::TIntVector4<int, true>* v2,
+												size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_mullo_epi32(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_mul<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_mul_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_mullo_epi32(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_mul<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] & v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_and(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												const Phanes::Core::Math::TIntVector4<int, true>* v2,
+												size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_and_si256(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_and<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] & s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_and_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_and_si256(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_and<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] | v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_or(Phanes::Core::Math::TIntVector4<int, true>* r,
+											const Phanes::Core::Math::TIntVector4<int, true>* v1,
+											const Phanes::Core::Math::TIntVector4<int, true>* v2,
+											size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_or_si256(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_or<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] | s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_or_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_or_si256(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_or<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] ^ v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_xor(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												const Phanes::Core::Math::TIntVector4<int, true>* v2,
+												size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_xor_si256(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_xor<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] ^ s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_xor_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													int s,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_xor_si256(a, _mm256_set1_epi32(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_xor<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] << v2[i] for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_left_shift(Phanes::Core::Math::TIntVector4<int, true>* r,
+													const Phanes::Core::Math::TIntVector4<int, true>* v1,
+													const Phanes::Core::Math::TIntVector4<int, true>* v2,
+													size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_sllv_epi32(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_left_shift<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] << s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_left_shift_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+															const Phanes::Core::Math::TIntVector4<int, true>* v1,
+															int s,
+															size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_sll_epi32(a, _mm_cvtsi32_si128(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_left_shift<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] >> v2[i] for n vectors, two per register.
+	/// </summary>
+	// Arithmetic shift like the scalar >> on signed integers.
+	P_TARGET_AVX2 inline void ivec4_batch_right_shift(Phanes::Core::Math::TIntVector4<int, true>* r,
+														const Phanes::Core::Math::TIntVector4<int, true>* v1,
+														const Phanes::Core::Math::TIntVector4<int, true>* v2,
+														size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v2[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_srav_epi32(a, b));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_right_shift<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] >> s for n vectors, two per register.
+	/// </summary>
+	P_TARGET_AVX2 inline void ivec4_batch_right_shift_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+															const Phanes::Core::Math::TIntVector4<int, true>* v1,
+															int s,
+															size_t n)
+	{
+		size_t i = 0;
+		for (; i + 2 <= n; i += 2)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&v1[i]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&r[i]), _mm256_sra_epi32(a, _mm_cvtsi32_si128(s)));
+		}
+
+		for (; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_right_shift<int, true>::map(r[i], v1[i], s);
+		}
+	}
+} // namespace Phanes::Core::Math::SIMD::AVX2
+
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+
+namespace Phanes::Core::Math::Detail
+{
+	// Two TIntVector4<int, true> are processed per 256-bit register.
+
+	template <>
+	struct compute_ivec4_batch_add<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_add(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_add_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_sub<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_sub(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_sub_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_mul<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_mul(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_mul_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_and<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_and(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_and_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_or<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_or(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_or_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_xor<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_xor(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_xor_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_left_shift<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_left_shift(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_left_shift_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_right_shift<int, true>
+	{
+		// Arithmetic shift like the scalar >> on signed integers.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_right_shift(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::AVX2::ivec4_batch_right_shift_scalar(r, v1, s, n);
+		}
+	};
+} // namespace Phanes::Core::Math::Detail
+
+#	endif
+
+#endif // !PHANES_BATCH_AVX2_HPP
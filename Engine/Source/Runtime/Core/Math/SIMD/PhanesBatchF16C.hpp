@@ -0,0 +1,379 @@
+#pragma once
+
+#include <immintrin.h>
+
+#include <cstring>
+
+#ifndef PHANES_BATCH_F16C_HPP
+#	define PHANES_BATCH_F16C_HPP
+
+// Half precision conversion with F16C (vcvtps2ph / vcvtph2ps). Every kernel carries P_TARGET_F16C, so dispatch builds
+// can compile them next to the SSE baseline (see PhanesDispatch.hpp). Builds without F16C use the scalar
+// FloatToHalf / HalfToFloat, which give the same bits (round to nearest even, quiet NaNs).
+//
+// Doubles are converted to float first, like the scalar path does.
+
+#	if P_F16C__ || P_SIMD_DISPATCH
+
+namespace Phanes::Core::Math::SIMD::F16C
+{
+	/// <summary>
+	/// r[i] = half(v[i]) for n floats, eight per instruction.
+	/// </summary>
+	P_TARGET_F16C inline void half_pack(Phanes::Core::Types::uint16* r, const float* v, size_t n)
+	{
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(v + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), h);
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(r + i), _mm_cvtps_ph(_mm_loadu_ps(v + i), _MM_FROUND_TO_NEAREST_INT));
+			i += 4;
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = (Phanes::Core::Types::uint16)_mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(v[i]), _MM_FROUND_TO_NEAREST_INT));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = float(v[i]) for n halfs, eight per instruction.
+	/// </summary>
+	P_TARGET_F16C inline void half_unpack(float* r, const Phanes::Core::Types::uint16* v, size_t n)
+	{
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			_mm256_storeu_ps(r + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i))));
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm_storeu_ps(r + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i))));
+			i += 4;
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(v[i])));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = half(v[i]) for n doubles, four per instruction.
+	/// </summary>
+	P_TARGET_F16C inline void half_pack(Phanes::Core::Types::uint16* r, const double* v, size_t n)
+	{
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128i h = _mm_cvtps_ph(_mm256_cvtpd_ps(_mm256_loadu_pd(v + i)), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(r + i), h);
+		}
+
+		for (; i < n; i++)
+		{
+			__m128 f = _mm_cvtsd_ss(_mm_setzero_ps(), _mm_set_sd(v[i]));
+			r[i] = (Phanes::Core::Types::uint16)_mm_cvtsi128_si32(_mm_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = double(v[i]) for n halfs, four per instruction.
+	/// </summary>
+	P_TARGET_F16C inline void half_unpack(double* r, const Phanes::Core::Types::uint16* v, size_t n)
+	{
+		size_t i = 0;
+		for (; i + 4 <= n; i += 4)
+		{
+			_mm256_storeu_pd(r + i, _mm256_cvtps_pd(_mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i)))));
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = (double)_mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(v[i])));
+		}
+	}
+
+	/// <summary>
+	/// Stores x, y, z of h to r. Unless last, one 8 byte store that spills into x of the next vector.
+	/// </summary>
+	P_TARGET_F16C inline void half3_store(Phanes::Core::Types::uint16* r, const __m128i h, bool last)
+	{
+		if (!last)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(r), h);
+			return;
+		}
+
+		Phanes::Core::Types::uint32 xy = (Phanes::Core::Types::uint32)_mm_cvtsi128_si32(h);
+		std::memcpy(r, &xy, 4);
+		r[2] = (Phanes::Core::Types::uint16)_mm_extract_epi16(h, 2);
+	}
+
+	/// <summary>
+	/// Loads x, y, z from v into the lower three halfs, the fourth is zero.
+	/// </summary>
+	P_TARGET_F16C inline __m128i half3_load(const Phanes::Core::Types::uint16* v, bool last)
+	{
+		if (!last)
+		{
+			return _mm_insert_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v)), 0, 3);
+		}
+
+		Phanes::Core::Types::uint32 xy;
+		std::memcpy(&xy, v, 4);
+		return _mm_insert_epi16(_mm_cvtsi32_si128((int)xy), v[2], 2);
+	}
+
+	/// <summary>
+	/// Packs n 3D vectors, two per instruction. The 16 byte store spills into the third vector, which is written next.
+	/// </summary>
+	P_TARGET_F16C inline void half3_pack(Phanes::Core::Math::THalfVector3<float>* r, const Phanes::Core::Math::TVector3<float, true>* v, size_t n)
+	{
+		// (x0 y0 z0 w0 x1 y1 z1 w1) -> (x0 y0 z0 x1 y1 z1)
+		const __m128i compact = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+
+		size_t i = 0;
+		for (; i + 3 <= n; i += 2)
+		{
+			__m128i h = _mm256_cvtps_ph(_mm256_set_m128(v[i + 1].data, v[i].data), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&r[i].x), _mm_shuffle_epi8(h, compact));
+		}
+
+		for (; i < n; i++)
+		{
+			half3_store(&r[i].x, _mm_cvtps_ph(v[i].data, _MM_FROUND_TO_NEAREST_INT), i + 1 == n);
+		}
+	}
+
+	/// <summary>
+	/// Unpacks n 3D vectors, two per instruction. w is zero.
+	/// </summary>
+	P_TARGET_F16C inline void half3_unpack(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::THalfVector3<float>* v, size_t n)
+	{
+		// (x0 y0 z0 x1 y1 z1) -> (x0 y0 z0 0 x1 y1 z1 0)
+		const __m128i expand = _mm_setr_epi8(0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11, -1, -1);
+
+		size_t i = 0;
+		for (; i + 3 <= n; i += 2)
+		{
+			__m128i h = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&v[i].x)), expand);
+			__m256 f = _mm256_cvtph_ps(h);
+			r[i].data = _mm256_castps256_ps128(f);
+			r[i + 1].data = _mm256_extractf128_ps(f, 1);
+		}
+
+		for (; i < n; i++)
+		{
+			r[i].data = _mm_cvtph_ps(half3_load(&v[i].x, i + 1 == n));
+		}
+	}
+
+	// Double vectors are registers in AVX builds only.
+#		if P_AVX__
+
+	/// <summary>
+	/// Packs n 3D vectors of doubles, one register each.
+	/// </summary>
+	P_TARGET_F16C inline void half3_pack(Phanes::Core::Math::THalfVector3<double>* r, const Phanes::Core::Math::TVector3<double, true>* v, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			half3_store(&r[i].x, _mm_cvtps_ph(_mm256_cvtpd_ps(v[i].data), _MM_FROUND_TO_NEAREST_INT), i + 1 == n);
+		}
+	}
+
+	/// <summary>
+	/// Unpacks n 3D vectors of doubles, one register each. w is zero.
+	/// </summary>
+	P_TARGET_F16C inline void half3_unpack(Phanes::Core::Math::TVector3<double, true>* r, const Phanes::Core::Math::THalfVector3<double>* v, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			r[i].data = _mm256_cvtps_pd(_mm_cvtph_ps(half3_load(&v[i].x, i + 1 == n)));
+		}
+	}
+#		endif
+} // namespace Phanes::Core::Math::SIMD::F16C
+
+#	endif // P_F16C__ || P_SIMD_DISPATCH
+
+#	if P_SSE__ && !P_SIMD_DISPATCH
+
+namespace Phanes::Core::Math::Detail
+{
+	// TVector2<double, true> is a single xmm register, it goes through the scalar path.
+
+	template <>
+	struct compute_half2_pack<double, true> : public compute_half2_pack<double, false> {};
+
+	template <>
+	struct compute_half2_unpack<double, true> : public compute_half2_unpack<double, false> {};
+
+#		if P_F16C__
+
+	template <>
+	struct compute_half_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Types::uint16* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half_unpack<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Types::uint16* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_unpack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector3<float>* r, const Phanes::Core::Math::TVector3<float, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half3_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_unpack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::THalfVector3<float>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half3_unpack(r, v, n);
+		}
+	};
+
+	// Both sides are contiguous arrays of four components.
+
+	template <>
+	struct compute_half4_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector4<float>* r, const Phanes::Core::Math::TVector4<float, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_pack(&r->x, reinterpret_cast<const float*>(v), n * 4);
+		}
+	};
+
+	template <>
+	struct compute_half4_unpack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>* r, const Phanes::Core::Math::THalfVector4<float>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_unpack(reinterpret_cast<float*>(r), &v->x, n * 4);
+		}
+	};
+
+	template <>
+	struct compute_half_pack<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Types::uint16* r, const double* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half_unpack<double, true>
+	{
+		static FORCEINLINE void map(double* r, const Phanes::Core::Types::uint16* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_unpack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_pack<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector3<double>* r, const Phanes::Core::Math::TVector3<double, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half3_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_unpack<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>* r, const Phanes::Core::Math::THalfVector3<double>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half3_unpack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half4_pack<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector4<double>* r, const Phanes::Core::Math::TVector4<double, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_pack(&r->x, reinterpret_cast<const double*>(v), n * 4);
+		}
+	};
+
+	template <>
+	struct compute_half4_unpack<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>* r, const Phanes::Core::Math::THalfVector4<double>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::F16C::half_unpack(reinterpret_cast<double*>(r), &v->x, n * 4);
+		}
+	};
+
+#		else
+
+	// No F16C: the scalar conversions, on the components of the registers.
+
+	template <>
+	struct compute_half_pack<float, true> : public compute_half_pack<float, false> {};
+
+	template <>
+	struct compute_half_unpack<float, true> : public compute_half_unpack<float, false> {};
+
+	template <>
+	struct compute_half3_pack<float, true> : public compute_half3_pack<float, false> {};
+
+	template <>
+	struct compute_half3_unpack<float, true> : public compute_half3_unpack<float, false> {};
+
+	template <>
+	struct compute_half4_pack<float, true> : public compute_half4_pack<float, false> {};
+
+	template <>
+	struct compute_half4_unpack<float, true> : public compute_half4_unpack<float, false> {};
+
+#			if P_AVX__
+
+	template <>
+	struct compute_half_pack<double, true> : public compute_half_pack<double, false> {};
+
+	template <>
+	struct compute_half_unpack<double, true> : public compute_half_unpack<double, false> {};
+
+	template <>
+	struct compute_half3_pack<double, true> : public compute_half3_pack<double, false> {};
+
+	template <>
+	struct compute_half3_unpack<double, true> : public compute_half3_unpack<double, false> {};
+
+	template <>
+	struct compute_half4_pack<double, true> : public compute_half4_pack<double, false> {};
+
+	template <>
+	struct compute_half4_unpack<double, true> : public compute_half4_unpack<double, false> {};
+
+#			endif
+#		endif
+} // namespace Phanes::Core::Math::Detail
+
+#	endif // P_SSE__ && !P_SIMD_DISPATCH
+
+#endif // !PHANES_BATCH_F16C_HPP
@@ -0,0 +1,1259 @@
+#pragma once
+
+#include <nmmintrin.h>
+
+#include <bit>
+#include <cstring>
+
+#ifndef PHANES_BATCH_SSE_HPP
+#	define PHANES_BATCH_SSE_HPP
+
+// SSE4.1 batch kernels over arrays and TVector3SoA / TVector4SoA streams. SSE builds call them directly, dispatch
+// builds use them as the lowest tier (see PhanesDispatch.hpp).
+
+namespace Phanes::Core::Math::SIMD::SSE
+{
+	/// <summary>
+	/// r[i] = v1[i] + v2[i]. n is a multiple of 4.
+	/// </summary>
+	inline void soa_add(float* r, const float* v1, const float* v2, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			_mm_store_ps(r + i, _mm_add_ps(_mm_load_ps(v1 + i), _mm_load_ps(v2 + i)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - v2[i]. n is a multiple of 4.
+	/// </summary>
+	inline void soa_sub(float* r, const float* v1, const float* v2, size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			_mm_store_ps(r + i, _mm_sub_ps(_mm_load_ps(v1 + i), _mm_load_ps(v2 + i)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * s. n is a multiple of 4.
+	/// </summary>
+	inline void soa_scale(float* r, const float* v1, float s, size_t n)
+	{
+		__m128 vs = _mm_set1_ps(s);
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			_mm_store_ps(r + i, _mm_mul_ps(_mm_load_ps(v1 + i), vs));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = (1 - t) * v1[i] + t * v2[i]. n is a multiple of 4.
+	/// </summary>
+	inline void soa_lerp(float* r, const float* v1, const float* v2, float t, size_t n)
+	{
+		__m128 vt = _mm_set1_ps(t);
+		__m128 vt1 = _mm_set1_ps(1.0f - t);
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 tmp = _mm_mul_ps(_mm_load_ps(v1 + i), vt1);
+			_mm_store_ps(r + i, _mm_add_ps(tmp, _mm_mul_ps(_mm_load_ps(v2 + i), vt)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = sin(v[i]). Any n, unaligned arrays. See vec4_sincos for the accuracy.
+	/// </summary>
+	inline void soa_sin(float* r, const float* v, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			_mm_storeu_ps(r + i, vec4_sin(_mm_loadu_ps(v + i)));
+		}
+
+		if (i < n)
+		{
+			alignas(16) float tmp[4] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			_mm_store_ps(tmp, vec4_sin(_mm_load_ps(tmp)));
+			std::memcpy(r + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = cos(v[i]). Any n, unaligned arrays. See vec4_sincos for the accuracy.
+	/// </summary>
+	inline void soa_cos(float* r, const float* v, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			_mm_storeu_ps(r + i, vec4_cos(_mm_loadu_ps(v + i)));
+		}
+
+		if (i < n)
+		{
+			alignas(16) float tmp[4] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			_mm_store_ps(tmp, vec4_cos(_mm_load_ps(tmp)));
+			std::memcpy(r + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// s[i] = sin(v[i]), c[i] = cos(v[i]). Any n, unaligned arrays.
+	/// </summary>
+	inline void soa_sincos(float* s, float* c, const float* v, size_t n)
+	{
+		size_t i = 0;
+		__m128 vs, vc;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vec4_sincos(_mm_loadu_ps(v + i), vs, vc);
+			_mm_storeu_ps(s + i, vs);
+			_mm_storeu_ps(c + i, vc);
+		}
+
+		if (i < n)
+		{
+			alignas(16) float tmp[4] = {};
+			std::memcpy(tmp, v + i, (n - i) * sizeof(float));
+			vec4_sincos(_mm_load_ps(tmp), vs, vc);
+
+			_mm_store_ps(tmp, vs);
+			std::memcpy(s + i, tmp, (n - i) * sizeof(float));
+			_mm_store_ps(tmp, vc);
+			std::memcpy(c + i, tmp, (n - i) * sizeof(float));
+		}
+	}
+
+	/// <summary>
+	/// Dot products of the first n vectors of v1 and v2.
+	/// </summary>
+	inline void vec4soa_dotp(float* r,
+							const Phanes::Core::Math::TVector4SoA<float>& v1,
+							const Phanes::Core::Math::TVector4SoA<float>& v2,
+							size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 dot = _mm_mul_ps(_mm_load_ps(v1.x + i), _mm_load_ps(v2.x + i));
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_load_ps(v1.y + i), _mm_load_ps(v2.y + i)));
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_load_ps(v1.z + i), _mm_load_ps(v2.z + i)));
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_load_ps(v1.w + i), _mm_load_ps(v2.w + i)));
+
+			_mm_storeu_ps(r + i, dot);
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+		}
+	}
+
+	/// <summary>
+	/// Magnitudes of the first n vectors of v1.
+	/// </summary>
+	inline void vec4soa_mag(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 x = _mm_load_ps(v1.x + i);
+			__m128 y = _mm_load_ps(v1.y + i);
+			__m128 z = _mm_load_ps(v1.z + i);
+			__m128 w = _mm_load_ps(v1.w + i);
+
+			__m128 dot = _mm_mul_ps(x, x);
+			dot = _mm_add_ps(dot, _mm_mul_ps(y, y));
+			dot = _mm_add_ps(dot, _mm_mul_ps(z, z));
+			dot = _mm_add_ps(dot, _mm_mul_ps(w, w));
+
+			_mm_storeu_ps(r + i, _mm_sqrt_ps(dot));
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i] + v1.w[i] * v1.w[i]);
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors. n is a multiple of 4.
+	/// </summary>
+	inline void vec4soa_norm(Phanes::Core::Math::TVector4SoA<float>& r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 inac = _mm_set1_ps(P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 x = _mm_load_ps(v1.x + i);
+			__m128 y = _mm_load_ps(v1.y + i);
+			__m128 z = _mm_load_ps(v1.z + i);
+			__m128 w = _mm_load_ps(v1.w + i);
+
+			__m128 dot = _mm_mul_ps(x, x);
+			dot = _mm_add_ps(dot, _mm_mul_ps(y, y));
+			dot = _mm_add_ps(dot, _mm_mul_ps(z, z));
+			dot = _mm_add_ps(dot, _mm_mul_ps(w, w));
+
+			__m128 mag = _mm_sqrt_ps(dot);
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m128 s = _mm_blendv_ps(one, _mm_div_ps(one, mag), _mm_cmpge_ps(mag, inac));
+
+			_mm_store_ps(r.x + i, _mm_mul_ps(x, s));
+			_mm_store_ps(r.y + i, _mm_mul_ps(y, s));
+			_mm_store_ps(r.z + i, _mm_mul_ps(z, s));
+			_mm_store_ps(r.w + i, _mm_mul_ps(w, s));
+		}
+	}
+
+	/// <summary>
+	/// Dot products of the first n vectors of v1 and v2.
+	/// </summary>
+	inline void vec3soa_dotp(float* r,
+							const Phanes::Core::Math::TVector3SoA<float>& v1,
+							const Phanes::Core::Math::TVector3SoA<float>& v2,
+							size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 dot = _mm_mul_ps(_mm_load_ps(v1.x + i), _mm_load_ps(v2.x + i));
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_load_ps(v1.y + i), _mm_load_ps(v2.y + i)));
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_load_ps(v1.z + i), _mm_load_ps(v2.z + i)));
+
+			_mm_storeu_ps(r + i, dot);
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+		}
+	}
+
+	/// <summary>
+	/// Magnitudes of the first n vectors of v1.
+	/// </summary>
+	inline void vec3soa_mag(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 x = _mm_load_ps(v1.x + i);
+			__m128 y = _mm_load_ps(v1.y + i);
+			__m128 z = _mm_load_ps(v1.z + i);
+
+			__m128 dot = _mm_mul_ps(x, x);
+			dot = _mm_add_ps(dot, _mm_mul_ps(y, y));
+			dot = _mm_add_ps(dot, _mm_mul_ps(z, z));
+
+			_mm_storeu_ps(r + i, _mm_sqrt_ps(dot));
+		}
+
+		for (; i < n; i++)
+		{
+			r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i]);
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors. n is a multiple of 4.
+	/// </summary>
+	inline void vec3soa_norm(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 inac = _mm_set1_ps(P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 x = _mm_load_ps(v1.x + i);
+			__m128 y = _mm_load_ps(v1.y + i);
+			__m128 z = _mm_load_ps(v1.z + i);
+
+			__m128 dot = _mm_mul_ps(x, x);
+			dot = _mm_add_ps(dot, _mm_mul_ps(y, y));
+			dot = _mm_add_ps(dot, _mm_mul_ps(z, z));
+
+			__m128 mag = _mm_sqrt_ps(dot);
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m128 s = _mm_blendv_ps(one, _mm_div_ps(one, mag), _mm_cmpge_ps(mag, inac));
+
+			_mm_store_ps(r.x + i, _mm_mul_ps(x, s));
+			_mm_store_ps(r.y + i, _mm_mul_ps(y, s));
+			_mm_store_ps(r.z + i, _mm_mul_ps(z, s));
+		}
+	}
+
+	/// <summary>
+	/// Normalizes n vectors with the refined rsqrt estimate. n is a multiple of 4.
+	/// </summary>
+	inline void vec3soa_fast_norm(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 inac = _mm_set1_ps(P_FLT_INAC * P_FLT_INAC);
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 x = _mm_load_ps(v1.x + i);
+			__m128 y = _mm_load_ps(v1.y + i);
+			__m128 z = _mm_load_ps(v1.z + i);
+
+			__m128 dot = _mm_mul_ps(x, x);
+			dot = _mm_add_ps(dot, _mm_mul_ps(y, y));
+			dot = _mm_add_ps(dot, _mm_mul_ps(z, z));
+
+			// Vectors shorter than P_FLT_INAC are left untouched.
+			__m128 s = _mm_blendv_ps(one, vec4_rsqrt<true>(dot), _mm_cmpge_ps(dot, inac));
+
+			_mm_store_ps(r.x + i, _mm_mul_ps(x, s));
+			_mm_store_ps(r.y + i, _mm_mul_ps(y, s));
+			_mm_store_ps(r.z + i, _mm_mul_ps(z, s));
+		}
+	}
+
+	/// <summary>
+	/// Cross products of n vectors. n is a multiple of 4.
+	/// </summary>
+	inline void vec3soa_cross_p(Phanes::Core::Math::TVector3SoA<float>& r,
+								const Phanes::Core::Math::TVector3SoA<float>& v1,
+								const Phanes::Core::Math::TVector3SoA<float>& v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 x1 = _mm_load_ps(v1.x + i);
+			__m128 y1 = _mm_load_ps(v1.y + i);
+			__m128 z1 = _mm_load_ps(v1.z + i);
+			__m128 x2 = _mm_load_ps(v2.x + i);
+			__m128 y2 = _mm_load_ps(v2.y + i);
+			__m128 z2 = _mm_load_ps(v2.z + i);
+
+			_mm_store_ps(r.x + i, _mm_sub_ps(_mm_mul_ps(y1, z2), _mm_mul_ps(z1, y2)));
+			_mm_store_ps(r.y + i, _mm_sub_ps(_mm_mul_ps(z1, x2), _mm_mul_ps(x1, z2)));
+			_mm_store_ps(r.z + i, _mm_sub_ps(_mm_mul_ps(x1, y2), _mm_mul_ps(y1, x2)));
+		}
+	}
+
+	/// <summary>
+	/// Transforms all vectors of v by the rows m[0..3], m[4..7] and m[8..11] of a 3x4 matrix. The last column is the translation, already scaled by w.
+	/// </summary>
+	inline void mat4_soa_transform(Phanes::Core::Math::TVector3SoA<float>& r,
+									const float* m,
+									const Phanes::Core::Math::TVector3SoA<float>& v)
+	{
+		__m128 m00 = _mm_set1_ps(m[0]);
+		__m128 m01 = _mm_set1_ps(m[1]);
+		__m128 m02 = _mm_set1_ps(m[2]);
+		__m128 m10 = _mm_set1_ps(m[4]);
+		__m128 m11 = _mm_set1_ps(m[5]);
+		__m128 m12 = _mm_set1_ps(m[6]);
+		__m128 m20 = _mm_set1_ps(m[8]);
+		__m128 m21 = _mm_set1_ps(m[9]);
+		__m128 m22 = _mm_set1_ps(m[10]);
+
+		__m128 t0 = _mm_set1_ps(m[3]);
+		__m128 t1 = _mm_set1_ps(m[7]);
+		__m128 t2 = _mm_set1_ps(m[11]);
+
+		for (size_t i = 0; i < v.PaddedSize(); i += 4)
+		{
+			__m128 x = _mm_load_ps(v.x + i);
+			__m128 y = _mm_load_ps(v.y + i);
+			__m128 z = _mm_load_ps(v.z + i);
+
+			_mm_store_ps(r.x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_add_ps(_mm_mul_ps(m02, z), t0)));
+			_mm_store_ps(r.y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_add_ps(_mm_mul_ps(m12, z), t1)));
+			_mm_store_ps(r.z + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_add_ps(_mm_mul_ps(m22, z), t2)));
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] + v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_add(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_add<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] + s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_add_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_add<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_sub(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_sub<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] - s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_sub_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_sub<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_mul(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_mul<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] * s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_mul_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_mul<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] & v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_and(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_and<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] & s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_and_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_and<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] | v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_or(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_or<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] | s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_or_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_or<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] ^ v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_xor(Phanes::Core::Math::TIntVector4<int, true>* r,
+								const Phanes::Core::Math::TIntVector4<int, true>* v1,
+								const Phanes::Core::Math::TIntVector4<int, true>* v2,
+								size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_xor<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] ^ s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_xor_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										int s,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_xor<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] << v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_left_shift(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										const Phanes::Core::Math::TIntVector4<int, true>* v2,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_left_shift<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] << s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_left_shift_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												int s,
+												size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_left_shift<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] >> v2[i] for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_right_shift(Phanes::Core::Math::TIntVector4<int, true>* r,
+										const Phanes::Core::Math::TIntVector4<int, true>* v1,
+										const Phanes::Core::Math::TIntVector4<int, true>* v2,
+										size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_right_shift<int, true>::map(r[i], v1[i], v2[i]);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = v1[i] >> s for n vectors, one per register.
+	/// </summary>
+	inline void ivec4_batch_right_shift_scalar(Phanes::Core::Math::TIntVector4<int, true>* r,
+												const Phanes::Core::Math::TIntVector4<int, true>* v1,
+												int s,
+												size_t n)
+	{
+		for (size_t i = 0; i < n; ++i)
+		{
+			Phanes::Core::Math::Detail::compute_ivec4_right_shift<int, true>::map(r[i], v1[i], s);
+		}
+	}
+
+	/// <summary>
+	/// r[i] = transpose(inverse(m[i])) for n matrices. Singular matrices give a zero matrix.
+	/// </summary>
+	/// <returns>False, if any matrix was singular.</returns>
+	inline bool mat3_batch_inv_transpose(Phanes::Core::Math::TMatrix3<float, true>* r,
+										 const Phanes::Core::Math::TMatrix3<float, true>* m,
+										 size_t n)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 zero = _mm_setzero_ps();
+		__m128 invertible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			__m128 c0 = m[i].c0.data;
+			__m128 c1 = m[i].c1.data;
+			__m128 c2 = m[i].c2.data;
+
+			// The rows of the inverse are the columns of the inverse transpose.
+			// a x b = (a * b.yzx - a.yzx * b).yzx, so the shuffled columns are shared by all three cross products.
+			__m128 c0_yzx = _mm_shuffle_ps(c0, c0, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 c1_yzx = _mm_shuffle_ps(c1, c1, _MM_SHUFFLE(3, 0, 2, 1));
+			__m128 c2_yzx = _mm_shuffle_ps(c2, c2, _MM_SHUFFLE(3, 0, 2, 1));
+
+			__m128 r0 = _mm_sub_ps(_mm_mul_ps(c1, c2_yzx), _mm_mul_ps(c1_yzx, c2));
+			__m128 r1 = _mm_sub_ps(_mm_mul_ps(c2, c0_yzx), _mm_mul_ps(c2_yzx, c0));
+			__m128 r2 = _mm_sub_ps(_mm_mul_ps(c0, c1_yzx), _mm_mul_ps(c0_yzx, c1));
+
+			r0 = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 0, 2, 1));
+			r1 = _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 0, 2, 1));
+			r2 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 0, 2, 1));
+
+			__m128 det = _mm_dp_ps(c0, r0, 0x7F);
+
+			// Branchless: 1 / det is masked to zero for singular matrices.
+			__m128 mask = _mm_cmpneq_ps(det, zero);
+			__m128 _1_det = _mm_and_ps(_mm_div_ps(one, det), mask);
+			invertible = _mm_and_ps(invertible, mask);
+
+			r[i].c0.data = _mm_mul_ps(r0, _1_det);
+			r[i].c1.data = _mm_mul_ps(r1, _1_det);
+			r[i].c2.data = _mm_mul_ps(r2, _1_det);
+		}
+
+		return _mm_movemask_ps(invertible) == 0xF;
+	}
+
+	/// <summary>
+	/// Coefficients u[i] and v[i] of the slerp weight polynomial, see quat_batch_slerp.
+	/// </summary>
+	inline constexpr float quat_slerp_u[8] = { 1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+											   1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), 1.85298109240830f / (8 * 17) };
+
+	inline constexpr float quat_slerp_v[8] = { 1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+											   5.0f / 11, 6.0f / 13, 7.0f / 15, 1.85298109240830f * 8 / 17 };
+
+	/// <summary>
+	/// r[i] = slerp(q1[i], q2[i], t) for n quaternions, four per iteration.
+	/// </summary>
+	/// <remarks>
+	/// The weights sin((1 - t) * theta) / sin(theta) and sin(t * theta) / sin(theta) are evaluated with the polynomial in
+	/// cos(theta) from D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP". It needs no acos / sin and no
+	/// branch for almost parallel quaternions. The weights are accurate to about 2e-5.
+	/// </remarks>
+	inline void quat_batch_slerp(Phanes::Core::Math::TQuaternion<float, true>* r,
+								 const Phanes::Core::Math::TQuaternion<float, true>* q1,
+								 const Phanes::Core::Math::TQuaternion<float, true>* q2,
+								 float t,
+								 size_t n)
+	{
+		float d = 1.0f - t;
+
+		__m128 kt[8];
+		__m128 kd[8];
+
+		for (int k = 0; k < 8; k++)
+		{
+			kt[k] = _mm_set1_ps(quat_slerp_u[k] * t * t - quat_slerp_v[k]);
+			kd[k] = _mm_set1_ps(quat_slerp_u[k] * d * d - quat_slerp_v[k]);
+		}
+
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 vt = _mm_set1_ps(t);
+		__m128 vd = _mm_set1_ps(d);
+
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 a0 = q1[i].data;
+			__m128 a1 = q1[i + 1].data;
+			__m128 a2 = q1[i + 2].data;
+			__m128 a3 = q1[i + 3].data;
+
+			__m128 b0 = q2[i].data;
+			__m128 b1 = q2[i + 1].data;
+			__m128 b2 = q2[i + 2].data;
+			__m128 b3 = q2[i + 3].data;
+
+			// (dot0, dot1, dot2, dot3)
+			__m128 cosTheta = _mm_hadd_ps(_mm_hadd_ps(_mm_mul_ps(a0, b0), _mm_mul_ps(a1, b1)),
+										  _mm_hadd_ps(_mm_mul_ps(a2, b2), _mm_mul_ps(a3, b3)));
+
+			// Shortest path: the sign of the dot product is moved onto the weight of q2.
+			__m128 sign = _mm_and_ps(cosTheta, _mm_set1_ps(-0.0f));
+			__m128 xm1 = _mm_sub_ps(_mm_xor_ps(cosTheta, sign), one);
+
+			__m128 ft = one;
+			__m128 fd = one;
+
+			for (int k = 7; k >= 0; k--)
+			{
+				ft = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(kt[k], xm1), ft));
+				fd = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(kd[k], xm1), fd));
+			}
+
+			__m128 wt = _mm_xor_ps(_mm_mul_ps(vt, ft), sign);
+			__m128 wd = _mm_mul_ps(vd, fd);
+
+			r[i].data = _mm_add_ps(_mm_mul_ps(a0, _mm_shuffle_ps(wd, wd, 0x00)), _mm_mul_ps(b0, _mm_shuffle_ps(wt, wt, 0x00)));
+			r[i + 1].data = _mm_add_ps(_mm_mul_ps(a1, _mm_shuffle_ps(wd, wd, 0x55)), _mm_mul_ps(b1, _mm_shuffle_ps(wt, wt, 0x55)));
+			r[i + 2].data = _mm_add_ps(_mm_mul_ps(a2, _mm_shuffle_ps(wd, wd, 0xAA)), _mm_mul_ps(b2, _mm_shuffle_ps(wt, wt, 0xAA)));
+			r[i + 3].data = _mm_add_ps(_mm_mul_ps(a3, _mm_shuffle_ps(wd, wd, 0xFF)), _mm_mul_ps(b3, _mm_shuffle_ps(wt, wt, 0xFF)));
+		}
+
+		if (i < n)
+		{
+			// Pads the tail with identities, so it takes the same path as the rest.
+			Phanes::Core::Math::TQuaternion<float, true> a[4];
+			Phanes::Core::Math::TQuaternion<float, true> b[4];
+
+			for (size_t k = 0; k < 4; k++)
+			{
+				a[k].data = (i + k < n) ? q1[i + k].data : _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+				b[k].data = (i + k < n) ? q2[i + k].data : _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			}
+
+			quat_batch_slerp(a, a, b, t, 4);
+
+			for (size_t k = 0; i + k < n; k++)
+			{
+				r[i + k].data = a[k].data;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Writes the six frustum planes as (nx, ny, nz, d, |nx|, |ny|, |nz|, 2 * d) to pl, so the culling kernels can
+	/// broadcast each component with one load.
+	/// </summary>
+	/// <param name="pl">48 floats</param>
+	inline void frustum_prepare(float* pl, const Phanes::Core::Math::TFrustum<float, true>& f)
+	{
+		for (int k = 0; k < 6; k++, pl += 8)
+		{
+			_mm_storeu_ps(pl, f.planes[k].comp.data);
+			_mm_storeu_ps(pl + 4, _mm_blend_ps(SIMD::vec4_abs(f.planes[k].comp.data), _mm_set1_ps(2.0f * f.planes[k].d), 0x8));
+		}
+	}
+
+	/// <summary>
+	/// Tests four boxes against the prepared planes.
+	/// </summary>
+	/// <returns>Visibility bits of the four boxes.</returns>
+	FORCEINLINE int frustum_aabb4(const float* pl, const Phanes::Core::Math::TAABB<float, true>* b)
+	{
+		__m128 l0 = b[0].min.data;
+		__m128 l1 = b[1].min.data;
+		__m128 l2 = b[2].min.data;
+		__m128 l3 = b[3].min.data;
+
+		__m128 h0 = b[0].max.data;
+		__m128 h1 = b[1].max.data;
+		__m128 h2 = b[2].max.data;
+		__m128 h3 = b[3].max.data;
+
+		_MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+		_MM_TRANSPOSE4_PS(h0, h1, h2, h3);
+
+		// Twice center and extents, compared against 2 * d: n * c + |n| * e >= d.
+		__m128 cx = _mm_add_ps(l0, h0);
+		__m128 cy = _mm_add_ps(l1, h1);
+		__m128 cz = _mm_add_ps(l2, h2);
+		__m128 ex = _mm_sub_ps(h0, l0);
+		__m128 ey = _mm_sub_ps(h1, l1);
+		__m128 ez = _mm_sub_ps(h2, l2);
+
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		for (int k = 0; k < 6; k++, pl += 8)
+		{
+			__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(pl[0]), cx), _mm_mul_ps(_mm_set1_ps(pl[1]), cy)),
+									 _mm_mul_ps(_mm_set1_ps(pl[2]), cz));
+			dist = _mm_add_ps(dist, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(pl[4]), ex), _mm_mul_ps(_mm_set1_ps(pl[5]), ey)),
+											   _mm_mul_ps(_mm_set1_ps(pl[6]), ez)));
+
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_set1_ps(pl[7])));
+		}
+
+		return _mm_movemask_ps(inside);
+	}
+
+	/// <summary>
+	/// Tests four spheres against the prepared planes.
+	/// </summary>
+	/// <returns>Visibility bits of the four spheres.</returns>
+	FORCEINLINE int frustum_sphere4(const float* pl, const Phanes::Core::Math::TSphere<float, true>* s)
+	{
+		__m128 cx = s[0].comp.data;
+		__m128 cy = s[1].comp.data;
+		__m128 cz = s[2].comp.data;
+		__m128 r = s[3].comp.data;
+
+		_MM_TRANSPOSE4_PS(cx, cy, cz, r);
+
+		__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		// n * c + r >= d
+		for (int k = 0; k < 6; k++, pl += 8)
+		{
+			__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(pl[0]), cx), _mm_mul_ps(_mm_set1_ps(pl[1]), cy)),
+									 _mm_add_ps(_mm_mul_ps(_mm_set1_ps(pl[2]), cz), r));
+
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_set1_ps(pl[3])));
+		}
+
+		return _mm_movemask_ps(inside);
+	}
+
+	/// <summary>
+	/// Culls n boxes, four per iteration. Sets bit i of visible, if box i is visible.
+	/// </summary>
+	/// <returns>Number of visible boxes.</returns>
+	inline size_t frustum_cull_aabbs(const Phanes::Core::Math::TFrustum<float, true>& f,
+									 const Phanes::Core::Math::TAABB<float, true>* b,
+									 size_t n,
+									 Phanes::Core::Types::uint32* visible)
+	{
+		alignas(16) float pl[48];
+		frustum_prepare(pl, f);
+
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			unsigned int mask = frustum_aabb4(pl, b + i);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		if (i < n)
+		{
+			// Pads the tail with copies of the last box, the extra bits are masked off.
+			Phanes::Core::Math::TAABB<float, true> tail[4];
+
+			for (size_t k = 0; k < 4; k++)
+			{
+				tail[k] = b[(i + k < n) ? i + k : n - 1];
+			}
+
+			unsigned int mask = frustum_aabb4(pl, tail) & ((1u << (n - i)) - 1);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		return count;
+	}
+
+	/// <summary>
+	/// Culls n spheres, four per iteration. Sets bit i of visible, if sphere i is visible.
+	/// </summary>
+	/// <returns>Number of visible spheres.</returns>
+	inline size_t frustum_cull_spheres(const Phanes::Core::Math::TFrustum<float, true>& f,
+									   const Phanes::Core::Math::TSphere<float, true>* s,
+									   size_t n,
+									   Phanes::Core::Types::uint32* visible)
+	{
+		alignas(16) float pl[48];
+		frustum_prepare(pl, f);
+
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			unsigned int mask = frustum_sphere4(pl, s + i);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		if (i < n)
+		{
+			// Pads the tail with copies of the last sphere, the extra bits are masked off.
+			Phanes::Core::Math::TSphere<float, true> tail[4];
+
+			for (size_t k = 0; k < 4; k++)
+			{
+				tail[k] = s[(i + k < n) ? i + k : n - 1];
+			}
+
+			unsigned int mask = frustum_sphere4(pl, tail) & ((1u << (n - i)) - 1);
+
+			visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (mask << (i & 31));
+			count += std::popcount(mask);
+		}
+
+		return count;
+	}
+
+	/// <summary>
+	/// Picks the nearest of the per lane hits of ray_triangles. Lane k of base holds the first index of the block of its hit, or -1.
+	/// </summary>
+	inline bool ray_triangles_reduce(Phanes::Core::Math::TTriangleHit<float>& hit,
+									 const float* t,
+									 const float* u,
+									 const float* v,
+									 const int* base,
+									 int lanes)
+	{
+		int best = -1;
+
+		for (int k = 0; k < lanes; k++)
+		{
+			// Equal parameters resolve to the lower index, like the scalar loop.
+			if (base[k] >= 0 && (best < 0 || t[k] < t[best] || (t[k] == t[best] && base[k] + k < base[best] + best)))
+			{
+				best = k;
+			}
+		}
+
+		if (best < 0)
+		{
+			return false;
+		}
+
+		hit.t = t[best];
+		hit.u = u[best];
+		hit.v = v[best];
+		hit.index = (size_t)(base[best] + best);
+		return true;
+	}
+
+	/// <summary>
+	/// Nearest hit of one ray in a triangle array, four triangles per iteration (Moller-Trumbore).
+	/// </summary>
+	/// <returns>True, if any triangle is hit at 0 <= t < tMax.</returns>
+	inline bool ray_triangles(Phanes::Core::Math::TTriangleHit<float>& hit,
+							  const Phanes::Core::Math::TTriangleSoA<float>& tris,
+							  float ox, float oy, float oz,
+							  float dx, float dy, float dz,
+							  float tMax)
+	{
+		const __m128 rox = _mm_set1_ps(ox);
+		const __m128 roy = _mm_set1_ps(oy);
+		const __m128 roz = _mm_set1_ps(oz);
+		const __m128 rdx = _mm_set1_ps(dx);
+		const __m128 rdy = _mm_set1_ps(dy);
+		const __m128 rdz = _mm_set1_ps(dz);
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		__m128 bt = _mm_set1_ps(tMax);
+		__m128 bu = zero;
+		__m128 bv = zero;
+		__m128 bi = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		size_t n = tris.PaddedSize();
+
+		for (size_t i = 0; i < n; i += 4)
+		{
+			__m128 e1x = _mm_load_ps(tris.e1[0] + i);
+			__m128 e1y = _mm_load_ps(tris.e1[1] + i);
+			__m128 e1z = _mm_load_ps(tris.e1[2] + i);
+			__m128 e2x = _mm_load_ps(tris.e2[0] + i);
+			__m128 e2y = _mm_load_ps(tris.e2[1] + i);
+			__m128 e2z = _mm_load_ps(tris.e2[2] + i);
+
+			// p = d x e2
+			__m128 px = _mm_sub_ps(_mm_mul_ps(rdy, e2z), _mm_mul_ps(rdz, e2y));
+			__m128 py = _mm_sub_ps(_mm_mul_ps(rdz, e2x), _mm_mul_ps(rdx, e2z));
+			__m128 pz = _mm_sub_ps(_mm_mul_ps(rdx, e2y), _mm_mul_ps(rdy, e2x));
+
+			__m128 inv = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz)));
+
+			// s = o - v0
+			__m128 sx = _mm_sub_ps(rox, _mm_load_ps(tris.v0[0] + i));
+			__m128 sy = _mm_sub_ps(roy, _mm_load_ps(tris.v0[1] + i));
+			__m128 sz = _mm_sub_ps(roz, _mm_load_ps(tris.v0[2] + i));
+
+			__m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inv);
+
+			// q = s x e1
+			__m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+			__m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+			__m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+
+			__m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rdx, qx), _mm_mul_ps(rdy, qy)), _mm_mul_ps(rdz, qz)), inv);
+			__m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inv);
+
+			// Ordered compares fail for NaN, so parallel rays and padding triangles never hit.
+			__m128 mask = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero)),
+									 _mm_and_ps(_mm_cmple_ps(_mm_add_ps(u, v), one), _mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmplt_ps(t, bt))));
+
+			bt = _mm_blendv_ps(bt, t, mask);
+			bu = _mm_blendv_ps(bu, u, mask);
+			bv = _mm_blendv_ps(bv, v, mask);
+			bi = _mm_blendv_ps(bi, _mm_castsi128_ps(_mm_set1_epi32((int)i)), mask);
+		}
+
+		alignas(16) float t[4];
+		alignas(16) float u[4];
+		alignas(16) float v[4];
+		alignas(16) int base[4];
+
+		_mm_store_ps(t, bt);
+		_mm_store_ps(u, bu);
+		_mm_store_ps(v, bv);
+		_mm_store_ps((float*)base, bi);
+
+		return ray_triangles_reduce(hit, t, u, v, base, 4);
+	}
+} // namespace Phanes::Core::Math::SIMD::SSE
+
+#	if P_INTRINSICS == P_INTRINSICS_SSE && !P_SIMD_DISPATCH
+
+namespace Phanes::Core::Math::Detail
+{
+	// AVX builds use the eight lane kernels in PhanesBatchAVX.hpp.
+
+	template <>
+	struct compute_soa_add<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_add(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sub<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_sub(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_scale<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, float s, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_scale(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_lerp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, float t, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_lerp(r, v1, v2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, const Phanes::Core::Math::TVector4SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec4soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec4soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<float>& r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec4soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec3soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec3soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec3soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_fast_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec3soa_fast_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_cross_p<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::vec3soa_cross_p(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_mat4_soa_transform<float, true>
+	{
+		template <bool S>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r,
+									const Phanes::Core::Math::TMatrix4<float, S>& m,
+									const Phanes::Core::Math::TVector3SoA<float>& v,
+									float w)
+		{
+			const float rows[12] = { m(0, 0), m(0, 1), m(0, 2), m(0, 3) * w,
+									 m(1, 0), m(1, 1), m(1, 2), m(1, 3) * w,
+									 m(2, 0), m(2, 1), m(2, 2), m(2, 3) * w };
+
+			Phanes::Core::Math::SIMD::SSE::mat4_soa_transform(r, rows, v);
+		}
+	};
+
+	template <>
+	struct compute_mat3_batch_inv_transpose<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>* r,
+									const Phanes::Core::Math::TMatrix3<float, true>* m,
+									size_t n)
+		{
+			return Phanes::Core::Math::SIMD::SSE::mat3_batch_inv_transpose(r, m, n);
+		}
+	};
+
+	template <>
+	struct compute_quat_batch_slerp<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>* r,
+									const Phanes::Core::Math::TQuaternion<float, true>* q1,
+									const Phanes::Core::Math::TQuaternion<float, true>* q2,
+									float t,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::quat_batch_slerp(r, q1, q2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_aabb<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TAABB<float, true>* b,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::SSE::frustum_cull_aabbs(f, b, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_sphere<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TSphere<float, true>* s,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::SSE::frustum_cull_spheres(f, s, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_ray_triangles<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TTriangleHit<float>& hit,
+									const Phanes::Core::Math::TTriangleSoA<float>& tris,
+									float ox, float oy, float oz,
+									float dx, float dy, float dz,
+									float tMax)
+		{
+			return Phanes::Core::Math::SIMD::SSE::ray_triangles(hit, tris, ox, oy, oz, dx, dy, dz, tMax);
+		}
+	};
+
+	template <>
+	struct compute_soa_sin<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_sin(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_cos<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_cos(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sincos<float, true>
+	{
+		static FORCEINLINE void map(float* s, float* c, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::SSE::soa_sincos(s, c, v, n);
+		}
+	};
+} // namespace Phanes::Core::Math::Detail
+
+#	endif
+
+#endif // !PHANES_BATCH_SSE_HPP
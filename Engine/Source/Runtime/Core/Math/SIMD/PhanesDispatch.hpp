@@ -0,0 +1,744 @@
+#pragma once
+
+#include "Core/Math/SIMD/PhanesBatchAVX.hpp"
+#include "Core/Math/SIMD/PhanesBatchAVX2.hpp"
+#include "Core/Math/SIMD/PhanesBatchF16C.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#	include <intrin.h>
+#endif
+
+// Runtime dispatch of the batch kernels.
+//
+// P_SIMD_DISPATCH builds compile against the SSE baseline. The SSE, AVX and AVX2 batch kernels are all compiled in
+// (the wider ones through P_TARGET_AVX / P_TARGET_AVX2) and the first batch call picks the widest set the CPU
+// supports. Single vector operations stay on the SSE baseline, only the batch kernels are dispatched.
+//
+// The environment variable PHANES_SIMD ("SSE", "AVX" or "AVX2") caps the selected level, which is useful to compare
+// the tiers on one host.
+
+#ifndef PHANES_DISPATCH_HPP
+#	define PHANES_DISPATCH_HPP
+
+namespace Phanes::Core::Math::SIMD
+{
+	/// <summary>
+	/// Detects the widest instruction set supported by the CPU and the operating system.
+	/// </summary>
+	/// <returns>P_INTRINSICS_SSE, P_INTRINSICS_AVX or P_INTRINSICS_AVX2</returns>
+	inline int DetectSIMDLevel()
+	{
+#	if defined(__GNUC__) || defined(__clang__)
+		// __builtin_cpu_supports checks XCR0 as well, so AVX is only reported if the OS saves the ymm registers.
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return P_INTRINSICS_AVX2;
+		}
+
+		if (__builtin_cpu_supports("avx"))
+		{
+			return P_INTRINSICS_AVX;
+		}
+#	elif defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+
+		if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) ? P_INTRINSICS_AVX2 : P_INTRINSICS_AVX;
+		}
+#	endif
+
+		return P_INTRINSICS_SSE;
+	}
+
+	/// <summary>
+	/// Level used at startup: DetectSIMDLevel(), capped by the PHANES_SIMD environment variable.
+	/// </summary>
+	inline int DefaultSIMDLevel()
+	{
+		int level = DetectSIMDLevel();
+
+		if (const char* env = std::getenv("PHANES_SIMD"))
+		{
+			if (std::strcmp(env, "SSE") == 0)
+			{
+				level = P_INTRINSICS_SSE;
+			}
+			else if (std::strcmp(env, "AVX") == 0)
+			{
+				level = std::min(level, P_INTRINSICS_AVX);
+			}
+		}
+
+		return level;
+	}
+
+	/// <summary>
+	/// Function pointers to the batch kernels of one instruction set.
+	/// </summary>
+	struct DispatchTable
+	{
+		using Vec3SoA = Phanes::Core::Math::TVector3SoA<float>;
+		using Vec4SoA = Phanes::Core::Math::TVector4SoA<float>;
+		using IVec4 = Phanes::Core::Math::TIntVector4<int, true>;
+		using Quat = Phanes::Core::Math::TQuaternion<float, true>;
+		using Mat3 = Phanes::Core::Math::TMatrix3<float, true>;
+		using Frustum = Phanes::Core::Math::TFrustum<float, true>;
+		using AABB = Phanes::Core::Math::TAABB<float, true>;
+		using Sphere = Phanes::Core::Math::TSphere<float, true>;
+		using TriangleHit = Phanes::Core::Math::TTriangleHit<float>;
+		using TriangleSoA = Phanes::Core::Math::TTriangleSoA<float>;
+		using Vec3 = Phanes::Core::Math::TVector3<float, true>;
+		using Half3 = Phanes::Core::Math::THalfVector3<float>;
+		using uint16 = Phanes::Core::Types::uint16;
+
+		/// <summary>
+		/// Instruction set of the kernels (P_INTRINSICS_SSE, P_INTRINSICS_AVX or P_INTRINSICS_AVX2).
+		/// </summary>
+		int level;
+
+		void (*soa_add)(float*, const float*, const float*, size_t);
+		void (*soa_sub)(float*, const float*, const float*, size_t);
+		void (*soa_scale)(float*, const float*, float, size_t);
+		void (*soa_lerp)(float*, const float*, const float*, float, size_t);
+		void (*vec4soa_dotp)(float*, const Vec4SoA&, const Vec4SoA&, size_t);
+		void (*vec4soa_mag)(float*, const Vec4SoA&, size_t);
+		void (*vec4soa_norm)(Vec4SoA&, const Vec4SoA&, size_t);
+		void (*vec3soa_dotp)(float*, const Vec3SoA&, const Vec3SoA&, size_t);
+		void (*vec3soa_mag)(float*, const Vec3SoA&, size_t);
+		void (*vec3soa_norm)(Vec3SoA&, const Vec3SoA&, size_t);
+		void (*vec3soa_fast_norm)(Vec3SoA&, const Vec3SoA&, size_t);
+		void (*vec3soa_cross_p)(Vec3SoA&, const Vec3SoA&, const Vec3SoA&, size_t);
+		void (*mat4_soa_transform)(Vec3SoA&, const float*, const Vec3SoA&);
+		void (*quat_batch_slerp)(Quat*, const Quat*, const Quat*, float, size_t);
+		bool (*mat3_batch_inv_transpose)(Mat3*, const Mat3*, size_t);
+		size_t (*frustum_cull_aabbs)(const Frustum&, const AABB*, size_t, Phanes::Core::Types::uint32*);
+		size_t (*frustum_cull_spheres)(const Frustum&, const Sphere*, size_t, Phanes::Core::Types::uint32*);
+		bool (*ray_triangles)(TriangleHit&, const TriangleSoA&, float, float, float, float, float, float, float);
+		void (*soa_sin)(float*, const float*, size_t);
+		void (*soa_cos)(float*, const float*, size_t);
+		void (*soa_sincos)(float*, float*, const float*, size_t);
+		void (*half_pack)(uint16*, const float*, size_t);
+		void (*half_unpack)(float*, const uint16*, size_t);
+		void (*half3_pack)(Half3*, const Vec3*, size_t);
+		void (*half3_unpack)(Vec3*, const Half3*, size_t);
+
+		void (*ivec4_batch_add)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_add_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_sub)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_sub_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_mul)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_mul_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_and)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_and_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_or)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_or_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_xor)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_xor_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_left_shift)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_left_shift_scalar)(IVec4*, const IVec4*, int, size_t);
+		void (*ivec4_batch_right_shift)(IVec4*, const IVec4*, const IVec4*, size_t);
+		void (*ivec4_batch_right_shift_scalar)(IVec4*, const IVec4*, int, size_t);
+	};
+
+	/// <summary>
+	/// Fills a table with the widest kernels available for level.
+	/// </summary>
+	/// <param name="level">P_INTRINSICS_SSE, P_INTRINSICS_AVX or P_INTRINSICS_AVX2</param>
+	inline DispatchTable MakeDispatchTable(int level)
+	{
+		DispatchTable t;
+		t.level = P_INTRINSICS_SSE;
+
+		t.soa_add = &SSE::soa_add;
+		t.soa_sub = &SSE::soa_sub;
+		t.soa_scale = &SSE::soa_scale;
+		t.soa_lerp = &SSE::soa_lerp;
+		t.vec4soa_dotp = &SSE::vec4soa_dotp;
+		t.vec4soa_mag = &SSE::vec4soa_mag;
+		t.vec4soa_norm = &SSE::vec4soa_norm;
+		t.vec3soa_dotp = &SSE::vec3soa_dotp;
+		t.vec3soa_mag = &SSE::vec3soa_mag;
+		t.vec3soa_norm = &SSE::vec3soa_norm;
+		t.vec3soa_fast_norm = &SSE::vec3soa_fast_norm;
+		t.vec3soa_cross_p = &SSE::vec3soa_cross_p;
+		t.mat4_soa_transform = &SSE::mat4_soa_transform;
+		t.quat_batch_slerp = &SSE::quat_batch_slerp;
+		t.mat3_batch_inv_transpose = &SSE::mat3_batch_inv_transpose;
+		t.frustum_cull_aabbs = &SSE::frustum_cull_aabbs;
+		t.frustum_cull_spheres = &SSE::frustum_cull_spheres;
+		t.ray_triangles = &SSE::ray_triangles;
+		t.soa_sin = &SSE::soa_sin;
+		t.soa_cos = &SSE::soa_cos;
+		t.soa_sincos = &SSE::soa_sincos;
+		t.half_pack = &Phanes::Core::Math::Detail::compute_half_pack<float, false>::map;
+		t.half_unpack = &Phanes::Core::Math::Detail::compute_half_unpack<float, false>::map;
+		t.half3_pack = &Phanes::Core::Math::Detail::compute_half3_pack<float, false>::map<true>;
+		t.half3_unpack = &Phanes::Core::Math::Detail::compute_half3_unpack<float, false>::map<true>;
+
+		t.ivec4_batch_add = &SSE::ivec4_batch_add;
+		t.ivec4_batch_add_scalar = &SSE::ivec4_batch_add_scalar;
+		t.ivec4_batch_sub = &SSE::ivec4_batch_sub;
+		t.ivec4_batch_sub_scalar = &SSE::ivec4_batch_sub_scalar;
+		t.ivec4_batch_mul = &SSE::ivec4_batch_mul;
+		t.ivec4_batch_mul_scalar = &SSE::ivec4_batch_mul_scalar;
+		t.ivec4_batch_and = &SSE::ivec4_batch_and;
+		t.ivec4_batch_and_scalar = &SSE::ivec4_batch_and_scalar;
+		t.ivec4_batch_or = &SSE::ivec4_batch_or;
+		t.ivec4_batch_or_scalar = &SSE::ivec4_batch_or_scalar;
+		t.ivec4_batch_xor = &SSE::ivec4_batch_xor;
+		t.ivec4_batch_xor_scalar = &SSE::ivec4_batch_xor_scalar;
+		t.ivec4_batch_left_shift = &SSE::ivec4_batch_left_shift;
+		t.ivec4_batch_left_shift_scalar = &SSE::ivec4_batch_left_shift_scalar;
+		t.ivec4_batch_right_shift = &SSE::ivec4_batch_right_shift;
+		t.ivec4_batch_right_shift_scalar = &SSE::ivec4_batch_right_shift_scalar;
+
+		if (level >= P_INTRINSICS_AVX)
+		{
+			t.level = P_INTRINSICS_AVX;
+
+			t.soa_add = &AVX::soa_add;
+			t.soa_sub = &AVX::soa_sub;
+			t.soa_scale = &AVX::soa_scale;
+			t.soa_lerp = &AVX::soa_lerp;
+			t.vec4soa_dotp = &AVX::vec4soa_dotp;
+			t.vec4soa_mag = &AVX::vec4soa_mag;
+			t.vec4soa_norm = &AVX::vec4soa_norm;
+			t.vec3soa_dotp = &AVX::vec3soa_dotp;
+			t.vec3soa_mag = &AVX::vec3soa_mag;
+			t.vec3soa_norm = &AVX::vec3soa_norm;
+			t.vec3soa_fast_norm = &AVX::vec3soa_fast_norm;
+			t.vec3soa_cross_p = &AVX::vec3soa_cross_p;
+			t.mat4_soa_transform = &AVX::mat4_soa_transform;
+			t.quat_batch_slerp = &AVX::quat_batch_slerp;
+			t.mat3_batch_inv_transpose = &AVX::mat3_batch_inv_transpose;
+			t.frustum_cull_aabbs = &AVX::frustum_cull_aabbs;
+			t.frustum_cull_spheres = &AVX::frustum_cull_spheres;
+			t.ray_triangles = &AVX::ray_triangles;
+			t.soa_sin = &AVX::soa_sin;
+			t.soa_cos = &AVX::soa_cos;
+			t.soa_sincos = &AVX::soa_sincos;
+		}
+
+		// AVX2 adds 256-bit integer operations, the float kernels stay on AVX. F16C is not part of AVX (Sandy Bridge has
+		// AVX only), but every AVX2 CPU has it, so the half conversions switch here.
+		if (level >= P_INTRINSICS_AVX2)
+		{
+			t.level = P_INTRINSICS_AVX2;
+
+			t.half_pack = &F16C::half_pack;
+			t.half_unpack = &F16C::half_unpack;
+			t.half3_pack = &F16C::half3_pack;
+			t.half3_unpack = &F16C::half3_unpack;
+
+			t.ivec4_batch_add = &AVX2::ivec4_batch_add;
+			t.ivec4_batch_add_scalar = &AVX2::ivec4_batch_add_scalar;
+			t.ivec4_batch_sub = &AVX2::ivec4_batch_sub;
+			t.ivec4_batch_sub_scalar = &AVX2::ivec4_batch_sub_scalar;
+			t.ivec4_batch_mul = &AVX2::ivec4_batch_mul;
+			t.ivec4_batch_mul_scalar = &AVX2::ivec4_batch_mul_scalar;
+			t.ivec4_batch_and = &AVX2::ivec4_batch_and;
+			t.ivec4_batch_and_scalar = &AVX2::ivec4_batch_and_scalar;
+			t.ivec4_batch_or = &AVX2::ivec4_batch_or;
+			t.ivec4_batch_or_scalar = &AVX2::ivec4_batch_or_scalar;
+			t.ivec4_batch_xor = &AVX2::ivec4_batch_xor;
+			t.ivec4_batch_xor_scalar = &AVX2::ivec4_batch_xor_scalar;
+			t.ivec4_batch_left_shift = &AVX2::ivec4_batch_left_shift;
+			t.ivec4_batch_left_shift_scalar = &AVX2::ivec4_batch_left_shift_scalar;
+			t.ivec4_batch_right_shift = &AVX2::ivec4_batch_right_shift;
+			t.ivec4_batch_right_shift_scalar = &AVX2::ivec4_batch_right_shift_scalar;
+		}
+
+		return t;
+	}
+
+	/// <summary>
+	/// The table in use. It is filled on first use (thread safe) from DefaultSIMDLevel().
+	/// </summary>
+	inline DispatchTable& DispatchTableInstance()
+	{
+		static DispatchTable table = MakeDispatchTable(DefaultSIMDLevel());
+		return table;
+	}
+
+	/// <summary>
+	/// Returns the kernels selected for this CPU.
+	/// </summary>
+	inline const DispatchTable& GetDispatchTable()
+	{
+		return DispatchTableInstance();
+	}
+
+	/// <summary>
+	/// Returns the instruction set of the selected kernels.
+	/// </summary>
+	/// <returns>P_INTRINSICS_SSE, P_INTRINSICS_AVX or P_INTRINSICS_AVX2</returns>
+	inline int GetSIMDLevel()
+	{
+		return GetDispatchTable().level;
+	}
+
+	/// <summary>
+	/// Switches the kernels to level, at most to what the CPU supports. <br>
+	/// Not thread safe, call it before any batch operation runs on other threads.
+	/// </summary>
+	/// <param name="level">P_INTRINSICS_SSE, P_INTRINSICS_AVX or P_INTRINSICS_AVX2</param>
+	inline void SetSIMDLevel(int level)
+	{
+		DispatchTableInstance() = MakeDispatchTable(std::min(level, DetectSIMDLevel()));
+	}
+} // namespace Phanes::Core::Math::SIMD
+
+namespace Phanes::Core::Math::Detail
+{
+	// Batch operations call through the table.
+
+	template <>
+	struct compute_soa_add<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_add(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sub<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_sub(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_scale<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, float s, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_scale(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_lerp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v1, const float* v2, float t, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_lerp(r, v1, v2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, const Phanes::Core::Math::TVector4SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec4soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec4soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<float>& r, const Phanes::Core::Math::TVector4SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec4soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_dotp<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec3soa_dotp(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_mag<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec3soa_mag(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec3soa_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_fast_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec3soa_fast_norm(r, v1, n);
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_cross_p<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3SoA<float>& v1, const Phanes::Core::Math::TVector3SoA<float>& v2, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().vec3soa_cross_p(r, v1, v2, n);
+		}
+	};
+
+	template <>
+	struct compute_mat4_soa_transform<float, true>
+	{
+		template <bool S>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r,
+									const Phanes::Core::Math::TMatrix4<float, S>& m,
+									const Phanes::Core::Math::TVector3SoA<float>& v,
+									float w)
+		{
+			const float rows[12] = { m(0, 0), m(0, 1), m(0, 2), m(0, 3) * w,
+									 m(1, 0), m(1, 1), m(1, 2), m(1, 3) * w,
+									 m(2, 0), m(2, 1), m(2, 2), m(2, 3) * w };
+
+			Phanes::Core::Math::SIMD::GetDispatchTable().mat4_soa_transform(r, rows, v);
+		}
+	};
+
+	template <>
+	struct compute_mat3_batch_inv_transpose<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>* r,
+									const Phanes::Core::Math::TMatrix3<float, true>* m,
+									size_t n)
+		{
+			return Phanes::Core::Math::SIMD::GetDispatchTable().mat3_batch_inv_transpose(r, m, n);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_aabb<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TAABB<float, true>* b,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::GetDispatchTable().frustum_cull_aabbs(f, b, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_sphere<float, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<float, true>& f,
+									  const Phanes::Core::Math::TSphere<float, true>* s,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			return Phanes::Core::Math::SIMD::GetDispatchTable().frustum_cull_spheres(f, s, n, visible);
+		}
+	};
+
+	template <>
+	struct compute_ray_triangles<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TTriangleHit<float>& hit,
+									const Phanes::Core::Math::TTriangleSoA<float>& tris,
+									float ox, float oy, float oz,
+									float dx, float dy, float dz,
+									float tMax)
+		{
+			return Phanes::Core::Math::SIMD::GetDispatchTable().ray_triangles(hit, tris, ox, oy, oz, dx, dy, dz, tMax);
+		}
+	};
+
+	template <>
+	struct compute_soa_sin<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_sin(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_cos<float, true>
+	{
+		static FORCEINLINE void map(float* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_cos(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_soa_sincos<float, true>
+	{
+		static FORCEINLINE void map(float* s, float* c, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().soa_sincos(s, c, v, n);
+		}
+	};
+
+	template <>
+	struct compute_quat_batch_slerp<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>* r,
+									const Phanes::Core::Math::TQuaternion<float, true>* q1,
+									const Phanes::Core::Math::TQuaternion<float, true>* q2,
+									float t,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().quat_batch_slerp(r, q1, q2, t, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_add<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_add(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_add_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_sub<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_sub(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_sub_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_mul<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_mul(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_mul_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_and<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_and(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_and_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_or<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_or(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_or_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_xor<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_xor(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_xor_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_left_shift<int, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_left_shift(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_left_shift_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_batch_right_shift<int, true>
+	{
+		// Arithmetic shift like the scalar >> on signed integers.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									const Phanes::Core::Math::TIntVector4<int, true>* v2,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_right_shift(r, v1, v2, n);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>* r,
+									const Phanes::Core::Math::TIntVector4<int, true>* v1,
+									int s,
+									size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().ivec4_batch_right_shift_scalar(r, v1, s, n);
+		}
+	};
+
+	template <>
+	struct compute_half_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Types::uint16* r, const float* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half_unpack<float, true>
+	{
+		static FORCEINLINE void map(float* r, const Phanes::Core::Types::uint16* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half_unpack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector3<float>* r, const Phanes::Core::Math::TVector3<float, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half3_pack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half3_unpack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::THalfVector3<float>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half3_unpack(r, v, n);
+		}
+	};
+
+	template <>
+	struct compute_half4_pack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::THalfVector4<float>* r, const Phanes::Core::Math::TVector4<float, true>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half_pack(&r->x, reinterpret_cast<const float*>(v), n * 4);
+		}
+	};
+
+	template <>
+	struct compute_half4_unpack<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>* r, const Phanes::Core::Math::THalfVector4<float>* v, size_t n)
+		{
+			Phanes::Core::Math::SIMD::GetDispatchTable().half_unpack(reinterpret_cast<float*>(r), &v->x, n * 4);
+		}
+	};
+
+	// TVector2<double, true> is a single xmm register, it goes through the scalar path.
+
+	template <>
+	struct compute_half2_pack<double, true> : public compute_half2_pack<double, false> {};
+
+	template <>
+	struct compute_half2_unpack<double, true> : public compute_half2_unpack<double, false> {};
+} // namespace Phanes::Core::Math::Detail
+
+#endif // !PHANES_DISPATCH_HPP
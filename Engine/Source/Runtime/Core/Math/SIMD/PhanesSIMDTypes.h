@@ -225,16 +225,14 @@ namespace Phanes::Core::Types
 #if P_INTRINSICS == 3
 
 	using Vec4x2i32Reg = __m256i;
-	using Vec8i32Reg;
-	= __m256i using Vec2x2i64Reg;
-	= __m256i using Vec4i64Reg;
-	= __m256i
-
-		using Vec4x2u32Reg;
-	= __m256i using Vec8u32Reg;
-	= __m256i using Vec2x2u64Reg;
-	= __m256i using Vec4u64Reg;
-	= __m256i
+	using Vec8i32Reg = __m256i;
+	using Vec2x2i64Reg = __m256i;
+	using Vec4i64Reg = __m256i;
+
+	using Vec4x2u32Reg = __m256i;
+	using Vec8u32Reg = __m256i;
+	using Vec2x2u64Reg = __m256i;
+	using Vec4u64Reg = __m256i;
 
 #elif P_INTRINSICS != P_INTRINSICS_NEON
 
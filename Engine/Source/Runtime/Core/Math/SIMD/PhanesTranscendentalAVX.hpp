@@ -0,0 +1,347 @@
+#pragma once
+
+#include <immintrin.h>
+
+#include <cmath>
+
+#ifndef PHANES_TRANSCENDENTAL_AVX_HPP
+#	define PHANES_TRANSCENDENTAL_AVX_HPP
+
+// Polynomial sin, cos, atan, exp and log on four doubles. sin, cos, exp and log use Taylor series on reduced ranges,
+// atan the rational fit of the Cephes library (S. L. Moshier). Errors are measured against libm over the documented
+// ranges (see MathTestFPU). Eight float sin / cos for the batch kernels is AVX::vec8_sincos in PhanesBatchAVX.hpp.
+//
+// Included by PhanesVectorMathAVX.hpp after the common helpers (vec4d_madd, ...).
+
+namespace Phanes::Core::Math::SIMD
+{
+	/// <summary>
+	/// Computes 2^e per component for integral e in [-1022, 1023]. AVX has no 256-bit integer shifts, the exponent is
+	/// assembled in two halves.
+	/// </summary>
+	/// <param name="e">Exponents, integral</param>
+	/// <returns>Powers of two</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_pow2i(const Phanes::Core::Types::Vec4f64Reg e)
+	{
+		// 2^52 + 1023 + e holds the biased exponent in its lowest mantissa bits.
+		__m256i b = _mm256_castpd_si256(_mm256_add_pd(e, _mm256_set1_pd(4503599627371519.0)));
+
+		__m128i lo = _mm_slli_epi64(_mm256_castsi256_si128(b), 52);
+		__m128i hi = _mm_slli_epi64(_mm256_extractf128_si256(b, 1), 52);
+
+		return _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+	}
+
+	/// <summary>
+	/// Recomputes the lanes of vec4d_sincos with |v| &gt; 1e6 with libm.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <param name="s">Sines, lanes in mask are replaced</param>
+	/// <param name="c">Cosines, lanes in mask are replaced</param>
+	/// <param name="mask">Lanes to recompute, as returned by _mm256_movemask_pd</param>
+	P_NOINLINE inline void vec4d_sincos_libm(const Phanes::Core::Types::Vec4f64Reg v,
+								  Phanes::Core::Types::Vec4f64Reg& s,
+								  Phanes::Core::Types::Vec4f64Reg& c,
+								  int mask)
+	{
+		alignas(32) double tv[4], ts[4], tc[4];
+		_mm256_store_pd(tv, v);
+		_mm256_store_pd(ts, s);
+		_mm256_store_pd(tc, c);
+
+		for (int k = 0; k < 4; k++)
+		{
+			if (mask & (1 << k))
+			{
+				ts[k] = std::sin(tv[k]);
+				tc[k] = std::cos(tv[k]);
+			}
+		}
+
+		s = _mm256_load_pd(ts);
+		c = _mm256_load_pd(tc);
+	}
+
+	/// <summary>
+	/// Computes sine and cosine per component. Max. error 2 ULP for |v| &lt;= 1e6. Larger angles lose accuracy in the
+	/// range reduction and go to libm (vec4d_sincos_libm).
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <param name="s">Sines</param>
+	/// <param name="c">Cosines</param>
+	FORCEINLINE void vec4d_sincos(const Phanes::Core::Types::Vec4f64Reg v,
+								  Phanes::Core::Types::Vec4f64Reg& s,
+								  Phanes::Core::Types::Vec4f64Reg& c)
+	{
+		// v = q * pi/2 + r with |r| <= pi/4. The first three parts of pi/2 have 33 bits, so q * part is exact up to 2^20.
+		__m256d q = _mm256_round_pd(_mm256_mul_pd(v, _mm256_set1_pd(0.6366197723675814)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256d r = vec4d_nmadd(q, _mm256_set1_pd(1.57079632673412561417e+00), v);
+		r = vec4d_nmadd(q, _mm256_set1_pd(6.07710050630396597660e-11), r);
+		r = vec4d_nmadd(q, _mm256_set1_pd(2.02226624871116645580e-21), r);
+		r = vec4d_nmadd(q, _mm256_set1_pd(8.47842766036889956997e-32), r);
+
+		__m256d z = _mm256_mul_pd(r, r);
+
+		// Taylor series up to r^17 and r^16, the remainders are below 2^-58 for |r| <= pi/4.
+		__m256d ps = vec4d_madd(_mm256_set1_pd(1.0 / 355687428096000.0), z, _mm256_set1_pd(-1.0 / 1307674368000.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(1.0 / 6227020800.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(-1.0 / 39916800.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(1.0 / 362880.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(-1.0 / 5040.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(1.0 / 120.0));
+		ps = vec4d_madd(ps, z, _mm256_set1_pd(-1.0 / 6.0));
+		ps = vec4d_madd(_mm256_mul_pd(ps, z), r, r);
+
+		__m256d pc = vec4d_madd(_mm256_set1_pd(1.0 / 20922789888000.0), z, _mm256_set1_pd(-1.0 / 87178291200.0));
+		pc = vec4d_madd(pc, z, _mm256_set1_pd(1.0 / 479001600.0));
+		pc = vec4d_madd(pc, z, _mm256_set1_pd(-1.0 / 3628800.0));
+		pc = vec4d_madd(pc, z, _mm256_set1_pd(1.0 / 40320.0));
+		pc = vec4d_madd(pc, z, _mm256_set1_pd(-1.0 / 720.0));
+		pc = vec4d_madd(pc, z, _mm256_set1_pd(1.0 / 24.0));
+		pc = vec4d_madd(_mm256_mul_pd(pc, z), z, vec4d_nmadd(_mm256_set1_pd(0.5), z, _mm256_set1_pd(1.0)));
+
+		// q mod 4 without integer instructions. Odd quadrants swap sine and cosine, quadrants 2 and 3 negate the sine,
+		// 1 and 2 the cosine.
+		__m256d q4 = vec4d_nmadd(_mm256_set1_pd(4.0), _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25))), q);
+
+		__m256d q1 = _mm256_cmp_pd(q4, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+		__m256d q2 = _mm256_cmp_pd(q4, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+		__m256d q3 = _mm256_cmp_pd(q4, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+
+		__m256d swap = _mm256_or_pd(q1, q3);
+		__m256d ssign = _mm256_and_pd(_mm256_or_pd(q2, q3), _mm256_set1_pd(-0.0));
+		__m256d csign = _mm256_and_pd(_mm256_or_pd(q1, q2), _mm256_set1_pd(-0.0));
+
+		s = _mm256_xor_pd(_mm256_blendv_pd(ps, pc, swap), ssign);
+		c = _mm256_xor_pd(_mm256_blendv_pd(pc, ps, swap), csign);
+
+		// Rare, so a branch instead of computing both paths. Infinities go to libm as well and give NaN.
+		int large = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), v), _mm256_set1_pd(1e6), _CMP_GT_OQ));
+
+		if (large != 0)
+		{
+			vec4d_sincos_libm(v, s, c, large);
+		}
+	}
+
+	/// <summary>
+	/// Computes the sine per component. Max. error 2 ULP for |v| &lt;= 1e6, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Sines</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_sin(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d s, c;
+		vec4d_sincos(v, s, c);
+		return s;
+	}
+
+	/// <summary>
+	/// Computes the cosine per component. Max. error 2 ULP for |v| &lt;= 1e6, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Cosines</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_cos(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d s, c;
+		vec4d_sincos(v, s, c);
+		return c;
+	}
+
+	/// <summary>
+	/// Computes the tangent per component as sin / cos. Max. error 4 ULP for |v| &lt;= 1e6, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Tangents</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_tan(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d s, c;
+		vec4d_sincos(v, s, c);
+		return _mm256_div_pd(s, c);
+	}
+
+	/// <summary>
+	/// Computes the arc tangent per component. Max. error 2 ULP.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Angles in [-pi/2, pi/2]</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_atan(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d one = _mm256_set1_pd(1.0);
+		__m256d sign = _mm256_and_pd(v, _mm256_set1_pd(-0.0));
+		__m256d a = _mm256_xor_pd(v, sign);
+
+		// a > tan(3pi/8): atan(a) = pi/2 + atan(-1 / a), a > 0.66: atan(a) = pi/4 + atan((a - 1) / (a + 1))
+		__m256d big = _mm256_cmp_pd(a, _mm256_set1_pd(2.41421356237309504880), _CMP_GT_OQ);
+		__m256d mid = _mm256_cmp_pd(a, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+
+		__m256d num = _mm256_blendv_pd(_mm256_blendv_pd(a, _mm256_sub_pd(a, one), mid), _mm256_set1_pd(-1.0), big);
+		__m256d den = _mm256_blendv_pd(_mm256_blendv_pd(one, _mm256_add_pd(a, one), mid), a, big);
+
+		// pi/4 and pi/2 in two parts
+		__m256d y = _mm256_blendv_pd(_mm256_and_pd(mid, _mm256_set1_pd(7.85398163397448309616E-1)), _mm256_set1_pd(1.57079632679489661923), big);
+		__m256d ylo = _mm256_blendv_pd(_mm256_and_pd(mid, _mm256_set1_pd(3.061616997868382943065E-17)), _mm256_set1_pd(6.123233995736765886130E-17), big);
+
+		__m256d x = _mm256_div_pd(num, den);
+		__m256d z = _mm256_mul_pd(x, x);
+
+		__m256d p = vec4d_madd(_mm256_set1_pd(-8.750608600031904122785E-1), z, _mm256_set1_pd(-1.615753718733365076637E1));
+		p = vec4d_madd(p, z, _mm256_set1_pd(-7.500855792314704667340E1));
+		p = vec4d_madd(p, z, _mm256_set1_pd(-1.228866684490136173410E2));
+		p = vec4d_madd(p, z, _mm256_set1_pd(-6.485021904942025371773E1));
+
+		__m256d q = _mm256_add_pd(z, _mm256_set1_pd(2.485846490142306297962E1));
+		q = vec4d_madd(q, z, _mm256_set1_pd(1.650270098316988542046E2));
+		q = vec4d_madd(q, z, _mm256_set1_pd(4.328810604912902668951E2));
+		q = vec4d_madd(q, z, _mm256_set1_pd(4.853903996359136964868E2));
+		q = vec4d_madd(q, z, _mm256_set1_pd(1.945506571482613964425E2));
+
+		p = vec4d_madd(x, _mm256_div_pd(_mm256_mul_pd(z, p), q), x);
+
+		return _mm256_xor_pd(_mm256_add_pd(y, _mm256_add_pd(p, ylo)), sign);
+	}
+
+	/// <summary>
+	/// Computes the angle of (x, y) per component. Max. error 3 ULP.
+	/// </summary>
+	/// <param name="y">Y coordinates</param>
+	/// <param name="x">X coordinates</param>
+	/// <returns>Angles in [-pi, pi]</returns>
+	/// <remarks>x = y = 0 gives 0 or pi like std::atan2. Both infinite is not handled.</remarks>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_atan2(const Phanes::Core::Types::Vec4f64Reg y,
+															const Phanes::Core::Types::Vec4f64Reg x)
+	{
+		__m256d zero = _mm256_setzero_pd();
+		__m256d ysign = _mm256_and_pd(y, _mm256_set1_pd(-0.0));
+		__m256d pi = _mm256_or_pd(_mm256_set1_pd(3.14159265358979323846), ysign);
+
+		__m256d r = vec4d_atan(_mm256_div_pd(y, x));
+		// pi by the sign bit of x, so x = -0 adds pi like std::atan2.
+		r = _mm256_add_pd(r, _mm256_blendv_pd(zero, pi, x));
+
+		// 0 / 0: 0 or pi by the sign of x.
+		__m256d origin = _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_EQ_OQ), _mm256_cmp_pd(y, zero, _CMP_EQ_OQ));
+
+		return _mm256_blendv_pd(r, _mm256_or_pd(_mm256_blendv_pd(zero, pi, x), ysign), origin);
+	}
+
+	/// <summary>
+	/// Computes the arc cosine per component as atan2(sqrt(1 - v^2), v). Max. error 3 ULP.
+	/// </summary>
+	/// <param name="v">Vector, components in [-1, 1]</param>
+	/// <returns>Angles in [0, pi], NaN outside of [-1, 1]</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_acos(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d one = _mm256_set1_pd(1.0);
+		return vec4d_atan2(_mm256_sqrt_pd(_mm256_mul_pd(_mm256_sub_pd(one, v), _mm256_add_pd(one, v))), v);
+	}
+
+	/// <summary>
+	/// Computes e^v per component. Max. error 1 ULP, subnormal results included.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Exponentials, infinity on overflow</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_exp(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		// Operand order keeps NaN.
+		__m256d x = _mm256_max_pd(_mm256_set1_pd(-746.0), _mm256_min_pd(_mm256_set1_pd(709.8), v));
+
+		// x = n * ln(2) + r, ln(2) split in two parts.
+		__m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256d r = vec4d_nmadd(n, _mm256_set1_pd(6.93147180369123816490e-01), x);
+		r = vec4d_nmadd(n, _mm256_set1_pd(1.90821492927058770002e-10), r);
+
+		// Taylor series up to r^13, the remainder is below 2^-57 for |r| <= ln(2) / 2.
+		__m256d p = vec4d_madd(_mm256_set1_pd(1.0 / 6227020800.0), r, _mm256_set1_pd(1.0 / 479001600.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 39916800.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 3628800.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 362880.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 40320.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 5040.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 720.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 120.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 24.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(1.0 / 6.0));
+		p = vec4d_madd(p, r, _mm256_set1_pd(0.5));
+		p = _mm256_add_pd(vec4d_madd(p, _mm256_mul_pd(r, r), r), _mm256_set1_pd(1.0));
+
+		// 2^n as two factors, so n = 1024 overflows and n < -1022 underflows gradually.
+		__m256d n1 = _mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5)));
+		__m256d n2 = _mm256_sub_pd(n, n1);
+
+		return _mm256_mul_pd(_mm256_mul_pd(p, vec4d_pow2i(n1)), vec4d_pow2i(n2));
+	}
+
+	/// <summary>
+	/// Computes the natural logarithm per component. Max. error 2 ULP, subnormal inputs included.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Logarithms. -infinity for 0, NaN for negative components.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_log(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d one = _mm256_set1_pd(1.0);
+		__m256d zero = _mm256_setzero_pd();
+
+		// Subnormals are scaled by 2^54 into the normal range.
+		__m256d tiny = _mm256_cmp_pd(v, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+		__m256d x = _mm256_blendv_pd(v, _mm256_mul_pd(v, _mm256_set1_pd(18014398509481984.0)), tiny);
+
+		// x = m * 2^e, m in [1, 2). The biased exponent is shifted into the mantissa of 2^52 in two halves.
+		__m256i b = _mm256_castpd_si256(x);
+		__m128i lo = _mm_srli_epi64(_mm256_castsi256_si128(b), 52);
+		__m128i hi = _mm_srli_epi64(_mm256_extractf128_si256(b, 1), 52);
+
+		__m256d e = _mm256_or_pd(_mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1)), _mm256_set1_pd(4503599627370496.0));
+		e = _mm256_sub_pd(e, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+		e = _mm256_sub_pd(e, _mm256_and_pd(tiny, _mm256_set1_pd(54.0)));
+
+		__m256d m = _mm256_or_pd(_mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFF))), one);
+
+		// m > sqrt(2): log(m) = log(m / 2) + log(2), keeps m in [sqrt(1/2), sqrt(2)]
+		__m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+		m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+		e = _mm256_add_pd(e, _mm256_and_pd(big, one));
+
+		// log(m) = 2 * atanh(f) = 2 * (f + f^3 / 3 + f^5 / 5 + ...) with f = (m - 1) / (m + 1), |f| <= 0.1716
+		__m256d f = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+		__m256d f2 = _mm256_add_pd(f, f);
+		__m256d s = _mm256_mul_pd(f, f);
+
+		__m256d p = vec4d_madd(_mm256_set1_pd(1.0 / 23.0), s, _mm256_set1_pd(1.0 / 21.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 19.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 17.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 15.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 13.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 11.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 9.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 7.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 5.0));
+		p = vec4d_madd(p, s, _mm256_set1_pd(1.0 / 3.0));
+
+		// e * ln(2) in two parts, the high part is exact.
+		__m256d lr = vec4d_madd(_mm256_mul_pd(f2, s), p, vec4d_madd(e, _mm256_set1_pd(1.90821492927058770002e-10), f2));
+		__m256d r = vec4d_madd(e, _mm256_set1_pd(6.93147180369123816490e-01), lr);
+
+		// log(0) = -inf, log(inf) = inf, negative and NaN give NaN.
+		r = _mm256_blendv_pd(r, _mm256_set1_pd(-std::numeric_limits<double>::infinity()), _mm256_cmp_pd(v, zero, _CMP_EQ_OQ));
+		r = _mm256_blendv_pd(r, v, _mm256_cmp_pd(v, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ));
+
+		return _mm256_or_pd(r, _mm256_cmp_pd(v, zero, _CMP_NGE_UQ));
+	}
+
+	/// <summary>
+	/// Computes x^y per component as e^(y * log(x)).
+	/// </summary>
+	/// <param name="x">Bases, not negative</param>
+	/// <param name="y">Exponents</param>
+	/// <returns>Powers, 1 where y is 0. NaN for negative bases.</returns>
+	/// <remarks>The error of log(x) is scaled by y * log(x), about |y * log(x)| ULP.</remarks>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_pow(const Phanes::Core::Types::Vec4f64Reg x,
+														  const Phanes::Core::Types::Vec4f64Reg y)
+	{
+		__m256d r = vec4d_exp(_mm256_mul_pd(y, vec4d_log(x)));
+		return _mm256_blendv_pd(r, _mm256_set1_pd(1.0), _mm256_cmp_pd(y, _mm256_setzero_pd(), _CMP_EQ_OQ));
+	}
+} // namespace Phanes::Core::Math::SIMD
+
+#endif // !PHANES_TRANSCENDENTAL_AVX_HPP
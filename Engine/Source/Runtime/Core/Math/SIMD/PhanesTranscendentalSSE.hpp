@@ -0,0 +1,293 @@
+#pragma once
+
+#include <nmmintrin.h>
+
+#include <cmath>
+
+#ifndef PHANES_TRANSCENDENTAL_SSE_HPP
+#	define PHANES_TRANSCENDENTAL_SSE_HPP
+
+// Polynomial sin, cos, atan, exp and log on four floats. The polynomials are the single precision minimax fits of the
+// Cephes library (S. L. Moshier). Errors are measured against libm over the documented ranges (see MathTestFPU).
+//
+// Included by PhanesVectorMathSSE.hpp after the common helpers (vec4_madd, ...).
+
+namespace Phanes::Core::Math::SIMD
+{
+	/// <summary>
+	/// Recomputes the lanes of vec4_sincos with |v| &gt; 8192 with libm.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <param name="s">Sines, lanes in mask are replaced</param>
+	/// <param name="c">Cosines, lanes in mask are replaced</param>
+	/// <param name="mask">Lanes to recompute, as returned by _mm_movemask_ps</param>
+	P_NOINLINE inline void vec4_sincos_libm(const Phanes::Core::Types::Vec4f32Reg v,
+								 Phanes::Core::Types::Vec4f32Reg& s,
+								 Phanes::Core::Types::Vec4f32Reg& c,
+								 int mask)
+	{
+		alignas(16) float tv[4], ts[4], tc[4];
+		_mm_store_ps(tv, v);
+		_mm_store_ps(ts, s);
+		_mm_store_ps(tc, c);
+
+		for (int k = 0; k < 4; k++)
+		{
+			if (mask & (1 << k))
+			{
+				ts[k] = std::sin(tv[k]);
+				tc[k] = std::cos(tv[k]);
+			}
+		}
+
+		s = _mm_load_ps(ts);
+		c = _mm_load_ps(tc);
+	}
+
+	/// <summary>
+	/// Computes sine and cosine per component. Max. error 2 ULP for |v| &lt;= 8192. Larger angles lose accuracy in the
+	/// range reduction and go to libm (vec4_sincos_libm).
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <param name="s">Sines</param>
+	/// <param name="c">Cosines</param>
+	FORCEINLINE void vec4_sincos(const Phanes::Core::Types::Vec4f32Reg v,
+								 Phanes::Core::Types::Vec4f32Reg& s,
+								 Phanes::Core::Types::Vec4f32Reg& c)
+	{
+		// v = q * pi/2 + r with |r| <= pi/4. The first three parts of pi/2 have 11 bits, so q * part is exact up to 2^13.
+		__m128 q = _mm_round_ps(_mm_mul_ps(v, _mm_set1_ps(0.636619772f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m128 r = vec4_nmadd(q, _mm_set1_ps(1.5703125f), v);
+		r = vec4_nmadd(q, _mm_set1_ps(4.837512969970703125e-4f), r);
+		r = vec4_nmadd(q, _mm_set1_ps(7.549533620476723e-8f), r);
+		r = vec4_nmadd(q, _mm_set1_ps(2.5633440682570896e-12f), r);
+
+		__m128 z = _mm_mul_ps(r, r);
+
+		__m128 ps = vec4_madd(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+		ps = vec4_madd(ps, z, _mm_set1_ps(-1.6666654611e-1f));
+		ps = vec4_madd(_mm_mul_ps(ps, z), r, r);
+
+		__m128 pc = vec4_madd(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+		pc = vec4_madd(pc, z, _mm_set1_ps(4.166664568298827e-2f));
+		pc = vec4_madd(_mm_mul_ps(pc, z), z, vec4_nmadd(_mm_set1_ps(0.5f), z, _mm_set1_ps(1.0f)));
+
+		// Odd quadrants swap sine and cosine. The sine is negated for q & 2, the cosine for (q + 1) & 2.
+		__m128i qi = _mm_cvtps_epi32(q);
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qi, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 ssign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qi, _mm_set1_epi32(2)), 30));
+		__m128 csign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(qi, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+		s = _mm_xor_ps(_mm_blendv_ps(ps, pc, swap), ssign);
+		c = _mm_xor_ps(_mm_blendv_ps(pc, ps, swap), csign);
+
+		// Rare, so a branch instead of computing both paths. Infinities go to libm as well and give NaN.
+		int large = _mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), v), _mm_set1_ps(8192.0f)));
+
+		if (large != 0)
+		{
+			vec4_sincos_libm(v, s, c, large);
+		}
+	}
+
+	/// <summary>
+	/// Computes the sine per component. Max. error 2 ULP for |v| &lt;= 8192, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Sines</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_sin(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 s, c;
+		vec4_sincos(v, s, c);
+		return s;
+	}
+
+	/// <summary>
+	/// Computes the cosine per component. Max. error 2 ULP for |v| &lt;= 8192, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Cosines</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_cos(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 s, c;
+		vec4_sincos(v, s, c);
+		return c;
+	}
+
+	/// <summary>
+	/// Computes the tangent per component as sin / cos. Max. error 4 ULP for |v| &lt;= 8192, libm above.
+	/// </summary>
+	/// <param name="v">Angles in radians</param>
+	/// <returns>Tangents</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_tan(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 s, c;
+		vec4_sincos(v, s, c);
+		return _mm_div_ps(s, c);
+	}
+
+	/// <summary>
+	/// Computes the arc tangent per component. Max. error 3 ULP.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Angles in [-pi/2, pi/2]</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_atan(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		__m128 sign = _mm_and_ps(v, _mm_set1_ps(-0.0f));
+		__m128 a = _mm_xor_ps(v, sign);
+
+		// a > tan(3pi/8): atan(a) = pi/2 + atan(-1 / a), a > tan(pi/8): atan(a) = pi/4 + atan((a - 1) / (a + 1))
+		__m128 big = _mm_cmpgt_ps(a, _mm_set1_ps(2.414213562373095f));
+		__m128 mid = _mm_cmpgt_ps(a, _mm_set1_ps(0.4142135623730950f));
+
+		__m128 num = _mm_blendv_ps(_mm_blendv_ps(a, _mm_sub_ps(a, one), mid), _mm_set1_ps(-1.0f), big);
+		__m128 den = _mm_blendv_ps(_mm_blendv_ps(one, _mm_add_ps(a, one), mid), a, big);
+		__m128 y = _mm_blendv_ps(_mm_and_ps(mid, _mm_set1_ps(0.7853981633974483f)), _mm_set1_ps(1.5707963267948966f), big);
+
+		__m128 x = _mm_div_ps(num, den);
+		__m128 z = _mm_mul_ps(x, x);
+
+		__m128 p = vec4_madd(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+		p = vec4_madd(p, z, _mm_set1_ps(1.99777106478e-1f));
+		p = vec4_madd(p, z, _mm_set1_ps(-3.33329491539e-1f));
+		p = vec4_madd(_mm_mul_ps(p, z), x, x);
+
+		return _mm_xor_ps(_mm_add_ps(y, p), sign);
+	}
+
+	/// <summary>
+	/// Computes the angle of (x, y) per component. Max. error 3 ULP.
+	/// </summary>
+	/// <param name="y">Y coordinates</param>
+	/// <param name="x">X coordinates</param>
+	/// <returns>Angles in [-pi, pi]</returns>
+	/// <remarks>x = y = 0 gives 0 or pi like std::atan2. Both infinite is not handled.</remarks>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_atan2(const Phanes::Core::Types::Vec4f32Reg y,
+														   const Phanes::Core::Types::Vec4f32Reg x)
+	{
+		__m128 zero = _mm_setzero_ps();
+		__m128 ysign = _mm_and_ps(y, _mm_set1_ps(-0.0f));
+		__m128 pi = _mm_or_ps(_mm_set1_ps(3.14159265358979f), ysign);
+
+		// pi by the sign bit of x, so x = -0 adds pi like std::atan2.
+		__m128 xneg = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+
+		__m128 r = vec4_atan(_mm_div_ps(y, x));
+		r = _mm_add_ps(r, _mm_and_ps(xneg, pi));
+
+		// 0 / 0: 0 or pi by the sign of x.
+		__m128 origin = _mm_and_ps(_mm_cmpeq_ps(x, zero), _mm_cmpeq_ps(y, zero));
+
+		return _mm_blendv_ps(r, _mm_or_ps(_mm_and_ps(xneg, pi), ysign), origin);
+	}
+
+	/// <summary>
+	/// Computes the arc cosine per component as atan2(sqrt(1 - v^2), v). Max. error 4 ULP.
+	/// </summary>
+	/// <param name="v">Vector, components in [-1, 1]</param>
+	/// <returns>Angles in [0, pi], NaN outside of [-1, 1]</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_acos(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+		return vec4_atan2(_mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(one, v), _mm_add_ps(one, v))), v);
+	}
+
+	/// <summary>
+	/// Computes e^v per component. Max. error 2 ULP, subnormal results included.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Exponentials, infinity on overflow</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_exp(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		// Operand order keeps NaN.
+		__m128 x = _mm_max_ps(_mm_set1_ps(-104.0f), _mm_min_ps(_mm_set1_ps(88.8f), v));
+
+		// x = n * ln(2) + r, ln(2) split in two parts.
+		__m128 n = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m128 r = vec4_nmadd(n, _mm_set1_ps(0.693359375f), x);
+		r = vec4_nmadd(n, _mm_set1_ps(-2.12194440e-4f), r);
+
+		__m128 p = vec4_madd(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+		p = vec4_madd(p, r, _mm_set1_ps(8.3334519073e-3f));
+		p = vec4_madd(p, r, _mm_set1_ps(4.1665795894e-2f));
+		p = vec4_madd(p, r, _mm_set1_ps(1.6666665459e-1f));
+		p = vec4_madd(p, r, _mm_set1_ps(5.0000001201e-1f));
+		p = _mm_add_ps(vec4_madd(p, _mm_mul_ps(r, r), r), _mm_set1_ps(1.0f));
+
+		// 2^n as two factors, so n = 128 overflows and n < -126 underflows gradually instead of wrapping the exponent.
+		__m128i ni = _mm_cvtps_epi32(n);
+		__m128i n1 = _mm_srai_epi32(ni, 1);
+		__m128i n2 = _mm_sub_epi32(ni, n1);
+
+		__m128 s1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+		__m128 s2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23));
+
+		return _mm_mul_ps(_mm_mul_ps(p, s1), s2);
+	}
+
+	/// <summary>
+	/// Computes the natural logarithm per component. Max. error 2 ULP, subnormal inputs included.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Logarithms. -infinity for 0, NaN for negative components.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_log(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 one = _mm_set1_ps(1.0f);
+
+		// Subnormals are scaled by 2^25 into the normal range.
+		__m128 tiny = _mm_cmplt_ps(v, _mm_set1_ps(1.17549435e-38f));
+		__m128 x = _mm_blendv_ps(v, _mm_mul_ps(v, _mm_set1_ps(33554432.0f)), tiny);
+
+		// x = m * 2^e, m in [0.5, 1)
+		__m128i bits = _mm_castps_si128(x);
+		__m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+		e = _mm_sub_ps(e, _mm_and_ps(tiny, _mm_set1_ps(25.0f)));
+
+		__m128 m = _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(0.5f));
+
+		// m < sqrt(1/2): log(m) = log(2 * m) - log(2), keeps m - 1 in [-0.29, 0.41]
+		__m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+		e = _mm_sub_ps(e, _mm_and_ps(small, one));
+		m = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(small, m)), one);
+
+		__m128 z = _mm_mul_ps(m, m);
+
+		__m128 p = vec4_madd(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(1.1676998740e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(-1.2420140846e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(1.4249322787e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(-1.6668057665e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(2.0000714765e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(-2.4999993993e-1f));
+		p = vec4_madd(p, m, _mm_set1_ps(3.3333331174e-1f));
+
+		__m128 y = _mm_mul_ps(_mm_mul_ps(p, m), z);
+		y = vec4_madd(e, _mm_set1_ps(-2.12194440e-4f), y);
+		y = vec4_nmadd(_mm_set1_ps(0.5f), z, y);
+
+		__m128 r = vec4_madd(e, _mm_set1_ps(0.693359375f), _mm_add_ps(m, y));
+
+		// log(0) = -inf, log(inf) = inf, negative and NaN give NaN.
+		r = _mm_blendv_ps(r, _mm_set1_ps(-std::numeric_limits<float>::infinity()), _mm_cmpeq_ps(v, _mm_setzero_ps()));
+		r = _mm_blendv_ps(r, v, _mm_cmpeq_ps(v, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+
+		return _mm_or_ps(r, _mm_cmpnge_ps(v, _mm_setzero_ps()));
+	}
+
+	/// <summary>
+	/// Computes x^y per component as e^(y * log(x)).
+	/// </summary>
+	/// <param name="x">Bases, not negative</param>
+	/// <param name="y">Exponents</param>
+	/// <returns>Powers, 1 where y is 0. NaN for negative bases.</returns>
+	/// <remarks>The error of log(x) is scaled by y * log(x), about 1.5 * |y * log(x)| ULP.</remarks>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_pow(const Phanes::Core::Types::Vec4f32Reg x,
+														 const Phanes::Core::Types::Vec4f32Reg y)
+	{
+		__m128 r = vec4_exp(_mm_mul_ps(y, vec4_log(x)));
+		return _mm_blendv_ps(r, _mm_set1_ps(1.0f), _mm_cmpeq_ps(y, _mm_setzero_ps()));
+	}
+} // namespace Phanes::Core::Math::SIMD
+
+#endif // !PHANES_TRANSCENDENTAL_SSE_HPP
@@ -1,6 +1,2927 @@
 #pragma once
 
-#include "PhanesVectorMathSSE.hpp" // Include previous 
+#include "PhanesVectorMathSSE.hpp" // Include previous
 
 #include <immintrin.h>
 
+// ========== //
+//   Common   //
+// ========== //
+
+#ifndef PHANES_VECTOR_MATH_AVX_HPP
+#	define PHANES_VECTOR_MATH_AVX_HPP
+
+namespace Phanes::Core::Math::SIMD
+{
+	/// <summary>
+	/// Computes a * b + c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Addend</param>
+	/// <returns>a * b + c</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_madd(const Phanes::Core::Types::Vec4f64Reg a,
+														   const Phanes::Core::Types::Vec4f64Reg b,
+														   const Phanes::Core::Types::Vec4f64Reg c)
+	{
+#	if P_FMA__
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes a * b - c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Subtrahend</param>
+	/// <returns>a * b - c</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_msub(const Phanes::Core::Types::Vec4f64Reg a,
+														   const Phanes::Core::Types::Vec4f64Reg b,
+														   const Phanes::Core::Types::Vec4f64Reg c)
+	{
+#	if P_FMA__
+		return _mm256_fmsub_pd(a, b, c);
+#	else
+		return _mm256_sub_pd(_mm256_mul_pd(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes c - a * b. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Minuend</param>
+	/// <returns>c - a * b</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_nmadd(const Phanes::Core::Types::Vec4f64Reg a,
+															const Phanes::Core::Types::Vec4f64Reg b,
+															const Phanes::Core::Types::Vec4f64Reg c)
+	{
+#	if P_FMA__
+		return _mm256_fnmadd_pd(a, b, c);
+#	else
+		return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+#	endif
+	}
+
+	/// <summary>
+	/// Computes a * b + c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Addend</param>
+	/// <returns>a * b + c</returns>
+	FORCEINLINE __m256 vec8_madd(const __m256 a,
+								 const __m256 b,
+								 const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes a * b - c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Subtrahend</param>
+	/// <returns>a * b - c</returns>
+	FORCEINLINE __m256 vec8_msub(const __m256 a,
+								 const __m256 b,
+								 const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fmsub_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes c - a * b. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Minuend</param>
+	/// <returns>c - a * b</returns>
+	FORCEINLINE __m256 vec8_nmadd(const __m256 a,
+								  const __m256 b,
+								  const __m256 c)
+	{
+#	if P_FMA__
+		return _mm256_fnmadd_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+#	endif
+	}
+
+	/// <summary>
+	/// Shuffles the vector to (y, z, x, w).
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Shuffled vector.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_yzxw(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 0, 2, 1));
+#	else
+		// (x, y, x, y) and (z, w, z, w) -> (y, z, x, w)
+		return _mm256_shuffle_pd(_mm256_permute2f128_pd(v, v, 0x00), _mm256_permute2f128_pd(v, v, 0x11), 0x9);
+#	endif
+	}
+
+	/// <summary>
+	/// Shuffles the vector to (z, x, y, w).
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Shuffled vector.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_zxyw(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 1, 0, 2));
+#	else
+		// (z, w, x, y) and (x, y, z, w) -> (z, x, y, w)
+		return _mm256_shuffle_pd(_mm256_permute2f128_pd(v, v, 0x01), v, 0xC);
+#	endif
+	}
+
+	/// <summary>
+	/// Broadcasts the last component into every component.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>(w, w, w, w)</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_splat_w(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+		return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 3, 3, 3));
+#	else
+		__m256d t = _mm256_permute_pd(v, 0xF);
+		return _mm256_permute2f128_pd(t, t, 0x11);
+#	endif
+	}
+
+	/// <summary>
+	/// Cross product of the first three components. The last component is (v1.w * v2.w - v1.w * v2.w).
+	/// </summary>
+	/// <param name="v1">Vector one</param>
+	/// <param name="v2">Vector two</param>
+	/// <returns>Cross product</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_cross_p(const Phanes::Core::Types::Vec4f64Reg v1,
+															  const Phanes::Core::Types::Vec4f64Reg v2)
+	{
+		// Not fused: both products are rounded the same way, so CrossP(v, v) stays exactly zero.
+		return _mm256_sub_pd(_mm256_mul_pd(vec4d_yzxw(v1), vec4d_zxyw(v2)),
+							 _mm256_mul_pd(vec4d_zxyw(v1), vec4d_yzxw(v2)));
+	}
+
+	/// <summary>
+	/// Adds all scalars of the vector.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Sum stored in every component.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_hadd(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m256d t = _mm256_hadd_pd(v, v);
+		return _mm256_add_pd(t, _mm256_permute2f128_pd(t, t, 0x01));
+	}
+
+	/// <summary>
+	/// Adds all scalars of the vector.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Sum of components.</returns>
+	FORCEINLINE double vec4d_hadd_cvtf64(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		__m128d t = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(t, _mm_unpackhi_pd(t, t)));
+	}
+
+	/// <summary>
+	/// Gets the absolute value of each scalar in the vector.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Vector with all components positive.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_abs(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+	}
+
+	/// <summary>
+	/// Gets the dot product of two vectors.
+	/// </summary>
+	/// <param name="v1">Vector one</param>
+	/// <param name="v2">Vector two</param>
+	/// <returns>Dot product stored in every component.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec4d_dot(const Phanes::Core::Types::Vec4f64Reg v1,
+														  const Phanes::Core::Types::Vec4f64Reg v2)
+	{
+		return vec4d_hadd(_mm256_mul_pd(v1, v2));
+	}
+
+	/// <summary>
+	/// Gets the dot product of two vectors.
+	/// </summary>
+	/// <param name="v1">Vector one</param>
+	/// <param name="v2">Vector two</param>
+	/// <returns>Dot product</returns>
+	FORCEINLINE double vec4d_dot_cvtf64(const Phanes::Core::Types::Vec4f64Reg v1,
+										const Phanes::Core::Types::Vec4f64Reg v2)
+	{
+		return vec4d_hadd_cvtf64(_mm256_mul_pd(v1, v2));
+	}
+
+	/// <summary>
+	/// Sets the last component of the register to zero. <br>
+	/// The last component of a TVector3 could hold unexpected values after scalar operations.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>Vector with w = 0.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg vec3d_fix(const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		return _mm256_blend_pd(v, _mm256_setzero_pd(), 0x8);
+	}
+
+	/// <summary>
+	/// Rotates the first three components of v by the unit quaternion q. The last component of v is kept.
+	/// </summary>
+	/// <param name="q">Quaternion (x, y, z, w)</param>
+	/// <param name="v">Vector</param>
+	/// <returns>Rotated vector</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f64Reg quatd_rotate_p(const Phanes::Core::Types::Vec4f64Reg q,
+															   const Phanes::Core::Types::Vec4f64Reg v)
+	{
+		// v' = v + w * t + u x t, with t = 2 * (u x v). The cross product clears the w lane.
+		__m256d t = vec4d_cross_p(q, v);
+		t = _mm256_add_pd(t, t);
+
+		return _mm256_add_pd(vec4d_madd(vec4d_splat_w(q), t, v), vec4d_cross_p(q, t));
+	}
+
+	/// <summary>
+	/// Transposes four registers, seen as the rows (or columns) of a 4x4 matrix.
+	/// </summary>
+	FORCEINLINE void mat4d_transpose(Phanes::Core::Types::Vec4f64Reg& r0,
+									 Phanes::Core::Types::Vec4f64Reg& r1,
+									 Phanes::Core::Types::Vec4f64Reg& r2,
+									 Phanes::Core::Types::Vec4f64Reg& r3)
+	{
+		__m256d tmp0 = _mm256_unpacklo_pd(r0, r1); // 00 10 02 12
+		__m256d tmp1 = _mm256_unpackhi_pd(r0, r1); // 01 11 03 13
+		__m256d tmp2 = _mm256_unpacklo_pd(r2, r3); // 20 30 22 32
+		__m256d tmp3 = _mm256_unpackhi_pd(r2, r3); // 21 31 23 33
+
+		r0 = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+		r1 = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+		r2 = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+		r3 = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+	}
+	/// <summary>
+	/// Copies a 128 bit register into both halves of a 256 bit register.
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <returns>(v, v)</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4x2f32Reg vec4x2_splat(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(v), v, 1);
+	}
+
+	/// <summary>
+	/// Slab test of eight rays against one box. See ray4_aabb.
+	/// </summary>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec8f32Reg ray8_aabb(const Phanes::Core::Types::Vec8f32Reg o[3],
+														  const Phanes::Core::Types::Vec8f32Reg inv[3],
+														  const Phanes::Core::Types::Vec8f32Reg bmin[3],
+														  const Phanes::Core::Types::Vec8f32Reg bmax[3],
+														  Phanes::Core::Types::Vec8f32Reg& t)
+	{
+		__m256 tmin = _mm256_setzero_ps();
+		__m256 tmax = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+
+		for (int k = 0; k < 3; k++)
+		{
+			__m256 t0 = _mm256_mul_ps(_mm256_sub_ps(bmin[k], o[k]), inv[k]);
+			__m256 t1 = _mm256_mul_ps(_mm256_sub_ps(bmax[k], o[k]), inv[k]);
+
+			tmin = _mm256_max_ps(_mm256_min_ps(t0, t1), tmin);
+			tmax = _mm256_min_ps(_mm256_max_ps(t0, t1), tmax);
+		}
+
+		t = tmin;
+		return _mm256_cmp_ps(tmin, tmax, _CMP_LE_OQ);
+	}
+
+	/// <summary>
+	/// Intersects eight rays with one plane. See ray4_plane.
+	/// </summary>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec8f32Reg ray8_plane(const Phanes::Core::Types::Vec8f32Reg o[3],
+														   const Phanes::Core::Types::Vec8f32Reg d[3],
+														   const Phanes::Core::Types::Vec8f32Reg n[3],
+														   const Phanes::Core::Types::Vec8f32Reg pd,
+														   Phanes::Core::Types::Vec8f32Reg& t)
+	{
+		__m256 denom = vec8_madd(n[2], d[2], vec8_madd(n[0], d[0], _mm256_mul_ps(n[1], d[1])));
+		__m256 dist = vec8_madd(n[2], o[2], vec8_madd(n[0], o[0], _mm256_mul_ps(n[1], o[1])));
+
+		t = _mm256_div_ps(_mm256_sub_ps(pd, dist), denom);
+
+		__m256 parallel = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), denom), _mm256_set1_ps(P_FLT_INAC), _CMP_LE_OQ);
+		return _mm256_andnot_ps(parallel, _mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+
+	/// <summary>
+	/// Intersects eight rays with one sphere. See ray4_sphere.
+	/// </summary>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec8f32Reg ray8_sphere(const Phanes::Core::Types::Vec8f32Reg o[3],
+															const Phanes::Core::Types::Vec8f32Reg d[3],
+															const Phanes::Core::Types::Vec8f32Reg c[3],
+															const Phanes::Core::Types::Vec8f32Reg r,
+															Phanes::Core::Types::Vec8f32Reg& t)
+	{
+		__m256 ocx = _mm256_sub_ps(o[0], c[0]);
+		__m256 ocy = _mm256_sub_ps(o[1], c[1]);
+		__m256 ocz = _mm256_sub_ps(o[2], c[2]);
+
+		__m256 a = vec8_madd(d[2], d[2], vec8_madd(d[0], d[0], _mm256_mul_ps(d[1], d[1])));
+		__m256 b = vec8_madd(ocz, d[2], vec8_madd(ocx, d[0], _mm256_mul_ps(ocy, d[1])));
+		__m256 cc = vec8_nmadd(r, r, vec8_madd(ocz, ocz, vec8_madd(ocx, ocx, _mm256_mul_ps(ocy, ocy))));
+
+		__m256 disc = vec8_msub(b, b, _mm256_mul_ps(a, cc));
+		__m256 sq = _mm256_sqrt_ps(_mm256_max_ps(disc, _mm256_setzero_ps()));
+
+		__m256 nb = _mm256_sub_ps(_mm256_setzero_ps(), b);
+		__m256 t0 = _mm256_div_ps(_mm256_sub_ps(nb, sq), a);
+		__m256 t1 = _mm256_div_ps(_mm256_add_ps(nb, sq), a);
+
+		t = _mm256_blendv_ps(t1, t0, _mm256_cmp_ps(t0, _mm256_setzero_ps(), _CMP_GE_OQ));
+
+		return _mm256_and_ps(_mm256_cmp_ps(disc, _mm256_setzero_ps(), _CMP_GE_OQ), _mm256_cmp_ps(t1, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+} // namespace Phanes::Core::Math::SIMD
+
+// sin, cos, atan, exp, log, ... on top of the helpers above.
+#	include "Core/Math/SIMD/PhanesTranscendentalAVX.hpp"
+
+// ============ //
+//   TVector4   //
+// ============ //
+
+namespace Phanes::Core::Math::Detail
+{
+	template <>
+	struct construct_vec4<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1,
+									const TVector4<double, true>& v2)
+		{
+			v1.comp = v2.comp;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, double s)
+		{
+			v1.comp = _mm256_set1_pd(s);
+		}
+
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TVector4<double, true>& v1, double x, double y, double z, double w)
+		{
+			v1.comp = _mm256_setr_pd(x, y, z, w);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector2<double, true>& v2,
+									const Phanes::Core::Math::TVector2<double, true>& v3)
+		{
+			v1.comp = _mm256_set_m128d(v3.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& v1, const double* s)
+		{
+			v1.comp = _mm256_loadu_pd(s);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& v,
+									double w)
+		{
+			r.comp = _mm256_blend_pd(v.comp, _mm256_set1_pd(w), 0x8);
+		}
+	};
+
+	template <>
+	struct move_vec4<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									Phanes::Core::Math::TVector4<double, true>&& v)
+		{
+			r.data = v.data;
+			v.data = _mm256_setzero_pd();
+		}
+	};
+
+	template <>
+	struct compute_vec4_add<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.comp = _mm256_add_pd(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									double s)
+		{
+			r.comp = _mm256_add_pd(v1.comp, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_vec4_sub<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.comp = _mm256_sub_pd(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									double s)
+		{
+			r.comp = _mm256_sub_pd(v1.comp, _mm256_set1_pd(s));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									double s,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			r.comp = _mm256_sub_pd(_mm256_set1_pd(s), v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_vec4_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.comp = _mm256_mul_pd(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									double s)
+		{
+			r.comp = _mm256_mul_pd(v1.comp, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_vec4_div<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.comp = _mm256_div_pd(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									double s)
+		{
+			r.comp = _mm256_div_pd(v1.comp, _mm256_set1_pd(s));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									double s,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			r.comp = _mm256_div_pd(_mm256_set1_pd(s), v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_vec4_eq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(v1.comp, v2.comp));
+			return _mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_LT_OQ)) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_vec4_ieq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(v1.comp, v2.comp));
+			return _mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_GT_OQ)) != 0;
+		}
+	};
+
+	template <>
+	struct compute_vec4_inc<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			r.comp = _mm256_add_pd(v1.comp, _mm256_set1_pd(1.0));
+		}
+	};
+
+	template <>
+	struct compute_vec4_dec<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			r.comp = _mm256_sub_pd(v1.comp, _mm256_set1_pd(1.0));
+		}
+	};
+
+	template <>
+	struct compute_vec4_mag<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			return sqrt(SIMD::vec4d_dot_cvtf64(v1.data, v1.data));
+		}
+	};
+
+	// There is no double estimate below AVX-512, the fast variants of double vectors are exact.
+	template <>
+	struct compute_vec4_fast_mag<double, true>
+	{
+		template<bool R>
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			return compute_vec4_mag<double, true>::map(v1);
+		}
+	};
+
+	template <>
+	struct compute_vec4_fast_norm<double, true>
+	{
+		template<bool R>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			__m256d sqr = SIMD::vec4d_dot(v1.data, v1.data);
+			__m256d n = _mm256_div_pd(v1.data, _mm256_sqrt_pd(sqr));
+
+			r.data = _mm256_blendv_pd(n, v1.data, _mm256_cmp_pd(sqr, _mm256_set1_pd(P_FLT_INAC * P_FLT_INAC), _CMP_LT_OQ));
+		}
+	};
+
+	template <>
+	struct compute_vec4_dotp<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector4<double, true>& v1,
+									  const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			return SIMD::vec4d_dot_cvtf64(v1.data, v2.data);
+		}
+	};
+
+	template <>
+	struct compute_vec4_angle<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector4<double, true>& v1,
+									  const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			double c = compute_vec4_dotp<double, true>::map(v1, v2) /
+					   (compute_vec4_mag<double, true>::map(v1) * compute_vec4_mag<double, true>::map(v2));
+
+			return _mm256_cvtsd_f64(SIMD::vec4d_acos(_mm256_set1_pd(c)));
+		}
+	};
+
+	template <>
+	struct compute_vec4_set<double, true>
+	{
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TVector4<double, true>& v1, double x, double y, double z, double w)
+		{
+			v1.data = _mm256_setr_pd(x, y, z, w);
+		}
+	};
+
+	template <>
+	struct compute_vec4_max<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.data = _mm256_max_pd(v1.data, v2.data);
+		}
+	};
+
+	template <>
+	struct compute_vec4_min<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1,
+									const Phanes::Core::Math::TVector4<double, true>& v2)
+		{
+			r.data = _mm256_min_pd(v1.data, v2.data);
+		}
+	};
+
+	template <>
+	struct compute_vec4_pdiv<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v1)
+		{
+			r.data = SIMD::vec3d_fix(_mm256_div_pd(v1.data, _mm256_set1_pd(v1.w)));
+		}
+	};
+
+	// ============ //
+	//   TVector3   //
+	// ============ //
+
+	template <>
+	struct construct_vec3<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1,
+									const TVector3<double, true>& v2)
+		{
+			v1.comp = SIMD::vec3d_fix(v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, double s)
+		{
+			v1.comp = _mm256_setr_pd(s, s, s, 0.0);
+		}
+
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TVector3<double, true>& v1, double x, double y, double z)
+		{
+			v1.comp = _mm256_setr_pd(x, y, z, 0.0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1,
+									const Phanes::Core::Math::TVector2<double, true>& v2,
+									double s)
+		{
+			v1.comp = _mm256_set_m128d(_mm_setr_pd(s, 0.0), v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& v1, const double* s)
+		{
+			v1.comp = _mm256_setr_pd(s[0], s[1], s[2], 0.0);
+		}
+	};
+
+	template <>
+	struct move_vec3<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									Phanes::Core::Math::TVector3<double, true>&& v)
+		{
+			r.data = v.data;
+			v.data = _mm256_setzero_pd();
+		}
+	};
+
+	template <>
+	struct compute_vec3_set<double, true>
+	{
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TVector3<double, true>& v1, double x, double y, double z)
+		{
+			v1.data = _mm256_setr_pd(x, y, z, 0.0);
+		}
+	};
+
+	template <>
+	struct compute_vec3_add<double, true> : public compute_vec4_add<double, true>
+	{ };
+	template <>
+	struct compute_vec3_sub<double, true> : public compute_vec4_sub<double, true>
+	{ };
+	template <>
+	struct compute_vec3_mul<double, true> : public compute_vec4_mul<double, true>
+	{ };
+	template <>
+	struct compute_vec3_div<double, true> : public compute_vec4_div<double, true>
+	{ };
+	template <>
+	struct compute_vec3_inc<double, true> : public compute_vec4_inc<double, true>
+	{ };
+	template <>
+	struct compute_vec3_dec<double, true> : public compute_vec4_dec<double, true>
+	{ };
+	template <>
+	struct compute_vec3_max<double, true> : public compute_vec4_max<double, true>
+	{ };
+	template <>
+	struct compute_vec3_min<double, true> : public compute_vec4_min<double, true>
+	{ };
+
+	// Scalar operations write into w, so it is masked out for everything that reduces the vector.
+
+	template <>
+	struct compute_vec3_eq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<double, true>& v1,
+									const Phanes::Core::Math::TVector3<double, true>& v2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(v1.comp, v2.comp));
+			return (_mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_LT_OQ)) & 0x7) == 0x7;
+		}
+	};
+
+	template <>
+	struct compute_vec3_ieq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<double, true>& v1,
+									const Phanes::Core::Math::TVector3<double, true>& v2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(v1.comp, v2.comp));
+			return (_mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_GT_OQ)) & 0x7) != 0;
+		}
+	};
+
+	template <>
+	struct compute_vec3_mag<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector3<double, true>& v1)
+		{
+			__m256d tmp = SIMD::vec3d_fix(v1.data);
+			return sqrt(SIMD::vec4d_dot_cvtf64(tmp, tmp));
+		}
+	};
+
+	template <>
+	struct compute_vec3_fast_mag<double, true>
+	{
+		template<bool R>
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector3<double, true>& v1)
+		{
+			return compute_vec3_mag<double, true>::map(v1);
+		}
+	};
+
+	template <>
+	struct compute_vec3_fast_norm<double, true>
+	{
+		template<bool R>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& v1)
+		{
+			__m256d tmp = SIMD::vec3d_fix(v1.data);
+			__m256d sqr = SIMD::vec4d_dot(tmp, tmp);
+			__m256d n = _mm256_div_pd(tmp, _mm256_sqrt_pd(sqr));
+
+			r.data = _mm256_blendv_pd(n, tmp, _mm256_cmp_pd(sqr, _mm256_set1_pd(P_FLT_INAC * P_FLT_INAC), _CMP_LT_OQ));
+		}
+	};
+
+	template <>
+	struct compute_vec3_dotp<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector3<double, true>& v1,
+									  const Phanes::Core::Math::TVector3<double, true>& v2)
+		{
+			return SIMD::vec4d_dot_cvtf64(SIMD::vec3d_fix(v1.data), v2.data);
+		}
+	};
+
+	template <>
+	struct compute_vec3_angle<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TVector3<double, true>& v1,
+									  const Phanes::Core::Math::TVector3<double, true>& v2)
+		{
+			double c = compute_vec3_dotp<double, true>::map(v1, v2) /
+					   (compute_vec3_mag<double, true>::map(v1) * compute_vec3_mag<double, true>::map(v2));
+
+			return _mm256_cvtsd_f64(SIMD::vec4d_acos(_mm256_set1_pd(c)));
+		}
+	};
+
+	template <>
+	struct compute_vec3_clamp<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& v1,
+									double radius)
+		{
+			r.data = _mm256_min_pd(_mm256_max_pd(v1.data, _mm256_set1_pd(-radius)), _mm256_set1_pd(radius));
+		}
+	};
+
+	template <>
+	struct compute_vec3_cross_p<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& v1,
+									const Phanes::Core::Math::TVector3<double, true>& v2)
+		{
+			r.data = SIMD::vec3d_fix(SIMD::vec4d_cross_p(v1.data, v2.data));
+		}
+	};
+
+	// ========= //
+	//   Plane   //
+	// ========= //
+
+	template <>
+	struct construct_plane<double, true>
+	{
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TPlane<double, true>& pl, const TVector3<double, true>& v1, double d)
+		{
+			pl.comp.data = _mm256_blend_pd(v1.data, _mm256_set1_pd(d), 0x8);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& pl,
+									const TVector3<double, true>& normal,
+									const TVector3<double, true>& base)
+		{
+			__m256d d = SIMD::vec4d_dot(SIMD::vec3d_fix(normal.data), base.data);
+			pl.comp.data = _mm256_blend_pd(normal.data, d, 0x8);
+		}
+
+		static FORCEINLINE void
+		map(Phanes::Core::Math::TPlane<double, true>& pl, double x, double y, double z, double d)
+		{
+			pl.comp.data = _mm256_setr_pd(x, y, z, d);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& pl,
+									const TVector3<double, true>& p1,
+									const TVector3<double, true>& p2,
+									const TVector3<double, true>& p3)
+		{
+			__m256d normal = SIMD::vec3d_fix(SIMD::vec4d_cross_p(p1.data, p2.data));
+			normal = _mm256_div_pd(normal, _mm256_sqrt_pd(SIMD::vec4d_dot(normal, normal)));
+
+			__m256d d = SIMD::vec4d_dot(normal, p3.data);
+			pl.comp.data = _mm256_blend_pd(normal, d, 0x8);
+		}
+	};
+
+	template <>
+	struct compute_plane_add<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									const Phanes::Core::Math::TPlane<double, true>& pl2)
+		{
+			r.comp.data = _mm256_add_pd(pl1.comp.data, pl2.comp.data);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									double s)
+		{
+			r.comp.data = _mm256_add_pd(pl1.comp.data, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_plane_sub<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									const Phanes::Core::Math::TPlane<double, true>& pl2)
+		{
+			r.comp.data = _mm256_sub_pd(pl1.comp.data, pl2.comp.data);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									double s)
+		{
+			r.comp.data = _mm256_sub_pd(pl1.comp.data, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_plane_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									const Phanes::Core::Math::TPlane<double, true>& pl2)
+		{
+			r.comp.data = _mm256_mul_pd(pl1.comp.data, pl2.comp.data);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									double s)
+		{
+			r.comp.data = _mm256_mul_pd(pl1.comp.data, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_plane_div<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									const Phanes::Core::Math::TPlane<double, true>& pl2)
+		{
+			r.comp.data = _mm256_div_pd(pl1.comp.data, pl2.comp.data);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									double s)
+		{
+			r.comp.data = _mm256_div_pd(pl1.comp.data, _mm256_set1_pd(s));
+		}
+	};
+
+	// =========== //
+	//   Matrix3   //
+	// =========== //
+
+	template <>
+	struct compute_mat3_transpose<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<double, true>& r,
+									const Phanes::Core::Math::TMatrix3<double, true>& m)
+		{
+			__m256d c0 = m.c0.data;
+			__m256d c1 = m.c1.data;
+			__m256d c2 = m.c2.data;
+			__m256d c3 = _mm256_setzero_pd();
+
+			SIMD::mat4d_transpose(c0, c1, c2, c3);
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+		}
+	};
+
+	template <>
+	struct compute_mat3_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix3<double, true>& r,
+									const Phanes::Core::Math::TMatrix3<double, true>& m1,
+									const Phanes::Core::Math::TMatrix3<double, true>& m2)
+		{
+			// r.cn = m1 * m2.cn, with each component of m2.cn broadcast from memory.
+			__m256d c0 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[0][0]));
+			__m256d c1 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[1][0]));
+			__m256d c2 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[2][0]));
+
+			c0 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[0][1]), c0);
+			c1 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[1][1]), c1);
+			c2 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[2][1]), c2);
+
+			c0 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[0][2]), c0);
+			c1 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[1][2]), c1);
+			c2 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[2][2]), c2);
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TMatrix3<double, true>& m1,
+									const Phanes::Core::Math::TVector3<double, true>& v)
+		{
+			__m256d tmp0 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&v.x));
+			__m256d tmp1 = _mm256_mul_pd(m1.c1.data, _mm256_broadcast_sd(&v.y));
+			__m256d tmp2 = _mm256_mul_pd(m1.c2.data, _mm256_broadcast_sd(&v.z));
+
+			r.data = _mm256_add_pd(_mm256_add_pd(tmp0, tmp1), tmp2);
+		}
+	};
+
+	template <>
+	struct compute_mat3_det<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TMatrix3<double, true>& m)
+		{
+			// Scalar triple product c0 . (c1 x c2)
+			return SIMD::vec4d_dot_cvtf64(SIMD::vec3d_fix(m.c0.data), SIMD::vec4d_cross_p(m.c1.data, m.c2.data));
+		}
+	};
+
+	template <>
+	struct compute_mat3_inv<double, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<double, true>& r,
+									const Phanes::Core::Math::TMatrix3<double, true>& m)
+		{
+			// Rows of the inverse, scaled by the determinant.
+			__m256d r0 = SIMD::vec4d_cross_p(m.c1.data, m.c2.data);
+			__m256d r1 = SIMD::vec4d_cross_p(m.c2.data, m.c0.data);
+			__m256d r2 = SIMD::vec4d_cross_p(m.c0.data, m.c1.data);
+			__m256d r3 = _mm256_setzero_pd();
+
+			__m256d det = SIMD::vec4d_dot(SIMD::vec3d_fix(m.c0.data), SIMD::vec3d_fix(r0));
+
+			if (_mm256_cvtsd_f64(det) == 0.0)
+			{
+				return false;
+			}
+
+			__m256d _1_det = _mm256_div_pd(_mm256_set1_pd(1.0), det);
+
+			r0 = _mm256_mul_pd(r0, _1_det);
+			r1 = _mm256_mul_pd(r1, _1_det);
+			r2 = _mm256_mul_pd(r2, _1_det);
+
+			SIMD::mat4d_transpose(r0, r1, r2, r3);
+
+			r.c0.data = r0;
+			r.c1.data = r1;
+			r.c2.data = r2;
+
+			return true;
+		}
+	};
+
+	template <>
+	struct compute_mat3_inv_transpose<double, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<double, true>& r,
+									const Phanes::Core::Math::TMatrix3<double, true>& m)
+		{
+			// The rows of the inverse are the columns of the inverse transpose.
+			__m256d r0 = SIMD::vec3d_fix(SIMD::vec4d_cross_p(m.c1.data, m.c2.data));
+			__m256d r1 = SIMD::vec3d_fix(SIMD::vec4d_cross_p(m.c2.data, m.c0.data));
+			__m256d r2 = SIMD::vec3d_fix(SIMD::vec4d_cross_p(m.c0.data, m.c1.data));
+
+			__m256d det = SIMD::vec4d_dot(SIMD::vec3d_fix(m.c0.data), r0);
+
+			if (_mm256_cvtsd_f64(det) == 0.0)
+			{
+				return false;
+			}
+
+			__m256d _1_det = _mm256_div_pd(_mm256_set1_pd(1.0), det);
+
+			r.c0.data = _mm256_mul_pd(r0, _1_det);
+			r.c1.data = _mm256_mul_pd(r1, _1_det);
+			r.c2.data = _mm256_mul_pd(r2, _1_det);
+
+			return true;
+		}
+	};
+
+	template <>
+	struct compute_mat3_batch_inv_transpose<double, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<double, true>* r,
+									const Phanes::Core::Math::TMatrix3<double, true>* m,
+									size_t n)
+		{
+			bool invertible = true;
+
+			for (size_t i = 0; i < n; i++)
+			{
+				if (!compute_mat3_inv_transpose<double, true>::map(r[i], m[i]))
+				{
+					r[i].c0.data = _mm256_setzero_pd();
+					r[i].c1.data = _mm256_setzero_pd();
+					r[i].c2.data = _mm256_setzero_pd();
+					invertible = false;
+				}
+			}
+
+			return invertible;
+		}
+	};
+
+	// =========== //
+	//   Matrix4   //
+	// =========== //
+
+	template <>
+	struct compute_mat4_det<double, true>
+	{
+		// Same formulation as the FPU version, but every TVector3 is kept in one ymm register.
+		static FORCEINLINE double map(const Phanes::Core::Math::TMatrix4<double, true>& m)
+		{
+			__m256d a = SIMD::vec3d_fix(m.c0.data);
+			__m256d b = SIMD::vec3d_fix(m.c1.data);
+			__m256d c = SIMD::vec3d_fix(m.c2.data);
+			__m256d d = SIMD::vec3d_fix(m.c3.data);
+
+			// Shuffled from the registers instead of loaded from memory, as the matrix is often just written (e.g. InverseV).
+			__m256d x = SIMD::vec4d_splat_w(m.c0.data);
+			__m256d y = SIMD::vec4d_splat_w(m.c1.data);
+			__m256d z = SIMD::vec4d_splat_w(m.c2.data);
+			__m256d w = SIMD::vec4d_splat_w(m.c3.data);
+
+			__m256d s = SIMD::vec4d_cross_p(a, b);
+			__m256d t = SIMD::vec4d_cross_p(c, d);
+			__m256d u = SIMD::vec4d_msub(a, y, _mm256_mul_pd(b, x));
+			__m256d v = SIMD::vec4d_msub(c, w, _mm256_mul_pd(d, z));
+
+			return SIMD::vec4d_hadd_cvtf64(SIMD::vec4d_madd(s, v, _mm256_mul_pd(t, u)));
+		}
+	};
+
+	template <>
+	struct compute_mat4_inv<double, true>
+	{
+		// Same formulation as the FPU version. The shuffled operands of the cross products are
+		// computed once and reused, as lane crossing shuffles are expensive on 256-bit registers.
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix4<double, true>& r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m)
+		{
+			__m256d a = SIMD::vec3d_fix(m.c0.data);
+			__m256d b = SIMD::vec3d_fix(m.c1.data);
+			__m256d c = SIMD::vec3d_fix(m.c2.data);
+			__m256d d = SIMD::vec3d_fix(m.c3.data);
+
+			// Shuffled from the registers instead of loaded from memory, as the matrix is often just written (e.g. InverseV).
+			__m256d x = SIMD::vec4d_splat_w(m.c0.data);
+			__m256d y = SIMD::vec4d_splat_w(m.c1.data);
+			__m256d z = SIMD::vec4d_splat_w(m.c2.data);
+			__m256d w = SIMD::vec4d_splat_w(m.c3.data);
+
+			__m256d a_yzx = SIMD::vec4d_yzxw(a), a_zxy = SIMD::vec4d_zxyw(a);
+			__m256d b_yzx = SIMD::vec4d_yzxw(b), b_zxy = SIMD::vec4d_zxyw(b);
+			__m256d c_yzx = SIMD::vec4d_yzxw(c), c_zxy = SIMD::vec4d_zxyw(c);
+			__m256d d_yzx = SIMD::vec4d_yzxw(d), d_zxy = SIMD::vec4d_zxyw(d);
+
+			__m256d s = SIMD::vec4d_msub(a_yzx, b_zxy, _mm256_mul_pd(a_zxy, b_yzx));
+			__m256d t = SIMD::vec4d_msub(c_yzx, d_zxy, _mm256_mul_pd(c_zxy, d_yzx));
+			__m256d u = SIMD::vec4d_msub(a, y, _mm256_mul_pd(b, x));
+			__m256d v = SIMD::vec4d_msub(c, w, _mm256_mul_pd(d, z));
+
+			// The fused products and the horizontal sum round differently than the scalar path, the singularity test
+			// takes its determinant, so every backend rejects the same matrices.
+			const double det = compute_mat4_det<double, false>::map(m);
+
+			if (det == 0.0)
+			{
+				return false;
+			}
+
+			__m256d _1_det = _mm256_set1_pd(1.0 / det);
+
+			s = _mm256_mul_pd(s, _1_det);
+			t = _mm256_mul_pd(t, _1_det);
+			u = _mm256_mul_pd(u, _1_det);
+			v = _mm256_mul_pd(v, _1_det);
+
+			__m256d u_yzx = SIMD::vec4d_yzxw(u), u_zxy = SIMD::vec4d_zxyw(u);
+			__m256d v_yzx = SIMD::vec4d_yzxw(v), v_zxy = SIMD::vec4d_zxyw(v);
+
+			// Rows of the inverse:
+			// r0 = CrossP(b, v) + t * y
+			// r1 = CrossP(v, a) - t * x
+			// r2 = CrossP(d, u) + s * w
+			// r3 = CrossP(u, c) - s * z
+			__m256d r0 = SIMD::vec4d_msub(b_yzx, v_zxy, _mm256_mul_pd(b_zxy, v_yzx));
+			__m256d r1 = SIMD::vec4d_msub(v_yzx, a_zxy, _mm256_mul_pd(v_zxy, a_yzx));
+			__m256d r2 = SIMD::vec4d_msub(d_yzx, u_zxy, _mm256_mul_pd(d_zxy, u_yzx));
+			__m256d r3 = SIMD::vec4d_msub(u_yzx, c_zxy, _mm256_mul_pd(u_zxy, c_yzx));
+
+			r0 = SIMD::vec4d_madd(t, y, r0);
+			r1 = SIMD::vec4d_nmadd(t, x, r1);
+			r2 = SIMD::vec4d_madd(s, w, r2);
+			r3 = SIMD::vec4d_nmadd(s, z, r3);
+
+			// Last column (-DotP(b, t), DotP(a, t), -DotP(d, s), DotP(c, s)):
+			// The four products are transposed, so the dot products are summed vertically.
+			__m256d p0 = _mm256_mul_pd(b, t);
+			__m256d p1 = _mm256_mul_pd(a, t);
+			__m256d p2 = _mm256_mul_pd(d, s);
+			__m256d p3 = _mm256_mul_pd(c, s);
+
+			SIMD::mat4d_transpose(p0, p1, p2, p3);
+
+			__m256d c3 = _mm256_add_pd(_mm256_add_pd(p0, p1), _mm256_add_pd(p2, p3));
+			c3 = _mm256_xor_pd(c3, _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0));
+
+			SIMD::mat4d_transpose(r0, r1, r2, r3);
+
+			r.c0.data = r0;
+			r.c1.data = r1;
+			r.c2.data = r2;
+			r.c3.data = c3;
+
+			return true;
+		}
+	};
+
+	template <>
+	struct compute_mat4_transpose<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<double, true>& r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m)
+		{
+			__m256d c0 = m.c0.data;
+			__m256d c1 = m.c1.data;
+			__m256d c2 = m.c2.data;
+			__m256d c3 = m.c3.data;
+
+			SIMD::mat4d_transpose(c0, c1, c2, c3);
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+			r.c3.data = c3;
+		}
+	};
+
+	template <>
+	struct compute_mat4_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<double, true>& r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m1,
+									const Phanes::Core::Math::TMatrix4<double, true>& m2)
+		{
+			// r.cn = m1 * m2.cn, with each component of m2.cn broadcast from memory.
+			__m256d c0 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[0][0]));
+			__m256d c1 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[1][0]));
+			__m256d c2 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[2][0]));
+			__m256d c3 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&m2.data[3][0]));
+
+			c0 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[0][1]), c0);
+			c1 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[1][1]), c1);
+			c2 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[2][1]), c2);
+			c3 = SIMD::vec4d_madd(m1.c1.data, _mm256_broadcast_sd(&m2.data[3][1]), c3);
+
+			c0 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[0][2]), c0);
+			c1 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[1][2]), c1);
+			c2 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[2][2]), c2);
+			c3 = SIMD::vec4d_madd(m1.c2.data, _mm256_broadcast_sd(&m2.data[3][2]), c3);
+
+			c0 = SIMD::vec4d_madd(m1.c3.data, _mm256_broadcast_sd(&m2.data[0][3]), c0);
+			c1 = SIMD::vec4d_madd(m1.c3.data, _mm256_broadcast_sd(&m2.data[1][3]), c1);
+			c2 = SIMD::vec4d_madd(m1.c3.data, _mm256_broadcast_sd(&m2.data[2][3]), c2);
+			c3 = SIMD::vec4d_madd(m1.c3.data, _mm256_broadcast_sd(&m2.data[3][3]), c3);
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+			r.c3.data = c3;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>& r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m1,
+									const Phanes::Core::Math::TVector4<double, true>& v)
+		{
+			__m256d tmp0 = _mm256_mul_pd(m1.c0.data, _mm256_broadcast_sd(&v.x));
+			__m256d tmp1 = _mm256_mul_pd(m1.c1.data, _mm256_broadcast_sd(&v.y));
+			__m256d tmp2 = _mm256_mul_pd(m1.c2.data, _mm256_broadcast_sd(&v.z));
+			__m256d tmp3 = _mm256_mul_pd(m1.c3.data, _mm256_broadcast_sd(&v.w));
+
+			r.data = _mm256_add_pd(_mm256_add_pd(tmp0, tmp1), _mm256_add_pd(tmp2, tmp3));
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform_points<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector3<float, true>* v,
+									size_t n)
+		{
+			// Two vectors per register. Clearing w of the columns keeps w of the results at zero.
+			__m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			__m256 c0 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c0.data, mask));
+			__m256 c1 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c1.data, mask));
+			__m256 c2 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c2.data, mask));
+			__m256 c3 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c3.data, mask));
+
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+				__m256 v23 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i + 2));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+				r01 = _mm256_add_ps(r01, c3);
+
+				__m256 r23 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v23, v23, 0x00));
+				r23 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v23, v23, 0x55), r23);
+				r23 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v23, v23, 0xAA), r23);
+				r23 = _mm256_add_ps(r23, c3);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i + 2), r23);
+			}
+
+			if (i + 2 <= n)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+				r01 = _mm256_add_ps(r01, c3);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				i += 2;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				__m128 r0 = _mm_mul_ps(_mm256_castps256_ps128(c0), _mm_shuffle_ps(v0, v0, 0x00));
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c1), _mm_shuffle_ps(v0, v0, 0x55), r0);
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c2), _mm_shuffle_ps(v0, v0, 0xAA), r0);
+				r0 = _mm_add_ps(r0, _mm256_castps256_ps128(c3));
+
+				r[i].data = r0;
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform_dirs<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector3<float, true>* v,
+									size_t n)
+		{
+			// Two vectors per register. Clearing w of the columns keeps w of the results at zero.
+			__m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			__m256 c0 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c0.data, mask));
+			__m256 c1 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c1.data, mask));
+			__m256 c2 = Phanes::Core::Math::SIMD::vec4x2_splat(_mm_and_ps(m.c2.data, mask));
+
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+				__m256 v23 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i + 2));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+
+				__m256 r23 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v23, v23, 0x00));
+				r23 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v23, v23, 0x55), r23);
+				r23 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v23, v23, 0xAA), r23);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i + 2), r23);
+			}
+
+			if (i + 2 <= n)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				i += 2;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				__m128 r0 = _mm_mul_ps(_mm256_castps256_ps128(c0), _mm_shuffle_ps(v0, v0, 0x00));
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c1), _mm_shuffle_ps(v0, v0, 0x55), r0);
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c2), _mm_shuffle_ps(v0, v0, 0xAA), r0);
+
+				r[i].data = r0;
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector4<float, true>* v,
+									size_t n)
+		{
+			// Two vectors per register.
+			__m256 c0 = Phanes::Core::Math::SIMD::vec4x2_splat(m.c0.data);
+			__m256 c1 = Phanes::Core::Math::SIMD::vec4x2_splat(m.c1.data);
+			__m256 c2 = Phanes::Core::Math::SIMD::vec4x2_splat(m.c2.data);
+			__m256 c3 = Phanes::Core::Math::SIMD::vec4x2_splat(m.c3.data);
+
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+				__m256 v23 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i + 2));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+				r01 = SIMD::vec8_madd(c3, _mm256_shuffle_ps(v01, v01, 0xFF), r01);
+
+				__m256 r23 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v23, v23, 0x00));
+				r23 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v23, v23, 0x55), r23);
+				r23 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v23, v23, 0xAA), r23);
+				r23 = SIMD::vec8_madd(c3, _mm256_shuffle_ps(v23, v23, 0xFF), r23);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i + 2), r23);
+			}
+
+			if (i + 2 <= n)
+			{
+				__m256 v01 = _mm256_loadu_ps(reinterpret_cast<const float*>(v + i));
+
+				__m256 r01 = _mm256_mul_ps(c0, _mm256_shuffle_ps(v01, v01, 0x00));
+				r01 = SIMD::vec8_madd(c1, _mm256_shuffle_ps(v01, v01, 0x55), r01);
+				r01 = SIMD::vec8_madd(c2, _mm256_shuffle_ps(v01, v01, 0xAA), r01);
+				r01 = SIMD::vec8_madd(c3, _mm256_shuffle_ps(v01, v01, 0xFF), r01);
+
+				_mm256_storeu_ps(reinterpret_cast<float*>(r + i), r01);
+				i += 2;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				__m128 r0 = _mm_mul_ps(_mm256_castps256_ps128(c0), _mm_shuffle_ps(v0, v0, 0x00));
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c1), _mm_shuffle_ps(v0, v0, 0x55), r0);
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c2), _mm_shuffle_ps(v0, v0, 0xAA), r0);
+				r0 = SIMD::vec4_madd(_mm256_castps256_ps128(c3), _mm_shuffle_ps(v0, v0, 0xFF), r0);
+
+				r[i].data = r0;
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform_points<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>* r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m,
+									const Phanes::Core::Math::TVector3<double, true>* v,
+									size_t n)
+		{
+			// Clearing w of the columns keeps w of the results at zero.
+			__m256d c0 = Phanes::Core::Math::SIMD::vec3d_fix(m.c0.data);
+			__m256d c1 = Phanes::Core::Math::SIMD::vec3d_fix(m.c1.data);
+			__m256d c2 = Phanes::Core::Math::SIMD::vec3d_fix(m.c2.data);
+			__m256d c3 = Phanes::Core::Math::SIMD::vec3d_fix(m.c3.data);
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+				r0 = _mm256_add_pd(r0, c3);
+
+				__m256d r1 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i + 1].x));
+				r1 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i + 1].y), r1);
+				r1 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i + 1].z), r1);
+				r1 = _mm256_add_pd(r1, c3);
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+				r0 = _mm256_add_pd(r0, c3);
+
+				r[i].data = r0;
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform_dirs<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>* r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m,
+									const Phanes::Core::Math::TVector3<double, true>* v,
+									size_t n)
+		{
+			// Clearing w of the columns keeps w of the results at zero.
+			__m256d c0 = Phanes::Core::Math::SIMD::vec3d_fix(m.c0.data);
+			__m256d c1 = Phanes::Core::Math::SIMD::vec3d_fix(m.c1.data);
+			__m256d c2 = Phanes::Core::Math::SIMD::vec3d_fix(m.c2.data);
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+
+				__m256d r1 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i + 1].x));
+				r1 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i + 1].y), r1);
+				r1 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i + 1].z), r1);
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+
+				r[i].data = r0;
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>* r,
+									const Phanes::Core::Math::TMatrix4<double, true>& m,
+									const Phanes::Core::Math::TVector4<double, true>* v,
+									size_t n)
+		{
+			__m256d c0 = m.c0.data;
+			__m256d c1 = m.c1.data;
+			__m256d c2 = m.c2.data;
+			__m256d c3 = m.c3.data;
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+				r0 = SIMD::vec4d_madd(c3, _mm256_broadcast_sd(&v[i].w), r0);
+
+				__m256d r1 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i + 1].x));
+				r1 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i + 1].y), r1);
+				r1 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i + 1].z), r1);
+				r1 = SIMD::vec4d_madd(c3, _mm256_broadcast_sd(&v[i + 1].w), r1);
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m256d r0 = _mm256_mul_pd(c0, _mm256_broadcast_sd(&v[i].x));
+				r0 = SIMD::vec4d_madd(c1, _mm256_broadcast_sd(&v[i].y), r0);
+				r0 = SIMD::vec4d_madd(c2, _mm256_broadcast_sd(&v[i].z), r0);
+				r0 = SIMD::vec4d_madd(c3, _mm256_broadcast_sd(&v[i].w), r0);
+
+				r[i].data = r0;
+			}
+		}
+	};
+	template <>
+	struct compute_mat4_soa_transform<double, true>
+	{
+		template <bool S>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<double>& r,
+									const Phanes::Core::Math::TMatrix4<double, S>& m,
+									const Phanes::Core::Math::TVector3SoA<double>& v,
+									double w)
+		{
+			__m256d m00 = _mm256_set1_pd(m(0, 0));
+			__m256d m01 = _mm256_set1_pd(m(0, 1));
+			__m256d m02 = _mm256_set1_pd(m(0, 2));
+			__m256d m10 = _mm256_set1_pd(m(1, 0));
+			__m256d m11 = _mm256_set1_pd(m(1, 1));
+			__m256d m12 = _mm256_set1_pd(m(1, 2));
+			__m256d m20 = _mm256_set1_pd(m(2, 0));
+			__m256d m21 = _mm256_set1_pd(m(2, 1));
+			__m256d m22 = _mm256_set1_pd(m(2, 2));
+
+			__m256d t0 = _mm256_set1_pd(m(0, 3) * w);
+			__m256d t1 = _mm256_set1_pd(m(1, 3) * w);
+			__m256d t2 = _mm256_set1_pd(m(2, 3) * w);
+
+			for (size_t i = 0; i < v.PaddedSize(); i += 4)
+			{
+				__m256d x = _mm256_load_pd(v.x + i);
+				__m256d y = _mm256_load_pd(v.y + i);
+				__m256d z = _mm256_load_pd(v.z + i);
+
+				_mm256_store_pd(r.x + i, _mm256_add_pd(SIMD::vec4d_madd(m00, x, _mm256_mul_pd(m01, y)), SIMD::vec4d_madd(m02, z, t0)));
+				_mm256_store_pd(r.y + i, _mm256_add_pd(SIMD::vec4d_madd(m10, x, _mm256_mul_pd(m11, y)), SIMD::vec4d_madd(m12, z, t1)));
+				_mm256_store_pd(r.z + i, _mm256_add_pd(SIMD::vec4d_madd(m20, x, _mm256_mul_pd(m21, y)), SIMD::vec4d_madd(m22, z, t2)));
+			}
+		}
+	};
+
+	// =============== //
+	//   TQuaternion   //
+	// =============== //
+
+	template <>
+	struct construct_quat<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, double x, double y, double z, double w)
+		{
+			r.data = _mm256_setr_pd(x, y, z, w);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& v,
+									double w)
+		{
+			r.data = _mm256_blend_pd(v.data, _mm256_set1_pd(w), 0x8);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TVector4<double, true>& v)
+		{
+			r.data = v.data;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r, const double* comp)
+		{
+			r.data = _mm256_loadu_pd(comp);
+		}
+	};
+
+	template <>
+	struct construct_quat_euler<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TVector3<double, true>& euler_angels)
+		{
+			// One sincos for all three half angles: s = (sy, sp, sr, -), c = (cy, cp, cr, -)
+			__m256d s, c;
+			SIMD::vec4d_sincos(_mm256_mul_pd(euler_angels.data, _mm256_set1_pd(0.5)), s, c);
+
+			__m256d slo = _mm256_permute2f128_pd(s, s, 0x00);
+			__m256d clo = _mm256_permute2f128_pd(c, c, 0x00);
+
+			__m256d sy = _mm256_permute_pd(slo, 0x0);
+			__m256d sp = _mm256_permute_pd(slo, 0xF);
+			__m256d sr = _mm256_permute_pd(_mm256_permute2f128_pd(s, s, 0x11), 0x0);
+			__m256d cy = _mm256_permute_pd(clo, 0x0);
+			__m256d cp = _mm256_permute_pd(clo, 0xF);
+			__m256d cr = _mm256_permute_pd(_mm256_permute2f128_pd(c, c, 0x11), 0x0);
+
+			// (sr, cr, cr, cr) * (cp, sp, cp, cp) * (cy, cy, sy, cy) -+-+ (cr, sr, sr, sr) * (sp, cp, sp, sp) * (sy, sy, cy, sy)
+			__m256d a = _mm256_mul_pd(_mm256_mul_pd(_mm256_blend_pd(cr, sr, 0x1), _mm256_blend_pd(cp, sp, 0x2)), _mm256_blend_pd(cy, sy, 0x4));
+			__m256d b = _mm256_mul_pd(_mm256_mul_pd(_mm256_blend_pd(sr, cr, 0x1), _mm256_blend_pd(sp, cp, 0x2)), _mm256_blend_pd(sy, cy, 0x4));
+
+			r.data = _mm256_add_pd(a, _mm256_xor_pd(b, _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0)));
+		}
+	};
+
+	template <>
+	struct compute_quat_add<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			r.data = _mm256_add_pd(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_sub<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			r.data = _mm256_sub_pd(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			__m256d a = q1.data;
+			__m256d b = q2.data;
+
+			// (y, x, w, z), (z, w, x, y) and (w, z, y, x) of q2 with in-lane and cross-lane swaps only.
+			__m256d yxwz = _mm256_permute_pd(b, 0x5);
+			__m256d zwxy = _mm256_permute2f128_pd(b, b, 0x01);
+			__m256d wzyx = _mm256_permute_pd(zwxy, 0x5);
+
+			__m256d lo = _mm256_permute2f128_pd(a, a, 0x00);
+			__m256d hi = _mm256_permute2f128_pd(a, a, 0x11);
+
+			// w1 * (x2, y2, z2, w2)
+			__m256d t0 = _mm256_mul_pd(_mm256_permute_pd(hi, 0xF), b);
+
+			// x1 * (w2, -z2, y2, -x2)
+			__m256d t1 = _mm256_mul_pd(_mm256_permute_pd(lo, 0x0), wzyx);
+			t1 = _mm256_xor_pd(t1, _mm256_setr_pd(0.0, -0.0, 0.0, -0.0));
+
+			// y1 * (z2, w2, -x2, -y2)
+			__m256d t2 = _mm256_mul_pd(_mm256_permute_pd(lo, 0xF), zwxy);
+			t2 = _mm256_xor_pd(t2, _mm256_setr_pd(0.0, 0.0, -0.0, -0.0));
+
+			// z1 * (-y2, x2, w2, -z2)
+			__m256d t3 = _mm256_mul_pd(_mm256_permute_pd(hi, 0x0), yxwz);
+			t3 = _mm256_xor_pd(t3, _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0));
+
+			r.data = _mm256_add_pd(_mm256_add_pd(t0, t1), _mm256_add_pd(t2, t3));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									double s)
+		{
+			r.data = _mm256_mul_pd(q1.data, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_quat_div<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									double s)
+		{
+			r.data = _mm256_div_pd(q1.data, _mm256_set1_pd(s));
+		}
+	};
+
+	template <>
+	struct compute_quat_eq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(q1.data, q2.data));
+			return _mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_LT_OQ)) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_quat_ieq<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			__m256d diff = SIMD::vec4d_abs(_mm256_sub_pd(q1.data, q2.data));
+			return _mm256_movemask_pd(_mm256_cmp_pd(diff, _mm256_set1_pd(P_FLT_INAC), _CMP_GT_OQ)) != 0;
+		}
+	};
+
+	template <>
+	struct compute_quat_dotp<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									  const Phanes::Core::Math::TQuaternion<double, true>& q2)
+		{
+			return SIMD::vec4d_dot_cvtf64(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_conj<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1)
+		{
+			r.data = _mm256_xor_pd(q1.data, _mm256_setr_pd(-0.0, -0.0, -0.0, 0.0));
+		}
+	};
+
+	template <>
+	struct compute_quat_inv<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1)
+		{
+			__m256d conj = _mm256_xor_pd(q1.data, _mm256_setr_pd(-0.0, -0.0, -0.0, 0.0));
+			r.data = _mm256_div_pd(conj, SIMD::vec4d_dot(q1.data, q1.data));
+		}
+	};
+
+	template <>
+	struct compute_quat_norm<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1)
+		{
+			r.data = _mm256_div_pd(q1.data, _mm256_sqrt_pd(SIMD::vec4d_dot(q1.data, q1.data)));
+		}
+	};
+
+	template <>
+	struct compute_quat_rotate<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q,
+									const Phanes::Core::Math::TVector3<double, true>& v)
+		{
+			r.data = SIMD::quatd_rotate_p(q.data, v.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_nlerp<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2,
+									double t)
+		{
+			// Shortest path: the sign of the dot product is moved onto t.
+			__m256d sign = _mm256_and_pd(SIMD::vec4d_dot(q1.data, q2.data), _mm256_set1_pd(-0.0));
+			__m256d t2 = _mm256_xor_pd(_mm256_set1_pd(t), sign);
+
+			__m256d tmp = SIMD::vec4d_madd(q1.data, _mm256_set1_pd(1.0 - t), _mm256_mul_pd(q2.data, t2));
+			r.data = _mm256_div_pd(tmp, _mm256_sqrt_pd(SIMD::vec4d_dot(tmp, tmp)));
+		}
+	};
+
+	template <>
+	struct compute_quat_slerp<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& q1,
+									const Phanes::Core::Math::TQuaternion<double, true>& q2,
+									double t)
+		{
+			double cosTheta = SIMD::vec4d_dot_cvtf64(q1.data, q2.data);
+			double sign = 1.0;
+
+			if (cosTheta < 0.0)
+			{
+				cosTheta = -cosTheta;
+				sign = -1.0;
+			}
+
+			if (cosTheta > 1.0 - P_FLT_INAC)
+			{
+				compute_quat_nlerp<double, true>::map(r, q1, q2, t);
+				return;
+			}
+
+			// (sin(theta), sin((1 - t) * theta), sin(t * theta), -) in one call
+			__m256d theta = SIMD::vec4d_acos(_mm256_set1_pd(cosTheta));
+
+			alignas(32) double s[4];
+			_mm256_store_pd(s, SIMD::vec4d_sin(_mm256_mul_pd(theta, _mm256_setr_pd(1.0, 1.0 - t, t, 0.0))));
+
+			double invSin = 1.0 / s[0];
+
+			__m256d t1 = _mm256_set1_pd(s[1] * invSin);
+			__m256d t2 = _mm256_set1_pd(s[2] * invSin * sign);
+
+			r.data = SIMD::vec4d_madd(q1.data, t1, _mm256_mul_pd(q2.data, t2));
+		}
+	};
+
+	template <>
+	struct compute_quat_batch_slerp<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<double, true>* r,
+									const Phanes::Core::Math::TQuaternion<double, true>* q1,
+									const Phanes::Core::Math::TQuaternion<double, true>* q2,
+									double t,
+									size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+			{
+				compute_quat_slerp<double, true>::map(r[i], q1[i], q2[i], t);
+			}
+		}
+	};
+
+	// ============== //
+	//   TTransform   //
+	// ============== //
+
+	template <>
+	struct construct_transform<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<double, true>& r,
+									const Phanes::Core::Math::TQuaternion<double, true>& rotation,
+									const Phanes::Core::Math::TVector3<double, true>& translation,
+									const Phanes::Core::Math::TVector3<double, true>& scale)
+		{
+			// w = 0 in translation and scale keeps the w lane of transformed points at zero.
+			r.rotation.data = rotation.data;
+			r.translation.data = SIMD::vec3d_fix(translation.data);
+			r.scale.data = SIMD::vec3d_fix(scale.data);
+		}
+	};
+
+	template <>
+	struct compute_transform_mul<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<double, true>& r,
+									const Phanes::Core::Math::TTransform<double, true>& tr1,
+									const Phanes::Core::Math::TTransform<double, true>& tr2)
+		{
+			// t = t1 + q1 * (s1 * t2)
+			__m256d t = _mm256_add_pd(tr1.translation.data,
+									  SIMD::quatd_rotate_p(tr1.rotation.data, _mm256_mul_pd(tr1.scale.data, tr2.translation.data)));
+			__m256d s = _mm256_mul_pd(tr1.scale.data, tr2.scale.data);
+
+			compute_quat_mul<double, true>::map(r.rotation, tr1.rotation, tr2.rotation);
+			r.translation.data = t;
+			r.scale.data = s;
+		}
+	};
+
+	template <>
+	struct compute_transform_inv<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<double, true>& r,
+									const Phanes::Core::Math::TTransform<double, true>& tr)
+		{
+			// q' = conj(q), s' = 1 / s, t' = -(s' * (q' * t))
+			__m256d q = _mm256_xor_pd(tr.rotation.data, _mm256_setr_pd(-0.0, -0.0, -0.0, 0.0));
+			__m256d s = SIMD::vec3d_fix(_mm256_div_pd(_mm256_set1_pd(1.0), tr.scale.data));
+			__m256d t = _mm256_mul_pd(SIMD::quatd_rotate_p(q, tr.translation.data), s);
+
+			r.rotation.data = q;
+			r.translation.data = _mm256_sub_pd(_mm256_setzero_pd(), t);
+			r.scale.data = s;
+		}
+	};
+
+	template <>
+	struct compute_transform_point<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TTransform<double, true>& tr,
+									const Phanes::Core::Math::TVector3<double, true>& p)
+		{
+			r.data = _mm256_add_pd(SIMD::quatd_rotate_p(tr.rotation.data, _mm256_mul_pd(p.data, tr.scale.data)), tr.translation.data);
+		}
+	};
+
+	template <>
+	struct compute_transform_dir<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>& r,
+									const Phanes::Core::Math::TTransform<double, true>& tr,
+									const Phanes::Core::Math::TVector3<double, true>& v)
+		{
+			r.data = SIMD::quatd_rotate_p(tr.rotation.data, _mm256_mul_pd(v.data, tr.scale.data));
+		}
+	};
+
+	template <>
+	struct compute_transform_to_mat4<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<double, true>& r,
+									const Phanes::Core::Math::TTransform<double, true>& tr)
+		{
+			// Cross-lane shuffles of doubles cost more than the nine products, so the terms are computed as scalars.
+			const Phanes::Core::Math::TQuaternion<double, true>& q = tr.rotation;
+
+			double xx = q.x * q.x;
+			double yy = q.y * q.y;
+			double zz = q.z * q.z;
+			double xy = q.x * q.y;
+			double xz = q.x * q.z;
+			double yz = q.y * q.z;
+			double wx = q.w * q.x;
+			double wy = q.w * q.y;
+			double wz = q.w * q.z;
+
+			r.c0.data = _mm256_mul_pd(_mm256_setr_pd(1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy), 0.0), _mm256_set1_pd(tr.scale.x));
+			r.c1.data = _mm256_mul_pd(_mm256_setr_pd(2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx), 0.0), _mm256_set1_pd(tr.scale.y));
+			r.c2.data = _mm256_mul_pd(_mm256_setr_pd(2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy), 0.0), _mm256_set1_pd(tr.scale.z));
+			r.c3.data = _mm256_blend_pd(tr.translation.data, _mm256_set1_pd(1.0), 0x8);
+		}
+	};
+
+	template <>
+	struct compute_plane_transform<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<double, true>& r,
+									const Phanes::Core::Math::TPlane<double, true>& pl1,
+									const Phanes::Core::Math::TTransform<double, true>& tr)
+		{
+			__m256d n = SIMD::vec3d_fix(pl1.comp.data);
+			__m256d d = SIMD::vec4d_splat_w(pl1.comp.data);
+
+			// w = 1 keeps n / s finite in the w lane.
+			__m256d s = _mm256_blend_pd(tr.scale.data, _mm256_set1_pd(1.0), 0x8);
+
+			// Base point n * d, moved like any other point.
+			__m256d o = _mm256_add_pd(SIMD::quatd_rotate_p(tr.rotation.data, _mm256_mul_pd(_mm256_mul_pd(n, d), s)), tr.translation.data);
+
+			// Normals transform with the inverse transpose of scale and rotation: n' = q * (n / s).
+			n = SIMD::quatd_rotate_p(tr.rotation.data, _mm256_div_pd(n, s));
+			n = _mm256_div_pd(n, _mm256_sqrt_pd(SIMD::vec4d_dot(n, n)));
+
+			r.comp.data = _mm256_blend_pd(n, SIMD::vec4d_dot(n, SIMD::vec3d_fix(o)), 0x8);
+		}
+	};
+
+	// ============ //
+	//   TFrustum   //
+	// ============ //
+
+	// Four doubles fill a whole register, so a box or sphere is tested one at a time.
+
+	template <>
+	struct compute_frustum_batch_aabb<double, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<double, true>& f,
+									  const Phanes::Core::Math::TAABB<double, true>* b,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			size_t count = 0;
+
+			for (size_t i = 0; i < n; i++)
+			{
+				Phanes::Core::Types::uint32 bit = Phanes::Core::Math::IsVisible(f, b[i]) ? 1u : 0u;
+
+				visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (bit << (i & 31));
+				count += bit;
+			}
+
+			return count;
+		}
+	};
+
+	template <>
+	struct compute_frustum_batch_sphere<double, true>
+	{
+		static FORCEINLINE size_t map(const Phanes::Core::Math::TFrustum<double, true>& f,
+									  const Phanes::Core::Math::TSphere<double, true>* s,
+									  size_t n,
+									  Phanes::Core::Types::uint32* visible)
+		{
+			size_t count = 0;
+
+			for (size_t i = 0; i < n; i++)
+			{
+				Phanes::Core::Types::uint32 bit = Phanes::Core::Math::IsVisible(f, s[i]) ? 1u : 0u;
+
+				visible[i >> 5] = ((i & 31) ? visible[i >> 5] : 0) | (bit << (i & 31));
+				count += bit;
+			}
+
+			return count;
+		}
+	};
+
+	// ============== //
+	//   TRayPacket   //
+	// ============== //
+
+	// Eight lane float packets fill one register. Double packets stay on the scalar path.
+
+	template <>
+	struct compute_packet_aabb<float, 8, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, 8>& p,
+														   float minX, float minY, float minZ,
+														   float maxX, float maxY, float maxZ,
+														   float* t)
+		{
+			const __m256 bmin[3] = { _mm256_set1_ps(minX), _mm256_set1_ps(minY), _mm256_set1_ps(minZ) };
+			const __m256 bmax[3] = { _mm256_set1_ps(maxX), _mm256_set1_ps(maxY), _mm256_set1_ps(maxZ) };
+			const __m256 o[3] = { _mm256_load_ps(p.ox), _mm256_load_ps(p.oy), _mm256_load_ps(p.oz) };
+			const __m256 inv[3] = { _mm256_load_ps(p.ix), _mm256_load_ps(p.iy), _mm256_load_ps(p.iz) };
+
+			__m256 tv;
+			Phanes::Core::Types::uint32 mask = _mm256_movemask_ps(SIMD::ray8_aabb(o, inv, bmin, bmax, tv));
+			_mm256_storeu_ps(t, tv);
+
+			return mask;
+		}
+	};
+
+	template <>
+	struct compute_packet_plane<float, 8, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, 8>& p, float nx, float ny, float nz, float d, float* t)
+		{
+			const __m256 n[3] = { _mm256_set1_ps(nx), _mm256_set1_ps(ny), _mm256_set1_ps(nz) };
+			const __m256 o[3] = { _mm256_load_ps(p.ox), _mm256_load_ps(p.oy), _mm256_load_ps(p.oz) };
+			const __m256 dir[3] = { _mm256_load_ps(p.dx), _mm256_load_ps(p.dy), _mm256_load_ps(p.dz) };
+
+			__m256 tv;
+			Phanes::Core::Types::uint32 mask = _mm256_movemask_ps(SIMD::ray8_plane(o, dir, n, _mm256_set1_ps(d), tv));
+			_mm256_storeu_ps(t, tv);
+
+			return mask;
+		}
+	};
+
+	template <>
+	struct compute_packet_sphere<float, 8, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, 8>& p, float cx, float cy, float cz, float radius, float* t)
+		{
+			const __m256 c[3] = { _mm256_set1_ps(cx), _mm256_set1_ps(cy), _mm256_set1_ps(cz) };
+			const __m256 o[3] = { _mm256_load_ps(p.ox), _mm256_load_ps(p.oy), _mm256_load_ps(p.oz) };
+			const __m256 dir[3] = { _mm256_load_ps(p.dx), _mm256_load_ps(p.dy), _mm256_load_ps(p.dz) };
+
+			__m256 tv;
+			Phanes::Core::Types::uint32 mask = _mm256_movemask_ps(SIMD::ray8_sphere(o, dir, c, _mm256_set1_ps(radius), tv));
+			_mm256_storeu_ps(t, tv);
+
+			return mask;
+		}
+	};
+
+	template <size_t L>
+	struct compute_packet_aabb<double, L, true> : compute_packet_aabb<double, L, false> {};
+
+	template <size_t L>
+	struct compute_packet_plane<double, L, true> : compute_packet_plane<double, L, false> {};
+
+	template <size_t L>
+	struct compute_packet_sphere<double, L, true> : compute_packet_sphere<double, L, false> {};
+
+	// ============= //
+	//   TTriangle   //
+	// ============= //
+
+	template <>
+	struct compute_ray_triangles<double, true> : compute_ray_triangles<double, false> {};
+
+	// ======== //
+	//   TBVH   //
+	// ======== //
+
+	// A double node is one ymm register for min and one for max, with lane 3 masked like the float node.
+
+	template <>
+	struct compute_bvh_ray_node<double, true>
+	{
+		static FORCEINLINE double map(const Phanes::Core::Math::TBVHNode<double>& n, const double* o, const double* inv, double tMax)
+		{
+			__m256d vo = _mm256_load_pd(o);
+			__m256d vinv = _mm256_load_pd(inv);
+
+			__m256d t0 = _mm256_mul_pd(_mm256_sub_pd(_mm256_load_pd(n.min), vo), vinv);
+			__m256d t1 = _mm256_mul_pd(_mm256_sub_pd(_mm256_load_pd(n.max), vo), vinv);
+
+			__m256d lo = _mm256_blend_pd(_mm256_min_pd(t0, t1), _mm256_setzero_pd(), 0x8);
+			__m256d hi = _mm256_blend_pd(_mm256_max_pd(t0, t1), _mm256_set1_pd(tMax), 0x8);
+
+			lo = _mm256_max_pd(lo, _mm256_permute2f128_pd(lo, lo, 0x01));
+			lo = _mm256_max_pd(lo, _mm256_permute_pd(lo, 0x5));
+			hi = _mm256_min_pd(hi, _mm256_permute2f128_pd(hi, hi, 0x01));
+			hi = _mm256_min_pd(hi, _mm256_permute_pd(hi, 0x5));
+
+			double tmin = _mm256_cvtsd_f64(lo);
+			return (tmin <= _mm256_cvtsd_f64(hi)) ? tmin : std::numeric_limits<double>::infinity();
+		}
+	};
+
+	template <>
+	struct compute_bvh_box_node<double, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TBVHNode<double>& n, const double* bmin, const double* bmax)
+		{
+			__m256d r = _mm256_and_pd(_mm256_cmp_pd(_mm256_load_pd(n.min), _mm256_load_pd(bmax), _CMP_LE_OQ),
+									  _mm256_cmp_pd(_mm256_load_pd(bmin), _mm256_load_pd(n.max), _CMP_LE_OQ));
+
+			return (_mm256_movemask_pd(r) & 0x7) == 0x7;
+		}
+	};
+
+	// ============================= //
+	//   TVector3SoA / TVector4SoA   //
+	// ============================= //
+
+	template <>
+	struct compute_soa_add<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v1, const double* v2, size_t n)
+		{
+			for (size_t i = 0; i < n; i += 4)
+			{
+				_mm256_store_pd(r + i, _mm256_add_pd(_mm256_load_pd(v1 + i), _mm256_load_pd(v2 + i)));
+			}
+		}
+	};
+
+	template <>
+	struct compute_soa_sub<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v1, const double* v2, size_t n)
+		{
+			for (size_t i = 0; i < n; i += 4)
+			{
+				_mm256_store_pd(r + i, _mm256_sub_pd(_mm256_load_pd(v1 + i), _mm256_load_pd(v2 + i)));
+			}
+		}
+	};
+
+	template <>
+	struct compute_soa_scale<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v1, double s, size_t n)
+		{
+			__m256d vs = _mm256_set1_pd(s);
+
+			for (size_t i = 0; i < n; i += 4)
+			{
+				_mm256_store_pd(r + i, _mm256_mul_pd(_mm256_load_pd(v1 + i), vs));
+			}
+		}
+	};
+
+	template <>
+	struct compute_soa_lerp<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v1, const double* v2, double t, size_t n)
+		{
+			__m256d vt = _mm256_set1_pd(t);
+			__m256d vt1 = _mm256_set1_pd(1.0 - t);
+
+			for (size_t i = 0; i < n; i += 4)
+			{
+				__m256d tmp = _mm256_mul_pd(_mm256_load_pd(v1 + i), vt1);
+				_mm256_store_pd(r + i, SIMD::vec4d_madd(_mm256_load_pd(v2 + i), vt, tmp));
+			}
+		}
+	};
+
+	// Transcendental kernels take any n and unaligned arrays, the tail goes through a padded register.
+
+	template <>
+	struct compute_soa_sin<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				_mm256_storeu_pd(r + i, SIMD::vec4d_sin(_mm256_loadu_pd(v + i)));
+			}
+
+			if (i < n)
+			{
+				alignas(32) double tmp[4] = {};
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					tmp[k] = v[i + k];
+				}
+
+				_mm256_store_pd(tmp, SIMD::vec4d_sin(_mm256_load_pd(tmp)));
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					r[i + k] = tmp[k];
+				}
+			}
+		}
+	};
+
+	template <>
+	struct compute_soa_cos<double, true>
+	{
+		static FORCEINLINE void map(double* r, const double* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				_mm256_storeu_pd(r + i, SIMD::vec4d_cos(_mm256_loadu_pd(v + i)));
+			}
+
+			if (i < n)
+			{
+				alignas(32) double tmp[4] = {};
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					tmp[k] = v[i + k];
+				}
+
+				_mm256_store_pd(tmp, SIMD::vec4d_cos(_mm256_load_pd(tmp)));
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					r[i + k] = tmp[k];
+				}
+			}
+		}
+	};
+
+	template <>
+	struct compute_soa_sincos<double, true>
+	{
+		static FORCEINLINE void map(double* s, double* c, const double* v, size_t n)
+		{
+			size_t i = 0;
+			__m256d vs, vc;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				SIMD::vec4d_sincos(_mm256_loadu_pd(v + i), vs, vc);
+				_mm256_storeu_pd(s + i, vs);
+				_mm256_storeu_pd(c + i, vc);
+			}
+
+			if (i < n)
+			{
+				alignas(32) double ts[4] = {};
+				alignas(32) double tc[4];
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					ts[k] = v[i + k];
+				}
+
+				SIMD::vec4d_sincos(_mm256_load_pd(ts), vs, vc);
+				_mm256_store_pd(ts, vs);
+				_mm256_store_pd(tc, vc);
+
+				for (size_t k = 0; i + k < n; k++)
+				{
+					s[i + k] = ts[k];
+					c[i + k] = tc[k];
+				}
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_dotp<double, true>
+	{
+		static FORCEINLINE void map(double* r, const Phanes::Core::Math::TVector4SoA<double>& v1, const Phanes::Core::Math::TVector4SoA<double>& v2, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d dot = _mm256_mul_pd(_mm256_load_pd(v1.x + i), _mm256_load_pd(v2.x + i));
+				dot = SIMD::vec4d_madd(_mm256_load_pd(v1.y + i), _mm256_load_pd(v2.y + i), dot);
+				dot = SIMD::vec4d_madd(_mm256_load_pd(v1.z + i), _mm256_load_pd(v2.z + i), dot);
+				dot = SIMD::vec4d_madd(_mm256_load_pd(v1.w + i), _mm256_load_pd(v2.w + i), dot);
+
+				_mm256_storeu_pd(r + i, dot);
+			}
+
+			for (; i < n; i++)
+			{
+				r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_mag<double, true>
+	{
+		static FORCEINLINE void map(double* r, const Phanes::Core::Math::TVector4SoA<double>& v1, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d x = _mm256_load_pd(v1.x + i);
+				__m256d y = _mm256_load_pd(v1.y + i);
+				__m256d z = _mm256_load_pd(v1.z + i);
+				__m256d w = _mm256_load_pd(v1.w + i);
+
+				__m256d dot = _mm256_mul_pd(x, x);
+				dot = SIMD::vec4d_madd(y, y, dot);
+				dot = SIMD::vec4d_madd(z, z, dot);
+				dot = SIMD::vec4d_madd(w, w, dot);
+
+				_mm256_storeu_pd(r + i, _mm256_sqrt_pd(dot));
+			}
+
+			for (; i < n; i++)
+			{
+				r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i] + v1.w[i] * v1.w[i]);
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_norm<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<double>& r, const Phanes::Core::Math::TVector4SoA<double>& v1, size_t n)
+		{
+			__m256d one = _mm256_set1_pd(1.0);
+			__m256d inac = _mm256_set1_pd((double)P_FLT_INAC);
+
+			for (size_t i = 0; i < n; i += 4)
+			{
+				__m256d x = _mm256_load_pd(v1.x + i);
+				__m256d y = _mm256_load_pd(v1.y + i);
+				__m256d z = _mm256_load_pd(v1.z + i);
+				__m256d w = _mm256_load_pd(v1.w + i);
+
+				__m256d dot = _mm256_mul_pd(x, x);
+				dot = SIMD::vec4d_madd(y, y, dot);
+				dot = SIMD::vec4d_madd(z, z, dot);
+				dot = SIMD::vec4d_madd(w, w, dot);
+
+				__m256d mag = _mm256_sqrt_pd(dot);
+
+				// Vectors shorter than P_FLT_INAC are left untouched.
+				__m256d s = _mm256_blendv_pd(one, _mm256_div_pd(one, mag), _mm256_cmp_pd(mag, inac, _CMP_GE_OQ));
+
+				_mm256_store_pd(r.x + i, _mm256_mul_pd(x, s));
+				_mm256_store_pd(r.y + i, _mm256_mul_pd(y, s));
+				_mm256_store_pd(r.z + i, _mm256_mul_pd(z, s));
+				_mm256_store_pd(r.w + i, _mm256_mul_pd(w, s));
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_dotp<double, true>
+	{
+		static FORCEINLINE void map(double* r, const Phanes::Core::Math::TVector3SoA<double>& v1, const Phanes::Core::Math::TVector3SoA<double>& v2, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d dot = _mm256_mul_pd(_mm256_load_pd(v1.x + i), _mm256_load_pd(v2.x + i));
+				dot = SIMD::vec4d_madd(_mm256_load_pd(v1.y + i), _mm256_load_pd(v2.y + i), dot);
+				dot = SIMD::vec4d_madd(_mm256_load_pd(v1.z + i), _mm256_load_pd(v2.z + i), dot);
+
+				_mm256_storeu_pd(r + i, dot);
+			}
+
+			for (; i < n; i++)
+			{
+				r[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_mag<double, true>
+	{
+		static FORCEINLINE void map(double* r, const Phanes::Core::Math::TVector3SoA<double>& v1, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d x = _mm256_load_pd(v1.x + i);
+				__m256d y = _mm256_load_pd(v1.y + i);
+				__m256d z = _mm256_load_pd(v1.z + i);
+
+				__m256d dot = _mm256_mul_pd(x, x);
+				dot = SIMD::vec4d_madd(y, y, dot);
+				dot = SIMD::vec4d_madd(z, z, dot);
+
+				_mm256_storeu_pd(r + i, _mm256_sqrt_pd(dot));
+			}
+
+			for (; i < n; i++)
+			{
+				r[i] = sqrt(v1.x[i] * v1.x[i] + v1.y[i] * v1.y[i] + v1.z[i] * v1.z[i]);
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_norm<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<double>& r, const Phanes::Core::Math::TVector3SoA<double>& v1, size_t n)
+		{
+			__m256d one = _mm256_set1_pd(1.0);
+			__m256d inac = _mm256_set1_pd((double)P_FLT_INAC);
+
+			for (size_t i = 0; i < n; i += 4)
+			{
+				__m256d x = _mm256_load_pd(v1.x + i);
+				__m256d y = _mm256_load_pd(v1.y + i);
+				__m256d z = _mm256_load_pd(v1.z + i);
+
+				__m256d dot = _mm256_mul_pd(x, x);
+				dot = SIMD::vec4d_madd(y, y, dot);
+				dot = SIMD::vec4d_madd(z, z, dot);
+
+				__m256d mag = _mm256_sqrt_pd(dot);
+
+				// Vectors shorter than P_FLT_INAC are left untouched.
+				__m256d s = _mm256_blendv_pd(one, _mm256_div_pd(one, mag), _mm256_cmp_pd(mag, inac, _CMP_GE_OQ));
+
+				_mm256_store_pd(r.x + i, _mm256_mul_pd(x, s));
+				_mm256_store_pd(r.y + i, _mm256_mul_pd(y, s));
+				_mm256_store_pd(r.z + i, _mm256_mul_pd(z, s));
+			}
+		}
+	};
+
+	// No double estimate below AVX-512, the fast variant is exact.
+	template <>
+	struct compute_vec3soa_fast_norm<double, true> : public compute_vec3soa_norm<double, true>
+	{ };
+
+	template <>
+	struct compute_vec3soa_cross_p<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<double>& r, const Phanes::Core::Math::TVector3SoA<double>& v1, const Phanes::Core::Math::TVector3SoA<double>& v2, size_t n)
+		{
+			for (size_t i = 0; i < n; i += 4)
+			{
+				__m256d x1 = _mm256_load_pd(v1.x + i);
+				__m256d y1 = _mm256_load_pd(v1.y + i);
+				__m256d z1 = _mm256_load_pd(v1.z + i);
+				__m256d x2 = _mm256_load_pd(v2.x + i);
+				__m256d y2 = _mm256_load_pd(v2.y + i);
+				__m256d z2 = _mm256_load_pd(v2.z + i);
+
+				_mm256_store_pd(r.x + i, SIMD::vec4d_msub(y1, z2, _mm256_mul_pd(z1, y2)));
+				_mm256_store_pd(r.y + i, SIMD::vec4d_msub(z1, x2, _mm256_mul_pd(x1, z2)));
+				_mm256_store_pd(r.z + i, SIMD::vec4d_msub(x1, y2, _mm256_mul_pd(y1, x2)));
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_gather<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<double>& r, const Phanes::Core::Math::TVector4<double, true>* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d v0 = v[i].data;
+				__m256d v1 = v[i + 1].data;
+				__m256d v2 = v[i + 2].data;
+				__m256d v3 = v[i + 3].data;
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(v0, v1, v2, v3);
+
+				_mm256_store_pd(r.x + i, v0);
+				_mm256_store_pd(r.y + i, v1);
+				_mm256_store_pd(r.z + i, v2);
+				_mm256_store_pd(r.w + i, v3);
+			}
+
+			for (; i < n; i++)
+			{
+				r.x[i] = v[i].x;
+				r.y[i] = v[i].y;
+				r.z[i] = v[i].z;
+				r.w[i] = v[i].w;
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_scatter<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<double, true>* r, const Phanes::Core::Math::TVector4SoA<double>& v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d v0 = _mm256_load_pd(v.x + i);
+				__m256d v1 = _mm256_load_pd(v.y + i);
+				__m256d v2 = _mm256_load_pd(v.z + i);
+				__m256d v3 = _mm256_load_pd(v.w + i);
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(v0, v1, v2, v3);
+
+				r[i].data = v0;
+				r[i + 1].data = v1;
+				r[i + 2].data = v2;
+				r[i + 3].data = v3;
+			}
+
+			for (; i < n; i++)
+			{
+				r[i].x = v.x[i];
+				r[i].y = v.y[i];
+				r[i].z = v.z[i];
+				r[i].w = v.w[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_gather<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<double>& r, const Phanes::Core::Math::TVector3<double, true>* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d v0 = v[i].data;
+				__m256d v1 = v[i + 1].data;
+				__m256d v2 = v[i + 2].data;
+				__m256d v3 = v[i + 3].data;
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(v0, v1, v2, v3);
+
+				_mm256_store_pd(r.x + i, v0);
+				_mm256_store_pd(r.y + i, v1);
+				_mm256_store_pd(r.z + i, v2);
+			}
+
+			for (; i < n; i++)
+			{
+				r.x[i] = v[i].x;
+				r.y[i] = v[i].y;
+				r.z[i] = v[i].z;
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_scatter<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>* r, const Phanes::Core::Math::TVector3SoA<double>& v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d v0 = _mm256_load_pd(v.x + i);
+				__m256d v1 = _mm256_load_pd(v.y + i);
+				__m256d v2 = _mm256_load_pd(v.z + i);
+				__m256d v3 = _mm256_setzero_pd();
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(v0, v1, v2, v3);
+
+				r[i].data = v0;
+				r[i + 1].data = v1;
+				r[i + 2].data = v2;
+				r[i + 3].data = v3;
+			}
+
+			for (; i < n; i++)
+			{
+				r[i].x = v.x[i];
+				r[i].y = v.y[i];
+				r[i].z = v.z[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_oct_pack<double, true>
+	{
+		template<typename O>
+		static FORCEINLINE void map(O* r, const Phanes::Core::Math::TVector3<double, true>* v, size_t n)
+		{
+			const __m256d sign = _mm256_set1_pd(-0.0);
+			const __m256d one = _mm256_set1_pd(1.0);
+			const __m256d scale = _mm256_set1_pd((double)std::numeric_limits<decltype(O::x)>::max());
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256d x = v[i].data;
+				__m256d y = v[i + 1].data;
+				__m256d z = v[i + 2].data;
+				__m256d w = v[i + 3].data;
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(x, y, z, w);
+
+				__m256d sum = _mm256_add_pd(_mm256_add_pd(_mm256_andnot_pd(sign, x), _mm256_andnot_pd(sign, y)), _mm256_andnot_pd(sign, z));
+				__m256d inv = _mm256_and_pd(_mm256_div_pd(one, sum), _mm256_cmp_pd(sum, _mm256_setzero_pd(), _CMP_GT_OQ));
+
+				__m256d u = _mm256_mul_pd(x, inv);
+				w = _mm256_mul_pd(y, inv);
+
+				// Fold the lower half over the diagonals.
+				__m256d fu = _mm256_mul_pd(_mm256_sub_pd(one, _mm256_andnot_pd(sign, w)), _mm256_or_pd(one, _mm256_and_pd(sign, u)));
+				__m256d fw = _mm256_mul_pd(_mm256_sub_pd(one, _mm256_andnot_pd(sign, u)), _mm256_or_pd(one, _mm256_and_pd(sign, w)));
+
+				__m256d lower = _mm256_cmp_pd(z, _mm256_setzero_pd(), _CMP_LT_OQ);
+				u = _mm256_blendv_pd(u, fu, lower);
+				w = _mm256_blendv_pd(w, fw, lower);
+
+				Phanes::Core::Math::SIMD::oct4_store(r + i, _mm256_cvtpd_epi32(_mm256_mul_pd(u, scale)), _mm256_cvtpd_epi32(_mm256_mul_pd(w, scale)));
+			}
+
+			compute_oct_pack<double, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_oct_unpack<double, true>
+	{
+		template<typename O>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<double, true>* r, const O* v, size_t n)
+		{
+			const __m256d sign = _mm256_set1_pd(-0.0);
+			const __m256d one = _mm256_set1_pd(1.0);
+			const __m256d scale = _mm256_set1_pd((double)std::numeric_limits<decltype(O::x)>::max());
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128i iu, iw;
+				Phanes::Core::Math::SIMD::oct4_load(v + i, iu, iw);
+
+				__m256d u = _mm256_max_pd(_mm256_div_pd(_mm256_cvtepi32_pd(iu), scale), _mm256_set1_pd(-1.0));
+				__m256d w = _mm256_max_pd(_mm256_div_pd(_mm256_cvtepi32_pd(iw), scale), _mm256_set1_pd(-1.0));
+				__m256d z = _mm256_sub_pd(_mm256_sub_pd(one, _mm256_andnot_pd(sign, u)), _mm256_andnot_pd(sign, w));
+
+				__m256d t = _mm256_max_pd(_mm256_sub_pd(_mm256_setzero_pd(), z), _mm256_setzero_pd());
+				u = _mm256_sub_pd(u, _mm256_or_pd(t, _mm256_and_pd(sign, u)));
+				w = _mm256_sub_pd(w, _mm256_or_pd(t, _mm256_and_pd(sign, w)));
+
+				__m256d inv = _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(u, u), _mm256_mul_pd(w, w)), _mm256_mul_pd(z, z))));
+
+				u = _mm256_mul_pd(u, inv);
+				w = _mm256_mul_pd(w, inv);
+				z = _mm256_mul_pd(z, inv);
+				__m256d e = _mm256_setzero_pd();
+
+				Phanes::Core::Math::SIMD::mat4d_transpose(u, w, z, e);
+
+				r[i].data = u;
+				r[i + 1].data = w;
+				r[i + 2].data = z;
+				r[i + 3].data = e;
+			}
+
+			compute_oct_unpack<double, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_norm_pack<double, true>
+	{
+		template<typename I>
+		static FORCEINLINE void map(I* r, const double* v, size_t n)
+		{
+			const __m256d lo = _mm256_set1_pd(std::is_signed_v<I> ? -1.0 : 0.0);
+			const __m256d hi = _mm256_set1_pd(1.0);
+			const __m256d scale = _mm256_set1_pd((double)std::numeric_limits<I>::max());
+			size_t i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m256d s0 = _mm256_loadu_pd(v + i);
+				__m256d s1 = _mm256_loadu_pd(v + i + 4);
+
+				// NaN encodes to 0.
+				s0 = _mm256_and_pd(_mm256_min_pd(_mm256_max_pd(s0, lo), hi), _mm256_cmp_pd(s0, s0, _CMP_ORD_Q));
+				s1 = _mm256_and_pd(_mm256_min_pd(_mm256_max_pd(s1, lo), hi), _mm256_cmp_pd(s1, s1, _CMP_ORD_Q));
+
+				Phanes::Core::Math::SIMD::norm8_store(r + i, _mm256_cvtpd_epi32(_mm256_mul_pd(s0, scale)), _mm256_cvtpd_epi32(_mm256_mul_pd(s1, scale)));
+			}
+
+			compute_norm_pack<double, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_norm_unpack<double, true>
+	{
+		template<typename I>
+		static FORCEINLINE void map(double* r, const I* v, size_t n)
+		{
+			const __m256d lo = _mm256_set1_pd(std::is_signed_v<I> ? -1.0 : 0.0);
+			const __m256d scale = _mm256_set1_pd((double)std::numeric_limits<I>::max());
+			size_t i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m128i i0, i1;
+				Phanes::Core::Math::SIMD::norm8_load(v + i, i0, i1);
+
+				_mm256_storeu_pd(r + i, _mm256_max_pd(_mm256_div_pd(_mm256_cvtepi32_pd(i0), scale), lo));
+				_mm256_storeu_pd(r + i + 4, _mm256_max_pd(_mm256_div_pd(_mm256_cvtepi32_pd(i1), scale), lo));
+			}
+
+			compute_norm_unpack<double, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_expr<double, true>
+	{
+		static FORCEINLINE __m256d load(const Phanes::Core::Math::TVector4<double, true>& v)
+		{
+			return v.comp;
+		}
+
+		static FORCEINLINE void store(Phanes::Core::Math::TVector4<double, true>& r, const __m256d v)
+		{
+			r.comp = v;
+		}
+
+		static FORCEINLINE __m256d splat(double s)
+		{
+			return _mm256_set1_pd(s);
+		}
+
+		static FORCEINLINE __m256d add(const __m256d a, const __m256d b)
+		{
+			return _mm256_add_pd(a, b);
+		}
+
+		static FORCEINLINE __m256d sub(const __m256d a, const __m256d b)
+		{
+			return _mm256_sub_pd(a, b);
+		}
+
+		static FORCEINLINE __m256d mul(const __m256d a, const __m256d b)
+		{
+			return _mm256_mul_pd(a, b);
+		}
+
+		static FORCEINLINE __m256d div(const __m256d a, const __m256d b)
+		{
+			return _mm256_div_pd(a, b);
+		}
+	};
+	template <>
+	struct compute_grid_cell<double, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>* r, const Phanes::Core::Math::TVector3<double, true>* v, double invCellSize, size_t n)
+		{
+			const __m256d inv = _mm256_set1_pd(invCellSize);
+			const __m256d lo = _mm256_set1_pd((double)grid_cell_min);
+			const __m256d hi = _mm256_set1_pd((double)grid_cell_max);
+
+			for (size_t i = 0; i < n; i++)
+			{
+				__m256d f = _mm256_min_pd(_mm256_max_pd(_mm256_floor_pd(_mm256_mul_pd(v[i].data, inv)), lo), hi);
+				r[i].comp = _mm_insert_epi32(_mm256_cvttpd_epi32(f), 0, 3);
+			}
+		}
+	};
+
+	template <>
+	struct compute_world_to_render<float, true>
+	{
+		template<bool SW>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::TVector3<double, SW>* v,
+									const Phanes::Core::Math::TVector3<double, SW>& origin, size_t n)
+		{
+			// w of the origin is ignored, w of the result is zero.
+			const __m256d o = _mm256_set_pd(0.0, origin.z, origin.y, origin.x);
+			const __m128 zero = _mm_setzero_ps();
+
+			for (size_t i = 0; i < n; i++)
+			{
+				__m128 p = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(&v[i].x), o));
+				r[i].data = _mm_blend_ps(p, zero, 0x8);
+			}
+		}
+	};
+
+	template <>
+	struct compute_render_rebase<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::TVector3<float, true>& delta, size_t n)
+		{
+			const __m256 d = _mm256_set_m128(delta.data, delta.data);
+			float* p = &r->x;
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				_mm256_storeu_ps(p + i * 4, _mm256_add_ps(_mm256_loadu_ps(p + i * 4), d));
+			}
+
+			if (i < n)
+			{
+				r[i].data = _mm_add_ps(r[i].data, delta.data);
+			}
+		}
+	};
+} // namespace Phanes::Core::Math::Detail
+
+// Kernels over whole SoA streams.
+#	include "Core/Math/SIMD/PhanesBatchAVX.hpp"
+
+#endif
@@ -1,3 +1,903 @@
 #pragma once
 
-#include "PhanesVectorMathAVX.hpp" // Include previous
\ No newline at end of file
+#include "PhanesVectorMathAVX.hpp" // Include previous
+
+// ========== //
+//   Common   //
+// ========== //
+
+#ifndef PHANES_VECTOR_MATH_AVX2_HPP
+#	define PHANES_VECTOR_MATH_AVX2_HPP
+
+namespace Phanes::Core::Math::SIMD
+{
+	/// <summary>
+	/// Multiplies the 64-bit integers and keeps the low 64 bits of the product (there is no vpmullq in AVX2).
+	/// </summary>
+	/// <param name="v1">Vector one</param>
+	/// <param name="v2">Vector two</param>
+	/// <returns>v1 * v2</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4i64Reg vec4i64_mullo(const Phanes::Core::Types::Vec4i64Reg v1,
+															  const Phanes::Core::Types::Vec4i64Reg v2)
+	{
+		// lo(v1) * lo(v2) + ((hi(v1) * lo(v2) + lo(v1) * hi(v2)) << 32)
+		__m256i lo = _mm256_mul_epu32(v1, v2);
+		__m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(v1, 32), v2),
+										 _mm256_mul_epu32(v1, _mm256_srli_epi64(v2, 32)));
+		return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+	}
+
+	/// <summary>
+	/// Arithmetic right shift of each 64-bit integer by the matching count (there is no vpsravq in AVX2).
+	/// </summary>
+	/// <param name="v">Vector</param>
+	/// <param name="count">Shift count for each component</param>
+	/// <returns>v >> count, counts outside [0, 63] fill with the sign like vpsravd</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4i64Reg vec4i64_srav(const Phanes::Core::Types::Vec4i64Reg v,
+															 Phanes::Core::Types::Vec4i64Reg count)
+	{
+		// Counts are unsigned, anything above 63 shifts like 63.
+		__m256i inRange = _mm256_cmpeq_epi64(_mm256_andnot_si256(_mm256_set1_epi64x(63), count), _mm256_setzero_si256());
+		count = _mm256_blendv_epi8(_mm256_set1_epi64x(63), count, inRange);
+
+		// Shift logically and fill the vacated bits with the sign. A shift by 64 in vpsllvq yields zero.
+		__m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+		__m256i fill = _mm256_sllv_epi64(sign, _mm256_sub_epi64(_mm256_set1_epi64x(64), count));
+		return _mm256_or_si256(_mm256_srlv_epi64(v, count), fill);
+	}
+} // namespace Phanes::Core::Math::SIMD
+
+namespace Phanes::Core::Math::Detail
+{
+	// ============================== //
+	//   TIntVector4 (int64/uint64)   //
+	// ============================== //
+
+	template <>
+	struct construct_ivec4<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			v1.comp = v2.comp;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+		{
+			v1.comp = _mm256_set1_epi64x(s);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 x,
+									Phanes::Core::Types::int64 y,
+									Phanes::Core::Types::int64 z,
+									Phanes::Core::Types::int64 w)
+		{
+			v1.comp = _mm256_setr_epi64x(x, y, z, w);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Types::int64* comp)
+		{
+			v1.comp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(comp));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_set_m128i(v2.comp, v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_add<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_sub<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_mul<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = SIMD::vec4i64_mullo(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = SIMD::vec4i64_mullo(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_div<Phanes::Core::Types::int64, true>
+	{
+		// There is no integer division in AVX2.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.x = v1.x / v2.x;
+			r.y = v1.y / v2.y;
+			r.z = v1.z / v2.z;
+			r.w = v1.w / v2.w;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.x = v1.x / s;
+			r.y = v1.y / s;
+			r.z = v1.z / s;
+			r.w = v1.w / s;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_mod<Phanes::Core::Types::int64, true>
+	{
+		// There is no integer division in AVX2.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.x = v1.x % v2.x;
+			r.y = v1.y % v2.y;
+			r.z = v1.z % v2.z;
+			r.w = v1.w % v2.w;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.x = v1.x % s;
+			r.y = v1.y % s;
+			r.z = v1.z % s;
+			r.w = v1.w % s;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_eq<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_ieq<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) != 0xF;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_inc<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(1));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_dec<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(1));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_and<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_and_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_and_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_or<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_or_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_or_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_xor<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_left_shift<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = _mm256_sllv_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_sll_epi64(v1.comp, _mm_cvtsi64_si128(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_right_shift<Phanes::Core::Types::int64, true>
+	{
+		// Arithmetic shift like the scalar >> on signed integers.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.comp = SIMD::vec4i64_srav(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.comp = SIMD::vec4i64_srav(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_bnot<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::int64, true>& v1)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(-1));
+		}
+	};
+
+	template <>
+	struct construct_ivec4<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			v1.comp = v2.comp;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1, Phanes::Core::Types::uint64 s)
+		{
+			v1.comp = _mm256_set1_epi64x(s);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 x,
+									Phanes::Core::Types::uint64 y,
+									Phanes::Core::Types::uint64 z,
+									Phanes::Core::Types::uint64 w)
+		{
+			v1.comp = _mm256_setr_epi64x(x, y, z, w);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1, const Phanes::Core::Types::uint64* comp)
+		{
+			v1.comp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(comp));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_set_m128i(v2.comp, v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_ivec4_add<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_sub<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_mul<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = SIMD::vec4i64_mullo(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = SIMD::vec4i64_mullo(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_div<Phanes::Core::Types::uint64, true>
+	{
+		// There is no integer division in AVX2.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.x = v1.x / v2.x;
+			r.y = v1.y / v2.y;
+			r.z = v1.z / v2.z;
+			r.w = v1.w / v2.w;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.x = v1.x / s;
+			r.y = v1.y / s;
+			r.z = v1.z / s;
+			r.w = v1.w / s;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_mod<Phanes::Core::Types::uint64, true>
+	{
+		// There is no integer division in AVX2.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.x = v1.x % v2.x;
+			r.y = v1.y % v2.y;
+			r.z = v1.z % v2.z;
+			r.w = v1.w % v2.w;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.x = v1.x % s;
+			r.y = v1.y % s;
+			r.z = v1.z % s;
+			r.w = v1.w % s;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_eq<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_ieq<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) != 0xF;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_inc<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1)
+		{
+			r.comp = _mm256_add_epi64(v1.comp, _mm256_set1_epi64x(1));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_dec<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1)
+		{
+			r.comp = _mm256_sub_epi64(v1.comp, _mm256_set1_epi64x(1));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_and<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_and_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_and_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_or<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_or_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_or_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_xor<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_left_shift<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_sllv_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_sll_epi64(v1.comp, _mm_cvtsi64_si128(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_right_shift<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.comp = _mm256_srlv_epi64(v1.comp, v2.comp);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_srl_epi64(v1.comp, _mm_cvtsi64_si128(s));
+		}
+	};
+
+	template <>
+	struct compute_ivec4_bnot<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector4<Phanes::Core::Types::uint64, true>& v1)
+		{
+			r.comp = _mm256_xor_si256(v1.comp, _mm256_set1_epi64x(-1));
+		}
+	};
+
+	// ============================== //
+	//   TIntVector3 (int64/uint64)   //
+	// ============================== //
+
+	template <>
+	struct construct_ivec3<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									const TIntVector3<Phanes::Core::Types::int64, true>& v2)
+		{
+			v1.comp = _mm256_blend_epi32(v2.comp, _mm256_setzero_si256(), 0xC0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, Phanes::Core::Types::int64 s)
+		{
+			v1.comp = _mm256_setr_epi64x(s, s, s, 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 x,
+									Phanes::Core::Types::int64 y,
+									Phanes::Core::Types::int64 z)
+		{
+			v1.comp = _mm256_setr_epi64x(x, y, z, 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1, const Phanes::Core::Types::int64* comp)
+		{
+			v1.comp = _mm256_setr_epi64x(comp[0], comp[1], comp[2], 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Types::int64 s)
+		{
+			r.comp = _mm256_set_m128i(_mm_set_epi64x(0, s), v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_ivec3_add<Phanes::Core::Types::int64, true> : public compute_ivec4_add<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_sub<Phanes::Core::Types::int64, true> : public compute_ivec4_sub<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_mul<Phanes::Core::Types::int64, true> : public compute_ivec4_mul<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_div<Phanes::Core::Types::int64, true>
+	{
+		// x, y and z only: the padding w is zero in both operands.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.x = v1.x / v2.x;
+			r.y = v1.y / v2.y;
+			r.z = v1.z / v2.z;
+			r.w = 0;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.x = v1.x / s;
+			r.y = v1.y / s;
+			r.z = v1.z / s;
+			r.w = 0;
+		}
+	};
+	template <>
+	struct compute_ivec3_mod<Phanes::Core::Types::int64, true>
+	{
+		// x, y and z only: the padding w is zero in both operands.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+		{
+			r.x = v1.x % v2.x;
+			r.y = v1.y % v2.y;
+			r.z = v1.z % v2.z;
+			r.w = 0;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									Phanes::Core::Types::int64 s)
+		{
+			r.x = v1.x % s;
+			r.y = v1.y % s;
+			r.z = v1.z % s;
+			r.w = 0;
+		}
+	};
+	template <>
+	struct compute_ivec3_inc<Phanes::Core::Types::int64, true> : public compute_ivec4_inc<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_dec<Phanes::Core::Types::int64, true> : public compute_ivec4_dec<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_and<Phanes::Core::Types::int64, true> : public compute_ivec4_and<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_or<Phanes::Core::Types::int64, true> : public compute_ivec4_or<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_xor<Phanes::Core::Types::int64, true> : public compute_ivec4_xor<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_left_shift<Phanes::Core::Types::int64, true> : public compute_ivec4_left_shift<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_right_shift<Phanes::Core::Types::int64, true> : public compute_ivec4_right_shift<Phanes::Core::Types::int64, true>
+	{ };
+	template <>
+	struct compute_ivec3_bnot<Phanes::Core::Types::int64, true> : public compute_ivec4_bnot<Phanes::Core::Types::int64, true>
+	{ };
+
+	// w is not part of the vector and may hold any value after scalar operations.
+
+	template <>
+	struct compute_ivec3_eq<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+		{
+			return (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) & 0x7) == 0x7;
+		}
+	};
+
+	template <>
+	struct compute_ivec3_ieq<Phanes::Core::Types::int64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::int64, true>& v2)
+		{
+			return (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) & 0x7) != 0x7;
+		}
+	};
+
+	template <>
+	struct construct_ivec3<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									const TIntVector3<Phanes::Core::Types::uint64, true>& v2)
+		{
+			v1.comp = _mm256_blend_epi32(v2.comp, _mm256_setzero_si256(), 0xC0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1, Phanes::Core::Types::uint64 s)
+		{
+			v1.comp = _mm256_setr_epi64x(s, s, s, 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 x,
+									Phanes::Core::Types::uint64 y,
+									Phanes::Core::Types::uint64 z)
+		{
+			v1.comp = _mm256_setr_epi64x(x, y, z, 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1, const Phanes::Core::Types::uint64* comp)
+		{
+			v1.comp = _mm256_setr_epi64x(comp[0], comp[1], comp[2], 0);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Types::uint64 s)
+		{
+			r.comp = _mm256_set_m128i(_mm_set_epi64x(0, s), v1.comp);
+		}
+	};
+
+	template <>
+	struct compute_ivec3_add<Phanes::Core::Types::uint64, true> : public compute_ivec4_add<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_sub<Phanes::Core::Types::uint64, true> : public compute_ivec4_sub<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_mul<Phanes::Core::Types::uint64, true> : public compute_ivec4_mul<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_div<Phanes::Core::Types::uint64, true>
+	{
+		// x, y and z only: the padding w is zero in both operands.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.x = v1.x / v2.x;
+			r.y = v1.y / v2.y;
+			r.z = v1.z / v2.z;
+			r.w = 0;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.x = v1.x / s;
+			r.y = v1.y / s;
+			r.z = v1.z / s;
+			r.w = 0;
+		}
+	};
+	template <>
+	struct compute_ivec3_mod<Phanes::Core::Types::uint64, true>
+	{
+		// x, y and z only: the padding w is zero in both operands.
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v2)
+		{
+			r.x = v1.x % v2.x;
+			r.y = v1.y % v2.y;
+			r.z = v1.z % v2.z;
+			r.w = 0;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& r,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									Phanes::Core::Types::uint64 s)
+		{
+			r.x = v1.x % s;
+			r.y = v1.y % s;
+			r.z = v1.z % s;
+			r.w = 0;
+		}
+	};
+	template <>
+	struct compute_ivec3_inc<Phanes::Core::Types::uint64, true> : public compute_ivec4_inc<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_dec<Phanes::Core::Types::uint64, true> : public compute_ivec4_dec<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_and<Phanes::Core::Types::uint64, true> : public compute_ivec4_and<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_or<Phanes::Core::Types::uint64, true> : public compute_ivec4_or<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_xor<Phanes::Core::Types::uint64, true> : public compute_ivec4_xor<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_left_shift<Phanes::Core::Types::uint64, true> : public compute_ivec4_left_shift<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_right_shift<Phanes::Core::Types::uint64, true> : public compute_ivec4_right_shift<Phanes::Core::Types::uint64, true>
+	{ };
+	template <>
+	struct compute_ivec3_bnot<Phanes::Core::Types::uint64, true> : public compute_ivec4_bnot<Phanes::Core::Types::uint64, true>
+	{ };
+
+	// w is not part of the vector and may hold any value after scalar operations.
+
+	template <>
+	struct compute_ivec3_eq<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v2)
+		{
+			return (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) & 0x7) == 0x7;
+		}
+	};
+
+	template <>
+	struct compute_ivec3_ieq<Phanes::Core::Types::uint64, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v1,
+									const Phanes::Core::Math::TIntVector3<Phanes::Core::Types::uint64, true>& v2)
+		{
+			return (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v1.comp, v2.comp))) & 0x7) != 0x7;
+		}
+	};
+} // namespace Phanes::Core::Math::Detail
+
+// Kernels over whole arrays of TIntVector4<int, true>.
+#	include "Core/Math/SIMD/PhanesBatchAVX2.hpp"
+
+#endif
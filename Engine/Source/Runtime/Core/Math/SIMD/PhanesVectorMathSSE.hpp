@@ -1,6 +1,10 @@
 #pragma once
 
 #include <nmmintrin.h>
+#include <immintrin.h> // FMA3, only used with P_FMA__
+
+#include <limits>
+#include <type_traits>
 
 #include "Core/Math/Boilerplate.h"
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
@@ -9,6 +13,11 @@
 #include "Core/Math/Vector3.hpp"
 #include "Core/Math/Vector4.hpp"
 
+#include "Core/Math/Vector3SoA.hpp"
+#include "Core/Math/Vector4SoA.hpp"
+#include "Core/Math/HalfVector.hpp"
+#include "Core/Math/NormalEncoding.hpp"
+
 #include "Core/Math/Plane.hpp"
 
 #include "Core/Math/IntVector2.hpp"
@@ -18,6 +27,18 @@
 #include "Core/Math/Matrix3.hpp"
 #include "Core/Math/Matrix4.hpp"
 
+#include "Core/Math/Quaternion.hpp"
+#include "Core/Math/Transform.hpp"
+
+#include "Core/Math/Frustum.hpp"
+#include "Core/Math/RayPacket.hpp"
+#include "Core/Math/Triangle.hpp"
+#include "Core/Math/BVH.hpp"
+#include "Core/Math/Transcendental.hpp"
+#include "Core/Math/Expression.hpp"
+#include "Core/Math/LargeWorld.hpp"
+#include "Core/Math/SpatialHashGrid.hpp"
+
 // ========== //
 //   Common   //
 // ========== //
@@ -27,6 +48,101 @@
 
 namespace Phanes::Core::Math::SIMD
 {
+	/// <summary>
+	/// Computes a * b + c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Addend</param>
+	/// <returns>a * b + c</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_madd(const Phanes::Core::Types::Vec4f32Reg a,
+														  const Phanes::Core::Types::Vec4f32Reg b,
+														  const Phanes::Core::Types::Vec4f32Reg c)
+	{
+#	if P_FMA__
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes a * b - c. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Subtrahend</param>
+	/// <returns>a * b - c</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_msub(const Phanes::Core::Types::Vec4f32Reg a,
+														  const Phanes::Core::Types::Vec4f32Reg b,
+														  const Phanes::Core::Types::Vec4f32Reg c)
+	{
+#	if P_FMA__
+		return _mm_fmsub_ps(a, b, c);
+#	else
+		return _mm_sub_ps(_mm_mul_ps(a, b), c);
+#	endif
+	}
+
+	/// <summary>
+	/// Computes c - a * b. One fused instruction in FMA builds (P_FMA__).
+	/// </summary>
+	/// <param name="a">Factor one</param>
+	/// <param name="b">Factor two</param>
+	/// <param name="c">Minuend</param>
+	/// <returns>c - a * b</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_nmadd(const Phanes::Core::Types::Vec4f32Reg a,
+														   const Phanes::Core::Types::Vec4f32Reg b,
+														   const Phanes::Core::Types::Vec4f32Reg c)
+	{
+#	if P_FMA__
+		return _mm_fnmadd_ps(a, b, c);
+#	else
+		return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#	endif
+	}
+
+	/// <summary>
+	/// Approximates 1 / sqrt(v) per component (rsqrtps, max. relative error 1.5 * 2^-12).
+	/// </summary>
+	/// <typeparam name="R">Refine with one Newton-Raphson step</typeparam>
+	/// <param name="v">Vector, components greater than zero</param>
+	/// <returns>Approximated inverse square roots</returns>
+	template<bool R>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_rsqrt(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 r = _mm_rsqrt_ps(v);
+
+		if constexpr (R)
+		{
+			// r * (1.5 - 0.5 * v * r * r)
+			__m128 h = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), v), r);
+			r = _mm_mul_ps(r, vec4_nmadd(h, r, _mm_set1_ps(1.5f)));
+		}
+
+		return r;
+	}
+
+	/// <summary>
+	/// Approximates 1 / v per component (rcpps, max. relative error 1.5 * 2^-12).
+	/// </summary>
+	/// <typeparam name="R">Refine with one Newton-Raphson step</typeparam>
+	/// <param name="v">Vector, components not zero</param>
+	/// <returns>Approximated reciprocals</returns>
+	template<bool R>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec4_rcp(const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		__m128 r = _mm_rcp_ps(v);
+
+		if constexpr (R)
+		{
+			// r * (2 - v * r)
+			r = _mm_mul_ps(r, vec4_nmadd(v, r, _mm_set1_ps(2.0f)));
+		}
+
+		return r;
+	}
+
 	Phanes::Core::Types::Vec4f32Reg vec4_cross_p(const Phanes::Core::Types::Vec4f32Reg v1,
 												 const Phanes::Core::Types::Vec4f32Reg v2)
 	{
@@ -34,6 +150,7 @@ namespace Phanes::Core::Math::SIMD
 		__m128 tmp1 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 1, 0, 2));
 		__m128 tmp2 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 1, 0, 2));
 		__m128 tmp3 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 0, 2, 1));
+		// Not fused: both products are rounded the same way, so CrossP(v, v) stays exactly zero.
 		return _mm_sub_ps(_mm_mul_ps(tmp0, tmp1), _mm_mul_ps(tmp2, tmp3));
 	}
 
@@ -46,8 +163,7 @@ namespace Phanes::Core::Math::SIMD
 	{
 		__m128 t = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
 		t = _mm_add_ps(t, v);
-		t = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2));
-		return _mm_add_ps(t, v);
+		return _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
 	}
 
 	/// <summary>
@@ -59,8 +175,7 @@ namespace Phanes::Core::Math::SIMD
 	{
 		__m128 t = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
 		t = _mm_add_ps(t, v);
-		t = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2));
-		t = _mm_add_ps(t, v);
+		t = _mm_add_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
 		return _mm_cvtss_f32(t);
 	}
 
@@ -108,14 +223,285 @@ namespace Phanes::Core::Math::SIMD
 	/// Sets the last component of the register to zero. <br>
 	/// The last component could hold unexpected values.
 	/// </summary>
-	/// <param name="v1"></param>
-	void vec3_fix(Phanes::Core::Types::Vec4f32Reg v1)
+	/// <param name="v1">Vector</param>
+	/// <returns>Vector with w = 0.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg vec3_fix(const Phanes::Core::Types::Vec4f32Reg v1)
+	{
+		return _mm_blend_ps(v1, _mm_setzero_ps(), 0x8);
+	}
+
+	/// <summary>
+	/// Rotates the first three components of v by the unit quaternion q. The last component of v is kept.
+	/// </summary>
+	/// <param name="q">Quaternion (x, y, z, w)</param>
+	/// <param name="v">Vector</param>
+	/// <returns>Rotated vector</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg quat_rotate_p(const Phanes::Core::Types::Vec4f32Reg q,
+															  const Phanes::Core::Types::Vec4f32Reg v)
+	{
+		// v' = v + w * t + u x t, with t = 2 * (u x v). The cross product clears the w lane.
+		__m128 t = vec4_cross_p(q, v);
+		t = _mm_add_ps(t, t);
+
+		__m128 w = _mm_shuffle_ps(q, q, 0xFF);
+
+		return _mm_add_ps(vec4_madd(w, t, v), vec4_cross_p(q, t));
+	}
+
+	/// <summary>
+	/// Slab test of four rays against one box. The box corners are splatted.
+	/// </summary>
+	/// <param name="o">Origins (x, y, z), one ray per lane</param>
+	/// <param name="inv">Reciprocal directions (x, y, z)</param>
+	/// <param name="bmin">Minimum corner (x, y, z)</param>
+	/// <param name="bmax">Maximum corner (x, y, z)</param>
+	/// <param name="t">Entry parameters, 0 for origins inside the box</param>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg ray4_aabb(const Phanes::Core::Types::Vec4f32Reg o[3],
+														  const Phanes::Core::Types::Vec4f32Reg inv[3],
+														  const Phanes::Core::Types::Vec4f32Reg bmin[3],
+														  const Phanes::Core::Types::Vec4f32Reg bmax[3],
+														  Phanes::Core::Types::Vec4f32Reg& t)
+	{
+		__m128 tmin = _mm_setzero_ps();
+		__m128 tmax = _mm_set1_ps(std::numeric_limits<float>::infinity());
+
+		for (int k = 0; k < 3; k++)
+		{
+			__m128 t0 = _mm_mul_ps(_mm_sub_ps(bmin[k], o[k]), inv[k]);
+			__m128 t1 = _mm_mul_ps(_mm_sub_ps(bmax[k], o[k]), inv[k]);
+
+			// min / max return the second operand for NaN, so 0 * inf keeps the current interval.
+			tmin = _mm_max_ps(_mm_min_ps(t0, t1), tmin);
+			tmax = _mm_min_ps(_mm_max_ps(t0, t1), tmax);
+		}
+
+		t = tmin;
+		return _mm_cmple_ps(tmin, tmax);
+	}
+
+	/// <summary>
+	/// Intersects four rays with one plane. The plane components are splatted.
+	/// </summary>
+	/// <param name="o">Origins (x, y, z), one ray per lane</param>
+	/// <param name="d">Directions (x, y, z)</param>
+	/// <param name="n">Plane normal (x, y, z)</param>
+	/// <param name="pd">Plane distance</param>
+	/// <param name="t">Hit parameters</param>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg ray4_plane(const Phanes::Core::Types::Vec4f32Reg o[3],
+														   const Phanes::Core::Types::Vec4f32Reg d[3],
+														   const Phanes::Core::Types::Vec4f32Reg n[3],
+														   const Phanes::Core::Types::Vec4f32Reg pd,
+														   Phanes::Core::Types::Vec4f32Reg& t)
+	{
+		__m128 denom = vec4_madd(n[2], d[2], vec4_madd(n[0], d[0], _mm_mul_ps(n[1], d[1])));
+		__m128 dist = vec4_madd(n[2], o[2], vec4_madd(n[0], o[0], _mm_mul_ps(n[1], o[1])));
+
+		t = _mm_div_ps(_mm_sub_ps(pd, dist), denom);
+
+		__m128 parallel = _mm_cmple_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), denom), _mm_set1_ps(P_FLT_INAC));
+		return _mm_andnot_ps(parallel, _mm_cmpge_ps(t, _mm_setzero_ps()));
+	}
+
+	/// <summary>
+	/// Intersects four rays with one sphere. The sphere components are splatted.
+	/// </summary>
+	/// <param name="o">Origins (x, y, z), one ray per lane</param>
+	/// <param name="d">Directions (x, y, z)</param>
+	/// <param name="c">Center (x, y, z)</param>
+	/// <param name="r">Radius</param>
+	/// <param name="t">Parameters of the first hits in front of the origins</param>
+	/// <returns>Lane mask of the hits.</returns>
+	FORCEINLINE Phanes::Core::Types::Vec4f32Reg ray4_sphere(const Phanes::Core::Types::Vec4f32Reg o[3],
+															const Phanes::Core::Types::Vec4f32Reg d[3],
+															const Phanes::Core::Types::Vec4f32Reg c[3],
+															const Phanes::Core::Types::Vec4f32Reg r,
+															Phanes::Core::Types::Vec4f32Reg& t)
+	{
+		__m128 ocx = _mm_sub_ps(o[0], c[0]);
+		__m128 ocy = _mm_sub_ps(o[1], c[1]);
+		__m128 ocz = _mm_sub_ps(o[2], c[2]);
+
+		__m128 a = vec4_madd(d[2], d[2], vec4_madd(d[0], d[0], _mm_mul_ps(d[1], d[1])));
+		__m128 b = vec4_madd(ocz, d[2], vec4_madd(ocx, d[0], _mm_mul_ps(ocy, d[1])));
+		__m128 cc = vec4_nmadd(r, r, vec4_madd(ocz, ocz, vec4_madd(ocx, ocx, _mm_mul_ps(ocy, ocy))));
+
+		__m128 disc = vec4_msub(b, b, _mm_mul_ps(a, cc));
+		__m128 sq = _mm_sqrt_ps(_mm_max_ps(disc, _mm_setzero_ps()));
+
+		__m128 nb = _mm_sub_ps(_mm_setzero_ps(), b);
+		__m128 t0 = _mm_div_ps(_mm_sub_ps(nb, sq), a);
+		__m128 t1 = _mm_div_ps(_mm_add_ps(nb, sq), a);
+
+		// Far root, if the origin is inside the sphere.
+		t = _mm_blendv_ps(t1, t0, _mm_cmpge_ps(t0, _mm_setzero_ps()));
+
+		return _mm_and_ps(_mm_cmpge_ps(disc, _mm_setzero_ps()), _mm_cmpge_ps(t1, _mm_setzero_ps()));
+	}
+
+	/// <summary>
+	/// Octahedral encoding of four directions, scaled and rounded to nearest even. See TOctNormal16.
+	/// </summary>
+	/// <param name="x">X components, one direction per lane</param>
+	/// <param name="y">Y components</param>
+	/// <param name="z">Z components</param>
+	/// <param name="scale">Largest integer of the format</param>
+	/// <param name="iu">First octahedral coordinates</param>
+	/// <param name="iw">Second octahedral coordinates</param>
+	FORCEINLINE void vec4_oct_encode(const Phanes::Core::Types::Vec4f32Reg x,
+									 const Phanes::Core::Types::Vec4f32Reg y,
+									 const Phanes::Core::Types::Vec4f32Reg z,
+									 const Phanes::Core::Types::Vec4f32Reg scale,
+									 __m128i& iu,
+									 __m128i& iw)
+	{
+		const __m128 sign = _mm_set1_ps(-0.0f);
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		__m128 sum = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(sign, x), _mm_andnot_ps(sign, y)), _mm_andnot_ps(sign, z));
+		__m128 inv = _mm_and_ps(_mm_div_ps(one, sum), _mm_cmpgt_ps(sum, _mm_setzero_ps()));
+
+		__m128 u = _mm_mul_ps(x, inv);
+		__m128 w = _mm_mul_ps(y, inv);
+
+		// Fold the lower half over the diagonals.
+		__m128 fu = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, w)), _mm_or_ps(one, _mm_and_ps(sign, u)));
+		__m128 fw = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, u)), _mm_or_ps(one, _mm_and_ps(sign, w)));
+
+		__m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+		u = _mm_blendv_ps(u, fu, lower);
+		w = _mm_blendv_ps(w, fw, lower);
+
+		iu = _mm_cvtps_epi32(_mm_mul_ps(u, scale));
+		iw = _mm_cvtps_epi32(_mm_mul_ps(w, scale));
+	}
+
+	/// <summary>
+	/// Decodes four octahedral unit vectors. See TOctNormal16.
+	/// </summary>
+	/// <param name="iu">First octahedral coordinates</param>
+	/// <param name="iw">Second octahedral coordinates</param>
+	/// <param name="scale">Largest integer of the format</param>
+	/// <param name="x">X components of the unit vectors</param>
+	/// <param name="y">Y components</param>
+	/// <param name="z">Z components</param>
+	FORCEINLINE void vec4_oct_decode(const __m128i iu,
+									 const __m128i iw,
+									 const Phanes::Core::Types::Vec4f32Reg scale,
+									 Phanes::Core::Types::Vec4f32Reg& x,
+									 Phanes::Core::Types::Vec4f32Reg& y,
+									 Phanes::Core::Types::Vec4f32Reg& z)
+	{
+		const __m128 sign = _mm_set1_ps(-0.0f);
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		__m128 u = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(iu), scale), _mm_set1_ps(-1.0f));
+		__m128 w = _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(iw), scale), _mm_set1_ps(-1.0f));
+		z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign, u)), _mm_andnot_ps(sign, w));
+
+		__m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+		u = _mm_sub_ps(u, _mm_or_ps(t, _mm_and_ps(sign, u)));
+		w = _mm_sub_ps(w, _mm_or_ps(t, _mm_and_ps(sign, w)));
+
+		__m128 inv = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(w, w)), _mm_mul_ps(z, z))));
+
+		x = _mm_mul_ps(u, inv);
+		y = _mm_mul_ps(w, inv);
+		z = _mm_mul_ps(z, inv);
+	}
+
+	/// <summary>
+	/// Stores four encoded normals from their 32 bit coordinates.
+	/// </summary>
+	template<RealType T>
+	FORCEINLINE void oct4_store(Phanes::Core::Math::TOctNormal16<T>* r, const __m128i iu, const __m128i iw)
+	{
+		__m128i p = _mm_packs_epi32(iu, iw); // u0 u1 u2 u3 w0 w1 w2 w3
+		_mm_storeu_si128((__m128i*)r, _mm_unpacklo_epi16(p, _mm_unpackhi_epi64(p, p)));
+	}
+
+	template<RealType T>
+	FORCEINLINE void oct4_store(Phanes::Core::Math::TOctNormal8<T>* r, const __m128i iu, const __m128i iw)
+	{
+		__m128i p = _mm_packs_epi32(iu, iw);
+		p = _mm_unpacklo_epi16(p, _mm_unpackhi_epi64(p, p));
+		_mm_storel_epi64((__m128i*)r, _mm_packs_epi16(p, p));
+	}
+
+	/// <summary>
+	/// Loads four encoded normals as 32 bit coordinates.
+	/// </summary>
+	template<RealType T>
+	FORCEINLINE void oct4_load(const Phanes::Core::Math::TOctNormal16<T>* v, __m128i& iu, __m128i& iw)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i*)v);
+		iu = _mm_srai_epi32(_mm_slli_epi32(p, 16), 16);
+		iw = _mm_srai_epi32(p, 16);
+	}
+
+	template<RealType T>
+	FORCEINLINE void oct4_load(const Phanes::Core::Math::TOctNormal8<T>* v, __m128i& iu, __m128i& iw)
+	{
+		__m128i p = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*)v));
+		iu = _mm_srai_epi32(_mm_slli_epi32(p, 16), 16);
+		iw = _mm_srai_epi32(p, 16);
+	}
+
+	/// <summary>
+	/// Narrows eight 32 bit integers to I with saturation and stores them.
+	/// </summary>
+	template<typename I>
+	FORCEINLINE void norm8_store(I* r, const __m128i i0, const __m128i i1)
+	{
+		if constexpr (std::is_same_v<I, Phanes::Core::Types::int16>)
+		{
+			_mm_storeu_si128((__m128i*)r, _mm_packs_epi32(i0, i1));
+		}
+		else if constexpr (std::is_same_v<I, Phanes::Core::Types::uint16>)
+		{
+			_mm_storeu_si128((__m128i*)r, _mm_packus_epi32(i0, i1));
+		}
+		else if constexpr (std::is_same_v<I, Phanes::Core::Types::int8>)
+		{
+			__m128i p = _mm_packs_epi32(i0, i1);
+			_mm_storel_epi64((__m128i*)r, _mm_packs_epi16(p, p));
+		}
+		else
+		{
+			static_assert(std::is_same_v<I, Phanes::Core::Types::uint8>);
+
+			__m128i p = _mm_packus_epi32(i0, i1);
+			_mm_storel_epi64((__m128i*)r, _mm_packus_epi16(p, p));
+		}
+	}
+
+	/// <summary>
+	/// Loads eight I and widens them to 32 bit integers.
+	/// </summary>
+	template<typename I>
+	FORCEINLINE void norm8_load(const I* v, __m128i& i0, __m128i& i1)
 	{
-		v1 = _mm_and_ps(
-			v1, _mm_castsi128_ps(_mm_set_epi32(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000)));
+		if constexpr (sizeof(I) == 2)
+		{
+			__m128i p = _mm_loadu_si128((const __m128i*)v);
+
+			i0 = std::is_signed_v<I> ? _mm_cvtepi16_epi32(p) : _mm_cvtepu16_epi32(p);
+			i1 = std::is_signed_v<I> ? _mm_cvtepi16_epi32(_mm_srli_si128(p, 8)) : _mm_cvtepu16_epi32(_mm_srli_si128(p, 8));
+		}
+		else
+		{
+			__m128i p = _mm_loadl_epi64((const __m128i*)v);
+
+			i0 = std::is_signed_v<I> ? _mm_cvtepi8_epi32(p) : _mm_cvtepu8_epi32(p);
+			i1 = std::is_signed_v<I> ? _mm_cvtepi8_epi32(_mm_srli_si128(p, 4)) : _mm_cvtepu8_epi32(_mm_srli_si128(p, 4));
+		}
 	}
 } // namespace Phanes::Core::Math::SIMD
 
+// sin, cos, atan, exp, log, ... on top of the helpers above.
+#	include "Core/Math/SIMD/PhanesTranscendentalSSE.hpp"
+
 // ============ //
 //   TVector4   //
 // ============ //
@@ -291,6 +677,41 @@ namespace Phanes::Core::Math::Detail
 		}
 	};
 
+	template <>
+	struct compute_vec4_fast_mag<float, true>
+	{
+		template<bool R>
+		static FORCEINLINE float map(const Phanes::Core::Math::TVector4<float, true>& v1)
+		{
+			__m128 sqr = SIMD::vec4_hadd(_mm_mul_ps(v1.data, v1.data));
+
+			// A magnitude needs no division, sqrtss is as fast as the refined estimate.
+			if constexpr (R)
+			{
+				return _mm_cvtss_f32(_mm_sqrt_ss(sqr));
+			}
+
+			// Clamping the estimate's input keeps zero vectors at zero instead of 0 * inf.
+			__m128 rs = _mm_rsqrt_ss(_mm_max_ss(sqr, _mm_set_ss(std::numeric_limits<float>::min())));
+			return _mm_cvtss_f32(_mm_mul_ss(sqr, rs));
+		}
+	};
+
+	template <>
+	struct compute_vec4_fast_norm<float, true>
+	{
+		template<bool R>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>& r,
+									const Phanes::Core::Math::TVector4<float, true>& v1)
+		{
+			__m128 sqr = SIMD::vec4_hadd(_mm_mul_ps(v1.data, v1.data));
+			__m128 n = _mm_mul_ps(v1.data, SIMD::vec4_rsqrt<R>(sqr));
+
+			// Vectors shorter than P_FLT_INAC are returned unchanged, like Normalize does.
+			r.data = _mm_blendv_ps(n, v1.data, _mm_cmplt_ps(sqr, _mm_set1_ps(P_FLT_INAC * P_FLT_INAC)));
+		}
+	};
+
 	template <>
 	struct compute_vec4_dotp<float, true>
 	{
@@ -301,6 +722,41 @@ namespace Phanes::Core::Math::Detail
 		}
 	};
 
+	template <>
+	struct compute_vec4_angle<float, true>
+	{
+		static FORCEINLINE float map(const Phanes::Core::Math::TVector4<float, true>& v1,
+									 const Phanes::Core::Math::TVector4<float, true>& v2)
+		{
+			float c = compute_vec4_dotp<float, true>::map(v1, v2) /
+					  (compute_vec4_mag<float, true>::map(v1) * compute_vec4_mag<float, true>::map(v2));
+
+			return _mm_cvtss_f32(SIMD::vec4_acos(_mm_set_ss(c)));
+		}
+	};
+
+	template <>
+	struct compute_vec4_eq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<float, true>& v1,
+									const Phanes::Core::Math::TVector4<float, true>& v2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(v1.data, v2.data));
+			return _mm_movemask_ps(_mm_cmplt_ps(diff, _mm_set1_ps(P_FLT_INAC))) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_vec4_ieq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector4<float, true>& v1,
+									const Phanes::Core::Math::TVector4<float, true>& v2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(v1.data, v2.data));
+			return _mm_movemask_ps(_mm_cmpgt_ps(diff, _mm_set1_ps(P_FLT_INAC))) != 0;
+		}
+	};
+
 	template <>
 	struct compute_vec4_set<float, true>
 	{
@@ -424,9 +880,39 @@ namespace Phanes::Core::Math::Detail
 	struct compute_vec3_mag<float, true> : public compute_vec4_mag<float, true>
 	{ };
 	template <>
+	struct compute_vec3_fast_mag<float, true> : public compute_vec4_fast_mag<float, true>
+	{ };
+	template <>
+	struct compute_vec3_fast_norm<float, true> : public compute_vec4_fast_norm<float, true>
+	{ };
+	template <>
 	struct compute_vec3_dotp<float, true> : public compute_vec4_dotp<float, true>
 	{ };
 	template <>
+	struct compute_vec3_angle<float, true> : public compute_vec4_angle<float, true>
+	{ };
+	template <>
+	struct compute_vec3_eq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<float, true>& v1,
+									const Phanes::Core::Math::TVector3<float, true>& v2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(v1.data, v2.data));
+			return (_mm_movemask_ps(_mm_cmplt_ps(diff, _mm_set1_ps(P_FLT_INAC))) & 0x7) == 0x7;
+		}
+	};
+
+	template <>
+	struct compute_vec3_ieq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TVector3<float, true>& v1,
+									const Phanes::Core::Math::TVector3<float, true>& v2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(v1.data, v2.data));
+			return (_mm_movemask_ps(_mm_cmpgt_ps(diff, _mm_set1_ps(P_FLT_INAC))) & 0x7) != 0;
+		}
+	};
+	template <>
 	struct compute_vec3_max<float, true> : public compute_vec4_max<float, true>
 	{ };
 	template <>
@@ -663,7 +1149,7 @@ namespace Phanes::Core::Math::Detail
 		map(Phanes::Core::Math::TPlane<float, true>& pl, float x, float y, float z, float d)
 		{
 
-			pl.comp.data = _mm_set_ps(x, y, z, d);
+			pl.comp.data = _mm_setr_ps(x, y, z, d);
 		}
 
 		// TODO: Create SSE constructor with 3 Points
@@ -673,44 +1159,72 @@ namespace Phanes::Core::Math::Detail
 	struct compute_plane_add<float, true>
 	{
 		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
-									Phanes::Core::Math::TPlane<float, true>& pl1,
-									Phanes::Core::Math::TPlane<float, true>& pl2)
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									const Phanes::Core::Math::TPlane<float, true>& pl2)
 		{
 			r.comp.data = _mm_add_ps(pl1.comp.data, pl2.comp.data);
 		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									float s)
+		{
+			r.comp.data = _mm_add_ps(pl1.comp.data, _mm_set_ps1(s));
+		}
 	};
 
 	template <>
 	struct compute_plane_sub<float, true>
 	{
 		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
-									Phanes::Core::Math::TPlane<float, true>& pl1,
-									Phanes::Core::Math::TPlane<float, true>& pl2)
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									const Phanes::Core::Math::TPlane<float, true>& pl2)
 		{
 			r.comp.data = _mm_sub_ps(pl1.comp.data, pl2.comp.data);
 		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									float s)
+		{
+			r.comp.data = _mm_sub_ps(pl1.comp.data, _mm_set_ps1(s));
+		}
 	};
 
 	template <>
 	struct compute_plane_mul<float, true>
 	{
 		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
-									Phanes::Core::Math::TPlane<float, true>& pl1,
-									Phanes::Core::Math::TPlane<float, true>& pl2)
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									const Phanes::Core::Math::TPlane<float, true>& pl2)
 		{
 			r.comp.data = _mm_mul_ps(pl1.comp.data, pl2.comp.data);
 		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									float s)
+		{
+			r.comp.data = _mm_mul_ps(pl1.comp.data, _mm_set_ps1(s));
+		}
 	};
 
 	template <>
 	struct compute_plane_div<float, true>
 	{
 		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
-									Phanes::Core::Math::TPlane<float, true>& pl1,
-									Phanes::Core::Math::TPlane<float, true>& pl2)
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									const Phanes::Core::Math::TPlane<float, true>& pl2)
 		{
 			r.comp.data = _mm_div_ps(pl1.comp.data, pl2.comp.data);
 		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									float s)
+		{
+			r.comp.data = _mm_div_ps(pl1.comp.data, _mm_set_ps1(s));
+		}
 	};
 
 	// =============== //
@@ -793,14 +1307,14 @@ namespace Phanes::Core::Math::Detail
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									const Phanes::Core::Math::TIntVector4<int, true>& v2)
 		{
-			r.comp = _mm_mul_epi32(v1.comp, v2.comp);
+			r.comp = _mm_mullo_epi32(v1.comp, v2.comp);
 		}
 
 		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r,
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									int s)
 		{
-			r.comp = _mm_mul_epi32(v1.comp, _mm_set1_epi32(s));
+			r.comp = _mm_mullo_epi32(v1.comp, _mm_set1_epi32(s));
 		}
 	};
 
@@ -824,6 +1338,26 @@ namespace Phanes::Core::Math::Detail
 		}
 	};
 
+	template <>
+	struct compute_ivec4_eq<int, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<int, true>& v1,
+									const Phanes::Core::Math::TIntVector4<int, true>& v2)
+		{
+			return _mm_movemask_epi8(_mm_cmpeq_epi32(v1.comp, v2.comp)) == 0xFFFF;
+		}
+	};
+
+	template <>
+	struct compute_ivec4_ieq<int, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector4<int, true>& v1,
+									const Phanes::Core::Math::TIntVector4<int, true>& v2)
+		{
+			return _mm_movemask_epi8(_mm_cmpeq_epi32(v1.comp, v2.comp)) != 0xFFFF;
+		}
+	};
+
 	template <>
 	struct compute_ivec4_and<int, true>
 	{
@@ -885,14 +1419,22 @@ namespace Phanes::Core::Math::Detail
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									const Phanes::Core::Math::TIntVector4<int, true>& v2)
 		{
-			r.comp = _mm_sll_epi32(v1.comp, v2.comp);
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+			r.comp = _mm_sllv_epi32(v1.comp, v2.comp);
+#	else
+			// SSE only shifts all components by the same count. Counts outside [0, 31] give 0 like vpsllvd.
+			r.x = ShiftLeft(v1.x, v2.x);
+			r.y = ShiftLeft(v1.y, v2.y);
+			r.z = ShiftLeft(v1.z, v2.z);
+			r.w = ShiftLeft(v1.w, v2.w);
+#	endif
 		}
 
 		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r,
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									int s)
 		{
-			r.comp = _mm_sll_epi32(v1.comp, _mm_set1_epi32(s));
+			r.comp = _mm_sll_epi32(v1.comp, _mm_cvtsi32_si128(s));
 		}
 	};
 
@@ -903,14 +1445,22 @@ namespace Phanes::Core::Math::Detail
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									const Phanes::Core::Math::TIntVector4<int, true>& v2)
 		{
-			r.comp = _mm_srl_epi32(v1.comp, v2.comp);
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+			r.comp = _mm_srav_epi32(v1.comp, v2.comp);
+#	else
+			// SSE only shifts all components by the same count. Counts outside [0, 31] fill with the sign like vpsravd.
+			r.x = ShiftRight(v1.x, v2.x);
+			r.y = ShiftRight(v1.y, v2.y);
+			r.z = ShiftRight(v1.z, v2.z);
+			r.w = ShiftRight(v1.w, v2.w);
+#	endif
 		}
 
 		static FORCEINLINE void map(Phanes::Core::Math::TIntVector4<int, true>& r,
 									const Phanes::Core::Math::TIntVector4<int, true>& v1,
 									int s)
 		{
-			r.comp = _mm_srl_epi32(v1.comp, _mm_set1_epi32(s));
+			r.comp = _mm_sra_epi32(v1.comp, _mm_cvtsi32_si128(s));
 		}
 	};
 
@@ -986,6 +1536,26 @@ namespace Phanes::Core::Math::Detail
 	struct compute_ivec3_right_shift<int, true> : public compute_ivec4_right_shift<int, true>
 	{ };
 
+	template <>
+	struct compute_ivec3_eq<int, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<int, true>& v1,
+									const Phanes::Core::Math::TIntVector3<int, true>& v2)
+		{
+			return (_mm_movemask_epi8(_mm_cmpeq_epi32(v1.comp, v2.comp)) & 0x0FFF) == 0x0FFF;
+		}
+	};
+
+	template <>
+	struct compute_ivec3_ieq<int, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TIntVector3<int, true>& v1,
+									const Phanes::Core::Math::TIntVector3<int, true>& v2)
+		{
+			return (_mm_movemask_epi8(_mm_cmpeq_epi32(v1.comp, v2.comp)) & 0x0FFF) != 0x0FFF;
+		}
+	};
+
 	// =============== //
 	//   TIntVector2   //
 	// =============== //
@@ -1153,7 +1723,13 @@ namespace Phanes::Core::Math::Detail
 			const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1,
 			const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
 		{
-			r.comp = _mm_sll_epi64(v1.comp, v2.comp);
+#	if P_INTRINSICS == P_INTRINSICS_AVX2
+			r.comp = _mm_sllv_epi64(v1.comp, v2.comp);
+#	else
+			// SSE only shifts all components by the same count. Counts outside [0, 63] give 0 like vpsllvq.
+			r.x = ShiftLeft(v1.x, v2.x);
+			r.y = ShiftLeft(v1.y, v2.y);
+#	endif
 		}
 
 		static FORCEINLINE void
@@ -1173,7 +1749,9 @@ namespace Phanes::Core::Math::Detail
 			const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1,
 			const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v2)
 		{
-			r.comp = _mm_srl_epi64(v1.comp, v2.comp);
+			// There is no arithmetic 64-bit shift before AVX-512. Counts outside [0, 63] fill with the sign.
+			r.x = ShiftRight(v1.x, v2.x);
+			r.y = ShiftRight(v1.y, v2.y);
 		}
 
 		static FORCEINLINE void
@@ -1181,7 +1759,8 @@ namespace Phanes::Core::Math::Detail
 			const Phanes::Core::Math::TIntVector2<Phanes::Core::Types::int64, true>& v1,
 			Phanes::Core::Types::int64 s)
 		{
-			r.comp = _mm_srl_epi64(v1.comp, _mm_set1_epi64x(s));
+			r.x = ShiftRight(v1.x, s);
+			r.y = ShiftRight(v1.y, s);
 		}
 	};
 
@@ -1213,78 +1792,142 @@ namespace Phanes::Core::Math::Detail
 									const TMatrix3<float, true>& m1,
 									const TMatrix3<float, true>& m2)
 		{
+			// Column i of r is m1 * (column i of m2). Copies, as r may alias m1 or m2.
+			__m128 c0 = m2.c0.data;
+			__m128 c1 = m2.c1.data;
+			__m128 c2 = m2.c2.data;
 
-			// First column
-			__m128 tmp0 = _mm_mul_ps(m1.c0.data, m2.c0.data);
-			__m128 tmp1 = _mm_mul_ps(m1.c1.data, m2.c0.data);
-			__m128 tmp2 = _mm_mul_ps(m1.c2.data, m2.c0.data);
-
-			r.c0.data = _mm_add_ps(_mm_add_ps(tmp0, tmp1), tmp2);
-
-			// Second column
-			tmp0 = _mm_mul_ps(m1.c0.data, m2.c1.data);
-			tmp1 = _mm_mul_ps(m1.c1.data, m2.c1.data);
-			tmp2 = _mm_mul_ps(m1.c2.data, m2.c1.data);
-
-			r.c1.data = _mm_add_ps(_mm_add_ps(tmp0, tmp1), tmp2);
-
-			// Third column
-			tmp0 = _mm_mul_ps(m1.c0.data, m2.c2.data);
-			tmp1 = _mm_mul_ps(m1.c1.data, m2.c2.data);
-			tmp2 = _mm_mul_ps(m1.c2.data, m2.c2.data);
+			c0 = SIMD::vec4_madd(m1.c2.data, _mm_shuffle_ps(c0, c0, 0xAA),
+								 SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c0, c0, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c0, c0, 0x00))));
+			c1 = SIMD::vec4_madd(m1.c2.data, _mm_shuffle_ps(c1, c1, 0xAA),
+								 SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c1, c1, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c1, c1, 0x00))));
+			c2 = SIMD::vec4_madd(m1.c2.data, _mm_shuffle_ps(c2, c2, 0xAA),
+								 SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c2, c2, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c2, c2, 0x00))));
 
-			r.c2.data = _mm_add_ps(_mm_add_ps(tmp0, tmp1), tmp2);
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
 		}
 
 		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r,
 									const TMatrix3<float, true>& m1,
 									const TVector3<float, true>& v)
 		{
-			__m128 tmp0 = _mm_mul_ps(m1.c0.data, v.data);
-			__m128 tmp1 = _mm_mul_ps(m1.c1.data, v.data);
-			__m128 tmp2 = _mm_mul_ps(m1.c2.data, v.data);
+			__m128 tmp = v.data;
 
-			r.data = _mm_add_ps(_mm_add_ps(tmp0, tmp1), tmp2);
+			r.data = SIMD::vec4_madd(m1.c2.data, _mm_shuffle_ps(tmp, tmp, 0xAA),
+									 SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(tmp, tmp, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(tmp, tmp, 0x00))));
 		}
 	};
 
-	// =========== //
-	//   Matrix4   //
-	// =========== //
-
 	template <>
-	struct compute_mat4_det<float, true>
+	struct compute_mat3_det<float, true>
 	{
-
-		// From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
-		static FORCEINLINE float map(const TMatrix4<float, true>& m1)
+		static FORCEINLINE float map(const Phanes::Core::Math::TMatrix3<float, true>& m1)
 		{
-			__m128 Fac0;
-			{
-				//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-				//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-				//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-				//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+			// Scalar triple product c0 . (c1 x c2), w is masked out.
+			return _mm_cvtss_f32(_mm_dp_ps(m1.c0.data, SIMD::vec4_cross_p(m1.c1.data, m1.c2.data), 0x7F));
+		}
+	};
 
-				__m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
-				__m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
+	template <>
+	struct compute_mat3_inv<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>& r,
+									const Phanes::Core::Math::TMatrix3<float, true>& m1)
+		{
+			// Rows of the inverse, scaled by the determinant.
+			__m128 r0 = SIMD::vec4_cross_p(m1.c1.data, m1.c2.data);
+			__m128 r1 = SIMD::vec4_cross_p(m1.c2.data, m1.c0.data);
+			__m128 r2 = SIMD::vec4_cross_p(m1.c0.data, m1.c1.data);
+			__m128 r3 = _mm_setzero_ps();
 
-				__m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
-				__m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
-				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
-				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
+			__m128 det = _mm_dp_ps(m1.c0.data, r0, 0x7F);
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac0 = _mm_sub_ps(Mul00, Mul01);
+			if (_mm_cvtss_f32(det) == 0.0f)
+			{
+				return false;
 			}
 
-			__m128 Fac1;
-			{
-				//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-				//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-				//	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-				//	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+			__m128 _1_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+			r0 = _mm_mul_ps(r0, _1_det);
+			r1 = _mm_mul_ps(r1, _1_det);
+			r2 = _mm_mul_ps(r2, _1_det);
+
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			r.c0.data = r0;
+			r.c1.data = r1;
+			r.c2.data = r2;
+
+			return true;
+		}
+	};
+
+	template <>
+	struct compute_mat3_inv_transpose<float, true>
+	{
+		static FORCEINLINE bool map(Phanes::Core::Math::TMatrix3<float, true>& r,
+									const Phanes::Core::Math::TMatrix3<float, true>& m1)
+		{
+			// The rows of the inverse are the columns of the inverse transpose, so no shuffle is needed.
+			__m128 r0 = SIMD::vec4_cross_p(m1.c1.data, m1.c2.data);
+			__m128 r1 = SIMD::vec4_cross_p(m1.c2.data, m1.c0.data);
+			__m128 r2 = SIMD::vec4_cross_p(m1.c0.data, m1.c1.data);
+
+			__m128 det = _mm_dp_ps(m1.c0.data, r0, 0x7F);
+
+			if (_mm_cvtss_f32(det) == 0.0f)
+			{
+				return false;
+			}
+
+			__m128 _1_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+			r.c0.data = _mm_mul_ps(r0, _1_det);
+			r.c1.data = _mm_mul_ps(r1, _1_det);
+			r.c2.data = _mm_mul_ps(r2, _1_det);
+
+			return true;
+		}
+	};
+
+	// =========== //
+	//   Matrix4   //
+	// =========== //
+
+	template <>
+	struct compute_mat4_det<float, true>
+	{
+
+		// From: GLM: https://github.com/g-truc/glm/blob/master/glm/simd/matrix.h (MIT License)
+		static FORCEINLINE float map(const TMatrix4<float, true>& m1)
+		{
+			__m128 Fac0;
+			{
+				//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+				//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+				//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+				//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+
+				__m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
+				__m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(2, 2, 2, 2));
+
+				__m128 Swp00 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
+				__m128 Swp01 = _mm_shuffle_ps(Swp0a, Swp0a, _MM_SHUFFLE(2, 0, 0, 0));
+				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
+				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
+
+				Fac0 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
+			}
+
+			__m128 Fac1;
+			{
+				//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+				//	valType SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+				//	valType SubFactor07 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+				//	valType SubFactor14 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
 
 				__m128 Swp0a = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(3, 3, 3, 3));
 				__m128 Swp0b = _mm_shuffle_ps(m1.c3.data, m1.c2.data, _MM_SHUFFLE(1, 1, 1, 1));
@@ -1294,9 +1937,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac1 = _mm_sub_ps(Mul00, Mul01);
+				Fac1 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac2;
@@ -1314,9 +1955,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac2 = _mm_sub_ps(Mul00, Mul01);
+				Fac2 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac3;
@@ -1334,9 +1973,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac3 = _mm_sub_ps(Mul00, Mul01);
+				Fac3 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac4;
@@ -1354,9 +1991,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac4 = _mm_sub_ps(Mul00, Mul01);
+				Fac4 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac5;
@@ -1374,9 +2009,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac5 = _mm_sub_ps(Mul00, Mul01);
+				Fac5 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
@@ -1415,11 +2048,7 @@ namespace Phanes::Core::Math::Detail
 			// - (Vec1[1] * Fac0[1] - Vec2[1] * Fac1[1] + Vec3[1] * Fac2[1]),
 			// + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
 			// - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
-			__m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-			__m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-			__m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-			__m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-			__m128 Add00 = _mm_add_ps(Sub00, Mul02);
+			__m128 Add00 = SIMD::vec4_madd(Vec3, Fac2, SIMD::vec4_nmadd(Vec2, Fac1, _mm_mul_ps(Vec1, Fac0)));
 			__m128 Inv0 = _mm_mul_ps(SignB, Add00);
 
 			// col1
@@ -1427,11 +2056,7 @@ namespace Phanes::Core::Math::Detail
 			// + (Vec0[0] * Fac0[1] - Vec2[1] * Fac3[1] + Vec3[1] * Fac4[1]),
 			// - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
 			// + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
-			__m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-			__m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-			__m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-			__m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-			__m128 Add01 = _mm_add_ps(Sub01, Mul05);
+			__m128 Add01 = SIMD::vec4_madd(Vec3, Fac4, SIMD::vec4_nmadd(Vec2, Fac3, _mm_mul_ps(Vec0, Fac0)));
 			__m128 Inv1 = _mm_mul_ps(SignA, Add01);
 
 			// col2
@@ -1439,11 +2064,7 @@ namespace Phanes::Core::Math::Detail
 			// - (Vec0[0] * Fac1[1] - Vec1[1] * Fac3[1] + Vec3[1] * Fac5[1]),
 			// + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
 			// - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
-			__m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-			__m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-			__m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-			__m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-			__m128 Add02 = _mm_add_ps(Sub02, Mul08);
+			__m128 Add02 = SIMD::vec4_madd(Vec3, Fac5, SIMD::vec4_nmadd(Vec1, Fac3, _mm_mul_ps(Vec0, Fac1)));
 			__m128 Inv2 = _mm_mul_ps(SignB, Add02);
 
 			// col3
@@ -1451,11 +2072,7 @@ namespace Phanes::Core::Math::Detail
 			// + (Vec1[0] * Fac2[1] - Vec1[1] * Fac4[1] + Vec2[1] * Fac5[1]),
 			// - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
 			// + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
-			__m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-			__m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-			__m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-			__m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-			__m128 Add03 = _mm_add_ps(Sub03, Mul11);
+			__m128 Add03 = SIMD::vec4_madd(Vec2, Fac5, SIMD::vec4_nmadd(Vec1, Fac4, _mm_mul_ps(Vec0, Fac2)));
 			__m128 Inv3 = _mm_mul_ps(SignA, Add03);
 
 			__m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
@@ -1493,9 +2110,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac0 = _mm_sub_ps(Mul00, Mul01);
+				Fac0 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac1;
@@ -1513,9 +2128,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac1 = _mm_sub_ps(Mul00, Mul01);
+				Fac1 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac2;
@@ -1533,9 +2146,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac2 = _mm_sub_ps(Mul00, Mul01);
+				Fac2 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac3;
@@ -1553,9 +2164,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(3, 3, 3, 3));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac3 = _mm_sub_ps(Mul00, Mul01);
+				Fac3 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac4;
@@ -1573,9 +2182,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(2, 2, 2, 2));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac4 = _mm_sub_ps(Mul00, Mul01);
+				Fac4 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 Fac5;
@@ -1593,9 +2200,7 @@ namespace Phanes::Core::Math::Detail
 				__m128 Swp02 = _mm_shuffle_ps(Swp0b, Swp0b, _MM_SHUFFLE(2, 0, 0, 0));
 				__m128 Swp03 = _mm_shuffle_ps(m1.c2.data, m1.c1.data, _MM_SHUFFLE(1, 1, 1, 1));
 
-				__m128 Mul00 = _mm_mul_ps(Swp00, Swp01);
-				__m128 Mul01 = _mm_mul_ps(Swp02, Swp03);
-				Fac5 = _mm_sub_ps(Mul00, Mul01);
+				Fac5 = SIMD::vec4_msub(Swp00, Swp01, _mm_mul_ps(Swp02, Swp03));
 			}
 
 			__m128 SignA = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
@@ -1634,11 +2239,7 @@ namespace Phanes::Core::Math::Detail
 			// - (Vec1[1] * Fac0[1] - Vec2[1] * Fac1[1] + Vec3[1] * Fac2[1]),
 			// + (Vec1[2] * Fac0[2] - Vec2[2] * Fac1[2] + Vec3[2] * Fac2[2]),
 			// - (Vec1[3] * Fac0[3] - Vec2[3] * Fac1[3] + Vec3[3] * Fac2[3]),
-			__m128 Mul00 = _mm_mul_ps(Vec1, Fac0);
-			__m128 Mul01 = _mm_mul_ps(Vec2, Fac1);
-			__m128 Mul02 = _mm_mul_ps(Vec3, Fac2);
-			__m128 Sub00 = _mm_sub_ps(Mul00, Mul01);
-			__m128 Add00 = _mm_add_ps(Sub00, Mul02);
+			__m128 Add00 = SIMD::vec4_madd(Vec3, Fac2, SIMD::vec4_nmadd(Vec2, Fac1, _mm_mul_ps(Vec1, Fac0)));
 			__m128 Inv0 = _mm_mul_ps(SignB, Add00);
 
 			// col1
@@ -1646,11 +2247,7 @@ namespace Phanes::Core::Math::Detail
 			// + (Vec0[0] * Fac0[1] - Vec2[1] * Fac3[1] + Vec3[1] * Fac4[1]),
 			// - (Vec0[0] * Fac0[2] - Vec2[2] * Fac3[2] + Vec3[2] * Fac4[2]),
 			// + (Vec0[0] * Fac0[3] - Vec2[3] * Fac3[3] + Vec3[3] * Fac4[3]),
-			__m128 Mul03 = _mm_mul_ps(Vec0, Fac0);
-			__m128 Mul04 = _mm_mul_ps(Vec2, Fac3);
-			__m128 Mul05 = _mm_mul_ps(Vec3, Fac4);
-			__m128 Sub01 = _mm_sub_ps(Mul03, Mul04);
-			__m128 Add01 = _mm_add_ps(Sub01, Mul05);
+			__m128 Add01 = SIMD::vec4_madd(Vec3, Fac4, SIMD::vec4_nmadd(Vec2, Fac3, _mm_mul_ps(Vec0, Fac0)));
 			__m128 Inv1 = _mm_mul_ps(SignA, Add01);
 
 			// col2
@@ -1658,11 +2255,7 @@ namespace Phanes::Core::Math::Detail
 			// - (Vec0[0] * Fac1[1] - Vec1[1] * Fac3[1] + Vec3[1] * Fac5[1]),
 			// + (Vec0[0] * Fac1[2] - Vec1[2] * Fac3[2] + Vec3[2] * Fac5[2]),
 			// - (Vec0[0] * Fac1[3] - Vec1[3] * Fac3[3] + Vec3[3] * Fac5[3]),
-			__m128 Mul06 = _mm_mul_ps(Vec0, Fac1);
-			__m128 Mul07 = _mm_mul_ps(Vec1, Fac3);
-			__m128 Mul08 = _mm_mul_ps(Vec3, Fac5);
-			__m128 Sub02 = _mm_sub_ps(Mul06, Mul07);
-			__m128 Add02 = _mm_add_ps(Sub02, Mul08);
+			__m128 Add02 = SIMD::vec4_madd(Vec3, Fac5, SIMD::vec4_nmadd(Vec1, Fac3, _mm_mul_ps(Vec0, Fac1)));
 			__m128 Inv2 = _mm_mul_ps(SignB, Add02);
 
 			// col3
@@ -1670,24 +2263,19 @@ namespace Phanes::Core::Math::Detail
 			// + (Vec1[0] * Fac2[1] - Vec1[1] * Fac4[1] + Vec2[1] * Fac5[1]),
 			// - (Vec1[0] * Fac2[2] - Vec1[2] * Fac4[2] + Vec2[2] * Fac5[2]),
 			// + (Vec1[0] * Fac2[3] - Vec1[3] * Fac4[3] + Vec2[3] * Fac5[3]));
-			__m128 Mul09 = _mm_mul_ps(Vec0, Fac2);
-			__m128 Mul10 = _mm_mul_ps(Vec1, Fac4);
-			__m128 Mul11 = _mm_mul_ps(Vec2, Fac5);
-			__m128 Sub03 = _mm_sub_ps(Mul09, Mul10);
-			__m128 Add03 = _mm_add_ps(Sub03, Mul11);
+			__m128 Add03 = SIMD::vec4_madd(Vec2, Fac5, SIMD::vec4_nmadd(Vec1, Fac4, _mm_mul_ps(Vec0, Fac2)));
 			__m128 Inv3 = _mm_mul_ps(SignA, Add03);
 
-			__m128 Row0 = _mm_shuffle_ps(Inv0, Inv1, _MM_SHUFFLE(0, 0, 0, 0));
-			__m128 Row1 = _mm_shuffle_ps(Inv2, Inv3, _MM_SHUFFLE(0, 0, 0, 0));
-			__m128 Row2 = _mm_shuffle_ps(Row0, Row1, _MM_SHUFFLE(2, 0, 2, 0));
+			// Not GLM's m[0] * Inverse[.][0]: the determinant of the scalar path, so SSE, AVX and the FPU reject the same
+			// matrices (GLM's sum lets some rank deficient matrices through).
+			const float det = compute_mat4_det<float, false>::map(m1);
 
-			//	valType Determinant = m[0][0] * Inverse[0][0]
-			//						+ m[0][1] * Inverse[1][0]
-			//						+ m[0][2] * Inverse[2][0]
-			//						+ m[0][3] * Inverse[3][0];
-			__m128 Det0 = Phanes::Core::Math::SIMD::vec4_dot(m1.c0.data, Row2);
-			__m128 Rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), Det0);
-			//__m128 Rcp0 = _mm_rcp_ps(Det0);
+			if (det == 0.0f)
+			{
+				return false;
+			}
+
+			__m128 Rcp0 = _mm_set1_ps(1.0f / det);
 
 			//	Inverse /= Determinant;
 			r.c0.data = _mm_mul_ps(Inv0, Rcp0);
@@ -1698,6 +2286,1047 @@ namespace Phanes::Core::Math::Detail
 			return true;
 		}
 	};
-} // namespace Phanes::Core::Math::Detail
+
+	template <>
+	struct compute_mat4_transpose<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<float, true>& r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m1)
+		{
+			__m128 c0 = m1.c0.data;
+			__m128 c1 = m1.c1.data;
+			__m128 c2 = m1.c2.data;
+			__m128 c3 = m1.c3.data;
+
+			_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+			r.c3.data = c3;
+		}
+	};
+
+	template <>
+	struct compute_mat4_mul<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<float, true>& r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m1,
+									const Phanes::Core::Math::TMatrix4<float, true>& m2)
+		{
+			__m128 c0 = m2.c0.data;
+			__m128 c1 = m2.c1.data;
+			__m128 c2 = m2.c2.data;
+			__m128 c3 = m2.c3.data;
+
+			c0 = _mm_add_ps(SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c0, c0, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c0, c0, 0x00))),
+							SIMD::vec4_madd(m1.c3.data, _mm_shuffle_ps(c0, c0, 0xFF), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(c0, c0, 0xAA))));
+			c1 = _mm_add_ps(SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c1, c1, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c1, c1, 0x00))),
+							SIMD::vec4_madd(m1.c3.data, _mm_shuffle_ps(c1, c1, 0xFF), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(c1, c1, 0xAA))));
+			c2 = _mm_add_ps(SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c2, c2, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c2, c2, 0x00))),
+							SIMD::vec4_madd(m1.c3.data, _mm_shuffle_ps(c2, c2, 0xFF), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(c2, c2, 0xAA))));
+			c3 = _mm_add_ps(SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(c3, c3, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(c3, c3, 0x00))),
+							SIMD::vec4_madd(m1.c3.data, _mm_shuffle_ps(c3, c3, 0xFF), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(c3, c3, 0xAA))));
+
+			r.c0.data = c0;
+			r.c1.data = c1;
+			r.c2.data = c2;
+			r.c3.data = c3;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>& r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m1,
+									const Phanes::Core::Math::TVector4<float, true>& v)
+		{
+			__m128 tmp = v.data;
+
+			r.data = _mm_add_ps(SIMD::vec4_madd(m1.c1.data, _mm_shuffle_ps(tmp, tmp, 0x55), _mm_mul_ps(m1.c0.data, _mm_shuffle_ps(tmp, tmp, 0x00))),
+								SIMD::vec4_madd(m1.c3.data, _mm_shuffle_ps(tmp, tmp, 0xFF), _mm_mul_ps(m1.c2.data, _mm_shuffle_ps(tmp, tmp, 0xAA))));
+		}
+	};
+
+#	if P_INTRINSICS == P_INTRINSICS_SSE
+	// AVX builds transform two vectors per register, see PhanesVectorMathAVX.hpp.
+
+	template <>
+	struct compute_mat4_transform_points<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector3<float, true>* v,
+									size_t n)
+		{
+			// Clearing w of the columns keeps w of the results at zero.
+			__m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			__m128 c0 = _mm_and_ps(m.c0.data, mask);
+			__m128 c1 = _mm_and_ps(m.c1.data, mask);
+			__m128 c2 = _mm_and_ps(m.c2.data, mask);
+			__m128 c3 = _mm_and_ps(m.c3.data, mask);
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+
+				__m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)), c3));
+				__m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v1, v1, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v1, v1, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v1, v1, 0xAA)), c3));
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				r[i].data = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)), c3));
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform_dirs<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector3<float, true>* v,
+									size_t n)
+		{
+			// Clearing w of the columns keeps w of the results at zero.
+			__m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			__m128 c0 = _mm_and_ps(m.c0.data, mask);
+			__m128 c1 = _mm_and_ps(m.c1.data, mask);
+			__m128 c2 = _mm_and_ps(m.c2.data, mask);
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+
+				__m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)));
+				__m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v1, v1, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v1, v1, 0x55))),
+									   _mm_mul_ps(c2, _mm_shuffle_ps(v1, v1, 0xAA)));
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				r[i].data = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)));
+			}
+		}
+	};
+
+	template <>
+	struct compute_mat4_transform<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>* r,
+									const Phanes::Core::Math::TMatrix4<float, true>& m,
+									const Phanes::Core::Math::TVector4<float, true>* v,
+									size_t n)
+		{
+			__m128 c0 = m.c0.data;
+			__m128 c1 = m.c1.data;
+			__m128 c2 = m.c2.data;
+			__m128 c3 = m.c3.data;
+
+			size_t i = 0;
+
+			for (; i + 2 <= n; i += 2)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+
+				__m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)),
+												  _mm_mul_ps(c3, _mm_shuffle_ps(v0, v0, 0xFF))));
+				__m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v1, v1, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v1, v1, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v1, v1, 0xAA)),
+												  _mm_mul_ps(c3, _mm_shuffle_ps(v1, v1, 0xFF))));
+
+				r[i].data = r0;
+				r[i + 1].data = r1;
+			}
+
+			if (i < n)
+			{
+				__m128 v0 = v[i].data;
+
+				r[i].data = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00)),
+												  _mm_mul_ps(c1, _mm_shuffle_ps(v0, v0, 0x55))),
+									   _mm_add_ps(_mm_mul_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA)),
+												  _mm_mul_ps(c3, _mm_shuffle_ps(v0, v0, 0xFF))));
+			}
+		}
+	};
+#	endif
+
+	// =============== //
+	//   TQuaternion   //
+	// =============== //
+
+	template <>
+	struct construct_quat<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, float x, float y, float z, float w)
+		{
+			r.data = _mm_setr_ps(x, y, z, w);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TVector3<float, true>& v,
+									float w)
+		{
+			r.data = _mm_blend_ps(v.data, _mm_set1_ps(w), 0x8);
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TVector4<float, true>& v)
+		{
+			r.data = v.data;
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r, const float* comp)
+		{
+			r.data = _mm_loadu_ps(comp);
+		}
+	};
+
+	template <>
+	struct construct_quat_euler<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TVector3<float, true>& euler_angels)
+		{
+			// One sincos for all three half angles: s = (sy, sp, sr, -), c = (cy, cp, cr, -)
+			__m128 s, c;
+			SIMD::vec4_sincos(_mm_mul_ps(euler_angels.data, _mm_set1_ps(0.5f)), s, c);
+
+			__m128 sy = _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 sp = _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 sr = _mm_shuffle_ps(s, s, _MM_SHUFFLE(2, 2, 2, 2));
+			__m128 cy = _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 0));
+			__m128 cp = _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 cr = _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2));
+
+			// (sr, cr, cr, cr) * (cp, sp, cp, cp) * (cy, cy, sy, cy) -+-+ (cr, sr, sr, sr) * (sp, cp, sp, sp) * (sy, sy, cy, sy)
+			__m128 a = _mm_mul_ps(_mm_mul_ps(_mm_blend_ps(cr, sr, 0x1), _mm_blend_ps(cp, sp, 0x2)), _mm_blend_ps(cy, sy, 0x4));
+			__m128 b = _mm_mul_ps(_mm_mul_ps(_mm_blend_ps(sr, cr, 0x1), _mm_blend_ps(sp, cp, 0x2)), _mm_blend_ps(sy, cy, 0x4));
+
+			r.data = _mm_add_ps(a, _mm_xor_ps(b, _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f)));
+		}
+	};
+
+	template <>
+	struct compute_quat_add<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			r.data = _mm_add_ps(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_sub<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			r.data = _mm_sub_ps(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_mul<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			__m128 a = q1.data;
+			__m128 b = q2.data;
+
+			// w1 * (x2, y2, z2, w2)
+			__m128 t0 = _mm_mul_ps(_mm_shuffle_ps(a, a, 0xFF), b);
+
+			// x1 * (w2, -z2, y2, -x2)
+			__m128 t1 = _mm_mul_ps(_mm_shuffle_ps(a, a, 0x00), _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)));
+			t1 = _mm_xor_ps(t1, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+
+			// y1 * (z2, w2, -x2, -y2)
+			__m128 t2 = _mm_mul_ps(_mm_shuffle_ps(a, a, 0x55), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)));
+			t2 = _mm_xor_ps(t2, _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+
+			// z1 * (-y2, x2, w2, -z2)
+			__m128 t3 = _mm_mul_ps(_mm_shuffle_ps(a, a, 0xAA), _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)));
+			t3 = _mm_xor_ps(t3, _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+			r.data = _mm_add_ps(_mm_add_ps(t0, t1), _mm_add_ps(t2, t3));
+		}
+
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									float s)
+		{
+			r.data = _mm_mul_ps(q1.data, _mm_set1_ps(s));
+		}
+	};
+
+	template <>
+	struct compute_quat_div<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									float s)
+		{
+			r.data = _mm_div_ps(q1.data, _mm_set1_ps(s));
+		}
+	};
+
+	template <>
+	struct compute_quat_eq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(q1.data, q2.data));
+			return _mm_movemask_ps(_mm_cmplt_ps(diff, _mm_set1_ps(P_FLT_INAC))) == 0xF;
+		}
+	};
+
+	template <>
+	struct compute_quat_ieq<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			__m128 diff = SIMD::vec4_abs(_mm_sub_ps(q1.data, q2.data));
+			return _mm_movemask_ps(_mm_cmpgt_ps(diff, _mm_set1_ps(P_FLT_INAC))) != 0;
+		}
+	};
+
+	template <>
+	struct compute_quat_dotp<float, true>
+	{
+		static FORCEINLINE float map(const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									 const Phanes::Core::Math::TQuaternion<float, true>& q2)
+		{
+			return SIMD::vec4_dot_cvtf32(q1.data, q2.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_conj<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1)
+		{
+			r.data = _mm_xor_ps(q1.data, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+		}
+	};
+
+	template <>
+	struct compute_quat_inv<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1)
+		{
+			__m128 conj = _mm_xor_ps(q1.data, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+			r.data = _mm_div_ps(conj, SIMD::vec4_dot(q1.data, q1.data));
+		}
+	};
+
+	template <>
+	struct compute_quat_norm<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1)
+		{
+			r.data = _mm_div_ps(q1.data, _mm_sqrt_ps(SIMD::vec4_dot(q1.data, q1.data)));
+		}
+	};
+
+	template <>
+	struct compute_quat_rotate<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q,
+									const Phanes::Core::Math::TVector3<float, true>& v)
+		{
+			r.data = SIMD::quat_rotate_p(q.data, v.data);
+		}
+	};
+
+	template <>
+	struct compute_quat_nlerp<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2,
+									float t)
+		{
+			// Shortest path: the sign of the dot product is moved onto t.
+			__m128 sign = _mm_and_ps(SIMD::vec4_dot(q1.data, q2.data), _mm_set1_ps(-0.0f));
+			__m128 t2 = _mm_xor_ps(_mm_set1_ps(t), sign);
+
+			__m128 tmp = SIMD::vec4_madd(q1.data, _mm_set1_ps(1.0f - t), _mm_mul_ps(q2.data, t2));
+			r.data = _mm_div_ps(tmp, _mm_sqrt_ps(SIMD::vec4_dot(tmp, tmp)));
+		}
+	};
+
+	template <>
+	struct compute_quat_slerp<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TQuaternion<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& q1,
+									const Phanes::Core::Math::TQuaternion<float, true>& q2,
+									float t)
+		{
+			float cosTheta = SIMD::vec4_dot_cvtf32(q1.data, q2.data);
+			float sign = 1.0f;
+
+			if (cosTheta < 0.0f)
+			{
+				cosTheta = -cosTheta;
+				sign = -1.0f;
+			}
+
+			if (cosTheta > 1.0f - P_FLT_INAC)
+			{
+				compute_quat_nlerp<float, true>::map(r, q1, q2, t);
+				return;
+			}
+
+			// (sin(theta), sin((1 - t) * theta), sin(t * theta), -) in one call
+			__m128 theta = SIMD::vec4_acos(_mm_set1_ps(cosTheta));
+			__m128 s = SIMD::vec4_sin(_mm_mul_ps(theta, _mm_setr_ps(1.0f, 1.0f - t, t, 0.0f)));
+			__m128 w = _mm_div_ps(_mm_mul_ps(s, _mm_setr_ps(1.0f, 1.0f, sign, 1.0f)), _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0)));
+
+			__m128 t1 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 1, 1, 1));
+			__m128 t2 = _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 2, 2, 2));
+
+			r.data = SIMD::vec4_madd(q1.data, t1, _mm_mul_ps(q2.data, t2));
+		}
+	};
+
+	// ============== //
+	//   TTransform   //
+	// ============== //
+
+	template <>
+	struct construct_transform<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<float, true>& r,
+									const Phanes::Core::Math::TQuaternion<float, true>& rotation,
+									const Phanes::Core::Math::TVector3<float, true>& translation,
+									const Phanes::Core::Math::TVector3<float, true>& scale)
+		{
+			// w = 0 in translation and scale keeps the w lane of transformed points at zero.
+			r.rotation.data = rotation.data;
+			r.translation.data = SIMD::vec3_fix(translation.data);
+			r.scale.data = SIMD::vec3_fix(scale.data);
+		}
+	};
+
+	template <>
+	struct compute_transform_mul<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<float, true>& r,
+									const Phanes::Core::Math::TTransform<float, true>& tr1,
+									const Phanes::Core::Math::TTransform<float, true>& tr2)
+		{
+			// t = t1 + q1 * (s1 * t2)
+			__m128 t = _mm_add_ps(tr1.translation.data,
+								  SIMD::quat_rotate_p(tr1.rotation.data, _mm_mul_ps(tr1.scale.data, tr2.translation.data)));
+			__m128 s = _mm_mul_ps(tr1.scale.data, tr2.scale.data);
+
+			compute_quat_mul<float, true>::map(r.rotation, tr1.rotation, tr2.rotation);
+			r.translation.data = t;
+			r.scale.data = s;
+		}
+	};
+
+	template <>
+	struct compute_transform_inv<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TTransform<float, true>& r,
+									const Phanes::Core::Math::TTransform<float, true>& tr)
+		{
+			// q' = conj(q), s' = 1 / s, t' = -(s' * (q' * t))
+			__m128 q = _mm_xor_ps(tr.rotation.data, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+			__m128 s = SIMD::vec3_fix(_mm_div_ps(_mm_set1_ps(1.0f), tr.scale.data));
+			__m128 t = _mm_mul_ps(SIMD::quat_rotate_p(q, tr.translation.data), s);
+
+			r.rotation.data = q;
+			r.translation.data = _mm_sub_ps(_mm_setzero_ps(), t);
+			r.scale.data = s;
+		}
+	};
+
+	template <>
+	struct compute_transform_point<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r,
+									const Phanes::Core::Math::TTransform<float, true>& tr,
+									const Phanes::Core::Math::TVector3<float, true>& p)
+		{
+			r.data = _mm_add_ps(SIMD::quat_rotate_p(tr.rotation.data, _mm_mul_ps(p.data, tr.scale.data)), tr.translation.data);
+		}
+	};
+
+	template <>
+	struct compute_transform_dir<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>& r,
+									const Phanes::Core::Math::TTransform<float, true>& tr,
+									const Phanes::Core::Math::TVector3<float, true>& v)
+		{
+			r.data = SIMD::quat_rotate_p(tr.rotation.data, _mm_mul_ps(v.data, tr.scale.data));
+		}
+	};
+
+	template <>
+	struct compute_transform_to_mat4<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TMatrix4<float, true>& r,
+									const Phanes::Core::Math::TTransform<float, true>& tr)
+		{
+			__m128 q = tr.rotation.data;
+			__m128 q2 = _mm_add_ps(q, q);
+			__m128 sq = _mm_mul_ps(q, q2); // (2xx, 2yy, 2zz, 2ww)
+
+			// (1 - 2yy - 2zz, 1 - 2xx - 2zz, 1 - 2xx - 2yy)
+			__m128 d = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 0, 0, 1))),
+								  _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 1, 2, 2)));
+
+			// (2xz, 2xy, 2yz, 2ww) and (2wy, 2wz, 2wx, 2ww)
+			__m128 a = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 1, 2)));
+			__m128 b = _mm_mul_ps(_mm_shuffle_ps(q, q, 0xFF), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 1)));
+
+			// m.w is exactly zero and provides the zero in the w lane of the columns.
+			__m128 p = _mm_add_ps(a, b);
+			__m128 m = _mm_sub_ps(a, b);
+
+			// c0 = (d.x, p.y, m.x), c1 = (m.y, d.y, p.z), c2 = (p.x, m.z, d.z)
+			__m128 c0 = _mm_shuffle_ps(_mm_blend_ps(d, p, 0x2), m, _MM_SHUFFLE(3, 0, 1, 0));
+			__m128 c1 = _mm_shuffle_ps(_mm_shuffle_ps(m, d, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(p, m, _MM_SHUFFLE(3, 3, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 c2 = _mm_shuffle_ps(_mm_shuffle_ps(p, m, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_ps(d, m, _MM_SHUFFLE(3, 3, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			__m128 s = tr.scale.data;
+
+			r.c0.data = _mm_mul_ps(c0, _mm_shuffle_ps(s, s, 0x00));
+			r.c1.data = _mm_mul_ps(c1, _mm_shuffle_ps(s, s, 0x55));
+			r.c2.data = _mm_mul_ps(c2, _mm_shuffle_ps(s, s, 0xAA));
+			r.c3.data = _mm_blend_ps(tr.translation.data, _mm_set1_ps(1.0f), 0x8);
+		}
+	};
+
+	template <>
+	struct compute_plane_transform<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TPlane<float, true>& r,
+									const Phanes::Core::Math::TPlane<float, true>& pl1,
+									const Phanes::Core::Math::TTransform<float, true>& tr)
+		{
+			__m128 n = SIMD::vec3_fix(pl1.comp.data);
+			__m128 d = _mm_shuffle_ps(pl1.comp.data, pl1.comp.data, 0xFF);
+
+			// w = 1 keeps n / s finite in the w lane.
+			__m128 s = _mm_blend_ps(tr.scale.data, _mm_set1_ps(1.0f), 0x8);
+
+			// Base point n * d, moved like any other point.
+			__m128 o = _mm_add_ps(SIMD::quat_rotate_p(tr.rotation.data, _mm_mul_ps(_mm_mul_ps(n, d), s)), tr.translation.data);
+
+			// Normals transform with the inverse transpose of scale and rotation: n' = q * (n / s).
+			n = SIMD::quat_rotate_p(tr.rotation.data, _mm_div_ps(n, s));
+			n = _mm_div_ps(n, _mm_sqrt_ps(_mm_dp_ps(n, n, 0x7F)));
+
+			r.comp.data = _mm_blend_ps(n, _mm_dp_ps(n, o, 0x7F), 0x8);
+		}
+	};
+
+	// ============== //
+	//   TRayPacket   //
+	// ============== //
+
+	// Four rays per register. Eight lane packets run the kernels on both halves.
+
+	template <size_t L>
+	struct compute_packet_aabb<float, L, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, L>& p,
+														   float minX, float minY, float minZ,
+														   float maxX, float maxY, float maxZ,
+														   float* t)
+		{
+			const __m128 bmin[3] = { _mm_set1_ps(minX), _mm_set1_ps(minY), _mm_set1_ps(minZ) };
+			const __m128 bmax[3] = { _mm_set1_ps(maxX), _mm_set1_ps(maxY), _mm_set1_ps(maxZ) };
+
+			Phanes::Core::Types::uint32 mask = 0;
+
+			for (size_t i = 0; i < L; i += 4)
+			{
+				const __m128 o[3] = { _mm_load_ps(p.ox + i), _mm_load_ps(p.oy + i), _mm_load_ps(p.oz + i) };
+				const __m128 inv[3] = { _mm_load_ps(p.ix + i), _mm_load_ps(p.iy + i), _mm_load_ps(p.iz + i) };
+
+				__m128 tv;
+				mask |= (Phanes::Core::Types::uint32)_mm_movemask_ps(SIMD::ray4_aabb(o, inv, bmin, bmax, tv)) << i;
+				_mm_storeu_ps(t + i, tv);
+			}
+
+			return mask;
+		}
+	};
+
+	template <size_t L>
+	struct compute_packet_plane<float, L, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, L>& p, float nx, float ny, float nz, float d, float* t)
+		{
+			const __m128 n[3] = { _mm_set1_ps(nx), _mm_set1_ps(ny), _mm_set1_ps(nz) };
+			const __m128 pd = _mm_set1_ps(d);
+
+			Phanes::Core::Types::uint32 mask = 0;
+
+			for (size_t i = 0; i < L; i += 4)
+			{
+				const __m128 o[3] = { _mm_load_ps(p.ox + i), _mm_load_ps(p.oy + i), _mm_load_ps(p.oz + i) };
+				const __m128 dir[3] = { _mm_load_ps(p.dx + i), _mm_load_ps(p.dy + i), _mm_load_ps(p.dz + i) };
+
+				__m128 tv;
+				mask |= (Phanes::Core::Types::uint32)_mm_movemask_ps(SIMD::ray4_plane(o, dir, n, pd, tv)) << i;
+				_mm_storeu_ps(t + i, tv);
+			}
+
+			return mask;
+		}
+	};
+
+	template <size_t L>
+	struct compute_packet_sphere<float, L, true>
+	{
+		static FORCEINLINE Phanes::Core::Types::uint32 map(const Phanes::Core::Math::TRayPacket<float, L>& p, float cx, float cy, float cz, float radius, float* t)
+		{
+			const __m128 c[3] = { _mm_set1_ps(cx), _mm_set1_ps(cy), _mm_set1_ps(cz) };
+			const __m128 r = _mm_set1_ps(radius);
+
+			Phanes::Core::Types::uint32 mask = 0;
+
+			for (size_t i = 0; i < L; i += 4)
+			{
+				const __m128 o[3] = { _mm_load_ps(p.ox + i), _mm_load_ps(p.oy + i), _mm_load_ps(p.oz + i) };
+				const __m128 dir[3] = { _mm_load_ps(p.dx + i), _mm_load_ps(p.dy + i), _mm_load_ps(p.dz + i) };
+
+				__m128 tv;
+				mask |= (Phanes::Core::Types::uint32)_mm_movemask_ps(SIMD::ray4_sphere(o, dir, c, r, tv)) << i;
+				_mm_storeu_ps(t + i, tv);
+			}
+
+			return mask;
+		}
+	};
+
+	// ======== //
+	//   TBVH   //
+	// ======== //
+
+	// A float node is one register for min and one for max. Lane 3 holds first / count and is masked.
+
+	template <>
+	struct compute_bvh_ray_node<float, true>
+	{
+		static FORCEINLINE float map(const Phanes::Core::Math::TBVHNode<float>& n, const float* o, const float* inv, float tMax)
+		{
+			__m128 vo = _mm_load_ps(o);
+			__m128 vinv = _mm_load_ps(inv);
+
+			__m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.min), vo), vinv);
+			__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(n.max), vo), vinv);
+
+			__m128 lo = _mm_blend_ps(_mm_min_ps(t0, t1), _mm_setzero_ps(), 0x8);
+			__m128 hi = _mm_blend_ps(_mm_max_ps(t0, t1), _mm_set1_ps(tMax), 0x8);
+
+			lo = _mm_max_ps(lo, _mm_shuffle_ps(lo, lo, 0x4E));
+			lo = _mm_max_ps(lo, _mm_shuffle_ps(lo, lo, 0xB1));
+			hi = _mm_min_ps(hi, _mm_shuffle_ps(hi, hi, 0x4E));
+			hi = _mm_min_ps(hi, _mm_shuffle_ps(hi, hi, 0xB1));
+
+			float tmin = _mm_cvtss_f32(lo);
+			return (tmin <= _mm_cvtss_f32(hi)) ? tmin : std::numeric_limits<float>::infinity();
+		}
+	};
+
+	template <>
+	struct compute_bvh_box_node<float, true>
+	{
+		static FORCEINLINE bool map(const Phanes::Core::Math::TBVHNode<float>& n, const float* bmin, const float* bmax)
+		{
+			__m128 r = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(n.min), _mm_load_ps(bmax)),
+								  _mm_cmple_ps(_mm_load_ps(bmin), _mm_load_ps(n.max)));
+
+			return (_mm_movemask_ps(r) & 0x7) == 0x7;
+		}
+	};
+
+	// ============================= //
+	//   TVector3SoA / TVector4SoA   //
+	// ============================= //
+
+	template <>
+	struct compute_vec4soa_gather<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4SoA<float>& r, const Phanes::Core::Math::TVector4<float, true>* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+				__m128 v2 = v[i + 2].data;
+				__m128 v3 = v[i + 3].data;
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				_mm_store_ps(r.x + i, v0);
+				_mm_store_ps(r.y + i, v1);
+				_mm_store_ps(r.z + i, v2);
+				_mm_store_ps(r.w + i, v3);
+			}
+
+			for (; i < n; i++)
+			{
+				r.x[i] = v[i].x;
+				r.y[i] = v[i].y;
+				r.z[i] = v[i].z;
+				r.w[i] = v[i].w;
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec4soa_scatter<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector4<float, true>* r, const Phanes::Core::Math::TVector4SoA<float>& v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128 v0 = _mm_load_ps(v.x + i);
+				__m128 v1 = _mm_load_ps(v.y + i);
+				__m128 v2 = _mm_load_ps(v.z + i);
+				__m128 v3 = _mm_load_ps(v.w + i);
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				r[i].data = v0;
+				r[i + 1].data = v1;
+				r[i + 2].data = v2;
+				r[i + 3].data = v3;
+			}
+
+			for (; i < n; i++)
+			{
+				r[i].x = v.x[i];
+				r[i].y = v.y[i];
+				r[i].z = v.z[i];
+				r[i].w = v.w[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_gather<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3SoA<float>& r, const Phanes::Core::Math::TVector3<float, true>* v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+				__m128 v2 = v[i + 2].data;
+				__m128 v3 = v[i + 3].data;
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				_mm_store_ps(r.x + i, v0);
+				_mm_store_ps(r.y + i, v1);
+				_mm_store_ps(r.z + i, v2);
+			}
+
+			for (; i < n; i++)
+			{
+				r.x[i] = v[i].x;
+				r.y[i] = v[i].y;
+				r.z[i] = v[i].z;
+			}
+		}
+	};
+
+	template <>
+	struct compute_vec3soa_scatter<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::TVector3SoA<float>& v, size_t n)
+		{
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128 v0 = _mm_load_ps(v.x + i);
+				__m128 v1 = _mm_load_ps(v.y + i);
+				__m128 v2 = _mm_load_ps(v.z + i);
+				__m128 v3 = _mm_setzero_ps();
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				r[i].data = v0;
+				r[i + 1].data = v1;
+				r[i + 2].data = v2;
+				r[i + 3].data = v3;
+			}
+
+			for (; i < n; i++)
+			{
+				r[i].x = v.x[i];
+				r[i].y = v.y[i];
+				r[i].z = v.z[i];
+			}
+		}
+	};
+
+	template <>
+	struct compute_oct_pack<float, true>
+	{
+		template<typename O>
+		static FORCEINLINE void map(O* r, const Phanes::Core::Math::TVector3<float, true>* v, size_t n)
+		{
+			const __m128 scale = _mm_set1_ps((float)std::numeric_limits<decltype(O::x)>::max());
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128 v0 = v[i].data;
+				__m128 v1 = v[i + 1].data;
+				__m128 v2 = v[i + 2].data;
+				__m128 v3 = v[i + 3].data;
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				__m128i iu, iw;
+				Phanes::Core::Math::SIMD::vec4_oct_encode(v0, v1, v2, scale, iu, iw);
+				Phanes::Core::Math::SIMD::oct4_store(r + i, iu, iw);
+			}
+
+			compute_oct_pack<float, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_oct_unpack<float, true>
+	{
+		template<typename O>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const O* v, size_t n)
+		{
+			const __m128 scale = _mm_set1_ps((float)std::numeric_limits<decltype(O::x)>::max());
+			size_t i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128i iu, iw;
+				Phanes::Core::Math::SIMD::oct4_load(v + i, iu, iw);
+
+				__m128 v0, v1, v2;
+				Phanes::Core::Math::SIMD::vec4_oct_decode(iu, iw, scale, v0, v1, v2);
+				__m128 v3 = _mm_setzero_ps();
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				r[i].data = v0;
+				r[i + 1].data = v1;
+				r[i + 2].data = v2;
+				r[i + 3].data = v3;
+			}
+
+			compute_oct_unpack<float, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_norm_pack<float, true>
+	{
+		template<typename I>
+		static FORCEINLINE void map(I* r, const float* v, size_t n)
+		{
+			const __m128 lo = _mm_set1_ps(std::is_signed_v<I> ? -1.0f : 0.0f);
+			const __m128 hi = _mm_set1_ps(1.0f);
+			const __m128 scale = _mm_set1_ps((float)std::numeric_limits<I>::max());
+			size_t i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m128 s0 = _mm_loadu_ps(v + i);
+				__m128 s1 = _mm_loadu_ps(v + i + 4);
+
+				// NaN encodes to 0.
+				s0 = _mm_and_ps(_mm_min_ps(_mm_max_ps(s0, lo), hi), _mm_cmpord_ps(s0, s0));
+				s1 = _mm_and_ps(_mm_min_ps(_mm_max_ps(s1, lo), hi), _mm_cmpord_ps(s1, s1));
+
+				Phanes::Core::Math::SIMD::norm8_store(r + i, _mm_cvtps_epi32(_mm_mul_ps(s0, scale)), _mm_cvtps_epi32(_mm_mul_ps(s1, scale)));
+			}
+
+			compute_norm_pack<float, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_norm_unpack<float, true>
+	{
+		template<typename I>
+		static FORCEINLINE void map(float* r, const I* v, size_t n)
+		{
+			const __m128 lo = _mm_set1_ps(std::is_signed_v<I> ? -1.0f : 0.0f);
+			const __m128 scale = _mm_set1_ps((float)std::numeric_limits<I>::max());
+			size_t i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m128i i0, i1;
+				Phanes::Core::Math::SIMD::norm8_load(v + i, i0, i1);
+
+				_mm_storeu_ps(r + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(i0), scale), lo));
+				_mm_storeu_ps(r + i + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(i1), scale), lo));
+			}
+
+			compute_norm_unpack<float, false>::map(r + i, v + i, n - i);
+		}
+	};
+
+	template <>
+	struct compute_expr<float, true>
+	{
+		static FORCEINLINE __m128 load(const Phanes::Core::Math::TVector4<float, true>& v)
+		{
+			return v.comp;
+		}
+
+		static FORCEINLINE void store(Phanes::Core::Math::TVector4<float, true>& r, const __m128 v)
+		{
+			r.comp = v;
+		}
+
+		static FORCEINLINE __m128 splat(float s)
+		{
+			return _mm_set_ps1(s);
+		}
+
+		static FORCEINLINE __m128 add(const __m128 a, const __m128 b)
+		{
+			return _mm_add_ps(a, b);
+		}
+
+		static FORCEINLINE __m128 sub(const __m128 a, const __m128 b)
+		{
+			return _mm_sub_ps(a, b);
+		}
+
+		static FORCEINLINE __m128 mul(const __m128 a, const __m128 b)
+		{
+			return _mm_mul_ps(a, b);
+		}
+
+		static FORCEINLINE __m128 div(const __m128 a, const __m128 b)
+		{
+			return _mm_div_ps(a, b);
+		}
+	};
+	template <>
+	struct compute_grid_cell<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TIntVector3<int, true>* r, const Phanes::Core::Math::TVector3<float, true>* v, float invCellSize, size_t n)
+		{
+			const __m128 inv = _mm_set1_ps(invCellSize);
+			const __m128 lo = _mm_set1_ps((float)grid_cell_min);
+			const __m128 hi = _mm_set1_ps((float)grid_cell_max);
+
+			for (size_t i = 0; i < n; i++)
+			{
+				// maxps returns its second operand for NaN, which puts NaN into the lowest cell.
+				__m128 f = _mm_min_ps(_mm_max_ps(_mm_floor_ps(_mm_mul_ps(v[i].data, inv)), lo), hi);
+				r[i].comp = _mm_insert_epi32(_mm_cvttps_epi32(f), 0, 3);
+			}
+		}
+	};
+
+#	if P_INTRINSICS == P_INTRINSICS_SSE
+	// AVX builds convert all three components with one instruction, see PhanesVectorMathAVX.hpp.
+
+	template <>
+	struct compute_world_to_render<float, true>
+	{
+		template<bool SW>
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::TVector3<double, SW>* v,
+									const Phanes::Core::Math::TVector3<double, SW>& origin, size_t n)
+		{
+			const __m128d oxy = _mm_loadu_pd(&origin.x);
+			const __m128d oz = _mm_load_sd(&origin.z);
+
+			for (size_t i = 0; i < n; i++)
+			{
+				__m128 xy = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(&v[i].x), oxy));
+				__m128 z = _mm_cvtpd_ps(_mm_sub_sd(_mm_load_sd(&v[i].z), oz));
+
+				// (x, y, z, 0)
+				r[i].data = _mm_movelh_ps(xy, z);
+			}
+		}
+	};
+
+	template <>
+	struct compute_render_rebase<float, true>
+	{
+		static FORCEINLINE void map(Phanes::Core::Math::TVector3<float, true>* r, const Phanes::Core::Math::TVector3<float, true>& delta, size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+			{
+				r[i].data = _mm_add_ps(r[i].data, delta.data);
+			}
+		}
+	};
+#	endif
+} // namespace Phanes::Core::Math::Detail
+
+// Kernels over whole arrays and SoA streams.
+#	include "Core/Math/SIMD/PhanesBatchSSE.hpp"
+#	include "Core/Math/SIMD/PhanesBatchF16C.hpp"
+
+#	if P_SIMD_DISPATCH
+#		include "Core/Math/SIMD/PhanesDispatch.hpp"
+#	endif
 
 #endif
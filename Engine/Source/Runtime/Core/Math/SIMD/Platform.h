@@ -325,3 +325,63 @@
 #       error No SIMD instruction set detected. Use P_FORCE_FPU to disable SIMD extensions.
 #   endif
 #endif
+
+
+// Fused multiply-add
+
+// P_FMA__ makes the SSE and AVX kernels use FMA3 for their multiply-add chains (one rounding instead of two). It is
+// set for AVX and AVX2 builds compiled with -mfma (MSVC: /arch:AVX2) and can be turned off with P_NO_FMA.
+// Build with -ffp-contract=off (premake does): implicit contraction of the scalar code and of the unfused kernels
+// breaks results that have to be exact, e.g. CrossP(v, v) == 0.
+
+#if !defined(P_FORCE_FPU) && !defined(P_NO_FMA) && P_AVX__ && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#   define P_FMA__ 1
+#else
+#   define P_FMA__ 0
+#endif
+
+
+// Half precision conversion
+
+// P_F16C__ converts THalfVector2 / 3 / 4 with the F16C instructions (vcvtps2ph / vcvtph2ps). It is set for AVX and
+// AVX2 builds compiled with -mf16c (MSVC: /arch:AVX2) and can be turned off with P_NO_F16C.
+
+#if !defined(P_FORCE_FPU) && !defined(P_NO_F16C) && P_AVX__ && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#   define P_F16C__ 1
+#else
+#   define P_F16C__ 0
+#endif
+
+
+// Runtime dispatch
+
+// P_SIMD_DISPATCH compiles against the SSE baseline and selects the SSE, AVX or AVX2 batch kernels on startup.
+// See PhanesDispatch.hpp.
+
+#ifndef P_SIMD_DISPATCH
+#   define P_SIMD_DISPATCH 0
+#endif
+
+#if P_SIMD_DISPATCH && (P_INTRINSICS != P_INTRINSICS_SSE)
+#   error P_SIMD_DISPATCH requires an SSE baseline build (SSE4, without AVX).
+#endif
+
+// Compiles a single function for a wider instruction set than the rest of the build.
+#if defined(__GNUC__) || defined(__clang__)
+#   define P_TARGET_AVX __attribute__((target("avx")))
+#   define P_TARGET_AVX2 __attribute__((target("avx2")))
+#   define P_TARGET_F16C __attribute__((target("avx,f16c")))
+#else
+#   define P_TARGET_AVX
+#   define P_TARGET_AVX2
+#   define P_TARGET_F16C
+#endif
+
+// Keeps rare slow paths out of the loops they are called from.
+#if defined(__GNUC__) || defined(__clang__)
+#   define P_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define P_NOINLINE __declspec(noinline)
+#else
+#   define P_NOINLINE
+#endif
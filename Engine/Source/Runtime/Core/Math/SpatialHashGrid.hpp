@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/AABB.hpp"
+#include "Core/Math/IntVector3.hpp"
+#include "Core/Math/Sphere.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#include <vector>
+
+#ifndef SPATIAL_HASH_GRID_H
+#define SPATIAL_HASH_GRID_H
+
+namespace Phanes::Core::Math
+{
+
+    // Contiguous range of a TSpatialHashGrid: the points indices[begin] to indices[end - 1].
+
+    struct SpatialHashRange
+    {
+    public:
+        Phanes::Core::Types::uint32 begin;
+
+        Phanes::Core::Types::uint32 end;
+
+    public:
+        /** Number of points in the range */
+        FORCEINLINE size_t Size() const { return end - begin; }
+    };
+
+
+    // Uniform grid over points, for neighbor queries of many moving agents. Rebuilt from scratch with Build (every frame),
+    // which reuses the memory of the previous build.
+    //
+    // Point indices are sorted by cell with a counting sort, and the occupied cells are sorted by z, then y, then x. All
+    // points of a row of cells along x are therefore one contiguous range of indices, and queries report one range per
+    // row they touch. An open addressing table (linear probing) maps cells to their position in the sorted arrays.
+    //
+    // Cell coordinates are clamped to [-2^20, 2^20 - 1], positions beyond that share the border cells. Queries report the
+    // points of all cells overlapping the query shape, the points themselves are not tested.
+
+    template<RealType T>
+    struct TSpatialHashGrid
+    {
+    public:
+        using Real = T;
+
+        /** Cell of unused table slots and result of failed lookups */
+        static constexpr Phanes::Core::Types::uint32 Empty = 0xFFFFFFFFu;
+
+        /** Slot of the cell table */
+        struct Slot
+        {
+            Phanes::Core::Types::uint64 key;
+
+            Phanes::Core::Types::uint32 cell;
+        };
+
+        /** Edge length of the cells */
+        Real cellSize = (Real)1.0;
+
+        /** 1 / cellSize */
+        Real invCellSize = (Real)1.0;
+
+        /** Keys of the occupied cells, sorted (Detail::grid_key) */
+        std::vector<Phanes::Core::Types::uint64> keys;
+
+        /** The points of cell i are indices[cellStart[i]] to indices[cellStart[i + 1] - 1]. One more element than keys. */
+        std::vector<Phanes::Core::Types::uint32> cellStart;
+
+        /** Point indices sorted by cell */
+        std::vector<Phanes::Core::Types::uint32> indices;
+
+        /** Cell table, power of two size, at most half full */
+        std::vector<Slot> table;
+
+        /** 64 - log2(table.size()) */
+        int shift = 64;
+
+        /** Scratch memory of Build, kept for the next build */
+        std::vector<Phanes::Core::Types::uint64> sortKeys[2];
+
+        /** Scratch memory of Build, kept for the next build */
+        std::vector<Phanes::Core::Types::uint32> sortIndices;
+
+    public:
+        /** Default constructor */
+        TSpatialHashGrid() = default;
+    };
+
+    // ============================== //
+    //   TSpatialHashGrid functions   //
+    // ============================== //
+
+    /**
+     * Converts positions to cells, floor(p / cellSize) with clamping. SSE4.1 (floats) and AVX (doubles) for aligned vectors.
+     *
+     * @param(r) Array of at least count cells
+     * @param(p) Array of positions
+     * @param(count) Number of positions
+     * @param(invCellSize) 1 / cell size
+     */
+
+    template<RealType T, bool S>
+    void PositionToCell(TIntVector3<int, S>* r, const TVector3<T, S>* p, size_t count, T invCellSize);
+
+    /**
+     * Converts a position to its cell.
+     *
+     * @param(p) Position
+     * @param(invCellSize) 1 / cell size
+     *
+     * @return Cell of p.
+     */
+
+    template<RealType T, bool S>
+    TIntVector3<int, S> PositionToCell(const TVector3<T, S>& p, T invCellSize);
+
+    /**
+     * Bins points into cells.
+     *
+     * @param(grid) Grid, previous contents are discarded
+     * @param(p) Positions of the points
+     * @param(count) Number of points, less than 2^32
+     * @param(cellSize) Edge length of the cells, e.g. the largest query radius
+     */
+
+    template<RealType T, bool S>
+    void Build(TSpatialHashGrid<T>& grid, const TVector3<T, S>* p, size_t count, T cellSize);
+
+    /**
+     * Finds the points of one cell.
+     *
+     * @param(grid) Grid
+     * @param(cell) Cell
+     *
+     * @return Range of the points in the cell, empty if the cell is not occupied.
+     */
+
+    template<RealType T, bool S>
+    SpatialHashRange Find(const TSpatialHashGrid<T>& grid, const TIntVector3<int, S>& cell);
+
+    /**
+     * Finds the points of all cells overlapping a box.
+     *
+     * @param(grid) Grid
+     * @param(b1) Box
+     * @param(fn) Called as void fn(SpatialHashRange range) for every non-empty row of cells, at most once per row.
+     */
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TSpatialHashGrid<T>& grid, const TAABB<T, S>& b1, Fn&& fn);
+
+    /**
+     * Finds the points of all cells overlapping a sphere. Rows are cut to the extent of the sphere.
+     *
+     * @param(grid) Grid
+     * @param(s1) Sphere
+     * @param(fn) Called as void fn(SpatialHashRange range) for every non-empty row of cells, at most once per row.
+     */
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TSpatialHashGrid<T>& grid, const TSphere<T, S>& s1, Fn&& fn);
+
+    /**
+     * Collects the ranges of all cells overlapping a box.
+     *
+     * @param(grid) Grid
+     * @param(b1) Box
+     * @param(r) Ranges are appended
+     *
+     * @return Number of points in the appended ranges.
+     */
+
+    template<RealType T, bool S>
+    size_t QueryRanges(const TSpatialHashGrid<T>& grid, const TAABB<T, S>& b1, std::vector<SpatialHashRange>& r);
+
+    /**
+     * Collects the ranges of all cells overlapping a sphere.
+     *
+     * @param(grid) Grid
+     * @param(s1) Sphere
+     * @param(r) Ranges are appended
+     *
+     * @return Number of points in the appended ranges.
+     */
+
+    template<RealType T, bool S>
+    size_t QueryRanges(const TSpatialHashGrid<T>& grid, const TSphere<T, S>& s1, std::vector<SpatialHashRange>& r);
+
+} // Phanes::Core::Math
+
+#endif // SPATIAL_HASH_GRID_H
+
+#include "Core/Math/SpatialHashGrid.inl"
@@ -0,0 +1,371 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/SpatialHashGridDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+
+namespace Phanes::Core::Math
+{
+    namespace Detail
+    {
+        // Cell of key, or TSpatialHashGrid<T>::Empty.
+        template<RealType T>
+        Phanes::Core::Types::uint32 grid_find(const TSpatialHashGrid<T>& grid, Phanes::Core::Types::uint64 key)
+        {
+            if (grid.table.empty())
+            {
+                return TSpatialHashGrid<T>::Empty;
+            }
+
+            size_t mask = grid.table.size() - 1;
+
+            for (size_t i = grid_hash(key, grid.shift);; i = (i + 1) & mask)
+            {
+                const typename TSpatialHashGrid<T>::Slot& s = grid.table[i];
+
+                if (s.cell == TSpatialHashGrid<T>::Empty || s.key == key)
+                {
+                    return s.cell;
+                }
+            }
+        }
+
+        // Cell of key. Inserts it as cell, if it is not in the table yet.
+        template<RealType T>
+        Phanes::Core::Types::uint32 grid_insert(TSpatialHashGrid<T>& grid, Phanes::Core::Types::uint64 key, Phanes::Core::Types::uint32 cell)
+        {
+            size_t mask = grid.table.size() - 1;
+
+            for (size_t i = grid_hash(key, grid.shift);; i = (i + 1) & mask)
+            {
+                typename TSpatialHashGrid<T>::Slot& s = grid.table[i];
+
+                if (s.cell == TSpatialHashGrid<T>::Empty)
+                {
+                    s.key = key;
+                    s.cell = cell;
+                    return cell;
+                }
+
+                if (s.key == key)
+                {
+                    return s.cell;
+                }
+            }
+        }
+
+        // Clears the table and resizes it to 2^bits slots.
+        template<RealType T>
+        void grid_reset(TSpatialHashGrid<T>& grid, int bits)
+        {
+            grid.table.assign((size_t)1 << bits, typename TSpatialHashGrid<T>::Slot{ 0, TSpatialHashGrid<T>::Empty });
+            grid.shift = 64 - bits;
+        }
+
+        // Reports the points of the occupied cells x0 to x1 of a row. They are consecutive in the sorted cells.
+        template<RealType T, typename Fn>
+        void grid_row(const TSpatialHashGrid<T>& grid, int x0, int x1, int y, int z, Fn& fn)
+        {
+            Phanes::Core::Types::uint64 last = grid_key(x1, y, z);
+            size_t first = grid.keys.size();
+
+            // Probing every cell is cheaper for short rows, binary search for long ones.
+            if ((size_t)(x1 - x0) < (size_t)std::bit_width(grid.keys.size()))
+            {
+                for (int x = x0; x <= x1; x++)
+                {
+                    Phanes::Core::Types::uint32 c = grid_find(grid, grid_key(x, y, z));
+
+                    if (c != TSpatialHashGrid<T>::Empty)
+                    {
+                        first = c;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                first = std::lower_bound(grid.keys.begin(), grid.keys.end(), grid_key(x0, y, z)) - grid.keys.begin();
+            }
+
+            if (first == grid.keys.size() || grid.keys[first] > last)
+            {
+                return;
+            }
+
+            size_t end = first + 1;
+
+            while (end < grid.keys.size() && grid.keys[end] <= last)
+            {
+                end++;
+            }
+
+            fn(SpatialHashRange{ grid.cellStart[first], grid.cellStart[end] });
+        }
+
+        // Distance of v to the slab of cell c along one axis. The border cells extend to infinity.
+        template<RealType T>
+        T grid_slab_distance(const TSpatialHashGrid<T>& grid, T v, int c)
+        {
+            T lo = (T)c * grid.cellSize;
+            T hi = (T)(c + 1) * grid.cellSize;
+
+            if (v < lo && c != grid_cell_min)
+            {
+                return lo - v;
+            }
+
+            if (v > hi && c != grid_cell_max)
+            {
+                return v - hi;
+            }
+
+            return (T)0.0;
+        }
+    }
+
+
+    template<RealType T, bool S>
+    void PositionToCell(TIntVector3<int, S>* r, const TVector3<T, S>* p, size_t count, T invCellSize)
+    {
+        Detail::compute_grid_cell<T, S>::map(r, p, invCellSize, count);
+    }
+
+    template<RealType T, bool S>
+    TIntVector3<int, S> PositionToCell(const TVector3<T, S>& p, T invCellSize)
+    {
+        TIntVector3<int, S> r;
+        Detail::compute_grid_cell<T, S>::map(&r, &p, invCellSize, 1);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    void Build(TSpatialHashGrid<T>& grid, const TVector3<T, S>* p, size_t count, T cellSize)
+    {
+        using uint32 = Phanes::Core::Types::uint32;
+        using uint64 = Phanes::Core::Types::uint64;
+
+        grid.cellSize = cellSize;
+        grid.invCellSize = (T)1.0 / cellSize;
+
+        grid.keys.clear();
+        grid.cellStart.assign(1, 0);
+        grid.indices.resize(count);
+
+        if (count == 0)
+        {
+            Detail::grid_reset(grid, 1);
+            return;
+        }
+
+        // Cells of the points and their bounds.
+        std::vector<uint64>& keys = grid.sortKeys[0];
+        std::vector<uint64>& tmpKeys = grid.sortKeys[1];
+        std::vector<uint32>& tmpIndices = grid.sortIndices;
+
+        keys.resize(count);
+        tmpKeys.resize(count);
+        tmpIndices.resize(count);
+
+        int lo[3] = { Detail::grid_cell_max, Detail::grid_cell_max, Detail::grid_cell_max };
+        int hi[3] = { Detail::grid_cell_min, Detail::grid_cell_min, Detail::grid_cell_min };
+
+        constexpr size_t Batch = 256;
+        TIntVector3<int, S> cells[Batch];
+
+        for (size_t b = 0; b < count; b += Batch)
+        {
+            size_t n = std::min(Batch, count - b);
+            PositionToCell(cells, p + b, n, grid.invCellSize);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                lo[0] = std::min(lo[0], cells[i].x); hi[0] = std::max(hi[0], cells[i].x);
+                lo[1] = std::min(lo[1], cells[i].y); hi[1] = std::max(hi[1], cells[i].y);
+                lo[2] = std::min(lo[2], cells[i].z); hi[2] = std::max(hi[2], cells[i].z);
+
+                keys[b + i] = Detail::grid_key(cells[i].x, cells[i].y, cells[i].z);
+            }
+        }
+
+        // Dense keys inside the bounds, in the same order as Detail::grid_key but with as few bits as possible.
+        uint64 nx = (uint64)(hi[0] - lo[0]) + 1;
+        uint64 ny = (uint64)(hi[1] - lo[1]) + 1;
+        uint64 nz = (uint64)(hi[2] - lo[2]) + 1;
+
+        uint64 base = Detail::grid_key(lo[0], lo[1], lo[2]);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64 d = keys[i] - base;
+            keys[i] = ((d >> 42) * ny + ((d >> 21) & 0x1FFFFFu)) * nx + (d & 0x1FFFFFu);
+            grid.indices[i] = (uint32)i;
+        }
+
+        // LSD radix sort, one counting sort per digit of at most 11 bits. Stable, so the points of a cell stay in order.
+        int bits = std::max(1, (int)std::bit_width(nx * ny * nz - 1));
+        int passes = (bits + 10) / 11;
+        int width = (bits + passes - 1) / passes;
+
+        std::vector<uint32> histogram((size_t)1 << width);
+
+        for (int pass = 0; pass < passes; pass++)
+        {
+            int shift = pass * width;
+            uint64 mask = ((uint64)1 << width) - 1;
+
+            std::fill(histogram.begin(), histogram.end(), 0);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                histogram[(keys[i] >> shift) & mask]++;
+            }
+
+            uint32 sum = 0;
+
+            for (uint32& h : histogram)
+            {
+                uint32 c = h;
+                h = sum;
+                sum += c;
+            }
+
+            for (size_t i = 0; i < count; i++)
+            {
+                uint32 d = histogram[(keys[i] >> shift) & mask]++;
+                tmpKeys[d] = keys[i];
+                tmpIndices[d] = grid.indices[i];
+            }
+
+            keys.swap(tmpKeys);
+            grid.indices.swap(tmpIndices);
+        }
+
+        // Occupied cells in order, with the first point of each.
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i == 0 || keys[i] != keys[i - 1])
+            {
+                if (i > 0)
+                {
+                    grid.cellStart.push_back((uint32)i);
+                }
+
+                uint64 k = keys[i];
+                int x = (int)(k % nx) + lo[0];
+                k /= nx;
+                int y = (int)(k % ny) + lo[1];
+                int z = (int)(k / ny) + lo[2];
+
+                grid.keys.push_back(Detail::grid_key(x, y, z));
+            }
+        }
+
+        grid.cellStart.push_back((uint32)count);
+
+        // At most half full.
+        Detail::grid_reset(grid, std::max(1, (int)std::bit_width(grid.keys.size() * 2 - 1)));
+
+        for (uint32 c = 0; c < (uint32)grid.keys.size(); c++)
+        {
+            Detail::grid_insert(grid, grid.keys[c], c);
+        }
+    }
+
+    template<RealType T, bool S>
+    SpatialHashRange Find(const TSpatialHashGrid<T>& grid, const TIntVector3<int, S>& cell)
+    {
+        Phanes::Core::Types::uint32 c = Detail::grid_find(grid, Detail::grid_key(cell.x, cell.y, cell.z));
+
+        if (c == TSpatialHashGrid<T>::Empty)
+        {
+            return SpatialHashRange{ 0, 0 };
+        }
+
+        return SpatialHashRange{ grid.cellStart[c], grid.cellStart[c + 1] };
+    }
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TSpatialHashGrid<T>& grid, const TAABB<T, S>& b1, Fn&& fn)
+    {
+        if (grid.keys.empty())
+        {
+            return;
+        }
+
+        using Cell = Detail::compute_grid_cell<T, false>;
+
+        int x0 = Cell::cell(b1.min.x, grid.invCellSize), x1 = Cell::cell(b1.max.x, grid.invCellSize);
+        int y0 = Cell::cell(b1.min.y, grid.invCellSize), y1 = Cell::cell(b1.max.y, grid.invCellSize);
+        int z0 = Cell::cell(b1.min.z, grid.invCellSize), z1 = Cell::cell(b1.max.z, grid.invCellSize);
+
+        for (int z = z0; z <= z1; z++)
+        {
+            for (int y = y0; y <= y1; y++)
+            {
+                Detail::grid_row(grid, x0, x1, y, z, fn);
+            }
+        }
+    }
+
+    template<RealType T, bool S, typename Fn>
+    void Query(const TSpatialHashGrid<T>& grid, const TSphere<T, S>& s1, Fn&& fn)
+    {
+        if (grid.keys.empty())
+        {
+            return;
+        }
+
+        using Cell = Detail::compute_grid_cell<T, false>;
+
+        T r = s1.radius;
+        T r2 = r * r;
+
+        int y0 = Cell::cell(s1.y - r, grid.invCellSize), y1 = Cell::cell(s1.y + r, grid.invCellSize);
+        int z0 = Cell::cell(s1.z - r, grid.invCellSize), z1 = Cell::cell(s1.z + r, grid.invCellSize);
+
+        for (int z = z0; z <= z1; z++)
+        {
+            T dz = Detail::grid_slab_distance(grid, s1.z, z);
+
+            for (int y = y0; y <= y1; y++)
+            {
+                T dy = Detail::grid_slab_distance(grid, s1.y, y);
+                T rem = r2 - dy * dy - dz * dz;
+
+                if (rem < (T)0.0)
+                {
+                    continue;
+                }
+
+                // Extent of the sphere along x, where it is widest inside the row.
+                T w = std::sqrt(rem);
+                Detail::grid_row(grid, Cell::cell(s1.x - w, grid.invCellSize), Cell::cell(s1.x + w, grid.invCellSize), y, z, fn);
+            }
+        }
+    }
+
+    template<RealType T, bool S>
+    size_t QueryRanges(const TSpatialHashGrid<T>& grid, const TAABB<T, S>& b1, std::vector<SpatialHashRange>& r)
+    {
+        size_t n = 0;
+        Query(grid, b1, [&r, &n](SpatialHashRange range) { r.push_back(range); n += range.Size(); });
+        return n;
+    }
+
+    template<RealType T, bool S>
+    size_t QueryRanges(const TSpatialHashGrid<T>& grid, const TSphere<T, S>& s1, std::vector<SpatialHashRange>& r)
+    {
+        size_t n = 0;
+        Query(grid, s1, [&r, &n](SpatialHashRange range) { r.push_back(range); n += range.Size(); });
+        return n;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/SIMD/Storage.h"
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Vector4.hpp"
+
+namespace Phanes::Core::Math
+{
+
+    // Bounding sphere, defined by center and radius.
+
+    template<RealType T, bool S>
+    struct TSphere
+    {
+    public:
+        using Real = T;
+
+        union
+        {
+            struct
+            {
+                /** X of the center */
+                Real x;
+
+                /** Y of the center */
+                Real y;
+
+                /** Z of the center */
+                Real z;
+
+                /** Radius */
+                Real radius;
+            };
+
+            /// <summary>
+            /// Center of the sphere. TVector3 is padded to four components, its last component aliases radius.
+            /// </summary>
+            TVector3<Real, S> center;
+
+            /// <summary>
+            /// Vector containing all components of the sphere (x, y, z and radius).
+            /// </summary>
+            TVector4<Real, S> comp;
+        };
+
+    public:
+        /** Default constructor */
+        TSphere() = default;
+
+        /**
+         * Construct sphere from center and radius.
+         *
+         * @param(center) Center
+         * @param(radius) Radius
+         */
+
+        TSphere(const TVector3<Real, S>& center, Real radius) : comp(center.x, center.y, center.z, radius) {};
+
+        /**
+         * Construct sphere from components.
+         *
+         * @param(x) X of the center
+         * @param(y) Y of the center
+         * @param(z) Z of the center
+         * @param(radius) Radius
+         */
+
+        TSphere(Real x, Real y, Real z, Real radius) : comp(x, y, z, radius) {};
+    };
+
+    // ===================== //
+    //   TSphere operators   //
+    // ===================== //
+
+    /**
+     * Tests two spheres for equality
+     *
+     * @param(s1) Sphere one
+     * @param(s2) Sphere two
+     *
+     * @return True, if same and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator== (const TSphere<T, S>& s1, const TSphere<T, S>& s2)
+    {
+        return s1.comp == s2.comp;
+    }
+
+    /**
+     * Tests two spheres for inequality
+     *
+     * @param(s1) Sphere one
+     * @param(s2) Sphere two
+     *
+     * @return True, if not same and false, if same.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator!= (const TSphere<T, S>& s1, const TSphere<T, S>& s2)
+    {
+        return s1.comp != s2.comp;
+    }
+
+    // ===================== //
+    //   TSphere functions   //
+    // ===================== //
+
+    /**
+     * Tests if a point is inside a sphere (including the border).
+     *
+     * @param(s1) Sphere
+     * @param(p1) Point
+     *
+     * @return True, if inside and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool IsInside(const TSphere<T, S>& s1, const TVector3<T, S>& p1)
+    {
+        T dx = p1.x - s1.x;
+        T dy = p1.y - s1.y;
+        T dz = p1.z - s1.z;
+
+        return dx * dx + dy * dy + dz * dz <= s1.radius * s1.radius;
+    }
+
+    /**
+     * Tests if two spheres overlap (touching counts as overlap).
+     *
+     * @param(s1) Sphere one
+     * @param(s2) Sphere two
+     *
+     * @return True, if overlapping and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool Intersects(const TSphere<T, S>& s1, const TSphere<T, S>& s2)
+    {
+        T dx = s2.x - s1.x;
+        T dy = s2.y - s1.y;
+        T dz = s2.z - s1.z;
+        T r = s1.radius + s2.radius;
+
+        return dx * dx + dy * dy + dz * dz <= r * r;
+    }
+
+} // Phanes::Core::Math
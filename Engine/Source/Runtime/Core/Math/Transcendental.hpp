@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#include <span>
+#include <type_traits>
+
+#ifndef TRANSCENDENTAL_H
+#define TRANSCENDENTAL_H
+
+namespace Phanes::Core::Math {
+
+    // Transcendental functions over whole arrays. SIMD builds evaluate four or eight elements per instruction with the
+    // polynomials of PhanesTranscendentalSSE.hpp / PhanesTranscendentalAVX.hpp (a few ULP), FPU builds call libm.
+    //
+    // Sin, Cos and SinCos take any angle. The polynomials cover |v| <= 8192 (float) and |v| <= 1e6 (double), vectors with
+    // larger elements compute those elements with libm, which is much slower but keeps the results within [-1, 1] and
+    // as accurate as the FPU build.
+
+    /// <summary>
+    /// Computes the sine of every element.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Sines, stops after min(v.size(), r.size()) elements. May alias v.</param>
+    /// <param name="v">Angles in radians, any magnitude (see above for the fast range)</param>
+    template<RealType T>
+    void Sin(std::span<T> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Computes the cosine of every element.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="r">Cosines, stops after min(v.size(), r.size()) elements. May alias v.</param>
+    /// <param name="v">Angles in radians, any magnitude (see above for the fast range)</param>
+    template<RealType T>
+    void Cos(std::span<T> r, std::span<const std::type_identity_t<T>> v);
+
+    /// <summary>
+    /// Computes sine and cosine of every element in one pass.
+    /// </summary>
+    /// <typeparam name="T">Type of elements</typeparam>
+    /// <param name="s">Sines, stops after the smallest of v.size(), s.size() and c.size() elements</param>
+    /// <param name="c">Cosines, same count as s</param>
+    /// <param name="v">Angles in radians, any magnitude (see above for the fast range)</param>
+    template<RealType T>
+    void SinCos(std::span<T> s, std::span<T> c, std::span<const std::type_identity_t<T>> v);
+
+} // Phanes::Core::Math
+
+#endif // !TRANSCENDENTAL_H
+
+#include "Core/Math/Transcendental.inl"
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/TranscendentalDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <algorithm>
+
+
+namespace Phanes::Core::Math
+{
+    template<RealType T>
+    void Sin(std::span<T> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_soa_sin<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void Cos(std::span<T> r, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_soa_cos<T, SIMD::use_simd<T, 4, true>::value>::map(r.data(), v.data(), std::min(v.size(), r.size()));
+    }
+
+    template<RealType T>
+    void SinCos(std::span<T> s, std::span<T> c, std::span<const std::type_identity_t<T>> v)
+    {
+        Detail::compute_soa_sincos<T, SIMD::use_simd<T, 4, true>::value>::map(s.data(), c.data(), v.data(), std::min({ v.size(), s.size(), c.size() }));
+    }
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathFwd.h"
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Matrix4.hpp"
+#include "Core/Math/Quaternion.hpp"
+
+#ifndef TRANSFORM_H
+#	define TRANSFORM_H
+
+#	define PIdentityTransform(type, aligned)                                                                                       \
+		Phanes::Core::Math::TTransform<type, aligned>(PIdentityQuaternion(type, aligned),                                          \
+													  Phanes::Core::Math::TVector3<type, aligned>((type)0.0),                      \
+													  Phanes::Core::Math::TVector3<type, aligned>((type)1.0))
+
+namespace Phanes::Core::Math
+{
+	// Affine transformation, described by scale, rotation and translation.
+	// A point p is transformed by: p' = rotation * (scale * p) + translation.
+	//
+	// Compared to a TMatrix4, composition and inversion are a handful of quaternion and vector operations.
+	// Both are exact for uniform scale. With non-uniform scale the result can't be expressed
+	// as scale, rotation and translation (shear) and the shear is dropped.
+
+	template <RealType T, bool S>
+	struct TTransform
+	{
+		using Real = T;
+
+	public:
+		/// <summary>
+		/// Rotation (normalized)
+		/// </summary>
+		TQuaternion<Real, S> rotation;
+
+		/// <summary>
+		/// Translation
+		/// </summary>
+		TVector3<Real, S> translation;
+
+		/// <summary>
+		/// Scale per axis
+		/// </summary>
+		TVector3<Real, S> scale;
+
+	public:
+		/// Default constructor
+		TTransform() = default;
+
+		/**
+		 * Construct rigid transform (scale of one) from rotation and translation.
+		 *
+		 * @param rotation Rotation (normalized)
+		 * @param translation Translation
+		 */
+		TTransform(const TQuaternion<Real, S>& rotation, const TVector3<Real, S>& translation);
+
+		/**
+		 * Construct transform from rotation, translation and scale.
+		 *
+		 * @param rotation Rotation (normalized)
+		 * @param translation Translation
+		 * @param scale Scale per axis
+		 */
+		TTransform(const TQuaternion<Real, S>& rotation, const TVector3<Real, S>& translation, const TVector3<Real, S>& scale);
+	};
+
+
+	// ======================== //
+	//   TTransform operators   //
+	// ======================== //
+
+	/// <summary>
+	/// Composes two transforms. Applies tr2, then tr1.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr1">Transform one</param>
+	/// <param name="tr2">Transform two</param>
+	/// <returns>tr1</returns>
+	template <RealType T, bool S>
+	TTransform<T, S>& operator*=(TTransform<T, S>& tr1, const TTransform<T, S>& tr2);
+
+	/// <summary>
+	/// Composes two transforms. Applies tr2, then tr1.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr1">Transform one</param>
+	/// <param name="tr2">Transform two</param>
+	/// <returns>Composed transform</returns>
+	/// <remarks>Exact for uniform scale. Shear from non-uniform scale in tr1 is dropped.</remarks>
+	template <RealType T, bool S>
+	TTransform<T, S> operator*(const TTransform<T, S>& tr1, const TTransform<T, S>& tr2);
+
+	/// <summary>
+	/// Tests two transforms for equality.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr1">Transform one</param>
+	/// <param name="tr2">Transform two</param>
+	/// <returns>True if equal, false if not.</returns>
+	/// <remarks>Compares the components. Rotations q and -q are not equal.</remarks>
+	template <RealType T, bool S>
+	FORCEINLINE bool operator==(const TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+	{
+		return tr1.rotation == tr2.rotation && tr1.translation == tr2.translation && tr1.scale == tr2.scale;
+	}
+
+	/// <summary>
+	/// Tests two transforms for inequality.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr1">Transform one</param>
+	/// <param name="tr2">Transform two</param>
+	/// <returns>True if inequal, false if not.</returns>
+	template <RealType T, bool S>
+	FORCEINLINE bool operator!=(const TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+	{
+		return !(tr1 == tr2);
+	}
+
+
+	// ======================== //
+	//   TTransform functions   //
+	// ======================== //
+
+	/// <summary>
+	/// Inverts a transform.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr">Transform</param>
+	/// <returns>Inverted transform</returns>
+	/// <remarks>Conjugates the rotation instead of inverting a matrix. Exact for uniform scale. A scale of zero yields non-finite components.</remarks>
+	template <RealType T, bool S>
+	TTransform<T, S> Inverse(const TTransform<T, S>& tr);
+
+	/// <summary>
+	/// Inverts a transform.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr">Transform</param>
+	/// <returns>tr</returns>
+	/// <remarks>Exact for uniform scale. A scale of zero yields non-finite components.</remarks>
+	template <RealType T, bool S>
+	TTransform<T, S>& InverseV(TTransform<T, S>& tr);
+
+	/// <summary>
+	/// Transforms a point (scale, rotation and translation).
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr">Transform</param>
+	/// <param name="p">Point</param>
+	/// <returns>Transformed point</returns>
+	template <RealType T, bool S>
+	TVector3<T, S> TransformPoint(const TTransform<T, S>& tr, const TVector3<T, S>& p);
+
+	/// <summary>
+	/// Transforms a direction (scale and rotation, no translation).
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr">Transform</param>
+	/// <param name="v">Direction</param>
+	/// <returns>Transformed direction</returns>
+	template <RealType T, bool S>
+	TVector3<T, S> TransformDirection(const TTransform<T, S>& tr, const TVector3<T, S>& v);
+
+	/// <summary>
+	/// Converts a transform to a transformation matrix.
+	/// </summary>
+	/// <typeparam name="T">Type of transform</typeparam>
+	/// <typeparam name="S">Transform is aligned?</typeparam>
+	/// <param name="tr">Transform</param>
+	/// <returns>Transformation matrix (rotation * scale in the upper 3x3, translation in the last column)</returns>
+	template <RealType T, bool S>
+	TMatrix4<T, S> ToMatrix4(const TTransform<T, S>& tr);
+
+} // namespace Phanes::Core::Math
+
+#endif // TRANSFORM_H
+
+#include "Core/Math/Transform.inl"
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/TransformDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+namespace Phanes::Core::Math
+{
+    template<RealType T, bool S>
+    TTransform<T, S>::TTransform(const TQuaternion<Real, S>& _rotation, const TVector3<Real, S>& _translation)
+    {
+        Detail::construct_transform<T, S>::map(*this, _rotation, _translation, TVector3<T, S>((T)1.0));
+    }
+
+    template<RealType T, bool S>
+    TTransform<T, S>::TTransform(const TQuaternion<Real, S>& _rotation, const TVector3<Real, S>& _translation, const TVector3<Real, S>& _scale)
+    {
+        Detail::construct_transform<T, S>::map(*this, _rotation, _translation, _scale);
+    }
+
+
+    template<RealType T, bool S>
+    TTransform<T, S>& operator*=(TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+    {
+        Detail::compute_transform_mul<T, S>::map(tr1, tr1, tr2);
+        return tr1;
+    }
+
+    template<RealType T, bool S>
+    TTransform<T, S> operator*(const TTransform<T, S>& tr1, const TTransform<T, S>& tr2)
+    {
+        TTransform<T, S> r;
+        Detail::compute_transform_mul<T, S>::map(r, tr1, tr2);
+        return r;
+    }
+
+
+    template<RealType T, bool S>
+    TTransform<T, S> Inverse(const TTransform<T, S>& tr)
+    {
+        TTransform<T, S> r;
+        Detail::compute_transform_inv<T, S>::map(r, tr);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TTransform<T, S>& InverseV(TTransform<T, S>& tr)
+    {
+        Detail::compute_transform_inv<T, S>::map(tr, tr);
+        return tr;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> TransformPoint(const TTransform<T, S>& tr, const TVector3<T, S>& p)
+    {
+        TVector3<T, S> r;
+        Detail::compute_transform_point<T, S>::map(r, tr, p);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TVector3<T, S> TransformDirection(const TTransform<T, S>& tr, const TVector3<T, S>& v)
+    {
+        TVector3<T, S> r;
+        Detail::compute_transform_dir<T, S>::map(r, tr, v);
+        return r;
+    }
+
+    template<RealType T, bool S>
+    TMatrix4<T, S> ToMatrix4(const TTransform<T, S>& tr)
+    {
+        TMatrix4<T, S> r;
+        Detail::compute_transform_to_mat4<T, S>::map(r, tr);
+        return r;
+    }
+}
@@ -0,0 +1,300 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Math/Ray.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#include <limits>
+
+#ifndef TRIANGLE_H
+#define TRIANGLE_H
+
+namespace Phanes::Core::Math
+{
+
+    // Triangle defined by three corners. Counter clockwise corners face the viewer.
+
+    template<RealType T, bool S>
+    struct TTriangle
+    {
+    public:
+        using Real = T;
+
+        /** First corner */
+        TVector3<Real, S> a;
+
+        /** Second corner */
+        TVector3<Real, S> b;
+
+        /** Third corner */
+        TVector3<Real, S> c;
+
+    public:
+        /** Default constructor */
+        TTriangle() = default;
+
+        /**
+         * Construct triangle from its corners.
+         *
+         * @param(a) First corner
+         * @param(b) Second corner
+         * @param(c) Third corner
+         */
+
+        TTriangle(const TVector3<Real, S>& a, const TVector3<Real, S>& b, const TVector3<Real, S>& c) : a(a), b(b), c(c) {};
+    };
+
+
+    // Result of a ray triangle test. The hit point is origin + t * direction = (1 - u - v) * a + u * b + v * c.
+
+    template<RealType T>
+    struct TTriangleHit
+    {
+        /** Ray parameter */
+        T t;
+
+        /** Barycentric weight of b */
+        T u;
+
+        /** Barycentric weight of c */
+        T v;
+
+        /** Index of the triangle */
+        size_t index;
+    };
+
+
+    // Structure of arrays of triangles, stored as first corner and two edges (v0[], e1[] = b - a, e2[] = c - a).
+    // This is the layout the Moller-Trumbore test needs, so nothing has to be recomputed per ray.
+
+    template<RealType T>
+    struct TTriangleSoA
+    {
+    public:
+        using Real = T;
+
+        /// <summary>
+        /// Number of elements every stream is padded to. Padding triangles are degenerate and are never hit.
+        /// </summary>
+        static constexpr size_t Lanes = 8;
+
+        /// <summary>
+        /// Alignment of every stream in bytes.
+        /// </summary>
+        static constexpr size_t Alignment = 32;
+
+        /// <summary>
+        /// First corners (x, y, z streams)
+        /// </summary>
+        Real* v0[3] = { nullptr, nullptr, nullptr };
+
+        /// <summary>
+        /// First edges, b - a (x, y, z streams)
+        /// </summary>
+        Real* e1[3] = { nullptr, nullptr, nullptr };
+
+        /// <summary>
+        /// Second edges, c - a (x, y, z streams)
+        /// </summary>
+        Real* e2[3] = { nullptr, nullptr, nullptr };
+
+    public:
+
+        /// <summary>
+        /// Default constructor. Creates an empty container.
+        /// </summary>
+        TTriangleSoA() = default;
+
+        /// <summary>
+        /// Creates n degenerate triangles.
+        /// </summary>
+        /// <param name="n">Number of triangles</param>
+        explicit TTriangleSoA(size_t n);
+
+        /// <summary>
+        /// Copy constructor.
+        /// </summary>
+        /// <param name="v"></param>
+        TTriangleSoA(const TTriangleSoA<T>& v);
+
+        /// <summary>
+        /// Move constructor.
+        /// </summary>
+        /// <param name="v"></param>
+        TTriangleSoA(TTriangleSoA<T>&& v) noexcept;
+
+        ~TTriangleSoA();
+
+        TTriangleSoA<T>& operator= (const TTriangleSoA<T>& v);
+
+        TTriangleSoA<T>& operator= (TTriangleSoA<T>&& v) noexcept;
+
+        /// <summary>
+        /// Number of triangles.
+        /// </summary>
+        FORCEINLINE size_t Size() const { return size; }
+
+        /// <summary>
+        /// Number of elements in each stream, including the padding.
+        /// </summary>
+        FORCEINLINE size_t PaddedSize() const { return (size + Lanes - 1) & ~(Lanes - 1); }
+
+        /// <summary>
+        /// Resizes the container. New triangles are degenerate.
+        /// </summary>
+        /// <param name="n">New number of triangles</param>
+        void Resize(size_t n);
+
+        /// <summary>
+        /// Reads triangle i.
+        /// </summary>
+        /// <param name="i">Index</param>
+        template<bool S = false>
+        TTriangle<T, S> Get(size_t i) const
+        {
+            TVector3<T, S> a(v0[0][i], v0[1][i], v0[2][i]);
+            return TTriangle<T, S>(a, a + TVector3<T, S>(e1[0][i], e1[1][i], e1[2][i]), a + TVector3<T, S>(e2[0][i], e2[1][i], e2[2][i]));
+        }
+
+        /// <summary>
+        /// Writes triangle i.
+        /// </summary>
+        /// <param name="i">Index</param>
+        /// <param name="t">Triangle</param>
+        template<bool S>
+        void Set(size_t i, const TTriangle<T, S>& t)
+        {
+            v0[0][i] = t.a.x;
+            v0[1][i] = t.a.y;
+            v0[2][i] = t.a.z;
+
+            e1[0][i] = t.b.x - t.a.x;
+            e1[1][i] = t.b.y - t.a.y;
+            e1[2][i] = t.b.z - t.a.z;
+
+            e2[0][i] = t.c.x - t.a.x;
+            e2[1][i] = t.c.y - t.a.y;
+            e2[2][i] = t.c.z - t.a.z;
+        }
+
+    private:
+
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    // ======================= //
+    //   TTriangle operators   //
+    // ======================= //
+
+    /**
+     * Tests two triangles for equality
+     *
+     * @param(t1) Triangle one
+     * @param(t2) Triangle two
+     *
+     * @return True, if same and false, if not.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator== (const TTriangle<T, S>& t1, const TTriangle<T, S>& t2)
+    {
+        return (t1.a == t2.a && t1.b == t2.b && t1.c == t2.c);
+    }
+
+    /**
+     * Tests two triangles for inequality
+     *
+     * @param(t1) Triangle one
+     * @param(t2) Triangle two
+     *
+     * @return True, if not same and false, if same.
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE bool operator!= (const TTriangle<T, S>& t1, const TTriangle<T, S>& t2)
+    {
+        return !(t1 == t2);
+    }
+
+    // ======================= //
+    //   TTriangle functions   //
+    // ======================= //
+
+    /**
+     * Gets the unit normal of a triangle.
+     *
+     * @param(t1) Triangle
+     *
+     * @return Normal of the counter clockwise side
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetNormal(const TTriangle<T, S>& t1)
+    {
+        return Normalize(CrossP(t1.b - t1.a, t1.c - t1.a));
+    }
+
+    /**
+     * Gets the centroid of a triangle.
+     *
+     * @param(t1) Triangle
+     *
+     * @return Centroid
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE TVector3<T, S> GetCenter(const TTriangle<T, S>& t1)
+    {
+        return (t1.a + t1.b + t1.c) / (T)3.0;
+    }
+
+    /**
+     * Gets the area of a triangle.
+     *
+     * @param(t1) Triangle
+     *
+     * @return Area
+     */
+
+    template<RealType T, bool S>
+    FORCEINLINE T GetArea(const TTriangle<T, S>& t1)
+    {
+        return Magnitude(CrossP(t1.b - t1.a, t1.c - t1.a)) * (T)0.5;
+    }
+
+    /**
+     * Intersects a ray with a triangle (Moller-Trumbore). Both sides are hit.
+     *
+     * @param(t1) Triangle
+     * @param(r1) Ray
+     * @param(hit) Parameter and barycentrics of the hit. hit.index is set to 0.
+     *
+     * @return True, if the ray hits the triangle at t >= 0.
+     */
+
+    template<RealType T, bool S>
+    bool RayIntersect(const TTriangle<T, S>& t1, const TRay<T, S>& r1, TTriangleHit<T>& hit);
+
+    /**
+     * Intersects a ray with all triangles of tris and gets the nearest hit.
+     * With SIMD four (SSE) or eight (AVX) triangles are tested at once.
+     *
+     * @param(tris) Triangles
+     * @param(r1) Ray
+     * @param(hit) Parameter, barycentrics and index of the nearest hit. Not written, if nothing is hit.
+     * @param(tMax) Only hits with t < tMax are reported
+     *
+     * @return True, if any triangle is hit at 0 <= t < tMax.
+     */
+
+    template<RealType T, bool S>
+    bool RayIntersect(const TTriangleSoA<T>& tris, const TRay<T, S>& r1, TTriangleHit<T>& hit, T tMax = std::numeric_limits<T>::infinity());
+
+} // Phanes::Core::Math
+
+#endif // TRIANGLE_H
+
+#include "Core/Math/Triangle.inl"
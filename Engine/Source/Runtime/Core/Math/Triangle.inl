@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/TriangleDecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <cstring>
+#include <new>
+
+
+namespace Phanes::Core::Math
+{
+    template<RealType T>
+    TTriangleSoA<T>::TTriangleSoA(size_t n)
+    {
+        Resize(n);
+    }
+
+    template<RealType T>
+    TTriangleSoA<T>::TTriangleSoA(const TTriangleSoA<T>& v)
+    {
+        *this = v;
+    }
+
+    template<RealType T>
+    TTriangleSoA<T>::TTriangleSoA(TTriangleSoA<T>&& v) noexcept
+    {
+        *this = std::move(v);
+    }
+
+    template<RealType T>
+    TTriangleSoA<T>::~TTriangleSoA()
+    {
+        if (v0[0])
+        {
+            ::operator delete(v0[0], std::align_val_t(Alignment));
+        }
+    }
+
+    template<RealType T>
+    TTriangleSoA<T>& TTriangleSoA<T>::operator=(const TTriangleSoA<T>& v)
+    {
+        if (this != &v)
+        {
+            Resize(v.size);
+
+            for (int k = 0; k < 3; k++)
+            {
+                std::memcpy(v0[k], v.v0[k], sizeof(T) * size);
+                std::memcpy(e1[k], v.e1[k], sizeof(T) * size);
+                std::memcpy(e2[k], v.e2[k], sizeof(T) * size);
+            }
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    TTriangleSoA<T>& TTriangleSoA<T>::operator=(TTriangleSoA<T>&& v) noexcept
+    {
+        if (this != &v)
+        {
+            if (v0[0])
+            {
+                ::operator delete(v0[0], std::align_val_t(Alignment));
+            }
+
+            for (int k = 0; k < 3; k++)
+            {
+                v0[k] = v.v0[k];
+                e1[k] = v.e1[k];
+                e2[k] = v.e2[k];
+
+                v.v0[k] = v.e1[k] = v.e2[k] = nullptr;
+            }
+
+            size = v.size;
+            capacity = v.capacity;
+
+            v.size = v.capacity = 0;
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    void TTriangleSoA<T>::Resize(size_t n)
+    {
+        size_t padded = (n + Lanes - 1) & ~(Lanes - 1);
+
+        if (padded > capacity)
+        {
+            // All nine streams share one block. Zeroed triangles are degenerate.
+            T* block = static_cast<T*>(::operator new(sizeof(T) * padded * 9, std::align_val_t(Alignment)));
+            std::memset(block, 0, sizeof(T) * padded * 9);
+
+            T** streams[9] = { &v0[0], &v0[1], &v0[2], &e1[0], &e1[1], &e1[2], &e2[0], &e2[1], &e2[2] };
+            T* old = v0[0];
+
+            for (int k = 0; k < 9; k++)
+            {
+                if (old)
+                {
+                    std::memcpy(block + padded * k, *streams[k], sizeof(T) * size);
+                }
+
+                *streams[k] = block + padded * k;
+            }
+
+            if (old)
+            {
+                ::operator delete(old, std::align_val_t(Alignment));
+            }
+
+            capacity = padded;
+        }
+        else if (v0[0])
+        {
+            // The padding has to stay degenerate, also when shrinking, as the batch kernels test it.
+            size_t first = (n < size) ? n : size;
+
+            for (int k = 0; k < 3; k++)
+            {
+                std::memset(v0[k] + first, 0, sizeof(T) * (padded - first));
+                std::memset(e1[k] + first, 0, sizeof(T) * (padded - first));
+                std::memset(e2[k] + first, 0, sizeof(T) * (padded - first));
+            }
+        }
+
+        size = n;
+    }
+
+
+    template<RealType T, bool S>
+    bool RayIntersect(const TTriangle<T, S>& t1, const TRay<T, S>& r1, TTriangleHit<T>& hit)
+    {
+        TVector3<T, S> e1 = t1.b - t1.a;
+        TVector3<T, S> e2 = t1.c - t1.a;
+
+        TVector3<T, S> p = CrossP(r1.direction, e2);
+        T inv = (T)1.0 / DotP(e1, p);
+
+        TVector3<T, S> s = r1.origin - t1.a;
+        T u = DotP(s, p) * inv;
+
+        TVector3<T, S> q = CrossP(s, e1);
+        T v = DotP(r1.direction, q) * inv;
+        T t = DotP(e2, q) * inv;
+
+        // Parallel rays give inf / NaN, which fails every comparison.
+        if (u >= (T)0.0 && v >= (T)0.0 && u + v <= (T)1.0 && t >= (T)0.0)
+        {
+            hit.t = t;
+            hit.u = u;
+            hit.v = v;
+            hit.index = 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    template<RealType T, bool S>
+    bool RayIntersect(const TTriangleSoA<T>& tris, const TRay<T, S>& r1, TTriangleHit<T>& hit, T tMax)
+    {
+        return Detail::compute_ray_triangles<T, SIMD::use_simd<T, 4, true>::value>::map(hit, tris,
+            r1.origin.x, r1.origin.y, r1.origin.z, r1.direction.x, r1.direction.y, r1.direction.z, tMax);
+    }
+}
@@ -85,7 +85,7 @@ namespace Phanes::Core::Math {
          * Copy constructor
          */
 
-        TVector2(const TVector2<Real, A>& v);
+        constexpr TVector2(const TVector2<Real, A>& v);
 
         /**
          * Construct Vector from xy components.
@@ -94,19 +94,19 @@ namespace Phanes::Core::Math {
          * @param(y) Y component
          */
 
-        TVector2(const Real x, const Real y);
+        constexpr TVector2(const Real x, const Real y);
 
         /// <summary>
         /// Construct vector from array.
         /// </summary>
         /// <param name="comp">Array of at least 2 items.</param>
-        TVector2(const Real* comp);
+        constexpr TVector2(const Real* comp);
 
         /// <summary>
         /// Construct vector by broadcasting one scalar into all components.
         /// </summary>
         /// <param name="s">Scalar</param>
-        TVector2(Real s);
+        constexpr TVector2(Real s);
     };
 
     // ====================== //
@@ -121,7 +121,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator+= (TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S>& operator+= (TVector2<T, S>& v1, T s);
 
     /**
      * Addition operation on same TVector2<T, S> (this) by a another TVector2<T, S>.
@@ -131,7 +131,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator+= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S>& operator+= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Substraction operation on same TVector2<T, S> (this) by a floating point.
@@ -141,7 +141,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator-= (TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S>& operator-= (TVector2<T, S>& v1, T s);
 
     /**
      * Substraction operation on same TVector2<T, S> (this) by a another TVector2<T, S>.
@@ -151,7 +151,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator-= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S>& operator-= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Multiplication of TVector2<T, S> (this) with a floating point.
@@ -161,7 +161,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator*= (TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S>& operator*= (TVector2<T, S>& v1, T s);
 
     /// <summary>
     /// Componentwise multiplication of vector by other vector.
@@ -172,7 +172,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector2<T, S>& operator*= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S>& operator*= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Devision of Vector (this) by floating point.
@@ -182,7 +182,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator/= (TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S>& operator/= (TVector2<T, S>& v1, T s);
 
     /// <summary>
     /// Componentwise division of vector by other vector.
@@ -193,7 +193,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector2<T, S>& operator/= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S>& operator/= (TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Scale of Vector by floating point. (> Creates a new TVector2<T, S>)
@@ -205,7 +205,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator* (const TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S> operator* (const TVector2<T, S>& v1, T s);
 
     /// <summary>
     /// Componentwise multiplication with vector by vector.
@@ -216,7 +216,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns></returns>
     template<RealType T, bool S>
-    TVector2<T, S> operator* (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S> operator* (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Division of Vector by floating point. (> Creates another TVector2<T, S>)
@@ -228,11 +228,11 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator/ (const TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S> operator/ (const TVector2<T, S>& v1, T s);
 
 
     template<RealType T, bool S>
-    inline TVector2<T, S> operator/ (T s, const TVector2<T, S>& v1);
+    constexpr TVector2<T, S> operator/ (T s, const TVector2<T, S>& v1);
 
     /// <summary>
     /// Componentwise multiplication with vector by vector.
@@ -243,7 +243,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns></returns>
     template<RealType T, bool S>
-    TVector2<T, S> operator/ (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S> operator/ (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Scale of Vector by floating point. (> Creates a new TVector2<T, S>)
@@ -255,7 +255,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline TVector2<T, S> operator* (T s, const TVector2<T, S>& v1)
+    constexpr TVector2<T, S> operator* (T s, const TVector2<T, S>& v1)
     {
         return v1 * s;
     }
@@ -270,7 +270,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator+ (const TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S> operator+ (const TVector2<T, S>& v1, T s);
 
     /**
      * Componentwise addition of Vector with floating point.
@@ -282,7 +282,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator+ (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S> operator+ (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Componentwise substraction of Vector with floating point.
@@ -294,11 +294,11 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator- (const TVector2<T, S>& v1, T s);
+    constexpr TVector2<T, S> operator- (const TVector2<T, S>& v1, T s);
 
 
     template<RealType T, bool S>
-    inline TVector2<T, S> operator- (T s, const TVector2<T, S>& v1);
+    constexpr TVector2<T, S> operator- (T s, const TVector2<T, S>& v1);
 
     /**
      * Componentwise substraction of Vector with Vector.
@@ -310,7 +310,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector2<T, S> operator- (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr TVector2<T, S> operator- (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Compare Vector for equality.
@@ -323,7 +323,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    bool operator== (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr bool operator== (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
 
     /**
@@ -337,7 +337,7 @@ namespace Phanes::Core::Math {
         */
 
     template<RealType T, bool S>
-    bool operator!= (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr bool operator!= (const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
 
 
@@ -383,7 +383,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    T SqrMagnitude(const TVector2<T, S>& v1);
+    constexpr T SqrMagnitude(const TVector2<T, S>& v1);
 
     /**
      * @see [FUNC]SqrMagnitude
@@ -507,7 +507,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline T DotP(const TVector2<T, S>& v1, const TVector2<T, S>& v2);
+    constexpr T DotP(const TVector2<T, S>& v1, const TVector2<T, S>& v2);
 
     /**
      * Creates Vector, with component wise largest values. 
@@ -11,184 +11,348 @@
 
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
 
+#include <type_traits>
+
 
 
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    TVector2<T, S>::TVector2(const TVector2<Real, S>& v)
+    constexpr TVector2<T, S>::TVector2(const TVector2<Real, S>& v)
     {
-        Detail::construct_vec2<T, S>::map(*this, v);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec2<T, false>::map(*this, v);
+        }
+        else
+        {
+            Detail::construct_vec2<T, S>::map(*this, v);
+        }
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>::TVector2(Real _x, Real _y)
+    constexpr TVector2<T, S>::TVector2(Real _x, Real _y)
     {
-        Detail::construct_vec2<T, S>::map(*this, _x, _y);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec2<T, false>::map(*this, _x, _y);
+        }
+        else
+        {
+            Detail::construct_vec2<T, S>::map(*this, _x, _y);
+        }
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>::TVector2(Real s)
+    constexpr TVector2<T, S>::TVector2(Real s)
     {
-        Detail::construct_vec2<T, S>::map(*this, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec2<T, false>::map(*this, s);
+        }
+        else
+        {
+            Detail::construct_vec2<T, S>::map(*this, s);
+        }
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>::TVector2(const Real* comp)
+    constexpr TVector2<T, S>::TVector2(const Real* comp)
     {
-        Detail::construct_vec2<T, S>::map(*this, comp);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec2<T, false>::map(*this, comp);
+        }
+        else
+        {
+            Detail::construct_vec2<T, S>::map(*this, comp);
+        }
     }
 
 
 
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator+=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S>& operator+=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
-        Detail::compute_vec2_add<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_add<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_add<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator+=(TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S>& operator+=(TVector2<T, S>& v1, T s)
     {
-        Detail::compute_vec2_add<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_add<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_add<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator-=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S>& operator-=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
-        Detail::compute_vec2_sub<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_sub<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_sub<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator-=(TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S>& operator-=(TVector2<T, S>& v1, T s)
     {
-        Detail::compute_vec2_sub<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_sub<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_sub<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator*=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S>& operator*=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
-        Detail::compute_vec2_mul<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_mul<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_mul<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator*=(TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S>& operator*=(TVector2<T, S>& v1, T s)
     {
-        Detail::compute_vec2_mul<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_mul<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_mul<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator/=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S>& operator/=(TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
-        Detail::compute_vec2_div<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_div<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_div<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S>& operator/=(TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S>& operator/=(TVector2<T, S>& v1, T s)
     {
-        Detail::compute_vec2_div<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_div<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_div<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator+(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S> operator+(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_add<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_add<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_add<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator+(const TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S> operator+(const TVector2<T, S>& v1, T s)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_add<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_add<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_add<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator-(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S> operator-(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_sub<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_sub<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_sub<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator-(const TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S> operator-(const TVector2<T, S>& v1, T s)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_sub<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_sub<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_sub<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator*(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S> operator*(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_mul<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_mul<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_mul<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator*(const TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S> operator*(const TVector2<T, S>& v1, T s)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_mul<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_mul<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_mul<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator/(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr TVector2<T, S> operator/(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_div<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_div<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec2_div<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator/(const TVector2<T, S>& v1, T s)
+    constexpr TVector2<T, S> operator/(const TVector2<T, S>& v1, T s)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_div<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_div<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec2_div<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator/(T s, const TVector2<T, S>& v1)
+    constexpr TVector2<T, S> operator/(T s, const TVector2<T, S>& v1)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_div<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_div<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec2_div<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector2<T, S> operator-(T s, const TVector2<T, S>& v1)
+    constexpr TVector2<T, S> operator-(T s, const TVector2<T, S>& v1)
     {
         TVector2<T, S> r;
-        Detail::compute_vec2_sub<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec2_sub<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec2_sub<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     // Comparision
 
     template<RealType T, bool S>
-    bool operator==(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr bool operator==(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec2_eq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec2_eq<T, S>::map(v1, v2);
     }
 
     template<RealType T, bool S>
-    bool operator!=(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr bool operator!=(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec2_ieq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec2_ieq<T, S>::map(v1, v2);
     }
 
@@ -231,14 +395,22 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    T SqrMagnitude(const TVector2<T, S>& v1)
+    constexpr T SqrMagnitude(const TVector2<T, S>& v1)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec2_dotp<T, false>::map(v1, v1);
+        }
         return Detail::compute_vec2_dotp<T, S>::map(v1, v1);
     }
 
     template<RealType T, bool S>
-    inline T DotP(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
+    constexpr T DotP(const TVector2<T, S>& v1, const TVector2<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec2_dotp<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec2_dotp<T, S>::map(v1, v2);
     }
 
@@ -1,8 +1,5 @@
 #pragma once
 
-// TODO: Slerp (using Quaternions)
-
-
 #include "Core/Math/Boilerplate.h"
 
 #include "Core/Math/MathCommon.hpp"
@@ -42,7 +39,7 @@ namespace Phanes::Core::Math {
         /// Broadcast s into x, y, z.
         /// </summary>
         /// <param name="s"></param>
-        TVector3(const Real s);
+        constexpr TVector3(const Real s);
 
         /// <summary>
         /// Construct from x, y, z.
@@ -50,20 +47,20 @@ namespace Phanes::Core::Math {
         /// <param name="x">X component</param>
         /// <param name="y">Y component</param>
         /// <param name="z">Z component</param>
-        TVector3(const Real x, const Real y, const Real z);
+        constexpr TVector3(const Real x, const Real y, const Real z);
 
         /// <summary>
         /// Construct 3d vector from array of components
         /// </summary>
         /// <param name="comp"></param>
-        TVector3(const Real* comp);
+        constexpr TVector3(const Real* comp);
 
         /// <summary>
         /// Construct vector from 2d Vector and a scalar.
         /// </summary>
         /// <param name="v">Vector</param>
         /// <param name="s">Scalar</param>
-        TVector3(const TVector2<Real, S>& v, Real s);
+        constexpr TVector3(const TVector2<Real, S>& v, Real s);
     };
 
 
@@ -80,7 +77,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator+= (TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S>& operator+= (TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar addition.
@@ -91,7 +88,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator+= (TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S>& operator+= (TVector3<T, S>& v1, T s);
 
     /// <summary>
     /// Vector - scalar substraction
@@ -102,7 +99,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator-= (TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S>& operator-= (TVector3<T, S>& v1, const TVector3<T, S>& v2);
        
     /// <summary>
     /// Vector substraction.
@@ -113,7 +110,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator-= (TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S>& operator-= (TVector3<T, S>& v1, T s);
 
     /// <summary>
     /// Componentwise multiplication
@@ -124,7 +121,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator*=(TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S>& operator*=(TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Componentwise multiplication
@@ -134,7 +131,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator*= (TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S>& operator*= (TVector3<T, S>& v1, T s);
 
     /// <summary>
     /// Componentwise division
@@ -145,7 +142,7 @@ namespace Phanes::Core::Math {
     /// <param name="v2"></param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator/=(TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S>& operator/=(TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Coponentwise division of 3D vector with floating point
@@ -155,7 +152,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline TVector3<T, S>& operator/= (TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S>& operator/= (TVector3<T, S>& v1, T s);
 
 
 
@@ -169,7 +166,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator* (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S> operator* (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Coponentwise multiplication of 3D Vectors with floating point
@@ -181,7 +178,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator* (const TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S> operator* (const TVector3<T, S>& v1, T s);
 
 
     /**
@@ -194,10 +191,10 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/ (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S> operator/ (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/ (T s, const TVector3<T, S>& v1);
+    constexpr TVector3<T, S> operator/ (T s, const TVector3<T, S>& v1);
 
 
     /**
@@ -210,7 +207,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/ (const TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S> operator/ (const TVector3<T, S>& v1, T s);
 
     /**
      * Coponentwise multiplication of 3D Vectors with floating point
@@ -222,7 +219,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    FORCEINLINE TVector3<T, S> operator* (T s, const TVector3<T, S>& v1) 
+    FORCEINLINE constexpr TVector3<T, S> operator* (T s, const TVector3<T, S>& v1) 
     { 
         return v1 * s; 
     };
@@ -237,7 +234,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator+ (const TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S> operator+ (const TVector3<T, S>& v1, T s);
 
     /**
      * Coponentwise addition of 3D vector to 3D vector
@@ -249,7 +246,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator+ (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S> operator+ (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Coponentwise substraction of floating point of 3D vector
@@ -261,10 +258,10 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator- (const TVector3<T, S>& v1, T s);
+    constexpr TVector3<T, S> operator- (const TVector3<T, S>& v1, T s);
 
     template<RealType T, bool S>
-    TVector3<T, S> operator- (T s, const TVector3<T, S>& v1);
+    constexpr TVector3<T, S> operator- (T s, const TVector3<T, S>& v1);
 
     /**
      * Coponentwise substraction of floating point of 3D vector
@@ -276,7 +273,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> operator- (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S> operator- (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Tests two 3D vectors for equality.
@@ -292,7 +289,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline bool operator== (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr bool operator== (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Tests two 3D vectors for inequality.
@@ -304,7 +301,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline bool operator!= (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr bool operator!= (const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     template<RealType T, bool S>
     TVector3<T, S> operator++(TVector3<T, S>& v1);
@@ -349,7 +346,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline T SqrMagnitude(const TVector3<T, S>& v1);
+    constexpr T SqrMagnitude(const TVector3<T, S>& v1);
 
     /**
      * @see SqrMagnitude
@@ -394,6 +391,32 @@ namespace Phanes::Core::Math {
         return v1;
     }
 
+    /**
+     * Approximates the magnitude of a vector with FastInvSqrt
+     *
+     * @param(v1) Vector
+     *
+     * @return Approximated magnitude of vector
+     *
+     * @note Without R the magnitude is sqr * FastInvSqrt<false>(sqr), see FastInvSqrt for the error bounds. With R (default)
+     *       it is exact, as a magnitude needs no division and sqrt is as fast as a refined estimate. Double is exact.
+     */
+
+    template<bool R = true, RealType T, bool S>
+    T FastMagnitude(const TVector3<T, S>& v1);
+
+    /**
+     * Normalizes vector with FastInvSqrt
+     *
+     * @param(v1) Vector
+     *
+     * @note Result is stored in v1. R refines the estimate with one Newton-Raphson step, see FastInvSqrt for the error
+     *       bounds. Double is exact.
+     */
+
+    template<bool R = true, RealType T, bool S>
+    TVector3<T, S>& FastNormalizeV(TVector3<T, S>& v1);
+
     /**
      * Reflects a vector on a surface
      *
@@ -459,10 +482,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    T Angle(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
-    {
-        return acos(DotP(v1, v2) / (Magnitude(v1) * Magnitude(v2)));
-    }
+    T Angle(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Dot product of two vectors
@@ -474,7 +494,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    inline T DotP(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr T DotP(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Orthogonalizes three vectors.
@@ -556,7 +576,7 @@ namespace Phanes::Core::Math {
     /// <returns>Copy of v1.</returns>
 
     template<RealType T, bool S>
-    TVector3<T, S>& CrossPV(TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S>& CrossPV(TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Gets the componentwise max of both vectors.
@@ -906,7 +926,7 @@ namespace Phanes::Core::Math {
     template<RealType T, bool S>
     TVector3<T, S> Normalize(const TVector3<T, S>& v1)
     {
-        float vecNorm = Magnitude(v1);
+        T vecNorm = Magnitude(v1);
         return (vecNorm < P_FLT_INAC) ? v1 : v1 / vecNorm;
     }
 
@@ -924,6 +944,19 @@ namespace Phanes::Core::Math {
         return v1 / Magnitude(v1);
     }
 
+    /**
+     * Normalizes vector with FastInvSqrt
+     *
+     * @param(v1) Vector
+     *
+     * @return Normalized vector
+     *
+     * @note R refines the estimate with one Newton-Raphson step, see FastInvSqrt for the error bounds. Double is exact.
+     */
+
+    template<bool R = true, RealType T, bool S>
+    TVector3<T, S> FastNormalize(const TVector3<T, S>& v1);
+
 
     /**
      * Returns signs of components in vector: -1 / +1 / 0.
@@ -1007,7 +1040,7 @@ namespace Phanes::Core::Math {
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> CrossP(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
+    constexpr TVector3<T, S> CrossP(const TVector3<T, S>& v1, const TVector3<T, S>& v2);
 
     /**
      * Linearly interpolates between two vectors.
@@ -1209,31 +1242,69 @@ namespace Phanes::Core::Math {
     }
 
     /**
-     * Interpolate vector v1 to desitnation v2 using v1 constant s. The magnitude of the vector stays the same throughout the interpolation.
+     * Spherically interpolates vector v1 to destination v2. The direction rotates with constant angular velocity, the magnitude is interpolated linearly.
      *
      * @param(v1) Starting vector
      * @param(v2) Destination vector
      * @param(t) 0.0 to 1.0 interpolation value
      *
-     * @return Interpolated unit vector
+     * @return Interpolated vector
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> Slerp(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T t) {};
+    TVector3<T, S> Slerp(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T t)
+    {
+        return SlerpUnclamped(v1, v2, Clamp(t, (T)0.0, (T)1.0));
+    }
 
     /**
-     * Interpolate vector v1 to desitnation v2 using v1 constant s. The magnitude of the vector stays the same throughout the interpolation.
+     * Spherically interpolates vector v1 to destination v2. The direction rotates with constant angular velocity, the magnitude is interpolated linearly.
      *
      * @param(v1) Starting vector
      * @param(v2) Destination vector
      * @param(t) 0.0 to 1.0 interpolation value
      *
-     * @return Interpolated unit vector.
-     * @note Does not clamp s between 0.0 and 1.0.
+     * @return Interpolated vector
+     * @note Does not clamp t between 0.0 and 1.0.
      */
 
     template<RealType T, bool S>
-    TVector3<T, S> SlerpUnclamped(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T t) {};
+    TVector3<T, S> SlerpUnclamped(const TVector3<T, S>& v1, const TVector3<T, S>& v2, T t)
+    {
+        T mag1 = Magnitude(v1);
+        T mag2 = Magnitude(v2);
+
+        if (mag1 < P_FLT_INAC || mag2 < P_FLT_INAC)
+        {
+            return LerpUnclamped(v1, v2, t);
+        }
+
+        TVector3<T, S> n1 = v1 / mag1;
+        TVector3<T, S> n2 = v2 / mag2;
+
+        T cosTheta = Clamp(DotP(n1, n2), (T)-1.0, (T)1.0);
+
+        // Almost parallel, lerp is exact enough and avoids dividing by sin(theta).
+        if (cosTheta > (T)1.0 - P_FLT_INAC)
+        {
+            return LerpUnclamped(v1, v2, t);
+        }
+
+        // Unit vector orthogonal to n1 in the plane of rotation. Opposite vectors span no plane, so any orthogonal vector is taken.
+        TVector3<T, S> ortho = n2 - cosTheta * n1;
+
+        if (SqrMagnitude(ortho) < P_FLT_INAC)
+        {
+            ortho = CrossP(n1, (Abs(n1.x) < (T)0.9) ? TVector3<T, S>(1, 0, 0) : TVector3<T, S>(0, 1, 0));
+        }
+
+        ortho = Normalize(ortho);
+
+        T theta = acos(cosTheta) * t;
+        T mag = mag1 + (mag2 - mag1) * t;
+
+        return ((T)cos(theta) * n1 + (T)sin(theta) * ortho) * mag;
+    }
 
 } // phanes
 
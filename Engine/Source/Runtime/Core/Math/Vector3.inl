@@ -7,184 +7,348 @@
 
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
 
+#include <type_traits>
+
 
 
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    TVector3<T, S>::TVector3(Real _x, Real _y, Real _z)
+    constexpr TVector3<T, S>::TVector3(Real _x, Real _y, Real _z)
     {
-        Detail::construct_vec3<T, S>::map(*this, _x, _y, _z);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec3<T, false>::map(*this, _x, _y, _z);
+        }
+        else
+        {
+            Detail::construct_vec3<T, S>::map(*this, _x, _y, _z);
+        }
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>::TVector3(Real s)
+    constexpr TVector3<T, S>::TVector3(Real s)
     {
-        Detail::construct_vec3<T, S>::map(*this, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec3<T, false>::map(*this, s);
+        }
+        else
+        {
+            Detail::construct_vec3<T, S>::map(*this, s);
+        }
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>::TVector3(const TVector2<Real, S>& v1, Real s)
+    constexpr TVector3<T, S>::TVector3(const TVector2<Real, S>& v1, Real s)
     {
-        Detail::construct_vec3<T, S>::map(*this, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec3<T, false>::map(*this, v1, s);
+        }
+        else
+        {
+            Detail::construct_vec3<T, S>::map(*this, v1, s);
+        }
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>::TVector3(const Real* comp)
+    constexpr TVector3<T, S>::TVector3(const Real* comp)
     {
         static_assert(sizeof(comp) >= sizeof(T) * 3, "Size of comp has to be of at least three (3) components.");
-        Detail::construct_vec3<T, S>::map(*this, comp);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec3<T, false>::map(*this, comp);
+        }
+        else
+        {
+            Detail::construct_vec3<T, S>::map(*this, comp);
+        }
     }
 
 
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator+=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S>& operator+=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
-        Detail::compute_vec3_add<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_add<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_add<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator+=(TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S>& operator+=(TVector3<T, S>& v1, T s)
     {
-        Detail::compute_vec3_add<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_add<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_add<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator-=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S>& operator-=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
-        Detail::compute_vec3_sub<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_sub<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_sub<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator-=(TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S>& operator-=(TVector3<T, S>& v1, T s)
     {
-        Detail::compute_vec3_sub<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_sub<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_sub<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator*=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S>& operator*=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
-        Detail::compute_vec3_mul<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_mul<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_mul<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator*=(TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S>& operator*=(TVector3<T, S>& v1, T s)
     {
-        Detail::compute_vec3_mul<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_mul<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_mul<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator/=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S>& operator/=(TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
-        Detail::compute_vec3_div<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_div<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_div<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& operator/=(TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S>& operator/=(TVector3<T, S>& v1, T s)
     {
-        Detail::compute_vec3_div<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_div<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_div<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator+(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S> operator+(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_add<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_add<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_add<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator+(const TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S> operator+(const TVector3<T, S>& v1, T s)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_add<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_add<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_add<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator-(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S> operator-(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_sub<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_sub<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_sub<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator-(const TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S> operator-(const TVector3<T, S>& v1, T s)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_sub<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_sub<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_sub<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator-(T s, const TVector3<T, S>& v1)
+    constexpr TVector3<T, S> operator-(T s, const TVector3<T, S>& v1)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_sub<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_sub<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec3_sub<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator*(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S> operator*(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_mul<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_mul<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_mul<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator*(const TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S> operator*(const TVector3<T, S>& v1, T s)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_mul<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_mul<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_mul<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S> operator/(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_div<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_div<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_div<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/(const TVector3<T, S>& v1, T s)
+    constexpr TVector3<T, S> operator/(const TVector3<T, S>& v1, T s)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_div<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_div<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec3_div<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S> operator/(T s, const TVector3<T, S>& v1)
+    constexpr TVector3<T, S> operator/(T s, const TVector3<T, S>& v1)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_div<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_div<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec3_div<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     // Comparision
 
     template<RealType T, bool S>
-    bool operator==(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr bool operator==(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec3_eq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec3_eq<T, S>::map(v1, v2);
     }
 
     template<RealType T, bool S>
-    bool operator!=(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr bool operator!=(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec3_ieq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec3_ieq<T, S>::map(v1, v2);
     }
 
@@ -223,17 +387,31 @@ namespace Phanes::Core::Math
     // Other
 
     template<RealType T, bool S>
-    TVector3<T, S> CrossP(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S> CrossP(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
         TVector3<T, S> r;
-        Detail::compute_vec3_cross_p<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_cross_p<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_cross_p<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector3<T, S>& CrossPV(TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr TVector3<T, S>& CrossPV(TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
-        Detail::compute_vec3_cross_p<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec3_cross_p<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec3_cross_p<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
@@ -244,14 +422,49 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    inline T SqrMagnitude(const TVector3<T, S>& v1)
+    T Angle(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    {
+        return Detail::compute_vec3_angle<T, S>::map(v1, v2);
+    }
+
+    template<bool R, RealType T, bool S>
+    inline T FastMagnitude(const TVector3<T, S>& v1)
+    {
+        return Detail::compute_vec3_fast_mag<T, S>::template map<R>(v1);
+    }
+
+    template<bool R, RealType T, bool S>
+    TVector3<T, S> FastNormalize(const TVector3<T, S>& v1)
+    {
+        TVector3<T, S> r;
+        Detail::compute_vec3_fast_norm<T, S>::template map<R>(r, v1);
+        return r;
+    }
+
+    template<bool R, RealType T, bool S>
+    TVector3<T, S>& FastNormalizeV(TVector3<T, S>& v1)
+    {
+        Detail::compute_vec3_fast_norm<T, S>::template map<R>(v1, v1);
+        return v1;
+    }
+
+    template<RealType T, bool S>
+    constexpr T SqrMagnitude(const TVector3<T, S>& v1)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec3_dotp<T, false>::map(v1, v1);
+        }
         return Detail::compute_vec3_dotp<T, S>::map(v1, v1);
     }
 
     template<RealType T, bool S>
-    inline T DotP(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
+    constexpr T DotP(const TVector3<T, S>& v1, const TVector3<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec3_dotp<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec3_dotp<T, S>::map(v1, v2);
     }
 
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/MathCommon.hpp"
+#include "Core/Math/MathFwd.h"
+
+#ifndef VECTOR3_SOA_H
+#define VECTOR3_SOA_H
+
+namespace Phanes::Core::Math {
+
+    // Structure of arrays of 3D vectors (x[], y[], z[])
+
+    template<RealType T>
+    struct TVector3SoA {
+    public:
+
+        using Real = T;
+
+        /// <summary>
+        /// Number of elements every stream is padded to. Batch kernels process whole registers and never need a scalar tail.
+        /// </summary>
+        static constexpr size_t Lanes = 8;
+
+        /// <summary>
+        /// Alignment of every stream in bytes.
+        /// </summary>
+        static constexpr size_t Alignment = 32;
+
+        /// <summary>
+        /// X components
+        /// </summary>
+        Real* x = nullptr;
+
+        /// <summary>
+        /// Y components
+        /// </summary>
+        Real* y = nullptr;
+
+        /// <summary>
+        /// Z components
+        /// </summary>
+        Real* z = nullptr;
+
+    public:
+
+        /// <summary>
+        /// Default constructor. Creates an empty container.
+        /// </summary>
+        TVector3SoA() = default;
+
+        /// <summary>
+        /// Creates n zero vectors.
+        /// </summary>
+        /// <param name="n">Number of vectors</param>
+        explicit TVector3SoA(size_t n);
+
+        /// <summary>
+        /// Copy constructor.
+        /// </summary>
+        /// <param name="v"></param>
+        TVector3SoA(const TVector3SoA<T>& v);
+
+        /// <summary>
+        /// Move constructor.
+        /// </summary>
+        /// <param name="v"></param>
+        TVector3SoA(TVector3SoA<T>&& v) noexcept;
+
+        ~TVector3SoA();
+
+        TVector3SoA<T>& operator= (const TVector3SoA<T>& v);
+
+        TVector3SoA<T>& operator= (TVector3SoA<T>&& v) noexcept;
+
+        /// <summary>
+        /// Number of vectors.
+        /// </summary>
+        FORCEINLINE size_t Size() const { return size; }
+
+        /// <summary>
+        /// Number of elements in each stream, including the padding.
+        /// </summary>
+        FORCEINLINE size_t PaddedSize() const { return (size + Lanes - 1) & ~(Lanes - 1); }
+
+        /// <summary>
+        /// Resizes the container. New vectors are zero.
+        /// </summary>
+        /// <param name="n">New number of vectors</param>
+        void Resize(size_t n);
+
+        /// <summary>
+        /// Reads vector i.
+        /// </summary>
+        /// <param name="i">Index</param>
+        template<bool S = false>
+        TVector3<T, S> Get(size_t i) const
+        {
+            return TVector3<T, S>(x[i], y[i], z[i]);
+        }
+
+        /// <summary>
+        /// Writes vector i.
+        /// </summary>
+        /// <param name="i">Index</param>
+        /// <param name="v">Vector</param>
+        template<bool S>
+        void Set(size_t i, const TVector3<T, S>& v)
+        {
+            x[i] = v.x;
+            y[i] = v.y;
+            z[i] = v.z;
+        }
+
+    private:
+
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+
+    // ================================== //
+    //   TVector3SoA batch operations   //
+    // ================================== //
+
+    /// <summary>
+    /// Componentwise addition. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1 or v2</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two, same size as v1</param>
+    template<RealType T>
+    void Add(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2);
+
+    /// <summary>
+    /// Componentwise substraction. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1 or v2</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two, same size as v1</param>
+    template<RealType T>
+    void Sub(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2);
+
+    /// <summary>
+    /// Scales all vectors by s. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1</param>
+    /// <param name="v1">Vectors</param>
+    /// <param name="s">Scalar</param>
+    template<RealType T>
+    void Scale(TVector3SoA<T>& r, const TVector3SoA<T>& v1, T s);
+
+    /// <summary>
+    /// Dot products of v1[i] and v2[i].
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Array of at least v1.Size() elements</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two, same size as v1</param>
+    template<RealType T>
+    void DotP(T* r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2);
+
+    /// <summary>
+    /// Cross products of v1[i] and v2[i]. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1 or v2</param>
+    /// <param name="v1">Vectors one</param>
+    /// <param name="v2">Vectors two, same size as v1</param>
+    template<RealType T>
+    void CrossP(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2);
+
+    /// <summary>
+    /// Magnitudes of all vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Array of at least v1.Size() elements</param>
+    /// <param name="v1">Vectors</param>
+    template<RealType T>
+    void Magnitude(T* r, const TVector3SoA<T>& v1);
+
+    /// <summary>
+    /// Normalizes all vectors. Vectors with a magnitude smaller than P_FLT_INAC are left as is. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1</param>
+    /// <param name="v1">Vectors</param>
+    template<RealType T>
+    void Normalize(TVector3SoA<T>& r, const TVector3SoA<T>& v1);
+
+    /// <summary>
+    /// Normalizes all vectors with the refined FastInvSqrt estimate (4 ULP for float). Vectors with a magnitude smaller than
+    /// P_FLT_INAC are left as is. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1</param>
+    /// <param name="v1">Vectors</param>
+    template<RealType T>
+    void FastNormalize(TVector3SoA<T>& r, const TVector3SoA<T>& v1);
+
+    /// <summary>
+    /// Linearly interpolates v1[i] to v2[i]. r is resized to the size of v1.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <param name="r">Result, may alias v1 or v2</param>
+    /// <param name="v1">Starting vectors</param>
+    /// <param name="v2">Destination vectors, same size as v1</param>
+    /// <param name="t">0.0 to 1.0 interpolation value</param>
+    template<RealType T>
+    void Lerp(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2, T t);
+
+    /// <summary>
+    /// Converts an array of vectors into r. r is resized to count.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Result</param>
+    /// <param name="v">Array of vectors</param>
+    /// <param name="count">Number of vectors</param>
+    template<RealType T, bool S>
+    void Gather(TVector3SoA<T>& r, const TVector3<T, S>* v, size_t count);
+
+    /// <summary>
+    /// Converts v back into an array of vectors.
+    /// </summary>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="S">Vector is aligned?</typeparam>
+    /// <param name="r">Array of at least v.Size() vectors</param>
+    /// <param name="v">Vectors</param>
+    template<RealType T, bool S>
+    void Scatter(TVector3<T, S>* r, const TVector3SoA<T>& v);
+
+} // Phanes::Core::Math
+
+#endif // !VECTOR3_SOA_H
+
+// Vector types are included after the declarations, so the SIMD backends they pull in see complete SoA types.
+#include "Core/Math/Vector3.hpp"
+#include "Core/Math/Vector4SoA.hpp"
+
+#include "Core/Math/Vector3SoA.inl"
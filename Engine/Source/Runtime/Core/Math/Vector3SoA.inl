@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/Vector3SoADecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <cstring>
+#include <new>
+
+
+namespace Phanes::Core::Math
+{
+    template<RealType T>
+    TVector3SoA<T>::TVector3SoA(size_t n)
+    {
+        Resize(n);
+    }
+
+    template<RealType T>
+    TVector3SoA<T>::TVector3SoA(const TVector3SoA<T>& v)
+    {
+        *this = v;
+    }
+
+    template<RealType T>
+    TVector3SoA<T>::TVector3SoA(TVector3SoA<T>&& v) noexcept
+    {
+        *this = std::move(v);
+    }
+
+    template<RealType T>
+    TVector3SoA<T>::~TVector3SoA()
+    {
+        if (x)
+        {
+            ::operator delete(x, std::align_val_t(Alignment));
+        }
+    }
+
+    template<RealType T>
+    TVector3SoA<T>& TVector3SoA<T>::operator=(const TVector3SoA<T>& v)
+    {
+        if (this != &v)
+        {
+            Resize(v.size);
+
+            std::memcpy(x, v.x, sizeof(T) * size);
+            std::memcpy(y, v.y, sizeof(T) * size);
+            std::memcpy(z, v.z, sizeof(T) * size);
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    TVector3SoA<T>& TVector3SoA<T>::operator=(TVector3SoA<T>&& v) noexcept
+    {
+        if (this != &v)
+        {
+            if (x)
+            {
+                ::operator delete(x, std::align_val_t(Alignment));
+            }
+
+            x = v.x;
+            y = v.y;
+            z = v.z;
+            size = v.size;
+            capacity = v.capacity;
+
+            v.x = v.y = v.z = nullptr;
+            v.size = v.capacity = 0;
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    void TVector3SoA<T>::Resize(size_t n)
+    {
+        size_t padded = (n + Lanes - 1) & ~(Lanes - 1);
+
+        if (padded > capacity)
+        {
+            // All three streams share one block.
+            T* block = static_cast<T*>(::operator new(sizeof(T) * padded * 3, std::align_val_t(Alignment)));
+            std::memset(block, 0, sizeof(T) * padded * 3);
+
+            if (x)
+            {
+                std::memcpy(block, x, sizeof(T) * size);
+                std::memcpy(block + padded, y, sizeof(T) * size);
+                std::memcpy(block + padded * 2, z, sizeof(T) * size);
+
+                ::operator delete(x, std::align_val_t(Alignment));
+            }
+
+            x = block;
+            y = block + padded;
+            z = block + padded * 2;
+            capacity = padded;
+        }
+        else if (x)
+        {
+            // The padding has to stay zero, also when shrinking, as the batch kernels run on PaddedSize().
+            size_t first = (n < size) ? n : size;
+
+            std::memset(x + first, 0, sizeof(T) * (padded - first));
+            std::memset(y + first, 0, sizeof(T) * (padded - first));
+            std::memset(z + first, 0, sizeof(T) * (padded - first));
+        }
+
+        size = n;
+    }
+
+
+    template<RealType T>
+    void Add(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, n);
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, n);
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, n);
+    }
+
+    template<RealType T>
+    void Sub(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, n);
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, n);
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, n);
+    }
+
+    template<RealType T>
+    void Scale(TVector3SoA<T>& r, const TVector3SoA<T>& v1, T s)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, s, n);
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, s, n);
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, s, n);
+    }
+
+    template<RealType T>
+    void DotP(T* r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2)
+    {
+        Detail::compute_vec3soa_dotp<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v2, v1.Size());
+    }
+
+    template<RealType T>
+    void CrossP(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2)
+    {
+        r.Resize(v1.Size());
+        Detail::compute_vec3soa_cross_p<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v2, v1.PaddedSize());
+    }
+
+    template<RealType T>
+    void Magnitude(T* r, const TVector3SoA<T>& v1)
+    {
+        Detail::compute_vec3soa_mag<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v1.Size());
+    }
+
+    template<RealType T>
+    void Normalize(TVector3SoA<T>& r, const TVector3SoA<T>& v1)
+    {
+        r.Resize(v1.Size());
+        Detail::compute_vec3soa_norm<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v1.PaddedSize());
+    }
+
+    template<RealType T>
+    void FastNormalize(TVector3SoA<T>& r, const TVector3SoA<T>& v1)
+    {
+        r.Resize(v1.Size());
+        Detail::compute_vec3soa_fast_norm<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v1.PaddedSize());
+    }
+
+    template<RealType T>
+    void Lerp(TVector3SoA<T>& r, const TVector3SoA<T>& v1, const TVector3SoA<T>& v2, T t)
+    {
+        t = Clamp(t, (T)0.0, (T)1.0);
+
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, t, n);
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, t, n);
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, t, n);
+    }
+
+    template<RealType T, bool S>
+    void Gather(TVector3SoA<T>& r, const TVector3<T, S>* v, size_t count)
+    {
+        r.Resize(count);
+        Detail::compute_vec3soa_gather<T, SIMD::use_simd<T, 4, S>::value>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Scatter(TVector3<T, S>* r, const TVector3SoA<T>& v)
+    {
+        Detail::compute_vec3soa_scatter<T, SIMD::use_simd<T, 4, S>::value>::map(r, v, v.Size());
+    }
+}
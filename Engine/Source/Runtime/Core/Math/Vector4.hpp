@@ -69,7 +69,7 @@ namespace Phanes::Core::Math
         /// <para>x,y,z,w = s</para>
         /// </summary>
         /// <param name="s">Scalar</param>
-        TVector4(Real s);
+        constexpr TVector4(Real s);
 
         /// <summary>
         /// Construct vector from x, y, z, w components.
@@ -78,7 +78,7 @@ namespace Phanes::Core::Math
         /// <param name="_y">Y component</param>
         /// <param name="_z">Z component</param>
         /// <param name="_w">W component</param>
-        TVector4(Real _x, Real _y, Real _z, Real _w);
+        constexpr TVector4(Real _x, Real _y, Real _z, Real _w);
 
         /// <summary>
         /// Construct vector from two 2d vectors like: 
@@ -87,20 +87,20 @@ namespace Phanes::Core::Math
         /// </summary>
         /// <param name="v1">TVector2 one</param>
         /// <param name="v2">TVector2 two</param>
-        TVector4(const TVector2<Real, S>& v1, const TVector2<Real, S>& v2);
+        constexpr TVector4(const TVector2<Real, S>& v1, const TVector2<Real, S>& v2);
 
         /// <summary>
         /// Construct vector from 3d vector (x,y,z) and w
         /// </summary>
         /// <param name="v1">TVector3</param>
         /// <param name="w">W</param>
-        TVector4(const TVector3<Real, S>& v1, Real w);
+        constexpr TVector4(const TVector3<Real, S>& v1, Real w);
 
         /// <summary>
         /// Construct vector from array of components
         /// </summary>
         /// <param name="comp">Array of at least 4 components</param>
-        TVector4(const Real* comp);
+        constexpr TVector4(const Real* comp);
 
     };
 
@@ -119,7 +119,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator+= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S>& operator+= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
     
     /// <summary>
     /// Vector - scalar addition.
@@ -130,7 +130,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator+= (TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S>& operator+= (TVector4<T, S>& v1, T s);
 
     /// <summary>
     /// Vector substraction.
@@ -141,7 +141,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator-= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S>& operator-= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar substraction.
@@ -152,7 +152,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator-= (TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S>& operator-= (TVector4<T, S>& v1, T s);
 
     /// <summary>
     /// Vector - scalar multiplication.
@@ -163,7 +163,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator*= (TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S>& operator*= (TVector4<T, S>& v1, T s);
 
     /// <summary>
     /// Scale vector by another vector componentwise.
@@ -174,7 +174,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator*= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S>& operator*= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar division.
@@ -185,7 +185,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator/= (TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S>& operator/= (TVector4<T, S>& v1, T s);
 
     /// <summary>
     /// Coponentwise vector division.
@@ -196,7 +196,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Copy of v1.</returns>
     template<RealType T, bool S>
-    TVector4<T, S>& operator/= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S>& operator/= (TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
 
 
@@ -211,7 +211,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator+ (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S> operator+ (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar addition.
@@ -222,7 +222,7 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator+ (const TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S> operator+ (const TVector4<T, S>& v1, T s);
 
     /// <summary>
     /// Vector substraction.
@@ -233,7 +233,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator- (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S> operator- (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar substraction.
@@ -244,10 +244,10 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator- (const TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S> operator- (const TVector4<T, S>& v1, T s);
 
     template<RealType T, bool S>
-    TVector4<T, S> operator- (T s, const TVector4<T, S>& v1);
+    constexpr TVector4<T, S> operator- (T s, const TVector4<T, S>& v1);
 
     /// <summary>
     /// Vector - scalar multiplication.
@@ -258,10 +258,10 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator* (const TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S> operator* (const TVector4<T, S>& v1, T s);
 
     template<RealType T, bool S>
-    FORCEINLINE TVector4<T, S> operator* (T s, const TVector4<T, S>& v1) { return v1 * s; };
+    FORCEINLINE constexpr TVector4<T, S> operator* (T s, const TVector4<T, S>& v1) { return v1 * s; };
 
     /// <summary>
     /// Scale vector by another vector componentwise.
@@ -272,7 +272,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator* (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S> operator* (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Vector - scalar division.
@@ -283,10 +283,10 @@ namespace Phanes::Core::Math
     /// <param name="s">Scalar</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator/ (const TVector4<T, S>& v1, T s);
+    constexpr TVector4<T, S> operator/ (const TVector4<T, S>& v1, T s);
 
     template<RealType T, bool S>
-    FORCEINLINE TVector4<T, S> operator/ (T s, const TVector4<T, S>& v1);
+    constexpr TVector4<T, S> operator/ (T s, const TVector4<T, S>& v1);
 
     /// <summary>
     /// Componentwise vector division.
@@ -297,7 +297,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Computed vector.</returns>
     template<RealType T, bool S>
-    TVector4<T, S> operator/ (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr TVector4<T, S> operator/ (const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
 
 
@@ -312,7 +312,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns><code>True</code>, if equal and <code>false</code> if not.</returns>
     template<RealType T, bool S>
-    bool operator==(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr bool operator==(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
 
     /// <summary>
@@ -324,7 +324,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns><code>True</code>, if inequal and <code>false</code> if equal.</returns>
     template<RealType T, bool S>
-    bool operator!=(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr bool operator!=(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
 
     
@@ -421,7 +421,7 @@ namespace Phanes::Core::Math
     /// <param name="v">Vector</param>
     /// <returns>Square of magnitude of vector.</returns>
     template<RealType T, bool S>
-    T SqrMagnitude(const TVector4<T, S>& v);
+    constexpr T SqrMagnitude(const TVector4<T, S>& v);
 
     /// <summary>
     /// Get magnitude of vector.
@@ -452,10 +452,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns></returns>
     template<RealType T, bool S> 
-    T Angle(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
-    {
-        return acos(DotP(v1, v2) / (Magnitude(v1) * Magnitude(v2)));
-    }
+    T Angle(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Cosine of angle between two vectors.
@@ -536,6 +533,43 @@ namespace Phanes::Core::Math
         return v1;
     }
 
+    /// <summary>
+    /// Approximates the magnitude of a vector with FastInvSqrt.
+    /// </summary>
+    /// <remarks>Only the estimate (R = false) is approximated, see FastInvSqrt for the error bounds. A magnitude needs no division,
+    /// so the refined variant takes the exact square root, which is as fast. Double is exact.</remarks>
+    /// <typeparam name="R">Refine the estimate, which makes the result exact</typeparam>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <returns>Approximated magnitude of vector.</returns>
+    template<bool R = true, RealType T, bool S>
+    T FastMagnitude(const TVector4<T, S>& v1);
+
+    /// <summary>
+    /// Normalizes a vector with FastInvSqrt.
+    /// </summary>
+    /// <remarks>Float SIMD vectors use rsqrtps, see FastInvSqrt for the error bounds. Double is exact.</remarks>
+    /// <typeparam name="R">Refine the estimate with one Newton-Raphson step</typeparam>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <returns>Normalized vector</returns>
+    template<bool R = true, RealType T, bool S>
+    TVector4<T, S> FastNormalize(const TVector4<T, S>& v1);
+
+    /// <summary>
+    /// Normalizes a vector with FastInvSqrt.
+    /// </summary>
+    /// <remarks>Float SIMD vectors use rsqrtps, see FastInvSqrt for the error bounds. Double is exact.</remarks>
+    /// <typeparam name="R">Refine the estimate with one Newton-Raphson step</typeparam>
+    /// <typeparam name="T">Type of vector</typeparam>
+    /// <typeparam name="A">Vector is aligned?</typeparam>
+    /// <param name="v1">Vector</param>
+    /// <returns>Copy of v1.</returns>
+    template<bool R = true, RealType T, bool S>
+    TVector4<T, S>& FastNormalizeV(TVector4<T, S>& v1);
+
     /// <summary>
     /// Calculates the dot product between two vectors.
     /// </summary>
@@ -545,7 +579,7 @@ namespace Phanes::Core::Math
     /// <param name="v2">Vector two</param>
     /// <returns>Dot product between vectors.</returns>
     template<RealType T, bool S>
-    T DotP(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
+    constexpr T DotP(const TVector4<T, S>& v1, const TVector4<T, S>& v2);
 
     /// <summary>
     /// Gets componentwise max of both vectors.
@@ -7,187 +7,358 @@
 
 #include "Core/Math/SIMD/PhanesSIMDTypes.h"
 
+#include <type_traits>
+
 namespace Phanes::Core::Math
 {
     template<RealType T, bool S>
-    TVector4<T, S>::TVector4(Real _x, Real _y, Real _z, Real _w)
+    constexpr TVector4<T, S>::TVector4(Real _x, Real _y, Real _z, Real _w)
     {
-        Detail::construct_vec4<T, S>::map(*this, _x, _y, _z, _w);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec4<T, false>::map(*this, _x, _y, _z, _w);
+        }
+        else
+        {
+            Detail::construct_vec4<T, S>::map(*this, _x, _y, _z, _w);
+        }
     }
 
     template<RealType T, bool S>
-    Phanes::Core::Math::TVector4<T, S>::TVector4(Real s)
+    constexpr Phanes::Core::Math::TVector4<T, S>::TVector4(Real s)
     {
-        Detail::construct_vec4<T, S>::map(*this, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec4<T, false>::map(*this, s);
+        }
+        else
+        {
+            Detail::construct_vec4<T, S>::map(*this, s);
+        }
     }
 
     template<RealType T, bool S>
-    Phanes::Core::Math::TVector4<T, S>::TVector4(const TVector2<Real, S>& v1, const TVector2<Real, S>& v2)
+    constexpr Phanes::Core::Math::TVector4<T, S>::TVector4(const TVector2<Real, S>& v1, const TVector2<Real, S>& v2)
     {
-        Detail::construct_vec4<T, S>::map(*this, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec4<T, false>::map(*this, v1, v2);
+        }
+        else
+        {
+            Detail::construct_vec4<T, S>::map(*this, v1, v2);
+        }
     }
 
     template<RealType T, bool S>
-    Phanes::Core::Math::TVector4<T, S>::TVector4(const Real* comp)
+    constexpr Phanes::Core::Math::TVector4<T, S>::TVector4(const Real* comp)
     {
         static_assert(sizeof(comp) >= sizeof(T) * 4, "Size of comp has to be of at least four (4) components.");
-        Detail::construct_vec4<T, S>::map(*this, comp);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec4<T, false>::map(*this, comp);
+        }
+        else
+        {
+            Detail::construct_vec4<T, S>::map(*this, comp);
+        }
     }
 
     template<RealType T, bool S>
-    Phanes::Core::Math::TVector4<T, S>::TVector4(const TVector3<T, S>& v, T w)
+    constexpr Phanes::Core::Math::TVector4<T, S>::TVector4(const TVector3<T, S>& v, T w)
     {
-        Detail::construct_vec4<T, S>::map(*this, v, w);
+        if (std::is_constant_evaluated())
+        {
+            Detail::construct_vec4<T, false>::map(*this, v, w);
+        }
+        else
+        {
+            Detail::construct_vec4<T, S>::map(*this, v, w);
+        }
     }
 
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator+=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S>& operator+=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
-        Detail::compute_vec4_add<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_add<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_add<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator+=(TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S>& operator+=(TVector4<T, S>& v1, T s)
     {
-        Detail::compute_vec4_add<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_add<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_add<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator-=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S>& operator-=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
-        Detail::compute_vec4_sub<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_sub<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_sub<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator-=(TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S>& operator-=(TVector4<T, S>& v1, T s)
     {
-        Detail::compute_vec4_sub<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_sub<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_sub<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator*=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S>& operator*=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
-        Detail::compute_vec4_mul<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_mul<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_mul<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator*=(TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S>& operator*=(TVector4<T, S>& v1, T s)
     {
-        Detail::compute_vec4_mul<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_mul<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_mul<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator/=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S>& operator/=(TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
-        Detail::compute_vec4_div<T, S>::map(v1, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_div<T, false>::map(v1, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_div<T, S>::map(v1, v1, v2);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S>& operator/=(TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S>& operator/=(TVector4<T, S>& v1, T s)
     {
-        Detail::compute_vec4_div<T, S>::map(v1, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_div<T, false>::map(v1, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_div<T, S>::map(v1, v1, s);
+        }
         return v1;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator+(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S> operator+(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_add<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_add<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_add<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator+(const TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S> operator+(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_add<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_add<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_add<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator-(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S> operator-(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_sub<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_sub<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_sub<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator-(const TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S> operator-(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_sub<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_sub<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_sub<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator-(T s, const TVector4<T, S>& v1)
+    constexpr TVector4<T, S> operator-(T s, const TVector4<T, S>& v1)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_sub<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_sub<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec4_sub<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator*(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S> operator*(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_mul<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_mul<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_mul<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator*(const TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S> operator*(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_mul<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_mul<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_mul<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator/(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr TVector4<T, S> operator/(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_div<T, S>::map(r, v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_div<T, false>::map(r, v1, v2);
+        }
+        else
+        {
+            Detail::compute_vec4_div<T, S>::map(r, v1, v2);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator/(const TVector4<T, S>& v1, T s)
+    constexpr TVector4<T, S> operator/(const TVector4<T, S>& v1, T s)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_div<T, S>::map(r, v1, s);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_div<T, false>::map(r, v1, s);
+        }
+        else
+        {
+            Detail::compute_vec4_div<T, S>::map(r, v1, s);
+        }
         return r;
     }
 
     template<RealType T, bool S>
-    TVector4<T, S> operator/(T s, const TVector4<T, S>& v1)
+    constexpr TVector4<T, S> operator/(T s, const TVector4<T, S>& v1)
     {
         TVector4<T, S> r;
-        Detail::compute_vec4_div<T, S>::map(r, s, v1);
+        if (std::is_constant_evaluated())
+        {
+            Detail::compute_vec4_div<T, false>::map(r, s, v1);
+        }
+        else
+        {
+            Detail::compute_vec4_div<T, S>::map(r, s, v1);
+        }
         return r;
     }
 
     // Comparision
 
     template<RealType T, bool S>
-    bool operator==(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr bool operator==(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec4_eq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec4_eq<T, S>::map(v1, v2);
     }
 
     template<RealType T, bool S>
-    bool operator!=(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr bool operator!=(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec4_ieq<T, false>::map(v1, v2);
+        }
         return Detail::compute_vec4_ieq<T, S>::map(v1, v2);
     }
 
@@ -223,9 +394,13 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    T DotP(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    constexpr T DotP(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
     {
-        return Detail::compute_vec4_dotp<T, S> ::map(v1, v2);
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec4_dotp<T, false>::map(v1, v2);
+        }
+        return Detail::compute_vec4_dotp<T, S>::map(v1, v2);
     }
 
     template<RealType T, bool S>
@@ -241,8 +416,39 @@ namespace Phanes::Core::Math
     }
 
     template<RealType T, bool S>
-    T SqrMagnitude(const TVector4<T, S>& v)
+    T Angle(const TVector4<T, S>& v1, const TVector4<T, S>& v2)
+    {
+        return Detail::compute_vec4_angle<T, S>::map(v1, v2);
+    }
+
+    template<bool R, RealType T, bool S>
+    T FastMagnitude(const TVector4<T, S>& v1)
+    {
+        return Detail::compute_vec4_fast_mag<T, S>::template map<R>(v1);
+    }
+
+    template<bool R, RealType T, bool S>
+    TVector4<T, S> FastNormalize(const TVector4<T, S>& v1)
+    {
+        TVector4<T, S> r;
+        Detail::compute_vec4_fast_norm<T, S>::template map<R>(r, v1);
+        return r;
+    }
+
+    template<bool R, RealType T, bool S>
+    TVector4<T, S>& FastNormalizeV(TVector4<T, S>& v1)
+    {
+        Detail::compute_vec4_fast_norm<T, S>::template map<R>(v1, v1);
+        return v1;
+    }
+
+    template<RealType T, bool S>
+    constexpr T SqrMagnitude(const TVector4<T, S>& v)
     {
+        if (std::is_constant_evaluated())
+        {
+            return Detail::compute_vec4_dotp<T, false>::map(v, v);
+        }
         return Detail::compute_vec4_dotp<T, S>::map(v, v);
     }
 
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Core/Math/Boilerplate.h"
+
+#include "Core/Math/Detail/Vector4SoADecl.inl"
+#include "Core/Math/SIMD/SIMDIntrinsics.h"
+
+#include "Core/Math/SIMD/PhanesSIMDTypes.h"
+
+#include <cstring>
+#include <new>
+
+
+namespace Phanes::Core::Math
+{
+    template<RealType T>
+    TVector4SoA<T>::TVector4SoA(size_t n)
+    {
+        Resize(n);
+    }
+
+    template<RealType T>
+    TVector4SoA<T>::TVector4SoA(const TVector4SoA<T>& v)
+    {
+        *this = v;
+    }
+
+    template<RealType T>
+    TVector4SoA<T>::TVector4SoA(TVector4SoA<T>&& v) noexcept
+    {
+        *this = std::move(v);
+    }
+
+    template<RealType T>
+    TVector4SoA<T>::~TVector4SoA()
+    {
+        if (x)
+        {
+            ::operator delete(x, std::align_val_t(Alignment));
+        }
+    }
+
+    template<RealType T>
+    TVector4SoA<T>& TVector4SoA<T>::operator=(const TVector4SoA<T>& v)
+    {
+        if (this != &v)
+        {
+            Resize(v.size);
+
+            std::memcpy(x, v.x, sizeof(T) * size);
+            std::memcpy(y, v.y, sizeof(T) * size);
+            std::memcpy(z, v.z, sizeof(T) * size);
+            std::memcpy(w, v.w, sizeof(T) * size);
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    TVector4SoA<T>& TVector4SoA<T>::operator=(TVector4SoA<T>&& v) noexcept
+    {
+        if (this != &v)
+        {
+            if (x)
+            {
+                ::operator delete(x, std::align_val_t(Alignment));
+            }
+
+            x = v.x;
+            y = v.y;
+            z = v.z;
+            w = v.w;
+            size = v.size;
+            capacity = v.capacity;
+
+            v.x = v.y = v.z = v.w = nullptr;
+            v.size = v.capacity = 0;
+        }
+
+        return *this;
+    }
+
+    template<RealType T>
+    void TVector4SoA<T>::Resize(size_t n)
+    {
+        size_t padded = (n + Lanes - 1) & ~(Lanes - 1);
+
+        if (padded > capacity)
+        {
+            // All four streams share one block.
+            T* block = static_cast<T*>(::operator new(sizeof(T) * padded * 4, std::align_val_t(Alignment)));
+            std::memset(block, 0, sizeof(T) * padded * 4);
+
+            if (x)
+            {
+                std::memcpy(block, x, sizeof(T) * size);
+                std::memcpy(block + padded, y, sizeof(T) * size);
+                std::memcpy(block + padded * 2, z, sizeof(T) * size);
+                std::memcpy(block + padded * 3, w, sizeof(T) * size);
+
+                ::operator delete(x, std::align_val_t(Alignment));
+            }
+
+            x = block;
+            y = block + padded;
+            z = block + padded * 2;
+            w = block + padded * 3;
+            capacity = padded;
+        }
+        else if (x)
+        {
+            // The padding has to stay zero, also when shrinking, as the batch kernels run on PaddedSize().
+            size_t first = (n < size) ? n : size;
+
+            std::memset(x + first, 0, sizeof(T) * (padded - first));
+            std::memset(y + first, 0, sizeof(T) * (padded - first));
+            std::memset(z + first, 0, sizeof(T) * (padded - first));
+            std::memset(w + first, 0, sizeof(T) * (padded - first));
+        }
+
+        size = n;
+    }
+
+
+    template<RealType T>
+    void Add(TVector4SoA<T>& r, const TVector4SoA<T>& v1, const TVector4SoA<T>& v2)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, n);
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, n);
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, n);
+        Detail::compute_soa_add<T, SIMD::use_simd<T, 4, true>::value>::map(r.w, v1.w, v2.w, n);
+    }
+
+    template<RealType T>
+    void Sub(TVector4SoA<T>& r, const TVector4SoA<T>& v1, const TVector4SoA<T>& v2)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, n);
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, n);
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, n);
+        Detail::compute_soa_sub<T, SIMD::use_simd<T, 4, true>::value>::map(r.w, v1.w, v2.w, n);
+    }
+
+    template<RealType T>
+    void Scale(TVector4SoA<T>& r, const TVector4SoA<T>& v1, T s)
+    {
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, s, n);
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, s, n);
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, s, n);
+        Detail::compute_soa_scale<T, SIMD::use_simd<T, 4, true>::value>::map(r.w, v1.w, s, n);
+    }
+
+    template<RealType T>
+    void DotP(T* r, const TVector4SoA<T>& v1, const TVector4SoA<T>& v2)
+    {
+        Detail::compute_vec4soa_dotp<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v2, v1.Size());
+    }
+
+    template<RealType T>
+    void Magnitude(T* r, const TVector4SoA<T>& v1)
+    {
+        Detail::compute_vec4soa_mag<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v1.Size());
+    }
+
+    template<RealType T>
+    void Normalize(TVector4SoA<T>& r, const TVector4SoA<T>& v1)
+    {
+        r.Resize(v1.Size());
+        Detail::compute_vec4soa_norm<T, SIMD::use_simd<T, 4, true>::value>::map(r, v1, v1.PaddedSize());
+    }
+
+    template<RealType T>
+    void Lerp(TVector4SoA<T>& r, const TVector4SoA<T>& v1, const TVector4SoA<T>& v2, T t)
+    {
+        t = Clamp(t, (T)0.0, (T)1.0);
+
+        r.Resize(v1.Size());
+        size_t n = v1.PaddedSize();
+
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.x, v1.x, v2.x, t, n);
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.y, v1.y, v2.y, t, n);
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.z, v1.z, v2.z, t, n);
+        Detail::compute_soa_lerp<T, SIMD::use_simd<T, 4, true>::value>::map(r.w, v1.w, v2.w, t, n);
+    }
+
+    template<RealType T, bool S>
+    void Gather(TVector4SoA<T>& r, const TVector4<T, S>* v, size_t count)
+    {
+        r.Resize(count);
+        Detail::compute_vec4soa_gather<T, SIMD::use_simd<T, 4, S>::value>::map(r, v, count);
+    }
+
+    template<RealType T, bool S>
+    void Scatter(TVector4<T, S>* r, const TVector4SoA<T>& v)
+    {
+        Detail::compute_vec4soa_scatter<T, SIMD::use_simd<T, 4, S>::value>::map(r, v, v.Size());
+    }
+}
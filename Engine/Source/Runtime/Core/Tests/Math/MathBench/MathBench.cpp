@@ -0,0 +1,1215 @@
+// Micro benchmarks for the math library.
+//
+// Every benchmark is run for the SIMD register type selected by the build (PMath::*Reg*) and
+// for the plain FPU type. premake builds one MathBench_<backend> binary per SSE setting
+// (FPU, SSE, AVX, AVX2, Dispatch), run them side by side to compare backends.
+//
+// Usage: MathBench_<backend> [--json <file>] [--filter <text>]
+//   --json    Writes all results as JSON, e.g. to compare releases.
+//   --filter  Only runs benchmarks whose name contains text.
+
+#include "Core/Math/Include.h"
+#include "Core/Math/Archive.hpp"
+#include "Core/Math/MathFwd.h"
+
+#include "Core/Core.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PMath = Phanes::Core::Math;
+
+namespace
+{
+	template <typename T>
+	FORCEINLINE void DoNotOptimize(const T& value)
+	{
+		asm volatile("" : : "r,m"(value) : "memory");
+	}
+
+	struct BenchResult
+	{
+		std::string name;
+		size_t iterations;
+		double nsPerOp;
+		double itemsPerSecond;
+	};
+
+	std::vector<BenchResult> results;
+	const char* filter = nullptr;
+
+	/// <summary>
+	/// Runs fn(i) for every i in [0, iterations) and records the time per call. <br>
+	/// items is the number of elements one call processes, it only affects the reported throughput.
+	/// </summary>
+	template <typename Fn>
+	void Bench(const char* name, size_t iterations, Fn&& fn, size_t items = 1)
+	{
+		if (filter && !std::strstr(name, filter))
+		{
+			return;
+		}
+
+		// Warm up caches and branch predictors.
+		for (size_t i = 0; i < iterations / 10; ++i)
+		{
+			fn(i);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			fn(i);
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count() / (double)iterations;
+		double throughput = (double)items * 1e9 / ns;
+
+		std::printf("%-40s %12.3f ns/op %12.2f M/s\n", name, ns, throughput * 1e-6);
+		results.push_back({ name, iterations, ns, throughput });
+	}
+
+	constexpr size_t N = 1024;
+	constexpr size_t Iterations = 1 << 22;
+
+	template <typename M>
+	std::vector<M> MakeMatrices()
+	{
+		std::vector<M> r;
+		r.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			double f = (double)i * 0.001;
+			r.emplace_back(2.0 + f, 0.5, 1.0, 3.0,
+						   1.0, 3.0 - f, 0.0, 1.0,
+						   0.0, 1.0, 4.0 + f, 2.0,
+						   1.0, 0.0, 0.25, 1.0);
+		}
+		return r;
+	}
+
+	template <typename V>
+	std::vector<V> MakeVectors()
+	{
+		std::vector<V> r;
+		r.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			double f = (double)i * 0.001;
+			r.emplace_back(1.0 + f, 2.0 - f, 3.0 * f, 1.0);
+		}
+		return r;
+	}
+
+	template <typename V3, typename V4, typename M3, typename M4>
+	void BenchFloat(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<V3> v3s;
+		std::vector<V4> v4s;
+		std::vector<M3> m3s;
+		v3s.reserve(N);
+		v4s.reserve(N);
+		m3s.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			v3s.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+			v4s.emplace_back(1.0f + f, 2.0f - f, 3.0f * f, 1.0f);
+			m3s.emplace_back(2.0f + f, 0.5f, 1.0f,
+							 1.0f, 3.0f - f, 0.0f,
+							 0.0f, 1.0f, 4.0f + f);
+		}
+		std::vector<M4> m4s = MakeMatrices<M4>();
+
+		std::snprintf(name, sizeof(name), "Vector3 add %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(v3s[i % N] + v3s[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Vector3 dot %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::DotP(v3s[i % N], v3s[(i + 1) % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 cross %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::CrossP(v3s[i % N], v3s[(i + 1) % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 normalize %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Normalize(v3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 fast normalize %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::FastNormalize(v3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 fast normalize (estimate) %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::FastNormalize<false>(v3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 magnitude %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Magnitude(v3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector3 fast magnitude (estimate) %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::FastMagnitude<false>(v3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector4 add %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(v4s[i % N] + v4s[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Vector4 dot %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::DotP(v4s[i % N], v4s[(i + 1) % N])); });
+
+		std::snprintf(name, sizeof(name), "Vector4 normalize %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Normalize(v4s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Matrix3 * Matrix3 %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(m3s[i % N] * m3s[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Matrix3 determinant %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Determinant(m3s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Matrix3 inverse %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			M3 m = m3s[i % N];
+			PMath::InverseV(m);
+			DoNotOptimize(m);
+		});
+
+		std::vector<M3> m3r(N);
+		std::snprintf(name, sizeof(name), "Matrix3 inverse transpose batch %s (1k)", suffix);
+		Bench(name, Iterations / N, [&](size_t) {
+			PMath::InverseTranspose(m3r.data(), m3s.data(), N);
+			DoNotOptimize(m3r[0]);
+		}, N);
+
+		std::snprintf(name, sizeof(name), "Matrix4 * Vector4 %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(m4s[i % N] * v4s[i % N]); });
+
+		std::snprintf(name, sizeof(name), "Matrix4 * Matrix4 %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(m4s[i % N] * m4s[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Matrix4 determinant %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Determinant(m4s[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Matrix4 inverse %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			M4 m = m4s[i % N];
+			PMath::InverseV(m);
+			DoNotOptimize(m);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 inverse Ref %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			Phanes::Ref<M4> r = Phanes::MakeRef<M4>();
+			DoNotOptimize(PMath::Inverse(m4s[i % N], r));
+			DoNotOptimize(*r);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 inverse optional %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Inverse(m4s[i % N])); });
+
+		std::vector<M4> m4r(N);
+		std::snprintf(name, sizeof(name), "Matrix4 inverse span %s (1k)", suffix);
+		Bench(name, Iterations / N, [&](size_t) {
+			DoNotOptimize(PMath::Inverse(std::span<const M4>(m4s), m4r));
+			DoNotOptimize(m4r[0]);
+		}, N);
+	}
+
+	void BenchPlane()
+	{
+		std::vector<PMath::Plane> pls;
+		std::vector<PMath::Vector3> ps;
+		pls.reserve(N);
+		ps.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			pls.emplace_back(PMath::Normalize(PMath::Vector3(1.0f + f, 2.0f - f, 0.5f)), 3.0f * f);
+			ps.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		Bench("Plane point distance FPU", Iterations, [&](size_t i) { DoNotOptimize(PMath::PointDistance(pls[i % N], ps[i % N])); });
+
+		Bench("Plane normalize FPU", Iterations, [&](size_t i) {
+			PMath::Plane pl = pls[i % N] * 2.0f;
+			DoNotOptimize(PMath::PlaneNormalizeV(pl));
+		});
+
+		Bench("Plane fast normalize FPU", Iterations, [&](size_t i) {
+			PMath::Plane pl = pls[i % N] * 2.0f;
+			DoNotOptimize(PMath::PlaneFastNormalizeV(pl));
+		});
+
+		Bench("Planes intersect (3) Ref FPU", Iterations / 4, [&](size_t i) {
+			Phanes::Ref<PMath::Vector3> p = Phanes::MakeRef<PMath::Vector3>();
+			DoNotOptimize(PMath::PlanesIntersect3(pls[i % N], pls[(i + 7) % N], pls[(i + 13) % N], p));
+			DoNotOptimize(*p);
+		});
+
+		Bench("Planes intersect (3) optional FPU", Iterations / 4, [&](size_t i) {
+			DoNotOptimize(PMath::PlanesIntersect3(pls[i % N], pls[(i + 7) % N], pls[(i + 13) % N]));
+		});
+
+		std::vector<PMath::TRay<float, false>> rays;
+		rays.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			rays.emplace_back(PMath::Vector3(0.5f - f, 1.0f, f), PMath::Vector3(f, -2.0f, 1.0f));
+		}
+
+		Bench("Plane ray intersect Ref FPU", Iterations, [&](size_t i) {
+			Phanes::Ref<PMath::Vector3> p = Phanes::MakeRef<PMath::Vector3>();
+			DoNotOptimize(PMath::RayIntersect(pls[i % N], rays[i % N], p));
+			DoNotOptimize(*p);
+		});
+
+		Bench("Plane ray intersect FPU", Iterations, [&](size_t i) { DoNotOptimize(PMath::RayIntersect(pls[i % N], rays[i % N])); });
+
+		std::vector<PMath::PlaneHit> hits(N);
+		Bench("Plane ray intersect span FPU (1k)", Iterations / N, [&](size_t i) {
+			DoNotOptimize(PMath::RayIntersect(pls[i % N], rays, hits));
+			DoNotOptimize(hits[0]);
+		}, N);
+	}
+
+	template <typename V, typename M>
+	void BenchDouble(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<V> vs = MakeVectors<V>();
+		std::vector<M> ms = MakeMatrices<M>();
+
+		std::snprintf(name, sizeof(name), "Vector4d add %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(vs[i % N] + vs[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Vector4d dot %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::DotP(vs[i % N], vs[(i + 1) % N])); });
+
+		std::snprintf(name, sizeof(name), "Matrix4d * Vector4d %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(ms[i % N] * vs[i % N]); });
+
+		std::snprintf(name, sizeof(name), "Matrix4d * Matrix4d %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(ms[i % N] * ms[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Matrix4d determinant %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Determinant(ms[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Matrix4d inverse %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			M m = ms[i % N];
+			PMath::InverseV(m);
+			DoNotOptimize(m);
+		});
+	}
+
+	constexpr size_t Particles = 100000;
+
+	/// <summary>
+	/// Compares per vector operations on an array of Vector3Reg to the TVector3SoA batch operations. Times are per batch of Particles vectors.
+	/// </summary>
+	void BenchSoA()
+	{
+		std::vector<PMath::Vector3Reg> aos;
+		aos.reserve(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			aos.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		std::vector<PMath::Vector3Reg> aosOut(Particles);
+		std::vector<float> mags(Particles);
+
+		PMath::Vector3SoA soa;
+		PMath::Gather(soa, aos.data(), Particles);
+		PMath::Vector3SoA soaOut(Particles);
+
+		Bench("Vector3 add AoS (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				aosOut[i] = aos[i] + aos[i];
+			}
+			DoNotOptimize(aosOut[0]);
+		}, Particles);
+		Bench("Vector3 add SoA (100k)", 200, [&](size_t) {
+			PMath::Add(soaOut, soa, soa);
+			DoNotOptimize(soaOut.x[0]);
+		}, Particles);
+
+		Bench("Vector3 magnitude AoS (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				mags[i] = PMath::Magnitude(aos[i]);
+			}
+			DoNotOptimize(mags[0]);
+		}, Particles);
+		Bench("Vector3 magnitude SoA (100k)", 200, [&](size_t) {
+			PMath::Magnitude(mags.data(), soa);
+			DoNotOptimize(mags[0]);
+		}, Particles);
+
+		Bench("Vector3 normalize AoS (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				aosOut[i] = PMath::Normalize(aos[i]);
+			}
+			DoNotOptimize(aosOut[0]);
+		}, Particles);
+		Bench("Vector3 normalize SoA (100k)", 200, [&](size_t) {
+			PMath::Normalize(soaOut, soa);
+			DoNotOptimize(soaOut.x[0]);
+		}, Particles);
+		Bench("Vector3 fast normalize SoA (100k)", 200, [&](size_t) {
+			PMath::FastNormalize(soaOut, soa);
+			DoNotOptimize(soaOut.x[0]);
+		}, Particles);
+
+		Bench("Vector3 gather + scatter (100k)", 200, [&](size_t) {
+			PMath::Gather(soaOut, aos.data(), Particles);
+			PMath::Scatter(aosOut.data(), soaOut);
+			DoNotOptimize(aosOut[0]);
+		}, Particles);
+	}
+	/// <summary>
+	/// Compares a loop of Matrix4 * Vector4 to the batch transforms. Times are per batch of Particles vectors.
+	/// </summary>
+	void BenchTransform()
+	{
+		PMath::Matrix4Reg m(2.0f, 0.5f, 1.0f, 3.0f,
+							1.0f, 3.0f, 0.0f, 1.0f,
+							0.0f, 1.0f, 4.0f, 2.0f,
+							0.0f, 0.0f, 0.0f, 1.0f);
+
+		std::vector<PMath::Vector3Reg> v;
+		v.reserve(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			v.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		std::vector<PMath::Vector3Reg> r(Particles);
+
+		PMath::Vector3SoA soa;
+		PMath::Gather(soa, v.data(), Particles);
+		PMath::Vector3SoA soaOut(Particles);
+
+		Bench("Matrix4 * point loop (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				PMath::Vector4Reg p = m * PMath::Vector4Reg(v[i].x, v[i].y, v[i].z, 1.0f);
+				r[i] = PMath::Vector3Reg(p.x, p.y, p.z);
+			}
+			DoNotOptimize(r[0]);
+		}, Particles);
+		Bench("TransformPoints span (100k)", 200, [&](size_t) {
+			PMath::TransformPoints(m, v, r);
+			DoNotOptimize(r[0]);
+		}, Particles);
+		Bench("TransformPoints SoA (100k)", 200, [&](size_t) {
+			PMath::TransformPoints(m, soa, soaOut);
+			DoNotOptimize(soaOut.x[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Quaternion products, rotations and slerp. The batch slerp time is per batch of Particles quaternions.
+	/// </summary>
+	template <typename Q, typename V3>
+	void BenchQuaternion(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<Q> qs;
+		std::vector<Q> qs2;
+		std::vector<V3> vs;
+		qs.reserve(Particles);
+		qs2.reserve(Particles);
+		vs.reserve(N);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			qs.push_back(PMath::Normalize(Q(1.0f + f, 2.0f - f, 3.0f * f, 1.0f)));
+			qs2.push_back(PMath::Normalize(Q(-f, 1.0f, 0.5f, 2.0f - f)));
+		}
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			vs.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		std::snprintf(name, sizeof(name), "Quaternion mul %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(qs[i % N] * qs[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Quaternion rotate %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(qs[i % N] * vs[i % N]); });
+
+		std::snprintf(name, sizeof(name), "Quaternion slerp %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Slerp(qs[i % N], qs2[i % N], 0.3f)); });
+
+		std::snprintf(name, sizeof(name), "Quaternion from euler %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(Q(vs[i % N])); });
+
+		std::vector<Q> r(Particles);
+		std::snprintf(name, sizeof(name), "Quaternion slerp loop %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				r[i] = PMath::Slerp(qs[i], qs2[i], 0.3f);
+			}
+			DoNotOptimize(r[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Quaternion slerp batch %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Slerp(r.data(), qs.data(), qs2.data(), 0.3f, Particles);
+			DoNotOptimize(r[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// TTransform composition, inverse and point transforms. Compare with "Matrix4 * Matrix4" and "Matrix4 inverse".
+	/// </summary>
+	template <typename Tr, typename Q, typename V3>
+	void BenchAffine(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<Tr> trs;
+		std::vector<V3> vs;
+		trs.reserve(N);
+		vs.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			trs.emplace_back(PMath::Normalize(Q(1.0f + f, 2.0f - f, 3.0f * f, 1.0f)), V3(1.0f + f, 2.0f - f, 3.0f * f), V3(1.0f + f));
+			vs.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		std::snprintf(name, sizeof(name), "Transform compose %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(trs[i % N] * trs[(i + 1) % N]); });
+
+		std::snprintf(name, sizeof(name), "Transform inverse %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::Inverse(trs[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Transform point %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::TransformPoint(trs[i % N], vs[i % N])); });
+
+		std::snprintf(name, sizeof(name), "Transform to Matrix4 %s", suffix);
+		Bench(name, Iterations, [&](size_t i) { DoNotOptimize(PMath::ToMatrix4(trs[i % N])); });
+	}
+
+	/// <summary>
+	/// Frustum culling of Particles boxes and spheres, single tests in a loop against the batch overloads.
+	/// </summary>
+	template <typename F, typename M4, typename B, typename Sp, typename V3>
+	void BenchCulling(const char* suffix)
+	{
+		char name[64];
+
+		// Perspective along +z, near 1 and far 100.
+		F f(M4(1.0f, 0.0f, 0.0f, 0.0f,
+			   0.0f, 1.0f, 0.0f, 0.0f,
+			   0.0f, 0.0f, 100.0f / 99.0f, -100.0f / 99.0f,
+			   0.0f, 0.0f, 1.0f, 0.0f));
+
+		std::vector<B> boxes;
+		std::vector<Sp> spheres;
+		boxes.reserve(Particles);
+		spheres.reserve(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float x = (float)(i % 199) - 99.0f;
+			float y = (float)((i * 7) % 197) - 98.0f;
+			float z = (float)((i * 13) % 211) - 50.0f;
+			boxes.emplace_back(V3(x - 1.0f, y - 1.0f, z - 1.0f), V3(x + 1.0f, y + 1.0f, z + 1.0f));
+			spheres.emplace_back(x, y, z, 1.0f);
+		}
+
+		std::vector<Phanes::Core::Types::uint32> visible((Particles + 31) / 32);
+
+		std::snprintf(name, sizeof(name), "Frustum AABB loop %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			size_t count = 0;
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				count += PMath::IsVisible(f, boxes[i]);
+			}
+			DoNotOptimize(count);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Frustum AABB batch %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) { DoNotOptimize(PMath::IsVisible(f, boxes.data(), Particles, visible.data())); }, Particles);
+
+		std::snprintf(name, sizeof(name), "Frustum sphere loop %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			size_t count = 0;
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				count += PMath::IsVisible(f, spheres[i]);
+			}
+			DoNotOptimize(count);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Frustum sphere batch %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) { DoNotOptimize(PMath::IsVisible(f, spheres.data(), Particles, visible.data())); }, Particles);
+	}
+
+	/// <summary>
+	/// Ray packets against a box and a sphere. Time per Particles rays, compared with the scalar kernel.
+	/// </summary>
+	template <size_t L>
+	void BenchRayPacket(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<PMath::TRayPacket<float, L>> packets(Particles / L);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			packets[i / L].Set(i % L, PMath::TRay<float, false>(PMath::Vector3(1.0f, std::sin(f), std::cos(f)), PMath::Vector3(-10.0f, 0.0f, 0.0f)));
+		}
+
+		PMath::AABBReg box(PMath::Vector3Reg(-1.0f), PMath::Vector3Reg(1.0f));
+		PMath::SphereReg sphere(0.0f, 0.0f, 0.0f, 1.0f);
+		alignas(32) float t[L];
+
+		std::snprintf(name, sizeof(name), "RayPacket%zu AABB scalar (100k)", L);
+		Bench(name, 200, [&](size_t) {
+			Phanes::Core::Types::uint32 hits = 0;
+			for (const auto& p : packets)
+			{
+				hits += PMath::Detail::compute_packet_aabb<float, L, false>::map(p, -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, t);
+			}
+			DoNotOptimize(hits);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "RayPacket%zu AABB %s (100k)", L, suffix);
+		Bench(name, 200, [&](size_t) {
+			Phanes::Core::Types::uint32 hits = 0;
+			for (const auto& p : packets)
+			{
+				hits += PMath::RayIntersect(box, p, t);
+			}
+			DoNotOptimize(hits);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "RayPacket%zu sphere scalar (100k)", L);
+		Bench(name, 200, [&](size_t) {
+			Phanes::Core::Types::uint32 hits = 0;
+			for (const auto& p : packets)
+			{
+				hits += PMath::Detail::compute_packet_sphere<float, L, false>::map(p, 0.0f, 0.0f, 0.0f, 1.0f, t);
+			}
+			DoNotOptimize(hits);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "RayPacket%zu sphere %s (100k)", L, suffix);
+		Bench(name, 200, [&](size_t) {
+			Phanes::Core::Types::uint32 hits = 0;
+			for (const auto& p : packets)
+			{
+				hits += PMath::RayIntersect(sphere, p, t);
+			}
+			DoNotOptimize(hits);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Nearest hit of one ray in 10k triangles, batch kernel against the scalar loop. Time per ray, rate in triangles.
+	/// </summary>
+	void BenchTriangles(const char* suffix)
+	{
+		char name[64];
+
+		constexpr size_t Triangles = 10000;
+
+		PMath::TriangleSoA tris(Triangles);
+		for (size_t i = 0; i < Triangles; ++i)
+		{
+			float x = (float)(i % 100) - 50.0f;
+			float y = (float)(i / 100) - 50.0f;
+			float z = (float)((i * 7) % 13);
+			tris.Set(i, PMath::Triangle(PMath::Vector3(x, y, z), PMath::Vector3(x + 1.0f, y, z), PMath::Vector3(x, y + 1.0f, z + 0.5f)));
+		}
+
+		std::vector<PMath::TRay<float, false>> rays;
+		rays.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.01f;
+			rays.emplace_back(PMath::Vector3(std::sin(f) * 0.1f, std::cos(f) * 0.1f, 1.0f), PMath::Vector3(std::sin(f) * 40.0f, std::cos(f) * 40.0f, -10.0f));
+		}
+
+		PMath::TriangleHit hit;
+
+		Bench("Ray vs 10k triangles scalar", 2000, [&](size_t i) {
+			const PMath::TRay<float, false>& r = rays[i % N];
+			DoNotOptimize(PMath::Detail::compute_ray_triangles<float, false>::map(hit, tris, r.origin.x, r.origin.y, r.origin.z,
+																				   r.direction.x, r.direction.y, r.direction.z,
+																				   std::numeric_limits<float>::infinity()));
+		}, Triangles);
+
+		std::snprintf(name, sizeof(name), "Ray vs 10k triangles %s", suffix);
+		Bench(name, 2000, [&](size_t i) { DoNotOptimize(PMath::RayIntersect(tris, rays[i % N], hit)); }, Triangles);
+	}
+
+	void BenchBVH()
+	{
+		constexpr size_t Triangles = 100000;
+
+		// Triangle soup on a wavy sheet, bounds and triangles share the index.
+		std::vector<PMath::Triangle> tris;
+		std::vector<PMath::AABB> bounds;
+		tris.reserve(Triangles);
+		bounds.reserve(Triangles);
+
+		for (size_t i = 0; i < Triangles; ++i)
+		{
+			float x = (float)(i % 316) - 158.0f;
+			float y = (float)(i / 316) - 158.0f;
+			float z = std::sin(x * 0.1f) * std::cos(y * 0.1f) * 10.0f;
+
+			PMath::Triangle t(PMath::Vector3(x, y, z), PMath::Vector3(x + 1.0f, y, z + 0.3f), PMath::Vector3(x, y + 1.0f, z - 0.3f));
+			tris.push_back(t);
+			bounds.emplace_back(PMath::Vector3(x, y, z - 0.3f), PMath::Vector3(x + 1.0f, y + 1.0f, z + 0.3f));
+		}
+
+		PMath::BVH bvh;
+
+		Bench("BVH build 100k serial", 5, [&](size_t) { PMath::Build(bvh, bounds.data(), Triangles, 1); }, Triangles);
+		Bench("BVH build 100k parallel", 5, [&](size_t) { PMath::Build(bvh, bounds.data(), Triangles); }, Triangles);
+		Bench("BVH refit 100k", 20, [&](size_t) { PMath::Refit(bvh, bounds.data()); }, Triangles);
+
+		std::vector<PMath::TRay<float, false>> rays;
+		rays.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.01f;
+			rays.emplace_back(PMath::Normalize(PMath::Vector3(std::sin(f), std::cos(f * 0.7f), -0.8f)), PMath::Vector3(std::sin(f * 0.3f) * 100.0f, std::cos(f * 0.3f) * 100.0f, 30.0f));
+		}
+
+		Bench("BVH ray cast 100k triangles", Iterations / 10, [&](size_t i) {
+			const PMath::TRay<float, false>& r = rays[i % N];
+			float tMax = std::numeric_limits<float>::infinity();
+
+			DoNotOptimize(PMath::RayCast(bvh, r, tMax, [&](Phanes::Core::Types::uint32 p, float& tBest) {
+				PMath::TriangleHit hit;
+				if (PMath::RayIntersect(tris[p], r, hit) && hit.t < tBest)
+				{
+					tBest = hit.t;
+					return true;
+				}
+				return false;
+			}));
+		});
+
+		Bench("BVH box query 100k", Iterations / 10, [&](size_t i) {
+			const PMath::TRay<float, false>& r = rays[i % N];
+			size_t found = 0;
+
+			PMath::Query(bvh, PMath::AABB(r.origin - PMath::Vector3(2.0f, 2.0f, 40.0f), r.origin + PMath::Vector3(2.0f)),
+						 [&](Phanes::Core::Types::uint32) { found++; });
+			DoNotOptimize(found);
+		});
+	}
+
+	/// <summary>
+	/// Binning 200k agents and radius queries, against a std::unordered_map grid of index vectors.
+	/// </summary>
+	void BenchSpatialHash(const char* suffix)
+	{
+		constexpr size_t Agents = 200000;
+		constexpr float CellSize = 4.0f;
+
+		char name[64];
+
+		std::vector<PMath::Vector3Reg> ps(Agents);
+		Phanes::Core::Types::uint32 seed = 1;
+		auto rnd = [&seed]() { seed = seed * 1664525u + 1013904223u; return (float)(seed >> 8) / (float)(1u << 24); };
+		for (size_t i = 0; i < Agents; ++i)
+		{
+			float x = rnd(), y = rnd(), z = rnd();
+			ps[i] = PMath::Vector3Reg(x * 1000.0f, y * 1000.0f, z * 20.0f);
+		}
+
+		PMath::SpatialHashGrid grid;
+
+		std::snprintf(name, sizeof(name), "Spatial hash build 200k %s", suffix);
+		Bench(name, 20, [&](size_t) {
+			PMath::Build(grid, ps.data(), Agents, CellSize);
+			DoNotOptimize(grid.indices[0]);
+		}, Agents);
+
+		std::unordered_map<Phanes::Core::Types::uint64, std::vector<Phanes::Core::Types::uint32>> map;
+		auto mapKey = [](int x, int y, int z) { return PMath::Detail::grid_key(x, y, z); };
+
+		Bench("unordered_map grid build 200k", 20, [&](size_t) {
+			for (auto& c : map)
+			{
+				c.second.clear();
+			}
+
+			for (size_t i = 0; i < Agents; ++i)
+			{
+				PMath::IntVector3Reg c = PMath::PositionToCell(ps[i], 1.0f / CellSize);
+				map[mapKey(c.x, c.y, c.z)].push_back((Phanes::Core::Types::uint32)i);
+			}
+			DoNotOptimize(map.size());
+		}, Agents);
+
+		std::vector<PMath::SpatialHashRange> ranges;
+
+		std::snprintf(name, sizeof(name), "Spatial hash radius query %s", suffix);
+		Bench(name, Iterations / 10, [&](size_t i) {
+			ranges.clear();
+			size_t found = PMath::QueryRanges(grid, PMath::SphereReg(ps[i % Agents], CellSize), ranges);
+			DoNotOptimize(found);
+		});
+
+		Bench("unordered_map grid radius query", Iterations / 10, [&](size_t i) {
+			PMath::IntVector3Reg lo = PMath::PositionToCell(ps[i % Agents] - PMath::Vector3Reg(CellSize), 1.0f / CellSize);
+			PMath::IntVector3Reg hi = PMath::PositionToCell(ps[i % Agents] + PMath::Vector3Reg(CellSize), 1.0f / CellSize);
+			size_t found = 0;
+
+			for (int z = lo.z; z <= hi.z; z++)
+			{
+				for (int y = lo.y; y <= hi.y; y++)
+				{
+					for (int x = lo.x; x <= hi.x; x++)
+					{
+						auto it = map.find(mapKey(x, y, z));
+						found += (it != map.end()) ? it->second.size() : 0;
+					}
+				}
+			}
+			DoNotOptimize(found);
+		});
+	}
+
+	/// <summary>
+	/// Sin / Cos over 100k angles, span API against a libm loop.
+	/// </summary>
+	void BenchTranscendental(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<float> v(Particles), s(Particles), c(Particles);
+		std::vector<double> vd(Particles), sd(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			v[i] = ((float)i - 50000.0f) * 0.01f;
+			vd[i] = v[i];
+		}
+
+		Bench("std::sin loop (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				s[i] = std::sin(v[i]);
+			}
+			DoNotOptimize(s[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Sin span %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Sin<float>(s, v);
+			DoNotOptimize(s[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "SinCos span %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::SinCos<float>(s, c, v);
+			DoNotOptimize(c[0]);
+		}, Particles);
+
+		Bench("std::sin loop double (100k)", 200, [&](size_t) {
+			for (size_t i = 0; i < Particles; ++i)
+			{
+				sd[i] = std::sin(vd[i]);
+			}
+			DoNotOptimize(sd[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Sin span double %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Sin<double>(sd, vd);
+			DoNotOptimize(sd[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Half precision pack / unpack of 100k vectors (AoS) and of the x stream of a TVector3SoA.
+	/// </summary>
+	void BenchHalf(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<PMath::Vector3Reg> vs(Particles), rs(Particles);
+		std::vector<PMath::HalfVector3> hs(Particles);
+		std::vector<Phanes::Core::Types::uint16> hx(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			vs[i] = PMath::Vector3Reg(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+
+		PMath::Vector3SoA soa;
+		PMath::Gather(soa, vs.data(), Particles);
+
+		std::snprintf(name, sizeof(name), "Vector3 pack half %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Pack(hs.data(), vs.data(), Particles);
+			DoNotOptimize(hs[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Vector3 unpack half %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Unpack(rs.data(), hs.data(), Particles);
+			DoNotOptimize(rs[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "SoA stream pack half %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Pack<float>(hx, std::span<const float>(soa.x, Particles));
+			DoNotOptimize(hx[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "SoA stream unpack half %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Unpack<float>(std::span<float>(soa.x, Particles), hx);
+			DoNotOptimize(soa.x[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Octahedral encode / decode of 100k normals (AoS) and SNORM16 of the x stream of a TVector3SoA.
+	/// </summary>
+	void BenchNormals(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<PMath::Vector3Reg> vs(Particles), rs(Particles);
+		std::vector<PMath::OctNormal16> os(Particles);
+		std::vector<Phanes::Core::Types::int16> sx(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			float f = (float)i * 0.001f;
+			vs[i] = PMath::Vector3Reg(std::sin(f), std::cos(f * 3.0f), 0.5f - std::sin(f * 0.7f));
+		}
+
+		PMath::Vector3SoA soa;
+		PMath::Gather(soa, vs.data(), Particles);
+
+		std::snprintf(name, sizeof(name), "Vector3 pack oct16 %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Pack(os.data(), vs.data(), Particles);
+			DoNotOptimize(os[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Vector3 unpack oct16 %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::Unpack(rs.data(), os.data(), Particles);
+			DoNotOptimize(rs[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "SoA stream pack snorm16 %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::PackSNorm<float>(sx, std::span<const float>(soa.x, Particles));
+			DoNotOptimize(sx[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "SoA stream unpack snorm16 %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::UnpackSNorm<float>(std::span<float>(soa.x, Particles), sx);
+			DoNotOptimize(soa.x[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Double world positions to float render space relative to a camera origin, and shifting render space on origin moves.
+	/// </summary>
+	void BenchLargeWorld(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<PMath::WorldPosition> ps(Particles);
+		std::vector<PMath::Vector3Reg> rs(Particles);
+		std::vector<PMath::Vector3> ru(Particles);
+		for (size_t i = 0; i < Particles; ++i)
+		{
+			double d = (double)i * 0.37;
+			ps[i] = PMath::WorldPosition(1.0e7 + d, -2.0e7 - d, 3.0e7 + 0.5 * d);
+		}
+
+		PMath::WorldPosition origin(1.0e7, -2.0e7, 3.0e7);
+		PMath::WorldPosition moved(1.0e7 + 1024.0, -2.0e7, 3.0e7 - 2048.0);
+
+		std::snprintf(name, sizeof(name), "World to render space %s (100k)", suffix);
+		Bench(name, 200, [&](size_t) {
+			PMath::ToRenderSpace(rs.data(), ps.data(), Particles, origin);
+			DoNotOptimize(rs[0]);
+		}, Particles);
+
+		Bench("World to render space FPU (100k)", 200, [&](size_t) {
+			PMath::ToRenderSpace(ru.data(), ps.data(), Particles, origin);
+			DoNotOptimize(ru[0]);
+		}, Particles);
+
+		std::snprintf(name, sizeof(name), "Rebase render space %s (100k)", suffix);
+		Bench(name, 200, [&](size_t i) {
+			PMath::Rebase(rs.data(), Particles, (i & 1) ? moved : origin, (i & 1) ? origin : moved);
+			DoNotOptimize(rs[0]);
+		}, Particles);
+
+		Bench("Rebase render space FPU (100k)", 200, [&](size_t i) {
+			PMath::Rebase(ru.data(), Particles, (i & 1) ? moved : origin, (i & 1) ? origin : moved);
+			DoNotOptimize(ru[0]);
+		}, Particles);
+	}
+
+	/// <summary>
+	/// Eager operators against lazy expressions (Lazy()), run it in Debug and Release builds. Lazy chains that end in a
+	/// vector replace the matrix products with matrix vector products.
+	/// </summary>
+	template <typename V4, typename M4>
+	void BenchExpressions(const char* suffix)
+	{
+		char name[64];
+
+		std::vector<V4> vs = MakeVectors<V4>();
+		std::vector<M4> ms = MakeMatrices<M4>();
+		float s = 2.5f, t = -0.75f;
+
+		std::snprintf(name, sizeof(name), "Vector4 a*s+b*t-c eager %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			V4 r = vs[i % N] * s + vs[(i + 1) % N] * t - vs[(i + 2) % N];
+			DoNotOptimize(r);
+		});
+
+		std::snprintf(name, sizeof(name), "Vector4 a*s+b*t-c lazy %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			V4 r = PMath::Lazy(vs[i % N]) * s + PMath::Lazy(vs[(i + 1) % N]) * t - vs[(i + 2) % N];
+			DoNotOptimize(r);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 A*B*C eager %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			M4 r = ms[i % N] * ms[(i + 1) % N] * ms[(i + 2) % N];
+			DoNotOptimize(r);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 A*B*C lazy %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			M4 r = PMath::Lazy(ms[i % N]) * ms[(i + 1) % N] * ms[(i + 2) % N];
+			DoNotOptimize(r);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 A*B*C*v eager %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			V4 r = ms[i % N] * ms[(i + 1) % N] * ms[(i + 2) % N] * vs[i % N];
+			DoNotOptimize(r);
+		});
+
+		std::snprintf(name, sizeof(name), "Matrix4 A*B*C*v lazy %s", suffix);
+		Bench(name, Iterations, [&](size_t i) {
+			V4 r = PMath::Lazy(ms[i % N]) * ms[(i + 1) % N] * ms[(i + 2) % N] * vs[i % N];
+			DoNotOptimize(r);
+		});
+	}
+
+	/// <summary>
+	/// ToString of vectors and matrices, e.g. for logging.
+	/// </summary>
+	void BenchToString()
+	{
+		std::vector<PMath::Vector3> vs;
+		vs.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			float f = (float)i * 0.001f;
+			vs.emplace_back(1.0f + f, 2.0f - f, 3.0f * f);
+		}
+		std::vector<PMath::Matrix4> ms = MakeMatrices<PMath::Matrix4>();
+
+		Bench("ToString Vector3", Iterations / 10, [&](size_t i) { DoNotOptimize(PMath::ToString(vs[i % N])); });
+		Bench("ToString Matrix4", Iterations / 10, [&](size_t i) { DoNotOptimize(PMath::ToString(ms[i % N])); });
+	}
+
+	/// <summary>
+	/// Loading 100k matrices from an archive: memory mapped without copying vs. copied into a vector.
+	/// </summary>
+	void BenchArchive()
+	{
+		const size_t count = 100000;
+		const char* path = "MathBench.pmar";
+
+		std::vector<PMath::Matrix4Reg> ms(count);
+		std::vector<PMath::Matrix4Reg> src = MakeMatrices<PMath::Matrix4Reg>();
+		for (size_t i = 0; i < count; ++i)
+		{
+			ms[i] = src[i % N];
+		}
+
+		Bench("Archive write 100k Matrix4", 20, [&](size_t i) {
+			PMath::ArchiveWriter w;
+			bool ok = w.Open(path) && w.WriteArray("transforms", ms.data(), ms.size()) && w.Close();
+			DoNotOptimize(ok);
+		});
+
+		Bench("Archive map + Get 100k Matrix4", 200, [&](size_t i) {
+			PMath::MappedArchive a;
+			a.Open(path);
+			std::span<const PMath::Matrix4Reg> m = a.Get<PMath::Matrix4Reg>("transforms");
+			DoNotOptimize(m[i % m.size()]);
+		});
+
+		Bench("Archive map + Read 100k Matrix4", 200, [&](size_t i) {
+			PMath::MappedArchive a;
+			a.Open(path);
+			std::vector<PMath::Matrix4Reg> m;
+			a.Read("transforms", m);
+			DoNotOptimize(m[i % m.size()]);
+		});
+
+		std::remove(path);
+	}
+
+	/// <summary>
+	/// Writes all results as JSON.
+	/// </summary>
+	bool WriteJson(const char* path, const char* backend, const char* batch)
+	{
+		FILE* f = std::fopen(path, "w");
+		if (!f)
+		{
+			return false;
+		}
+
+#if defined(__VERSION__)
+		const char* compiler = __VERSION__;
+#else
+		const char* compiler = "unknown";
+#endif
+
+		std::fprintf(f, "{\n");
+		std::fprintf(f, "  \"backend\": \"%s\",\n", backend);
+		std::fprintf(f, "  \"batch_kernels\": \"%s\",\n", batch);
+		std::fprintf(f, "  \"compiler\": \"%s\",\n", compiler);
+		std::fprintf(f, "  \"results\": [\n");
+
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const BenchResult& r = results[i];
+			std::fprintf(f, "    { \"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.4f, \"items_per_second\": %.1f }%s\n",
+						 r.name.c_str(), r.iterations, r.nsPerOp, r.itemsPerSecond, (i + 1 < results.size()) ? "," : "");
+		}
+
+		std::fprintf(f, "  ]\n}\n");
+		std::fclose(f);
+		return true;
+	}
+} // namespace
+
+int main(int argc, char** argv)
+{
+	const char* jsonPath = nullptr;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+		{
+			jsonPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+		{
+			filter = argv[++i];
+		}
+		else
+		{
+			std::printf("Usage: %s [--json <file>] [--filter <text>]\n", argv[0]);
+			return 1;
+		}
+	}
+
+#if P_INTRINSICS == P_INTRINSICS_AVX2
+	const char* backend = "AVX2";
+#elif P_INTRINSICS == P_INTRINSICS_AVX
+	const char* backend = "AVX";
+#elif P_INTRINSICS == P_INTRINSICS_SSE
+	const char* backend = "SSE";
+#else
+	const char* backend = "FPU";
+#endif
+
+#if P_SIMD_DISPATCH
+	// Set PHANES_SIMD=SSE|AVX|AVX2 to compare the dispatched tiers.
+	const char* levels[] = { "FPU", "SSE", "AVX", "AVX2" };
+	const char* batch = levels[PMath::SIMD::GetSIMDLevel()];
+#else
+	const char* batch = backend;
+#endif
+
+	std::printf("Backend: %s, batch kernels: %s\n\n", backend, batch);
+
+	BenchFloat<PMath::Vector3Reg, PMath::Vector4Reg, PMath::Matrix3Reg, PMath::Matrix4Reg>(backend);
+	std::printf("\n");
+	BenchFloat<PMath::Vector3, PMath::Vector4, PMath::Matrix3, PMath::Matrix4>("FPU");
+	std::printf("\n");
+	BenchPlane();
+	std::printf("\n");
+	BenchDouble<PMath::Vector4Regd, PMath::Matrix4Regd>(backend);
+	std::printf("\n");
+	BenchDouble<PMath::Vector4d, PMath::Matrix4d>("FPU");
+	std::printf("\n");
+	BenchSoA();
+	std::printf("\n");
+	BenchTransform();
+	std::printf("\n");
+	BenchQuaternion<PMath::QuaternionReg, PMath::Vector3Reg>(backend);
+	std::printf("\n");
+	BenchQuaternion<PMath::Quaternion, PMath::Vector3>("FPU");
+	std::printf("\n");
+	BenchAffine<PMath::TransformReg, PMath::QuaternionReg, PMath::Vector3Reg>(backend);
+	std::printf("\n");
+	BenchAffine<PMath::Transformf, PMath::Quaternion, PMath::Vector3>("FPU");
+	std::printf("\n");
+	BenchCulling<PMath::FrustumReg, PMath::Matrix4Reg, PMath::AABBReg, PMath::SphereReg, PMath::Vector3Reg>(backend);
+	std::printf("\n");
+	BenchCulling<PMath::Frustum, PMath::Matrix4, PMath::AABB, PMath::Sphere, PMath::Vector3>("FPU");
+	std::printf("\n");
+	BenchRayPacket<4>(backend);
+	BenchRayPacket<8>(backend);
+	std::printf("\n");
+	BenchTriangles(batch);
+	std::printf("\n");
+	BenchBVH();
+	std::printf("\n");
+	BenchSpatialHash(backend);
+	std::printf("\n");
+	BenchTranscendental(batch);
+	std::printf("\n");
+	BenchHalf(batch);
+	std::printf("\n");
+	BenchNormals(batch);
+	std::printf("\n");
+	BenchLargeWorld(backend);
+	std::printf("\n");
+	BenchExpressions<PMath::Vector4Reg, PMath::Matrix4Reg>(backend);
+	std::printf("\n");
+	BenchExpressions<PMath::Vector4, PMath::Matrix4>("FPU");
+	std::printf("\n");
+	BenchToString();
+	std::printf("\n");
+	BenchArchive();
+
+	if (jsonPath && !WriteJson(jsonPath, backend, batch))
+	{
+		std::printf("Could not write %s\n", jsonPath);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,20 @@
+-- One MathBench binary per SSE setting, so every backend can be measured from one build.
+-- Run e.g. bin/<version>/Release/MathBench_AVX2/MathBench_AVX2 --json avx2.json
+
+for _, backend in ipairs({ "FPU", "SSE", "AVX", "AVX2", "Dispatch" }) do
+    project ("MathBench_" .. backend)
+        kind "ConsoleApp"
+        boilerplate(backend)
+
+        files {
+            PhanesRuntime .. "/Core/Tests/Math/MathBench/**.h",
+            PhanesRuntime .. "/Core/Tests/Math/MathBench/**.cpp"
+        }
+
+        buildoptions {"-Wno-unused-variable", "-w", "-fpermissive"}
+
+        includedirs {
+            PhanesRuntime .. "/Core/Tests/Math/MathBench",
+            PhanesRuntime
+        }
+end
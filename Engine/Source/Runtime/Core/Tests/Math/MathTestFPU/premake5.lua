@@ -28,7 +28,7 @@ project "MathTestFPU"
     pchheader (PhanesRuntime .. "/Core/Tests/Math/MathTestFPU/pch.h")
     pchsource (PhanesRuntime .. "/Core/Tests/Math/MathTestFPU/pch.cpp")
 
-    links { "gtest" }
+    links { "gtest", "fmt" }
     dependson { "gtest" }
 
     includedirs {
@@ -1,11 +1,21 @@
 #include "Core/Math/Include.h"
+#include "Core/Math/Archive.hpp"
+#include "Core/Math/MathFormat.hpp"
 #include "Core/Math/MathFwd.h"
 #include "pch.h"
 
 #include "Core/Core.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
 #include <iomanip>
+#include <limits>
+#include <optional>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-fpermissive"
@@ -310,6 +320,31 @@ namespace VectorTests
 		EXPECT_TRUE(PMath::VectorTriple(v, v1, v2) == PMath::IntVector3(83, 37, 116));
 	}
 
+	TEST(IntVector3, RegTests)
+	{
+		// Division and modulo leave the zero padding alone, so a vector divisor never divides by zero.
+		PMath::LongVector3Reg l0(-7, 13, 100000000000);
+		PMath::LongVector3Reg l1(3, -2, 7);
+
+		EXPECT_TRUE(l0 / l1 == PMath::LongVector3Reg(-2, -6, 14285714285));
+		EXPECT_TRUE(l0 % l1 == PMath::LongVector3Reg(-1, 1, 5));
+		EXPECT_TRUE(l0 / Phanes::Core::Types::int64(4) == PMath::LongVector3Reg(-1, 3, 25000000000));
+		EXPECT_TRUE(l0 % Phanes::Core::Types::int64(4) == PMath::LongVector3Reg(-3, 1, 0));
+
+		l0 /= l1;
+		EXPECT_TRUE(l0 == PMath::LongVector3Reg(-2, -6, 14285714285));
+
+		using ULongVector3Reg = PMath::TIntVector3<Phanes::Core::Types::uint64, PMath::SIMD::use_simd<Phanes::Core::Types::uint64, 3, true>::value>;
+		ULongVector3Reg u0(7, 13, 18000000000000000000ull);
+		ULongVector3Reg u1(3, 2, 7);
+
+		EXPECT_TRUE(u0 / u1 == ULongVector3Reg(2, 6, 2571428571428571428ull));
+		EXPECT_TRUE(u0 % u1 == ULongVector3Reg(1, 1, 4));
+
+		u0 %= u1;
+		EXPECT_TRUE(u0 == ULongVector3Reg(1, 1, 4));
+	}
+
 	TEST(IntVector4, OperatorTests)
 	{
 		PMath::IntVector4 v(3, 5, 4, 6);
@@ -443,6 +478,71 @@ namespace VectorTests
 		EXPECT_TRUE(PMath::Negate(v) == PMath::IntVector4(-3, -5, -3, -6));
 	}
 
+	TEST(IntVector4, RegTests)
+	{
+		PMath::LongVector4Reg l0(-7, 13, 100000000000, 3);
+		PMath::LongVector4Reg l1(3, 2, 5, 1);
+
+		EXPECT_TRUE(l0 + l1 == PMath::LongVector4Reg(-4, 15, 100000000005, 4));
+		EXPECT_TRUE(l0 * l1 == PMath::LongVector4Reg(-21, 26, 500000000000, 3));
+		EXPECT_TRUE(l0 / l1 == PMath::LongVector4Reg(-2, 6, 20000000000, 3));
+		EXPECT_TRUE(l0 % l1 == PMath::LongVector4Reg(-1, 1, 0, 0));
+		EXPECT_TRUE((l0 << l1) == PMath::LongVector4Reg(-56, 52, 3200000000000, 6));
+		EXPECT_TRUE((l0 >> Phanes::Core::Types::int64(1)) == PMath::LongVector4Reg(-4, 6, 50000000000, 1));
+		EXPECT_TRUE((l0 ^ l1) == PMath::LongVector4Reg(-7 ^ 3, 13 ^ 2, 100000000000 ^ 5, 2));
+		EXPECT_TRUE(l0 != l1);
+
+		PMath::IntVector4Reg v0[5];
+		PMath::IntVector4Reg v1[5];
+		PMath::IntVector4Reg r[5];
+
+		for (int i = 0; i < 5; i++)
+		{
+			v0[i] = PMath::IntVector4Reg(-3 * i - 1, i, 7 * i, -100 + i);
+			v1[i] = PMath::IntVector4Reg(i, 1, 2, 3);
+		}
+
+		PMath::BatchAdd(r, v0, v1, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == v0[i] + v1[i]);
+
+		PMath::BatchMul(r, v0, -5, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == v0[i] * -5);
+
+		PMath::BatchLeftShift(r, v0, v1, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == (v0[i] << v1[i]));
+
+		PMath::BatchRightShift(r, v0, 2, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == PMath::IntVector4Reg(v0[i].x >> 2, v0[i].y >> 2, v0[i].z >> 2, v0[i].w >> 2));
+
+		// Counts outside [0, bits) behave like vpsllv / vpsrav on every backend: 0 for left shifts, the sign for right shifts.
+		PMath::IntVector4Reg iv(-5, 7, -1, 12);
+		PMath::IntVector4Reg ic(32, 40, -1, 31);
+		EXPECT_TRUE((iv << ic) == PMath::IntVector4Reg(0, 0, 0, 0));
+		EXPECT_TRUE((iv >> ic) == PMath::IntVector4Reg(-1, 0, -1, 0));
+		EXPECT_TRUE((iv >> 33) == PMath::IntVector4Reg(-1, 0, -1, 0));
+
+		PMath::LongVector4Reg lv(-7, 13, -100000000000, 3);
+		PMath::LongVector4Reg lc(64, 100, -1, 63);
+		EXPECT_TRUE((lv << lc) == PMath::LongVector4Reg(0, 0, 0, (Phanes::Core::Types::int64)((Phanes::Core::Types::uint64)3 << 63)));
+		EXPECT_TRUE((lv >> lc) == PMath::LongVector4Reg(-1, 0, -1, 0));
+		EXPECT_TRUE((lv >> Phanes::Core::Types::int64(64)) == PMath::LongVector4Reg(-1, 0, -1, 0));
+
+		for (int i = 0; i < 5; i++)
+			v1[i] = PMath::IntVector4Reg(32 + i, -i - 1, 31, i);
+
+		PMath::BatchLeftShift(r, v0, v1, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == PMath::IntVector4Reg(0, 0, (int)((unsigned int)v0[i].z << 31), v0[i].w << i));
+
+		PMath::BatchRightShift(r, v0, v1, 5);
+		for (int i = 0; i < 5; i++)
+			EXPECT_TRUE(r[i] == PMath::IntVector4Reg(-1, 0, 0, v0[i].w >> i));
+	}
+
 	TEST(Vector2, OperatorTests)
 	{
 		PMath::Vector2 v0(2.4f, 3.1f);
@@ -945,6 +1045,544 @@ namespace VectorTests
 		EXPECT_TRUE(PMath::CompInverseV(v0) ==
 					PMath::Vector4(1.0f / 2.4f, 1.0f / 3.1f, 1.0f / 5.6f, 1.0f / -3.7f));
 	}
+
+	TEST(Vector3, SlerpTests)
+	{
+		PMath::Vector3Reg v0 = PMath::Slerp(PMath::Vector3Reg(2.0f, 0.0f, 0.0f), PMath::Vector3Reg(0.0f, 4.0f, 0.0f), 0.5f);
+		EXPECT_NEAR(v0.x, 3.0f * sqrtf(0.5f), P_FLT_INAC);
+		EXPECT_NEAR(v0.y, 3.0f * sqrtf(0.5f), P_FLT_INAC);
+		EXPECT_NEAR(v0.z, 0.0f, P_FLT_INAC);
+
+		// Opposite vectors
+		PMath::Vector3 v1 = PMath::Slerp(PMath::Vector3(1.0f, 0.0f, 0.0f), PMath::Vector3(-1.0f, 0.0f, 0.0f), 0.5f);
+		EXPECT_NEAR(PMath::Magnitude(v1), 1.0f, P_FLT_INAC);
+		EXPECT_NEAR(v1.x, 0.0f, P_FLT_INAC);
+	}
+
+	TEST(Vector3SoA, BatchTests)
+	{
+		PMath::Vector3Reg v[11];
+		for (int i = 0; i < 11; i++)
+		{
+			v[i] = PMath::Vector3Reg(0.5f * i, -1.0f * i, 3.0f);
+		}
+		v[3] = PMath::Vector3Reg(0.0f, 0.0f, 0.0f);
+
+		PMath::Vector3SoA v0;
+		PMath::Gather(v0, v, 11);
+		EXPECT_EQ(v0.Size(), 11);
+
+		PMath::Vector3SoA v1(v0);
+		PMath::Vector3SoA r;
+		float s[11];
+
+		PMath::Add(r, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_FLOAT_EQ(r.y[i], 2.0f * v[i].y);
+
+		PMath::Scale(r, v0, -2.0f);
+		for (int i = 0; i < 11; i++)
+			EXPECT_FLOAT_EQ(r.x[i], -2.0f * v[i].x);
+
+		PMath::DotP(s, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_FLOAT_EQ(s[i], v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z);
+
+		PMath::Magnitude(s, v0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_FLOAT_EQ(s[i], PMath::Magnitude(PMath::Vector3(v[i].x, v[i].y, v[i].z)));
+
+		PMath::Normalize(r, v0);
+		EXPECT_FLOAT_EQ(r.x[3], 0.0f);
+		for (int i = 0; i < 11; i++)
+			if (i != 3)
+				EXPECT_NEAR(r.x[i] * r.x[i] + r.y[i] * r.y[i] + r.z[i] * r.z[i], 1.0f, P_FLT_INAC);
+
+		v1.Set(1, PMath::Vector3(0.0f, 1.0f, 0.0f));
+		PMath::CrossP(r, v0, v1);
+		EXPECT_TRUE(r.Get(1) == PMath::Vector3(-3.0f, 0.0f, 0.5f));
+
+		PMath::Lerp(r, v0, v1, 0.5f);
+		EXPECT_TRUE(r.Get(1) == PMath::Vector3(0.25f, 0.0f, 1.5f));
+
+		PMath::Vector3Reg out[11];
+		PMath::Scatter(out, v0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(out[i].x == v[i].x && out[i].y == v[i].y && out[i].z == v[i].z);
+
+		// Shrinking and copying a shorter array into an existing buffer keep the padding zero.
+		float nan = std::numeric_limits<float>::quiet_NaN();
+		PMath::Vector3SoA p(11), q(5);
+		for (int i = 0; i < 11; i++)
+			p.Set(i, PMath::Vector3(nan, nan, nan));
+
+		p.Resize(5);
+		for (size_t i = 5; i < p.PaddedSize(); i++)
+			EXPECT_TRUE(p.x[i] == 0.0f && p.y[i] == 0.0f && p.z[i] == 0.0f);
+
+		p.Resize(11);
+		for (int i = 0; i < 11; i++)
+			p.Set(i, PMath::Vector3(nan, nan, nan));
+
+		p = q;
+		EXPECT_EQ(p.Size(), 5);
+		for (size_t i = 0; i < p.PaddedSize(); i++)
+			EXPECT_TRUE(p.x[i] == 0.0f && p.y[i] == 0.0f && p.z[i] == 0.0f);
+	}
+
+	TEST(Vector3SoA, DoubleTests)
+	{
+		PMath::Vector3Regd v[11];
+		for (int i = 0; i < 11; i++)
+		{
+			v[i] = PMath::Vector3Regd(0.5 * i, -1.0 * i, 3.0);
+		}
+		v[3] = PMath::Vector3Regd(0.0, 0.0, 0.0);
+
+		PMath::Vector3SoAd v0;
+		PMath::Gather(v0, v, 11);
+		EXPECT_EQ(v0.Size(), 11);
+
+		PMath::Vector3SoAd v1(v0);
+		PMath::Vector3SoAd r;
+		double s[11];
+
+		PMath::Add(r, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_DOUBLE_EQ(r.y[i], 2.0 * v[i].y);
+
+		PMath::Sub(r, v0, r);
+		for (int i = 0; i < 11; i++)
+			EXPECT_DOUBLE_EQ(r.x[i], -v[i].x);
+
+		PMath::Scale(r, v0, -2.0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_DOUBLE_EQ(r.z[i], -2.0 * v[i].z);
+
+		PMath::DotP(s, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_DOUBLE_EQ(s[i], v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z);
+
+		PMath::Magnitude(s, v0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_DOUBLE_EQ(s[i], PMath::Magnitude(PMath::Vector3d(v[i].x, v[i].y, v[i].z)));
+
+		PMath::Normalize(r, v0);
+		EXPECT_DOUBLE_EQ(r.x[3], 0.0);
+		for (int i = 0; i < 11; i++)
+			if (i != 3)
+				EXPECT_NEAR(r.x[i] * r.x[i] + r.y[i] * r.y[i] + r.z[i] * r.z[i], 1.0, 1e-12);
+
+		v1.Set(1, PMath::Vector3d(0.0, 1.0, 0.0));
+		PMath::CrossP(r, v0, v1);
+		EXPECT_TRUE(r.Get(1) == PMath::Vector3d(-3.0, 0.0, 0.5));
+
+		PMath::Lerp(r, v0, v1, 0.5);
+		EXPECT_TRUE(r.Get(1) == PMath::Vector3d(0.25, 0.0, 1.5));
+
+		PMath::Vector3Regd out[11];
+		PMath::Scatter(out, v0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(out[i].x == v[i].x && out[i].y == v[i].y && out[i].z == v[i].z);
+	}
+
+	// Same checks for float and double, aligned vectors take the transposing Gather / Scatter kernels.
+	template <typename T>
+	static void CheckVector4SoA()
+	{
+		using Vec = PMath::TVector4<T, PMath::SIMD::use_simd<T, 4, true>::value>;
+		using VecU = PMath::TVector4<T, false>;
+
+		Vec v[11];
+		VecU u[11];
+		for (int i = 0; i < 11; i++)
+		{
+			v[i] = Vec((T)0.5 * i, (T)-1.0 * i, (T)3.0, (T)0.25 * i - (T)1.0);
+			u[i] = VecU(v[i].x, v[i].y, v[i].z, v[i].w);
+		}
+		v[3] = Vec((T)0.0, (T)0.0, (T)0.0, (T)0.0);
+		u[3] = VecU((T)0.0, (T)0.0, (T)0.0, (T)0.0);
+
+		PMath::TVector4SoA<T> v0, v1;
+		PMath::Gather(v0, v, 11);
+		PMath::Gather(v1, u, 11);
+		EXPECT_EQ(v0.Size(), 11);
+		EXPECT_EQ(v0.PaddedSize() % PMath::TVector4SoA<T>::Lanes, 0);
+
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(v0.Get(i) == v1.Get(i));
+
+		PMath::TVector4SoA<T> r;
+		T s[11];
+
+		PMath::Add(r, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(r.Get(i) == VecU((T)2.0 * v[i].x, (T)2.0 * v[i].y, (T)2.0 * v[i].z, (T)2.0 * v[i].w));
+
+		PMath::Sub(r, v0, r);
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(r.Get(i) == VecU(-v[i].x, -v[i].y, -v[i].z, -v[i].w));
+
+		PMath::Scale(r, v0, (T)-2.0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_TRUE(r.Get(i) == VecU((T)-2.0 * v[i].x, (T)-2.0 * v[i].y, (T)-2.0 * v[i].z, (T)-2.0 * v[i].w));
+
+		PMath::DotP(s, v0, v1);
+		for (int i = 0; i < 11; i++)
+			EXPECT_NEAR(s[i], v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z + v[i].w * v[i].w, (T)1e-5);
+
+		PMath::Magnitude(s, v0);
+		for (int i = 0; i < 11; i++)
+			EXPECT_NEAR(s[i], PMath::Magnitude(VecU(v[i].x, v[i].y, v[i].z, v[i].w)), (T)1e-5);
+
+		PMath::Normalize(r, v0);
+		EXPECT_TRUE(r.Get(3) == VecU((T)0.0, (T)0.0, (T)0.0, (T)0.0));
+		for (int i = 0; i < 11; i++)
+			if (i != 3)
+				EXPECT_NEAR(r.x[i] * r.x[i] + r.y[i] * r.y[i] + r.z[i] * r.z[i] + r.w[i] * r.w[i], (T)1.0, P_FLT_INAC);
+
+		v1.Set(1, VecU((T)0.0, (T)1.0, (T)0.0, (T)2.0));
+		PMath::Lerp(r, v0, v1, (T)0.5);
+		EXPECT_TRUE(r.Get(1) == VecU((T)0.25, (T)0.0, (T)1.5, (T)0.625));
+
+		Vec out[11];
+		VecU outU[11];
+		PMath::Scatter(out, v0);
+		PMath::Scatter(outU, v0);
+		for (int i = 0; i < 11; i++)
+		{
+			EXPECT_TRUE(out[i].x == v[i].x && out[i].y == v[i].y && out[i].z == v[i].z && out[i].w == v[i].w);
+			EXPECT_TRUE(outU[i] == u[i]);
+		}
+
+		// Shrinking and copying a shorter array into an existing buffer keep the padding zero.
+		T nan = std::numeric_limits<T>::quiet_NaN();
+		PMath::TVector4SoA<T> p(11), q(5);
+		for (int i = 0; i < 11; i++)
+			p.Set(i, VecU(nan, nan, nan, nan));
+
+		p.Resize(5);
+		for (size_t i = 5; i < p.PaddedSize(); i++)
+			EXPECT_TRUE(p.x[i] == (T)0.0 && p.y[i] == (T)0.0 && p.z[i] == (T)0.0 && p.w[i] == (T)0.0);
+
+		p.Resize(11);
+		for (int i = 0; i < 11; i++)
+			p.Set(i, VecU(nan, nan, nan, nan));
+
+		p = q;
+		EXPECT_EQ(p.Size(), 5);
+		for (size_t i = 0; i < p.PaddedSize(); i++)
+			EXPECT_TRUE(p.x[i] == (T)0.0 && p.y[i] == (T)0.0 && p.z[i] == (T)0.0 && p.w[i] == (T)0.0);
+	}
+
+	TEST(Vector4SoA, BatchTests)
+	{
+		CheckVector4SoA<float>();
+	}
+
+	TEST(Vector4SoA, DoubleTests)
+	{
+		CheckVector4SoA<double>();
+	}
+
+	TEST(HalfVector, ConversionTests)
+	{
+		// Rounding, range limits and specials of the scalar conversion (the SIMD paths give the same bits).
+		EXPECT_EQ(PMath::FloatToHalf(1.0f), 0x3C00);
+		EXPECT_EQ(PMath::FloatToHalf(-2.0f), 0xC000);
+		EXPECT_EQ(PMath::FloatToHalf(65504.0f), 0x7BFF);
+		EXPECT_EQ(PMath::FloatToHalf(65519.0f), 0x7BFF);
+		EXPECT_EQ(PMath::FloatToHalf(65520.0f), 0x7C00);
+		EXPECT_EQ(PMath::FloatToHalf(1.0f + 1.0f / 2048.0f), 0x3C00);
+		EXPECT_EQ(PMath::FloatToHalf(1.0f + 3.0f / 2048.0f), 0x3C02);
+		EXPECT_EQ(PMath::FloatToHalf(5.9604644775390625e-8f), 0x0001);
+		EXPECT_EQ(PMath::FloatToHalf(2.98023223876953125e-8f), 0x0000);
+		EXPECT_EQ(PMath::FloatToHalf(-0.0f), 0x8000);
+		EXPECT_EQ(PMath::FloatToHalf(std::numeric_limits<float>::infinity()), 0x7C00);
+		EXPECT_EQ(PMath::FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7E00, 0x7E00);
+		EXPECT_FLOAT_EQ(PMath::HalfToFloat(0x3555), 0.333251953125f);
+		EXPECT_FLOAT_EQ(PMath::HalfToFloat(0x0001), 5.9604644775390625e-8f);
+		EXPECT_TRUE(std::isnan(PMath::HalfToFloat(0x7C01)));
+		static_assert(PMath::HalfToFloat(PMath::FloatToHalf(0.5f)) == 0.5f);
+
+		// Every half round trips.
+		for (int h = 0; h < 0x10000; h++)
+		{
+			if ((h & 0x7C00) != 0x7C00 || (h & 0x03FF) == 0)
+			{
+				EXPECT_EQ(PMath::FloatToHalf(PMath::HalfToFloat((Phanes::Core::Types::uint16)h)), h);
+			}
+		}
+
+		// Batches of odd length against the scalar conversion, so the tails run too.
+		constexpr int n = 37;
+		std::vector<PMath::Vector3Reg> v3(n), r3(n);
+		std::vector<PMath::Vector4Reg> v4(n), r4(n);
+		std::vector<PMath::Vector2> v2(n), r2(n);
+		std::vector<PMath::HalfVector3> h3(n + 1);
+		std::vector<PMath::HalfVector4> h4(n);
+		std::vector<PMath::HalfVector2> h2(n);
+		std::vector<float> f(n), rf(n);
+		std::vector<Phanes::Core::Types::uint16> hf(n);
+
+		for (int i = 0; i < n; i++)
+		{
+			float a = std::sin(i * 0.71f) * (1 << (i % 17)), b = i * -0.37f, c = 1.0f / (i + 1);
+			v3[i] = PMath::Vector3Reg(a, b, c);
+			v4[i] = PMath::Vector4Reg(a, b, c, -a);
+			v2[i] = PMath::Vector2(c, a);
+			f[i] = a * 3.0f;
+		}
+
+		h3[n] = PMath::HalfVector3(PMath::Vector3(7.0f, 7.0f, 7.0f));
+		PMath::Pack(h3.data(), v3.data(), n);
+		PMath::Pack(h4.data(), v4.data(), n);
+		PMath::Pack(h2.data(), v2.data(), n);
+		PMath::Pack<float>(hf, f);
+
+		for (int i = 0; i < n; i++)
+		{
+			EXPECT_EQ(h3[i].x, PMath::FloatToHalf(v3[i].x));
+			EXPECT_EQ(h3[i].y, PMath::FloatToHalf(v3[i].y));
+			EXPECT_EQ(h3[i].z, PMath::FloatToHalf(v3[i].z));
+			EXPECT_TRUE(h4[i] == PMath::HalfVector4(PMath::Vector4(v4[i].x, v4[i].y, v4[i].z, v4[i].w)));
+			EXPECT_TRUE(h2[i] == PMath::HalfVector2(v2[i]));
+			EXPECT_EQ(hf[i], PMath::FloatToHalf(f[i]));
+		}
+		EXPECT_TRUE(h3[n] == PMath::HalfVector3(PMath::Vector3(7.0f, 7.0f, 7.0f)));
+
+		PMath::Unpack(r3.data(), h3.data(), n);
+		PMath::Unpack(r4.data(), h4.data(), n);
+		PMath::Unpack(r2.data(), h2.data(), n);
+		PMath::Unpack<float>(rf, hf);
+
+		for (int i = 0; i < n; i++)
+		{
+			EXPECT_FLOAT_EQ(r3[i].x, PMath::HalfToFloat(h3[i].x));
+			EXPECT_FLOAT_EQ(r3[i].z, PMath::HalfToFloat(h3[i].z));
+			EXPECT_FLOAT_EQ(r3[i].w, 0.0f);
+			EXPECT_FLOAT_EQ(r4[i].w, PMath::HalfToFloat(h4[i].w));
+			EXPECT_FLOAT_EQ(r2[i].y, PMath::HalfToFloat(h2[i].y));
+			EXPECT_FLOAT_EQ(rf[i], PMath::HalfToFloat(hf[i]));
+			EXPECT_NEAR(r3[i].y, v3[i].y, std::abs(v3[i].y) * 0.0005f);
+		}
+
+		// A shorter result span stops the batch, the elements behind it stay untouched.
+		std::vector<Phanes::Core::Types::uint16> th(n, 0xABCD);
+		std::vector<float> tf(n, 42.0f);
+		PMath::Pack<float>(std::span(th).first(9), f);
+		PMath::Unpack<float>(std::span(tf).first(6), std::span<const Phanes::Core::Types::uint16>(hf));
+
+		EXPECT_TRUE(std::equal(th.begin(), th.begin() + 9, hf.begin()));
+		EXPECT_TRUE(std::all_of(th.begin() + 9, th.end(), [](Phanes::Core::Types::uint16 h) { return h == 0xABCD; }));
+		EXPECT_TRUE(std::equal(tf.begin(), tf.begin() + 6, rf.begin()));
+		EXPECT_TRUE(std::all_of(tf.begin() + 6, tf.end(), [](float c) { return c == 42.0f; }));
+
+		PMath::Vector3Reg g = h3[5].Get<PMath::SIMD::use_simd<float, 3, true>::value>();
+		EXPECT_TRUE(g == r3[5]);
+
+		PMath::Vector4Regd d(1.0, -0.25, 1e-5, 70000.0);
+		PMath::HalfVector4d hd(d);
+		PMath::Vector4Regd rd = hd.Get<PMath::SIMD::use_simd<double, 4, true>::value>();
+		EXPECT_DOUBLE_EQ(rd.x, 1.0);
+		EXPECT_DOUBLE_EQ(rd.y, -0.25);
+		EXPECT_NEAR(rd.z, 1e-5, 3e-8);
+		EXPECT_TRUE(std::isinf(rd.w));
+	}
+
+	TEST(NormalEncoding, RoundTripTests)
+	{
+		// Directions over the whole sphere (spiral) plus the axes and the fold edges, odd count for the tails.
+		constexpr int n = 4099;
+		std::vector<PMath::Vector3Reg> v(n), r16(n), r8(n);
+		std::vector<PMath::OctNormal16> o16(n);
+		std::vector<PMath::OctNormal8> o8(n);
+
+		for (int i = 0; i < n; i++)
+		{
+			float z = 1.0f - 2.0f * (i + 0.5f) / n, s = std::sqrt(1.0f - z * z);
+			v[i] = PMath::Vector3Reg(s * std::cos(i * 2.3999632f), s * std::sin(i * 2.3999632f), z);
+		}
+
+		v[0] = PMath::Vector3Reg(0.0f, 0.0f, 1.0f);
+		v[1] = PMath::Vector3Reg(0.0f, 0.0f, -1.0f);
+		v[2] = PMath::Vector3Reg(-1.0f, 0.0f, 0.0f);
+		v[3] = PMath::Vector3Reg(0.0f, 1.0f, 0.0f);
+		v[4] = PMath::Vector3Reg(0.5f, -0.5f, -0.7071068f);
+		v[5] = PMath::Vector3Reg(-3.0f, 4.0f, -12.0f);
+
+		PMath::Pack(o16.data(), v.data(), n);
+		PMath::Pack(o8.data(), v.data(), n);
+		PMath::Unpack(r16.data(), o16.data(), n);
+		PMath::Unpack(r8.data(), o8.data(), n);
+
+		float max16 = 0.0f, max8 = 0.0f;
+
+		for (int i = 0; i < n; i++)
+		{
+			PMath::Vector3 d(v[i].x, v[i].y, v[i].z);
+
+			// The batches give the same codes as the scalar path, scaling does not change them.
+			EXPECT_TRUE(o16[i] == PMath::OctNormal16(d * 2.0f));
+			EXPECT_TRUE(o8[i] == PMath::OctNormal8(d));
+
+			PMath::NormalizeV(d);
+
+			for (const PMath::Vector3Reg& r : { r16[i], r8[i] })
+			{
+				EXPECT_NEAR(r.x * r.x + r.y * r.y + r.z * r.z, 1.0f, 1e-6f);
+				EXPECT_FLOAT_EQ(r.w, 0.0f);
+			}
+
+			max16 = std::max(max16, std::atan2(PMath::Magnitude(PMath::CrossP(d, PMath::Vector3(r16[i].x, r16[i].y, r16[i].z))),
+											   PMath::DotP(d, PMath::Vector3(r16[i].x, r16[i].y, r16[i].z))));
+			max8 = std::max(max8, std::atan2(PMath::Magnitude(PMath::CrossP(d, PMath::Vector3(r8[i].x, r8[i].y, r8[i].z))),
+											 PMath::DotP(d, PMath::Vector3(r8[i].x, r8[i].y, r8[i].z))));
+		}
+
+		EXPECT_LT(max16, 6.5e-5f);
+		EXPECT_LT(max8, 0.017f);
+		EXPECT_TRUE(r16[0] == PMath::Vector3Reg(0.0f, 0.0f, 1.0f));
+		EXPECT_TRUE(r16[1] == PMath::Vector3Reg(0.0f, 0.0f, -1.0f));
+
+		std::vector<PMath::Vector3Regd> vd(9), rd(9);
+		std::vector<PMath::OctNormal16d> od(9);
+
+		for (int i = 0; i < 9; i++)
+		{
+			vd[i] = PMath::Vector3Regd(v[i].x, v[i].y, v[i].z);
+		}
+
+		PMath::Pack(od.data(), vd.data(), 9);
+		PMath::Unpack(rd.data(), od.data(), 9);
+
+		for (int i = 0; i < 9; i++)
+		{
+			EXPECT_TRUE(od[i] == PMath::OctNormal16d(PMath::Vector3d(vd[i].x, vd[i].y, vd[i].z)));
+			EXPECT_NEAR(rd[i].x, r16[i].x, 1e-6);
+			EXPECT_NEAR(rd[i].z, r16[i].z, 1e-6);
+		}
+
+		// SNORM / UNORM: rounding to nearest even, clamping and NaN.
+		constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+		std::vector<float> f = { -1.0f, 1.0f, 0.0f, -2.0f, 3.0f, nan, 0.5f, 0.25f, -0.5f, -0.25f, 0.75f };
+		std::vector<Phanes::Core::Types::int16> s16(f.size());
+		std::vector<Phanes::Core::Types::int8> s8(f.size());
+		std::vector<Phanes::Core::Types::uint16> u16(f.size());
+		std::vector<Phanes::Core::Types::uint8> u8(f.size());
+
+		PMath::PackSNorm<float>(s16, f);
+		PMath::PackSNorm<float>(s8, f);
+		PMath::PackUNorm<float>(u16, f);
+		PMath::PackUNorm<float>(u8, f);
+
+		EXPECT_EQ(s16[0], -32767); EXPECT_EQ(s16[1], 32767); EXPECT_EQ(s16[3], -32767); EXPECT_EQ(s16[5], 0); EXPECT_EQ(s16[6], 16384);
+		EXPECT_EQ(s8[0], -127); EXPECT_EQ(s8[4], 127); EXPECT_EQ(s8[5], 0); EXPECT_EQ(s8[6], 64); EXPECT_EQ(s8[8], -64); EXPECT_EQ(s8[9], -32);
+		EXPECT_EQ(u16[0], 0); EXPECT_EQ(u16[1], 65535); EXPECT_EQ(u16[5], 0); EXPECT_EQ(u16[6], 32768);
+		EXPECT_EQ(u8[3], 0); EXPECT_EQ(u8[4], 255); EXPECT_EQ(u8[6], 128); EXPECT_EQ(u8[7], 64); EXPECT_EQ(u8[8], 0); EXPECT_EQ(u8[10], 191);
+
+		// Every code round trips, the most negative SNORM code decodes to -1.
+		std::vector<Phanes::Core::Types::int16> c16(65536), e16(65536);
+		std::vector<Phanes::Core::Types::uint8> c8(256), e8(256);
+		std::vector<float> d16(65536), d8(256);
+
+		for (int i = 0; i < 65536; i++)
+		{
+			c16[i] = (Phanes::Core::Types::int16)(i - 32768);
+		}
+		for (int i = 0; i < 256; i++)
+		{
+			c8[i] = (Phanes::Core::Types::uint8)i;
+		}
+
+		PMath::UnpackSNorm<float>(d16, c16);
+		PMath::UnpackUNorm<float>(d8, c8);
+		PMath::PackSNorm<float>(e16, d16);
+		PMath::PackUNorm<float>(e8, d8);
+
+		EXPECT_FLOAT_EQ(d16[0], -1.0f);
+		EXPECT_FLOAT_EQ(d16[1], -1.0f);
+		EXPECT_FLOAT_EQ(d8[255], 1.0f);
+		EXPECT_EQ(e16[0], -32767);
+		EXPECT_TRUE(std::equal(e16.begin() + 1, e16.end(), c16.begin() + 1));
+		EXPECT_TRUE(e8 == c8);
+
+		std::vector<double> dd16(65536);
+		PMath::UnpackSNorm<double>(dd16, c16);
+		PMath::PackSNorm<double>(e16, dd16);
+
+		EXPECT_DOUBLE_EQ(dd16[16384], -0.5 - 0.5 / 32767.0);
+		EXPECT_TRUE(std::equal(e16.begin() + 1, e16.end(), c16.begin() + 1));
+
+		// A shorter result span stops the batch, the elements behind it stay untouched.
+		std::vector<Phanes::Core::Types::uint8> t8(f.size(), 42);
+		std::vector<float> tf(f.size(), 42.0f);
+		PMath::PackUNorm<float>(std::span(t8).first(5), f);
+		PMath::UnpackSNorm<float>(std::span(tf).first(3), std::span<const Phanes::Core::Types::int16>(s16));
+
+		EXPECT_TRUE(std::equal(t8.begin(), t8.begin() + 5, u8.begin()));
+		EXPECT_TRUE(std::all_of(t8.begin() + 5, t8.end(), [](Phanes::Core::Types::uint8 c) { return c == 42; }));
+		EXPECT_FLOAT_EQ(tf[1], 1.0f);
+		EXPECT_TRUE(std::all_of(tf.begin() + 3, tf.end(), [](float c) { return c == 42.0f; }));
+	}
+
+	TEST(LargeWorld, RenderSpaceTests)
+	{
+		PMath::WorldPosition origin(1.0e7, -2.0e7, 3.0e7);
+
+		std::vector<PMath::WorldPosition> ps;
+		for (int i = 0; i < 7; i++)
+		{
+			ps.emplace_back(1.0e7 + 0.125 * i + 0.001, -2.0e7 - 0.25 * i, 3.0e7 + 100.0 * i + 0.5);
+		}
+
+		// 4 + 3, SIMD loop and a tail for the AVX rebase.
+		std::vector<PMath::Vector3Reg> rs(ps.size());
+		PMath::ToRenderSpace(rs.data(), ps.data(), ps.size(), origin);
+
+		std::vector<PMath::Vector3> ru(ps.size());
+		PMath::ToRenderSpace(ru.data(), ps.data(), ps.size(), origin);
+
+		for (size_t i = 0; i < ps.size(); i++)
+		{
+			EXPECT_EQ(rs[i].x, (float)(ps[i].x - origin.x));
+			EXPECT_EQ(rs[i].y, (float)(ps[i].y - origin.y));
+			EXPECT_EQ(rs[i].z, (float)(ps[i].z - origin.z));
+			EXPECT_EQ(rs[i].w, 0.0f);
+
+			EXPECT_TRUE(ru[i] == PMath::Vector3(rs[i].x, rs[i].y, rs[i].z));
+			EXPECT_TRUE(PMath::ToRenderSpace(ps[i], origin) == rs[i]);
+		}
+
+		// Converting first loses the centimeters.
+		EXPECT_NEAR(rs[6].x, 0.751f, 1e-6f);
+		EXPECT_NE((float)ps[6].x - (float)origin.x, rs[6].x);
+
+		PMath::WorldPosition back = PMath::ToWorldSpace(rs[3], origin);
+		EXPECT_NEAR(back.x, ps[3].x, 1e-6);
+		EXPECT_NEAR(back.y, ps[3].y, 1e-6);
+		EXPECT_NEAR(back.z, ps[3].z, 1e-6);
+
+		PMath::WorldPosition snapped = PMath::SnapOrigin(PMath::WorldPosition(1500.0, -600.0, 10.0), 1024.0);
+		EXPECT_TRUE(snapped == PMath::WorldPosition(1024.0, -1024.0, 0.0));
+
+		// Move the origin by a few km.
+		PMath::WorldPosition origin2 = PMath::SnapOrigin(PMath::WorldPosition(origin.x + 5000.3, origin.y - 3000.0, origin.z + 2.0), 1024.0);
+		PMath::Rebase(rs.data(), rs.size(), origin, origin2);
+		PMath::Rebase(ru.data(), ru.size(), origin, origin2);
+
+		for (size_t i = 0; i < ps.size(); i++)
+		{
+			PMath::Vector3Reg e = PMath::ToRenderSpace(ps[i], origin2);
+
+			EXPECT_NEAR(rs[i].x, e.x, 1e-3f);
+			EXPECT_NEAR(rs[i].y, e.y, 1e-3f);
+			EXPECT_NEAR(rs[i].z, e.z, 1e-3f);
+			EXPECT_EQ(rs[i].w, 0.0f);
+
+			EXPECT_TRUE(ru[i] == PMath::Vector3(rs[i].x, rs[i].y, rs[i].z));
+		}
+	}
 } // namespace VectorTests
 
 namespace MatrixTests
@@ -1132,6 +1770,110 @@ namespace MatrixTests
 					PMath::Matrix3(1.0f, 2.0f, 2.0f, 5.0f, 6.0f, -3.0f, 3.0f, 4.0f, 5.0f));
 	}
 
+	TEST(Matrix3, SIMDTests)
+	{
+		PMath::Matrix3Reg m0(1.0f, 5.0f, 3.0f, 2.0f, 6.0f, 4.0f, 2.0f, -3.0f, 5.0f);
+		PMath::Matrix3Reg m1(2.0f, 4.0f, 1.0f, 3.0f, 4.0f, -3.0f, 1.0f, 6.0f, 3.0f);
+
+		PMath::Matrix3Reg m2 = m0 * m1;
+		EXPECT_NEAR(m2(0, 0), 20.0f, P_FLT_INAC);
+		EXPECT_NEAR(m2(0, 1), 42.0f, P_FLT_INAC);
+		EXPECT_NEAR(m2(1, 2), -4.0f, P_FLT_INAC);
+		EXPECT_NEAR(m2(2, 1), 26.0f, P_FLT_INAC);
+
+		PMath::Vector3Reg v = m0 * PMath::Vector3Reg(2.0f, 4.0f, 3.0f);
+		EXPECT_TRUE(v == PMath::Vector3Reg(31.0f, 40.0f, 7.0f));
+
+		EXPECT_NEAR(PMath::Determinant(m0), -22.0f, P_FLT_INAC);
+
+		PMath::Matrix3Reg inv = m0;
+		EXPECT_TRUE(PMath::InverseV(inv));
+		EXPECT_NEAR(inv(0, 0), -21.0f / 11.0f, P_FLT_INAC);
+		EXPECT_NEAR(inv(1, 1), 1.0f / 22.0f, P_FLT_INAC);
+		EXPECT_NEAR(inv(2, 1), -13.0f / 22.0f, P_FLT_INAC);
+		EXPECT_NEAR(inv(0, 2), -1.0f / 11.0f, P_FLT_INAC);
+
+		Phanes::Ref<PMath::Matrix3Reg> it = Phanes::MakeRef<PMath::Matrix3Reg>();
+		EXPECT_TRUE(PMath::InverseTranspose(m0, it));
+		EXPECT_TRUE(*it == PMath::Transpose(inv));
+
+		PMath::Matrix3Reg singular(1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 0.0f, 1.0f, 1.0f);
+		EXPECT_FALSE(PMath::InverseV(singular));
+
+		// Batch, odd count to cover the tails.
+		std::vector<PMath::Matrix3Reg> ms(7), rs(7);
+		for (int i = 0; i < 7; i++)
+		{
+			ms[i] = PMath::Matrix3Reg(1.0f + i, 5.0f, 3.0f, 2.0f, 6.0f - i, 4.0f, 2.0f, -3.0f, 5.0f + 0.5f * i);
+		}
+
+		EXPECT_TRUE(PMath::InverseTranspose(rs.data(), ms.data(), ms.size()));
+		for (int i = 0; i < 7; i++)
+		{
+			EXPECT_TRUE(PMath::InverseTranspose(ms[i], it));
+			EXPECT_TRUE(rs[i] == *it);
+		}
+
+		ms[4] = singular;
+		EXPECT_FALSE(PMath::InverseTranspose(rs.data(), ms.data(), ms.size()));
+		EXPECT_TRUE(rs[4] == PMath::Matrix3Reg(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+		PMath::InverseTranspose(ms[3], it);
+		EXPECT_TRUE(rs[3] == *it);
+
+#if P_INTRINSICS >= P_INTRINSICS_AVX
+		PMath::TMatrix3<double, true> d0(1.0, 5.0, 3.0, 2.0, 6.0, 4.0, 2.0, -3.0, 5.0);
+		EXPECT_NEAR(PMath::Determinant(d0), -22.0, P_FLT_INAC);
+		EXPECT_TRUE(PMath::InverseV(d0));
+		EXPECT_NEAR(d0(2, 1), -13.0 / 22.0, P_FLT_INAC);
+		EXPECT_NEAR(d0(0, 1), 17.0 / 11.0, P_FLT_INAC);
+		EXPECT_NEAR((d0 * PMath::TMatrix3<double, true>(1.0, 5.0, 3.0, 2.0, 6.0, 4.0, 2.0, -3.0, 5.0))(1, 1), 1.0, P_FLT_INAC);
+#endif
+	}
+
+	TEST(Matrix3, SingularTests)
+	{
+		// Third row equal to the first: x and z of the cross product of two columns are exact negatives, so every
+		// backend has to find det == 0, also with FMA.
+		std::mt19937 gen(7);
+		std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+		std::vector<PMath::Matrix3Reg> ms(9), rs(9);
+		for (int i = 0; i < 200; i++)
+		{
+			float e[6];
+			for (float& x : e)
+			{
+				x = dist(gen);
+			}
+
+			PMath::Matrix3 m(e[0], e[1], e[2], e[3], e[4], e[5], e[0], e[1], e[2]);
+			PMath::Matrix3Reg mr(e[0], e[1], e[2], e[3], e[4], e[5], e[0], e[1], e[2]);
+
+			EXPECT_FALSE(PMath::Inverse(m).has_value());
+			EXPECT_FALSE(PMath::Inverse(mr).has_value());
+			EXPECT_FALSE(PMath::InverseTranspose(mr).has_value());
+
+			ms[i % 9] = mr;
+			if (i % 9 == 8)
+			{
+				EXPECT_FALSE(PMath::InverseTranspose(rs.data(), ms.data(), ms.size()));
+				EXPECT_TRUE(std::all_of(rs.begin(), rs.end(), [](const PMath::Matrix3Reg& r)
+				{
+					return r == PMath::Matrix3Reg(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+				}));
+			}
+
+			PMath::Vector3Reg v(e[3], e[4], e[5]);
+			EXPECT_TRUE(PMath::CrossP(v, v) == PMath::Vector3Reg(0.0f, 0.0f, 0.0f));
+
+#if P_INTRINSICS >= P_INTRINSICS_AVX
+			PMath::TMatrix3<double, true> d(e[0], e[1], e[2], e[3], e[4], e[5], e[0], e[1], e[2]);
+			EXPECT_FALSE(PMath::Inverse(d).has_value());
+			EXPECT_FALSE(PMath::InverseTranspose(d).has_value());
+#endif
+		}
+	}
+
 	TEST(Matrix4, OperationTests)
 	{
 		PMath::Matrix4 m0 = PMath::Matrix4(1.0f,
@@ -1592,10 +2334,1011 @@ namespace MatrixTests
 														   1.0f,
 														   3.0f,
 														   -2.0f));
+
+		std::optional<PMath::Matrix4> inv = PMath::Inverse(m0);
+		ASSERT_TRUE(inv.has_value());
+		EXPECT_TRUE(*inv == *tmp);
+
+		PMath::Matrix4 singular(1.0f, 2.0f, 3.0f, 4.0f,
+								2.0f, 4.0f, 6.0f, 8.0f,
+								0.0f, 1.0f, 0.0f, 1.0f,
+								1.0f, 0.0f, 2.0f, 0.0f);
+		EXPECT_FALSE(PMath::Inverse(singular).has_value());
+
+		// Batch, with the SIMD backend and a singular matrix in between.
+		std::vector<PMath::Matrix4Reg> ms(5), rs(5);
+		for (int i = 0; i < 5; i++)
+		{
+			ms[i] = PMath::Matrix4Reg(1.0f + i, 5.0f, 3.0f, 4.0f, 2.0f, 6.0f - i, 4.0f, 1.0f, 2.0f, -3.0f, 5.0f, 3.0f, 8.0f, -4.0f, 6.0f, -2.0f + i);
+		}
+
+		EXPECT_TRUE(PMath::Inverse(std::span<const PMath::Matrix4Reg>(ms), rs));
+		for (int i = 0; i < 5; i++)
+		{
+			std::optional<PMath::Matrix4Reg> r = PMath::Inverse(ms[i]);
+			ASSERT_TRUE(r.has_value());
+			EXPECT_TRUE(rs[i] == *r);
+		}
+
+		ms[2] = PMath::Matrix4Reg(1.0f, 2.0f, 3.0f, 4.0f, 2.0f, 4.0f, 6.0f, 8.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 2.0f, 0.0f);
+		EXPECT_FALSE(PMath::Inverse(ms[2]).has_value());
+		EXPECT_FALSE(PMath::Inverse(std::span<const PMath::Matrix4Reg>(ms), rs));
+		EXPECT_TRUE(rs[2] == PMath::Matrix4Reg(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f));
+		EXPECT_TRUE(rs[3] == *PMath::Inverse(ms[3]));
+	}
+
+	TEST(Matrix4, DoubleRegTests)
+	{
+		// Matrix4Regd is backed by 256-bit registers on AVX builds and must match the FPU path.
+		PMath::Matrix4Regd m0(1.0, 5.0, 3.0, 4.0,
+							  2.0, 6.0, 4.0, 1.0,
+							  2.0, -3.0, 5.0, 3.0,
+							  8.0, -4.0, 6.0, -2.0);
+		PMath::Matrix4d m1(1.0, 5.0, 3.0, 4.0,
+						   2.0, 6.0, 4.0, 1.0,
+						   2.0, -3.0, 5.0, 3.0,
+						   8.0, -4.0, 6.0, -2.0);
+
+		EXPECT_DOUBLE_EQ(PMath::Determinant(m0), PMath::Determinant(m1));
+
+		PMath::Matrix4Regd r0 = m0 * m0;
+		PMath::Matrix4d r1 = m1 * m1;
+
+		PMath::Vector4Regd v0 = m0 * PMath::Vector4Regd(1.0, -2.0, 3.0, 0.5);
+		PMath::Vector4d v1 = m1 * PMath::Vector4d(1.0, -2.0, 3.0, 0.5);
+
+		PMath::Matrix4Regd i0 = m0;
+		PMath::Matrix4d i1 = m1;
+		EXPECT_TRUE(PMath::InverseV(i0));
+		EXPECT_TRUE(PMath::InverseV(i1));
+
+		for (int n = 0; n < 4; n++)
+		{
+			EXPECT_DOUBLE_EQ(v0.data[n], v1.data[n]);
+
+			for (int m = 0; m < 4; m++)
+			{
+				EXPECT_DOUBLE_EQ(r0(n, m), r1(n, m));
+				EXPECT_NEAR(i0(n, m), i1(n, m), 1e-12);
+				EXPECT_DOUBLE_EQ(PMath::Transpose(m0)(n, m), m1(m, n));
+			}
+		}
+	}
+
+	TEST(Matrix4, SingularTests)
+	{
+		// Rank 3, last row equal to the second: the scalar path finds det == 0 exactly and every backend has to agree.
+		std::mt19937 gen(11);
+		std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+		std::vector<PMath::Matrix4Reg> ms(5), rs(5);
+		for (int i = 0; i < 200; i++)
+		{
+			float e[12];
+			for (float& x : e)
+			{
+				x = dist(gen);
+			}
+
+			PMath::Matrix4 m(e[0], e[1], e[2], e[3],
+							 e[4], e[5], e[6], e[7],
+							 e[8], e[9], e[10], e[11],
+							 e[4], e[5], e[6], e[7]);
+			PMath::Matrix4Reg mr(e[0], e[1], e[2], e[3],
+								 e[4], e[5], e[6], e[7],
+								 e[8], e[9], e[10], e[11],
+								 e[4], e[5], e[6], e[7]);
+			PMath::Matrix4Regd md(e[0], e[1], e[2], e[3],
+								  e[4], e[5], e[6], e[7],
+								  e[8], e[9], e[10], e[11],
+								  e[4], e[5], e[6], e[7]);
+
+			EXPECT_FALSE(PMath::Inverse(m).has_value());
+			EXPECT_FALSE(PMath::Inverse(mr).has_value());
+			EXPECT_FALSE(PMath::Inverse(md).has_value());
+			EXPECT_FALSE(PMath::InverseV(mr));
+
+			ms[i % 5] = mr;
+			if (i % 5 == 4)
+			{
+				EXPECT_FALSE(PMath::Inverse(std::span<const PMath::Matrix4Reg>(ms), std::span<PMath::Matrix4Reg>(rs)));
+			}
+		}
+	}
+
+	TEST(Matrix4, TransformTests)
+	{
+		PMath::Matrix4Reg m0(2.0f, 0.5f, 1.0f, 3.0f,
+							 1.0f, 3.0f, 0.0f, 1.0f,
+							 0.0f, 1.0f, 4.0f, 2.0f,
+							 0.0f, 0.0f, 0.0f, 1.0f);
+		PMath::Matrix4 m1(2.0f, 0.5f, 1.0f, 3.0f,
+						  1.0f, 3.0f, 0.0f, 1.0f,
+						  0.0f, 1.0f, 4.0f, 2.0f,
+						  0.0f, 0.0f, 0.0f, 1.0f);
+
+		// Odd count to cover the tails of the unrolled kernels.
+		std::vector<PMath::Vector3Reg> v(7);
+		std::vector<PMath::Vector4Reg> v4(7);
+		for (int i = 0; i < 7; i++)
+		{
+			v[i] = PMath::Vector3Reg(0.5f * i, 2.0f - i, 1.0f);
+			v4[i] = PMath::Vector4Reg(0.5f * i, 2.0f - i, 1.0f, 0.5f);
+		}
+
+		std::vector<PMath::Vector3Reg> p(7), d(7);
+		std::vector<PMath::Vector4Reg> r4(7);
+		PMath::TransformPoints(m0, v, p);
+		PMath::TransformDirections(m0, v, d);
+		PMath::Transform(m0, v4, r4);
+
+		PMath::Vector3SoA s0, s1;
+		PMath::Gather(s0, v.data(), v.size());
+		PMath::TransformPoints(m0, s0, s1);
+
+		for (int i = 0; i < 7; i++)
+		{
+			PMath::Vector4 p1 = m1 * PMath::Vector4(v[i].x, v[i].y, v[i].z, 1.0f);
+			PMath::Vector4 d1 = m1 * PMath::Vector4(v[i].x, v[i].y, v[i].z, 0.0f);
+			PMath::Vector4 r1 = m1 * PMath::Vector4(v4[i].x, v4[i].y, v4[i].z, v4[i].w);
+
+			EXPECT_NEAR(p[i].x, p1.x, P_FLT_INAC);
+			EXPECT_NEAR(p[i].y, p1.y, P_FLT_INAC);
+			EXPECT_NEAR(p[i].z, p1.z, P_FLT_INAC);
+			EXPECT_NEAR(d[i].x, d1.x, P_FLT_INAC);
+			EXPECT_NEAR(d[i].y, d1.y, P_FLT_INAC);
+			EXPECT_NEAR(d[i].z, d1.z, P_FLT_INAC);
+			EXPECT_NEAR(r4[i].x, r1.x, P_FLT_INAC);
+			EXPECT_NEAR(r4[i].w, r1.w, P_FLT_INAC);
+			EXPECT_NEAR(s1.x[i], p1.x, P_FLT_INAC);
+			EXPECT_NEAR(s1.z[i], p1.z, P_FLT_INAC);
+		}
+
+		// In place
+		PMath::TransformPoints(m0, v, v);
+		for (int i = 0; i < 7; i++)
+			EXPECT_TRUE(v[i].x == p[i].x && v[i].y == p[i].y && v[i].z == p[i].z);
 	}
 
 } // namespace MatrixTests
 
+namespace QuaternionTests
+{
+	TEST(Quaternion, OperatorTests)
+	{
+		// 90 degrees around z and x
+		PMath::QuaternionReg qz = PMath::FromAxisAngle(PMath::Vector3Reg(0.0f, 0.0f, 1.0f), P_PI_FLT / 2.0f);
+		PMath::QuaternionReg qx = PMath::FromAxisAngle(PMath::Vector3Reg(1.0f, 0.0f, 0.0f), P_PI_FLT / 2.0f);
+		PMath::Quaternion fz(qz.x, qz.y, qz.z, qz.w);
+		PMath::Quaternion fx(qx.x, qx.y, qx.z, qx.w);
+
+		PMath::QuaternionReg q0 = qz * qx;
+		PMath::Quaternion q1 = fz * fx;
+
+		EXPECT_NEAR(q0.x, 0.5f, P_FLT_INAC);
+		EXPECT_NEAR(q0.y, 0.5f, P_FLT_INAC);
+		EXPECT_NEAR(q0.z, 0.5f, P_FLT_INAC);
+		EXPECT_NEAR(q0.w, 0.5f, P_FLT_INAC);
+		EXPECT_TRUE(q1 == PMath::Quaternion(0.5f, 0.5f, 0.5f, 0.5f));
+
+		// qx is applied first: x stays x and is then rotated onto y.
+		PMath::Vector3Reg v0 = q0 * PMath::Vector3Reg(1.0f, 0.0f, 0.0f);
+		EXPECT_NEAR(v0.x, 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(v0.y, 1.0f, P_FLT_INAC);
+		EXPECT_NEAR(v0.z, 0.0f, P_FLT_INAC);
+
+		PMath::Vector3 v1 = q1 * PMath::Vector3(0.0f, 1.0f, 0.0f);
+		EXPECT_NEAR(v1.x, 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(v1.y, 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(v1.z, 1.0f, P_FLT_INAC);
+
+		q0 *= 2.0f;
+		EXPECT_TRUE(q0 == PMath::QuaternionReg(1.0f, 1.0f, 1.0f, 1.0f));
+		q0 = q0 / 2.0f - PMath::QuaternionReg(0.5f, 0.5f, 0.5f, 0.0f);
+		EXPECT_TRUE(q0 == PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 0.5f));
+		EXPECT_TRUE(q0 != -q0);
+	}
+
+	TEST(Quaternion, FunctionTests)
+	{
+		PMath::QuaternionReg q0 = PMath::Normalize(PMath::QuaternionReg(1.0f, -2.0f, 0.5f, 3.0f));
+		PMath::QuaternionReg q1 = PMath::Normalize(PMath::QuaternionReg(0.5f, -1.0f, 2.0f, 1.0f));
+
+		EXPECT_TRUE(PMath::IsNormalized(q0));
+		EXPECT_TRUE(q0 * PMath::Conjugate(q0) == PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 1.0f));
+		EXPECT_TRUE(PMath::Inverse(PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 2.0f)) == PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 0.5f));
+
+		// Matrix conversion matches rotation and round trips.
+		PMath::Vector3Reg v(1.0f, 2.0f, -3.0f);
+		PMath::Vector3Reg r0 = PMath::Rotate(q0, v);
+		PMath::Vector4Reg r1 = PMath::ToMatrix4(q0) * PMath::Vector4Reg(v.x, v.y, v.z, 0.0f);
+		EXPECT_NEAR(r0.x, r1.x, P_FLT_INAC);
+		EXPECT_NEAR(r0.y, r1.y, P_FLT_INAC);
+		EXPECT_NEAR(r0.z, r1.z, P_FLT_INAC);
+		EXPECT_TRUE(PMath::QuaternionReg(PMath::ToMatrix4(q0)) == q0);
+
+		// Euler angles: yaw around z
+		PMath::Quaternion qe(PMath::Vector3(P_PI_FLT / 2.0f, 0.0f, 0.0f));
+		EXPECT_TRUE(qe == PMath::FromAxisAngle(PMath::Vector3(0.0f, 0.0f, 1.0f), P_PI_FLT / 2.0f));
+
+		// Slerp keeps constant angular velocity and takes the shortest path.
+		PMath::QuaternionReg s0 = PMath::Slerp(PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 1.0f), q0, 0.5f);
+		PMath::QuaternionReg s1 = PMath::Slerp(PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 1.0f), -q0, 0.5f);
+		EXPECT_TRUE(PMath::IsNormalized(s0));
+		EXPECT_TRUE(s0 * s0 == q0);
+		EXPECT_TRUE(s0 == s1);
+		EXPECT_TRUE(PMath::Slerp(q0, q1, 0.0f) == q0);
+		EXPECT_TRUE(PMath::Slerp(q0, q1, 1.0f) == q1);
+		EXPECT_TRUE(PMath::NLerp(q0, q1, 1.0f) == q1);
+		EXPECT_TRUE(PMath::Slerp(q0, -q1, 1.0f) == q1);
+
+		// Batch slerp, odd count to cover the tails.
+		std::vector<PMath::QuaternionReg> a(11), b(11), r(11);
+		for (int i = 0; i < 11; i++)
+		{
+			a[i] = PMath::Normalize(PMath::QuaternionReg(0.1f * i, 1.0f, -0.5f, 1.0f - 0.2f * i));
+			b[i] = PMath::Normalize(PMath::QuaternionReg(-1.0f, 0.3f * i, 0.5f, 0.25f));
+		}
+		b[3] = a[3];
+
+		PMath::Slerp(r.data(), a.data(), b.data(), 0.3f, r.size());
+		for (int i = 0; i < 11; i++)
+		{
+			PMath::QuaternionReg e = PMath::Slerp(a[i], b[i], 0.3f);
+			EXPECT_NEAR(r[i].x, e.x, P_FLT_INAC_LARGE);
+			EXPECT_NEAR(r[i].y, e.y, P_FLT_INAC_LARGE);
+			EXPECT_NEAR(r[i].z, e.z, P_FLT_INAC_LARGE);
+			EXPECT_NEAR(r[i].w, e.w, P_FLT_INAC_LARGE);
+		}
+	}
+
+	TEST(Quaternion, DoubleTests)
+	{
+		PMath::QuaternionRegd q0 = PMath::FromAxisAngle(PMath::Vector3Regd(0.0, 1.0, 0.0), P_PI / 2.0);
+		PMath::Quaterniond q1 = PMath::FromAxisAngle(PMath::Vector3d(0.0, 1.0, 0.0), P_PI / 2.0);
+
+		PMath::QuaternionRegd m0 = q0 * q0;
+		PMath::Quaterniond m1 = q1 * q1;
+		EXPECT_NEAR(m0.y, m1.y, P_FLT_INAC);
+		EXPECT_NEAR(m0.w, m1.w, P_FLT_INAC);
+
+		PMath::Vector3Regd v0 = q0 * PMath::Vector3Regd(0.0, 0.0, 1.0);
+		EXPECT_NEAR(v0.x, 1.0, P_FLT_INAC);
+		EXPECT_NEAR(v0.z, 0.0, P_FLT_INAC);
+
+		PMath::QuaternionRegd s0 = PMath::Slerp(PMath::QuaternionRegd(0.0, 0.0, 0.0, 1.0), m0, 0.5);
+		EXPECT_NEAR(s0.y, q0.y, P_FLT_INAC);
+		EXPECT_NEAR(s0.w, q0.w, P_FLT_INAC);
+	}
+} // namespace QuaternionTests
+
+namespace TransformTests
+{
+	TEST(Transform, OperatorTests)
+	{
+		PMath::TransformReg a(PMath::FromAxisAngle(PMath::Vector3Reg(0.0f, 0.0f, 1.0f), P_PI_FLT / 2.0f), PMath::Vector3Reg(1.0f, 2.0f, 3.0f), PMath::Vector3Reg(2.0f));
+		PMath::TransformReg b(PMath::FromAxisAngle(PMath::Vector3Reg(1.0f, 0.0f, 0.0f), P_PI_FLT / 2.0f), PMath::Vector3Reg(-1.0f, 0.0f, 2.0f));
+		PMath::Vector3Reg p(0.5f, -1.0f, 2.0f);
+
+		// Scale, then rotation, then translation: (0.5, -1, 2) -> (1, -2, 4) -> (2, 1, 4) -> (3, 3, 7)
+		EXPECT_TRUE(PMath::TransformPoint(a, p) == PMath::Vector3Reg(3.0f, 3.0f, 7.0f));
+		EXPECT_TRUE(PMath::TransformDirection(a, p) == PMath::Vector3Reg(2.0f, 1.0f, 4.0f));
+
+		// b is applied first.
+		PMath::TransformReg ab = a * b;
+		EXPECT_TRUE(PMath::TransformPoint(ab, p) == PMath::TransformPoint(a, PMath::TransformPoint(b, p)));
+		EXPECT_TRUE(ab != a);
+
+		ab = a;
+		ab *= b;
+		EXPECT_TRUE(ab == a * b);
+
+		// Scalar version gives the same result.
+		PMath::Transformf fa(PMath::Quaternion(a.rotation.x, a.rotation.y, a.rotation.z, a.rotation.w), PMath::Vector3(1.0f, 2.0f, 3.0f), PMath::Vector3(2.0f, 2.0f, 2.0f));
+		PMath::Transformf fb(PMath::Quaternion(b.rotation.x, b.rotation.y, b.rotation.z, b.rotation.w), PMath::Vector3(-1.0f, 0.0f, 2.0f));
+		PMath::Vector3 f0 = PMath::TransformPoint(fa * fb, PMath::Vector3(0.5f, -1.0f, 2.0f));
+		EXPECT_NEAR(f0.x, PMath::TransformPoint(ab, p).x, P_FLT_INAC);
+		EXPECT_NEAR(f0.y, PMath::TransformPoint(ab, p).y, P_FLT_INAC);
+		EXPECT_NEAR(f0.z, PMath::TransformPoint(ab, p).z, P_FLT_INAC);
+	}
+
+	TEST(Transform, FunctionTests)
+	{
+		PMath::TransformReg a(PMath::Normalize(PMath::QuaternionReg(1.0f, -2.0f, 0.5f, 3.0f)), PMath::Vector3Reg(1.0f, 2.0f, 3.0f), PMath::Vector3Reg(0.5f));
+		PMath::Vector3Reg p(0.5f, -1.0f, 2.0f);
+
+		// Inverse undoes the transform.
+		EXPECT_TRUE(PMath::TransformPoint(PMath::Inverse(a), PMath::TransformPoint(a, p)) == p);
+		EXPECT_TRUE(a * PMath::Inverse(a) == PMath::TransformReg(PMath::QuaternionReg(0.0f, 0.0f, 0.0f, 1.0f), PMath::Vector3Reg(0.0f)));
+
+		PMath::TransformReg b = a;
+		PMath::InverseV(b);
+		EXPECT_TRUE(b == PMath::Inverse(a));
+		EXPECT_TRUE(PMath::QuaternionReg(b) == PMath::Conjugate(a.rotation));
+
+		// Matrix conversion, with non-uniform scale.
+		PMath::TransformReg c(a.rotation, a.translation, PMath::Vector3Reg(1.0f, 2.0f, 3.0f));
+		PMath::Vector3Reg r0 = PMath::TransformPoint(c, p);
+		PMath::Vector4Reg r1 = PMath::ToMatrix4(c) * PMath::Vector4Reg(p.x, p.y, p.z, 1.0f);
+		EXPECT_NEAR(r0.x, r1.x, P_FLT_INAC);
+		EXPECT_NEAR(r0.y, r1.y, P_FLT_INAC);
+		EXPECT_NEAR(r0.z, r1.z, P_FLT_INAC);
+		EXPECT_NEAR(r1.w, 1.0f, P_FLT_INAC);
+
+		PMath::Transformf f(PMath::Quaternion(c.rotation.x, c.rotation.y, c.rotation.z, c.rotation.w), PMath::Vector3(1.0f, 2.0f, 3.0f), PMath::Vector3(1.0f, 2.0f, 3.0f));
+		PMath::Vector4 r2 = PMath::ToMatrix4(f) * PMath::Vector4(p.x, p.y, p.z, 1.0f);
+		EXPECT_NEAR(r0.x, r2.x, P_FLT_INAC);
+		EXPECT_NEAR(r0.y, r2.y, P_FLT_INAC);
+		EXPECT_NEAR(r0.z, r2.z, P_FLT_INAC);
+		EXPECT_NEAR(r2.w, 1.0f, P_FLT_INAC);
+	}
+
+	TEST(Transform, DoubleTests)
+	{
+		PMath::TransformRegd a(PMath::FromAxisAngle(PMath::Vector3Regd(0.0, 1.0, 0.0), P_PI / 2.0), PMath::Vector3Regd(1.0, 2.0, 3.0), PMath::Vector3Regd(2.0));
+		PMath::Vector3Regd p(1.0, 0.0, 0.0);
+
+		PMath::Vector3Regd r0 = PMath::TransformPoint(a, p);
+		EXPECT_NEAR(r0.x, 1.0, P_FLT_INAC);
+		EXPECT_NEAR(r0.y, 2.0, P_FLT_INAC);
+		EXPECT_NEAR(r0.z, 1.0, P_FLT_INAC);
+
+		PMath::Vector3Regd r1 = PMath::TransformPoint(PMath::Inverse(a), r0);
+		EXPECT_NEAR(r1.x, 1.0, P_FLT_INAC);
+		EXPECT_NEAR(r1.y, 0.0, P_FLT_INAC);
+		EXPECT_NEAR(r1.z, 0.0, P_FLT_INAC);
+
+		PMath::Vector4Regd r2 = PMath::ToMatrix4(a * a) * PMath::Vector4Regd(1.0, 0.0, 0.0, 1.0);
+		PMath::Vector3Regd r3 = PMath::TransformPoint(a, r0);
+		EXPECT_NEAR(r2.x, r3.x, P_FLT_INAC);
+		EXPECT_NEAR(r2.y, r3.y, P_FLT_INAC);
+		EXPECT_NEAR(r2.z, r3.z, P_FLT_INAC);
+	}
+} // namespace TransformTests
+
+namespace FrustumTests
+{
+	// Scaled clip space: visible is [-10, 10] x [-10, 10] x [0, 10].
+	static const PMath::Matrix4Reg ortho(0.1f, 0.0f, 0.0f, 0.0f,
+										 0.0f, 0.1f, 0.0f, 0.0f,
+										 0.0f, 0.0f, 0.1f, 0.0f,
+										 0.0f, 0.0f, 0.0f, 1.0f);
+
+	// Perspective along +z with 90 degree fov, near 1 and far 2.
+	static const PMath::Matrix4Reg persp(1.0f, 0.0f, 0.0f, 0.0f,
+										 0.0f, 1.0f, 0.0f, 0.0f,
+										 0.0f, 0.0f, 2.0f, -2.0f,
+										 0.0f, 0.0f, 1.0f, 0.0f);
+
+	TEST(Frustum, FunctionTests)
+	{
+		PMath::FrustumReg f(ortho);
+
+		EXPECT_TRUE(PMath::IsVisible(f, PMath::Vector3Reg(0.0f, 0.0f, 5.0f)));
+		EXPECT_TRUE(PMath::IsVisible(f, PMath::Vector3Reg(-9.0f, 9.0f, 9.0f)));
+		EXPECT_FALSE(PMath::IsVisible(f, PMath::Vector3Reg(11.0f, 0.0f, 5.0f)));
+		EXPECT_FALSE(PMath::IsVisible(f, PMath::Vector3Reg(0.0f, 0.0f, -1.0f)));
+
+		EXPECT_TRUE(PMath::IsVisible(f, PMath::AABBReg(PMath::Vector3Reg(9.0f, 9.0f, 9.0f), PMath::Vector3Reg(12.0f, 12.0f, 12.0f))));
+		EXPECT_FALSE(PMath::IsVisible(f, PMath::AABBReg(PMath::Vector3Reg(11.0f, 0.0f, 0.0f), PMath::Vector3Reg(12.0f, 1.0f, 1.0f))));
+		EXPECT_FALSE(PMath::IsVisible(f, PMath::AABBReg(PMath::Vector3Reg(0.0f, 0.0f, -3.0f), PMath::Vector3Reg(1.0f, 1.0f, -1.0f))));
+
+		EXPECT_TRUE(PMath::IsVisible(f, PMath::SphereReg(0.0f, -11.0f, 5.0f, 2.0f)));
+		EXPECT_FALSE(PMath::IsVisible(f, PMath::SphereReg(0.0f, -11.0f, 5.0f, 0.5f)));
+
+		// OpenGL depth: near plane moves to z = -10.
+		PMath::FrustumReg g(ortho, false);
+		EXPECT_TRUE(PMath::IsVisible(g, PMath::Vector3Reg(0.0f, 0.0f, -5.0f)));
+		EXPECT_FALSE(PMath::IsVisible(g, PMath::Vector3Reg(0.0f, 0.0f, -11.0f)));
+
+		PMath::FrustumReg p(persp);
+		EXPECT_TRUE(PMath::IsVisible(p, PMath::Vector3Reg(0.0f, 0.0f, 1.5f)));
+		EXPECT_TRUE(PMath::IsVisible(p, PMath::Vector3Reg(1.4f, -1.4f, 1.5f)));
+		EXPECT_FALSE(PMath::IsVisible(p, PMath::Vector3Reg(1.9f, 0.0f, 1.5f)));
+		EXPECT_FALSE(PMath::IsVisible(p, PMath::Vector3Reg(0.0f, 0.0f, 0.5f)));
+		EXPECT_FALSE(PMath::IsVisible(p, PMath::Vector3Reg(0.0f, 0.0f, 2.5f)));
+
+		EXPECT_FALSE(PMath::IsVisible(p, PMath::SphereReg(1.9f, 0.0f, 1.5f, 0.1f)));
+		EXPECT_TRUE(PMath::IsVisible(p, PMath::SphereReg(1.9f, 0.0f, 1.5f, 0.5f)));
+
+		PMath::Frustum h(PMath::Matrix4(1.0f, 0.0f, 0.0f, 0.0f,
+										0.0f, 1.0f, 0.0f, 0.0f,
+										0.0f, 0.0f, 2.0f, -2.0f,
+										0.0f, 0.0f, 1.0f, 0.0f));
+		EXPECT_TRUE(PMath::IsVisible(h, PMath::AABB(PMath::Vector3(1.4f, 0.0f, 1.4f), PMath::Vector3(1.8f, 0.2f, 1.6f))));
+		EXPECT_FALSE(PMath::IsVisible(h, PMath::AABB(PMath::Vector3(1.8f, 0.0f, 1.0f), PMath::Vector3(2.0f, 0.2f, 1.2f))));
+		EXPECT_FALSE(PMath::IsVisible(h, PMath::Sphere(1.9f, 0.0f, 1.5f, 0.1f)));
+	}
+
+	TEST(Frustum, BatchTests)
+	{
+		// 70 bounds cover full blocks, a partial block and the word boundaries.
+		constexpr size_t n = 70;
+
+		PMath::AABBReg boxes[n];
+		PMath::SphereReg spheres[n];
+
+		for (size_t i = 0; i < n; i++)
+		{
+			float x = (float)((int)(i * 7) % 31) - 15.0f;
+			float y = (float)((int)(i * 11) % 29) - 14.0f;
+			float z = (float)((int)(i * 5) % 23) - 6.0f;
+			float e = 0.5f + (float)(i % 4);
+
+			boxes[i] = PMath::AABBReg(PMath::Vector3Reg(x - e, y - e, z - e), PMath::Vector3Reg(x + e, y + e, z + e));
+			spheres[i] = PMath::SphereReg(x, y, z, e);
+		}
+
+		for (const PMath::Matrix4Reg& m : { ortho, persp })
+		{
+			PMath::FrustumReg f(m);
+
+			Phanes::Core::Types::uint32 visibleBoxes[3] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+			Phanes::Core::Types::uint32 visibleSpheres[3] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+
+			size_t countBoxes = PMath::IsVisible(f, boxes, n, visibleBoxes);
+			size_t countSpheres = PMath::IsVisible(f, spheres, n, visibleSpheres);
+
+			size_t expectedBoxes = 0;
+			size_t expectedSpheres = 0;
+
+			for (size_t i = 0; i < n; i++)
+			{
+				bool box = PMath::IsVisible(f, boxes[i]);
+				bool sphere = PMath::IsVisible(f, spheres[i]);
+
+				EXPECT_EQ(((visibleBoxes[i / 32] >> (i % 32)) & 1u) != 0, box);
+				EXPECT_EQ(((visibleSpheres[i / 32] >> (i % 32)) & 1u) != 0, sphere);
+
+				expectedBoxes += box;
+				expectedSpheres += sphere;
+			}
+
+			// Bits past n are cleared.
+			EXPECT_EQ(visibleBoxes[2] >> (n % 32), 0u);
+			EXPECT_EQ(visibleSpheres[2] >> (n % 32), 0u);
+
+			EXPECT_EQ(countBoxes, expectedBoxes);
+			EXPECT_EQ(countSpheres, expectedSpheres);
+			EXPECT_GT(countBoxes, 0u);
+			EXPECT_LT(countBoxes, n);
+		}
+	}
+
+	TEST(Frustum, DoubleTests)
+	{
+		PMath::FrustumRegd f(PMath::Matrix4Regd(0.1, 0.0, 0.0, 0.0,
+												0.0, 0.1, 0.0, 0.0,
+												0.0, 0.0, 0.1, 0.0,
+												0.0, 0.0, 0.0, 1.0));
+
+		PMath::AABBRegd boxes[3] = { PMath::AABBRegd(PMath::Vector3Regd(9.0), PMath::Vector3Regd(12.0)),
+									 PMath::AABBRegd(PMath::Vector3Regd(11.0), PMath::Vector3Regd(12.0)),
+									 PMath::AABBRegd(PMath::Vector3Regd(-1.0), PMath::Vector3Regd(1.0)) };
+
+		Phanes::Core::Types::uint32 visible = 0;
+		EXPECT_EQ(PMath::IsVisible(f, boxes, 3, &visible), 2u);
+		EXPECT_EQ(visible, 0x5u);
+
+		PMath::SphereRegd spheres[2] = { PMath::SphereRegd(0.0, 0.0, -2.0, 1.0), PMath::SphereRegd(0.0, 0.0, -2.0, 3.0) };
+		EXPECT_EQ(PMath::IsVisible(f, spheres, 2, &visible), 1u);
+		EXPECT_EQ(visible, 0x2u);
+	}
+} // namespace FrustumTests
+
+namespace RayPacketTests
+{
+	template <typename T>
+	static PMath::TRay<T, false> MakeRay(T ox, T oy, T oz, T dx, T dy, T dz)
+	{
+		return PMath::TRay<T, false>(PMath::TVector3<T, false>(dx, dy, dz), PMath::TVector3<T, false>(ox, oy, oz));
+	}
+
+	template <typename T>
+	static void FillRays(PMath::TRay<T, false>* rays)
+	{
+		rays[0] = MakeRay<T>(-5, 0, 0, 1, 0, 0);		// through the center
+		rays[1] = MakeRay<T>(-5, 2, 0, 1, 0, 0);		// passes above
+		rays[2] = MakeRay<T>(0, 0, 0, 0, 1, 0);			// starts inside
+		rays[3] = MakeRay<T>(5, 0, 0, 1, 0, 0);			// points away
+		rays[4] = MakeRay<T>(-5, -5, 0, 1, 1, 0);		// diagonal
+		rays[5] = MakeRay<T>(0, 5, 0, 0, -2, 0);		// not normalized
+		rays[6] = MakeRay<T>(0.5, 5, 0.5, 0, -1, 0);
+		rays[7] = MakeRay<T>(0, 0, -5, 0, 0, 2);
+	}
+
+	TEST(RayPacket, FunctionTests)
+	{
+		PMath::TRay<float, false> rays[8];
+		FillRays(rays);
+
+		PMath::RayPacket8 p(rays);
+		PMath::RayPacket4 lo(rays);
+		PMath::RayPacket4 hi(rays + 4);
+
+		EXPECT_EQ(p.Get(5), rays[5]);
+
+		alignas(32) float t[8];
+		alignas(16) float t4[4];
+
+		// Box
+		PMath::AABBReg b(PMath::Vector3Reg(-1.0f), PMath::Vector3Reg(1.0f));
+		EXPECT_EQ(PMath::RayIntersect(b, p, t), 0xF5u);
+		EXPECT_FLOAT_EQ(t[0], 4.0f);
+		EXPECT_FLOAT_EQ(t[2], 0.0f);
+		EXPECT_FLOAT_EQ(t[4], 4.0f);
+		EXPECT_FLOAT_EQ(t[5], 2.0f);
+		EXPECT_FLOAT_EQ(t[6], 4.0f);
+		EXPECT_FLOAT_EQ(t[7], 2.0f);
+
+		EXPECT_EQ(PMath::RayIntersect(b, lo, t4), 0x5u);
+		EXPECT_FLOAT_EQ(t4[0], 4.0f);
+		EXPECT_EQ(PMath::RayIntersect(b, hi, t4), 0xFu);
+		EXPECT_FLOAT_EQ(t4[1], 2.0f);
+
+		// Plane x = 0
+		PMath::PlaneReg pl(PMath::Vector3Reg(1.0f, 0.0f, 0.0f), 0.0f);
+		EXPECT_EQ(PMath::RayIntersect(pl, p, t), 0x13u);
+		EXPECT_FLOAT_EQ(t[0], 5.0f);
+		EXPECT_FLOAT_EQ(t[1], 5.0f);
+		EXPECT_FLOAT_EQ(t[4], 5.0f);
+		EXPECT_EQ(PMath::RayIntersect(pl, hi, t4), 0x1u);
+
+		// Plane z = 0
+		EXPECT_EQ(PMath::RayIntersect(PMath::PlaneReg(PMath::Vector3Reg(0.0f, 0.0f, 1.0f), 0.0f), p, t), 0x80u);
+		EXPECT_FLOAT_EQ(t[7], 2.5f);
+
+		// Sphere
+		PMath::SphereReg s(0.0f, 0.0f, 0.0f, 1.0f);
+		EXPECT_EQ(PMath::RayIntersect(s, p, t), 0xF5u);
+		EXPECT_FLOAT_EQ(t[0], 4.0f);
+		EXPECT_FLOAT_EQ(t[2], 1.0f);
+		EXPECT_NEAR(t[4], 5.0f - 0.5f * sqrt(2.0f), P_FLT_INAC);
+		EXPECT_FLOAT_EQ(t[5], 2.0f);
+		EXPECT_NEAR(t[6], 5.0f - sqrt(0.5f), P_FLT_INAC);
+		EXPECT_FLOAT_EQ(t[7], 2.0f);
+
+		// Ray 1 touches the sphere.
+		EXPECT_EQ(PMath::RayIntersect(PMath::Sphere(0.0f, 3.0f, 0.0f, 1.0f), p, t), 0x66u);
+		EXPECT_FLOAT_EQ(t[2], 2.0f);
+		EXPECT_FLOAT_EQ(t[5], 0.5f);
+	}
+
+	TEST(RayPacket, DoubleTests)
+	{
+		PMath::TRay<double, false> rays[4];
+		PMath::TRay<double, false> rays8[8];
+		FillRays(rays8);
+		std::copy(rays8 + 4, rays8 + 8, rays);
+
+		PMath::RayPacket4d p(rays);
+		alignas(32) double t[4];
+
+		EXPECT_EQ(PMath::RayIntersect(PMath::AABBRegd(PMath::Vector3Regd(-1.0), PMath::Vector3Regd(1.0)), p, t), 0xFu);
+		EXPECT_DOUBLE_EQ(t[1], 2.0);
+
+		EXPECT_EQ(PMath::RayIntersect(PMath::SphereRegd(0.0, 0.0, 0.0, 1.0), p, t), 0xFu);
+		EXPECT_DOUBLE_EQ(t[3], 2.0);
+
+		EXPECT_EQ(PMath::RayIntersect(PMath::PlaneRegd(PMath::Vector3Regd(0.0, 0.0, 1.0), 0.0), p, t), 0x8u);
+		EXPECT_DOUBLE_EQ(t[3], 2.5);
+	}
+} // namespace RayPacketTests
+
+namespace TriangleTests
+{
+	TEST(Triangle, FunctionTests)
+	{
+		PMath::Triangle tri(PMath::Vector3(0.0f, 0.0f, 0.0f), PMath::Vector3(1.0f, 0.0f, 0.0f), PMath::Vector3(0.0f, 1.0f, 0.0f));
+
+		EXPECT_TRUE(PMath::GetNormal(tri) == PMath::Vector3(0.0f, 0.0f, 1.0f));
+		EXPECT_FLOAT_EQ(PMath::GetArea(tri), 0.5f);
+		EXPECT_NEAR(PMath::GetCenter(tri).x, 1.0f / 3.0f, P_FLT_INAC);
+
+		PMath::TriangleHit hit;
+		EXPECT_TRUE(PMath::RayIntersect(tri, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, -2.0f), PMath::Vector3(0.25f, 0.5f, 1.0f)), hit));
+		EXPECT_FLOAT_EQ(hit.t, 0.5f);
+		EXPECT_FLOAT_EQ(hit.u, 0.25f);
+		EXPECT_FLOAT_EQ(hit.v, 0.5f);
+
+		// Back side
+		EXPECT_TRUE(PMath::RayIntersect(tri, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, 1.0f), PMath::Vector3(0.25f, 0.25f, -1.0f)), hit));
+		EXPECT_FLOAT_EQ(hit.t, 1.0f);
+
+		// Outside, behind and parallel
+		EXPECT_FALSE(PMath::RayIntersect(tri, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, -1.0f), PMath::Vector3(0.75f, 0.75f, 1.0f)), hit));
+		EXPECT_FALSE(PMath::RayIntersect(tri, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, 1.0f), PMath::Vector3(0.25f, 0.25f, 1.0f)), hit));
+		EXPECT_FALSE(PMath::RayIntersect(tri, PMath::TRay<float, false>(PMath::Vector3(1.0f, 0.0f, 0.0f), PMath::Vector3(-1.0f, 0.25f, 1.0f)), hit));
+	}
+
+	template <typename T>
+	static bool NearestHit(const PMath::TTriangleSoA<T>& tris, const PMath::TRay<T, false>& r, PMath::TTriangleHit<T>& hit)
+	{
+		bool found = false;
+
+		for (size_t i = 0; i < tris.Size(); i++)
+		{
+			PMath::TTriangleHit<T> h;
+			if (PMath::RayIntersect(tris.Get(i), r, h) && (!found || h.t < hit.t))
+			{
+				hit = h;
+				hit.index = i;
+				found = true;
+			}
+		}
+
+		return found;
+	}
+
+	TEST(Triangle, BatchTests)
+	{
+		// Stack of 37 triangles, triangle i lies at z = (17 * i + 3) % 37.
+		PMath::TriangleSoA tris(37);
+
+		for (size_t i = 0; i < tris.Size(); i++)
+		{
+			float z = (float)((17 * i + 3) % 37);
+			tris.Set(i, PMath::Triangle(PMath::Vector3(-1.0f, -1.0f, z), PMath::Vector3(2.0f, -1.0f, z), PMath::Vector3(-1.0f, 2.0f, z)));
+		}
+
+		EXPECT_EQ(tris.PaddedSize(), 40u);
+		EXPECT_TRUE(tris.Get(5) == PMath::Triangle(PMath::Vector3(-1.0f, -1.0f, 14.0f), PMath::Vector3(2.0f, -1.0f, 14.0f), PMath::Vector3(-1.0f, 2.0f, 14.0f)));
+
+		PMath::TriangleHit hit;
+		PMath::TriangleHit expected;
+
+		PMath::TRay<float, false> up(PMath::Vector3(0.0f, 0.0f, 1.0f), PMath::Vector3(0.1f, 0.2f, -10.0f));
+		EXPECT_TRUE(PMath::RayIntersect(tris, up, hit));
+		EXPECT_EQ(hit.index, 2u);
+		EXPECT_FLOAT_EQ(hit.t, 10.0f);
+		EXPECT_NEAR(hit.u, 1.1f / 3.0f, P_FLT_INAC);
+		EXPECT_NEAR(hit.v, 1.2f / 3.0f, P_FLT_INAC);
+
+		EXPECT_FALSE(PMath::RayIntersect(tris, up, hit, 10.0f));
+		EXPECT_TRUE(PMath::RayIntersect(tris, up, hit, 10.5f));
+
+		PMath::TRay<float, false> down(PMath::Vector3(0.0f, 0.0f, -2.0f), PMath::Vector3(0.5f, 0.5f, 100.0f));
+		EXPECT_TRUE(PMath::RayIntersect(tris, down, hit));
+		EXPECT_EQ(hit.index, 15u);
+		EXPECT_FLOAT_EQ(hit.t, 32.0f);
+
+		EXPECT_FALSE(PMath::RayIntersect(tris, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, 1.0f), PMath::Vector3(1.5f, 1.5f, -10.0f)), hit));
+
+		// Shrinking keeps the padding degenerate.
+		tris.Resize(10);
+		EXPECT_TRUE(NearestHit(tris, down, expected));
+		EXPECT_TRUE(PMath::RayIntersect(tris, down, hit));
+		EXPECT_EQ(hit.index, expected.index);
+		EXPECT_FLOAT_EQ(hit.t, expected.t);
+
+		PMath::TriangleSoA copy = tris;
+		EXPECT_TRUE(PMath::RayIntersect(copy, up, hit));
+		EXPECT_TRUE(NearestHit(tris, up, expected));
+		EXPECT_EQ(hit.index, expected.index);
+
+		PMath::TriangleSoAd trisd(3);
+		trisd.Set(0, PMath::Triangled(PMath::Vector3d(0.0, 0.0, 3.0), PMath::Vector3d(1.0, 0.0, 3.0), PMath::Vector3d(0.0, 1.0, 3.0)));
+		trisd.Set(1, PMath::Triangled(PMath::Vector3d(0.0, 0.0, 1.0), PMath::Vector3d(1.0, 0.0, 1.0), PMath::Vector3d(0.0, 1.0, 1.0)));
+		trisd.Set(2, PMath::Triangled(PMath::Vector3d(0.0, 0.0, 2.0), PMath::Vector3d(1.0, 0.0, 2.0), PMath::Vector3d(0.0, 1.0, 2.0)));
+
+		PMath::TriangleHitd hitd;
+		EXPECT_TRUE(PMath::RayIntersect(trisd, PMath::TRay<double, false>(PMath::Vector3d(0.0, 0.0, 1.0), PMath::Vector3d(0.2, 0.3, 0.0)), hitd));
+		EXPECT_EQ(hitd.index, 1u);
+		EXPECT_DOUBLE_EQ(hitd.t, 1.0);
+		EXPECT_DOUBLE_EQ(hitd.u, 0.2);
+		EXPECT_DOUBLE_EQ(hitd.v, 0.3);
+	}
+} // namespace TriangleTests
+
+namespace BVHTests
+{
+	// Entry parameter of a ray into a box, or -1 on a miss.
+	template <typename T>
+	static T BoxEntry(const PMath::TAABB<T, false>& b, const PMath::TRay<T, false>& r)
+	{
+		T o[3] = { r.origin.x, r.origin.y, r.origin.z };
+		T d[3] = { r.direction.x, r.direction.y, r.direction.z };
+		T lo[3] = { b.min.x, b.min.y, b.min.z };
+		T hi[3] = { b.max.x, b.max.y, b.max.z };
+
+		T tmin = (T)0.0;
+		T tmax = std::numeric_limits<T>::max();
+
+		for (int k = 0; k < 3; k++)
+		{
+			T t0 = (lo[k] - o[k]) / d[k];
+			T t1 = (hi[k] - o[k]) / d[k];
+
+			tmin = std::max(tmin, std::min(t0, t1));
+			tmax = std::min(tmax, std::max(t0, t1));
+		}
+
+		return (tmin <= tmax) ? tmin : (T)-1.0;
+	}
+
+	template <typename T>
+	static bool Overlaps(const PMath::TAABB<T, false>& a, const PMath::TAABB<T, false>& b)
+	{
+		return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y && a.min.z <= b.max.z && b.min.z <= a.max.z;
+	}
+
+	// Compares ray casts and box queries against brute force.
+	template <typename T>
+	static void CheckBVH(const PMath::TBVH<T>& bvh, const std::vector<PMath::TAABB<T, false>>& boxes)
+	{
+		using Vec = PMath::TVector3<T, false>;
+
+		unsigned int seed = 7;
+		auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return (T)(seed >> 8) / (T)(1u << 24); };
+
+		for (int i = 0; i < 200; i++)
+		{
+			PMath::TRay<T, false> r(Vec(next() - (T)0.5, next() - (T)0.5, next() + (T)0.1), Vec(next() * 20, next() * 20, (T)-5.0));
+
+			T expected = std::numeric_limits<T>::max();
+			for (const auto& b : boxes)
+			{
+				T t = BoxEntry(b, r);
+				expected = (t >= (T)0.0 && t < expected) ? t : expected;
+			}
+
+			T tMax = std::numeric_limits<T>::max();
+			bool hit = PMath::RayCast(bvh, r, tMax, [&](Phanes::Core::Types::uint32 p, T& tBest)
+				{
+					T t = BoxEntry(boxes[p], r);
+					if (t >= (T)0.0 && t < tBest)
+					{
+						tBest = t;
+						return true;
+					}
+					return false;
+				});
+
+			EXPECT_EQ(hit, expected != std::numeric_limits<T>::max());
+			EXPECT_EQ(tMax, expected);
+		}
+
+		for (int i = 0; i < 50; i++)
+		{
+			Vec c(next() * 20, next() * 20, next() * 20);
+			PMath::TAABB<T, false> q(c - Vec(next() * 3), c + Vec(next() * 3));
+
+			std::vector<Phanes::Core::Types::uint32> found;
+			PMath::Query(bvh, q, [&](Phanes::Core::Types::uint32 p)
+				{
+					if (Overlaps(boxes[p], q))
+					{
+						found.push_back(p);
+					}
+				});
+
+			std::vector<Phanes::Core::Types::uint32> expected;
+			for (size_t p = 0; p < boxes.size(); p++)
+			{
+				if (Overlaps(boxes[p], q))
+				{
+					expected.push_back((Phanes::Core::Types::uint32)p);
+				}
+			}
+
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(found, expected);
+		}
+	}
+
+	template <typename T>
+	static std::vector<PMath::TAABB<T, false>> RandomBoxes(size_t n)
+	{
+		using Vec = PMath::TVector3<T, false>;
+
+		std::vector<PMath::TAABB<T, false>> boxes(n);
+		unsigned int seed = 3;
+		auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return (T)(seed >> 8) / (T)(1u << 24); };
+
+		for (auto& b : boxes)
+		{
+			Vec c(next() * 20, next() * 20, next() * 20);
+			Vec e(next() * (T)0.5 + (T)0.01, next() * (T)0.5 + (T)0.01, next() * (T)0.5 + (T)0.01);
+			b = PMath::TAABB<T, false>(c - e, c + e);
+		}
+
+		return boxes;
+	}
+
+	TEST(BVH, FunctionTests)
+	{
+		static_assert(sizeof(PMath::TBVHNode<float>) == 32);
+		static_assert(sizeof(PMath::TBVHNode<double>) == 64);
+
+		std::vector<PMath::AABB> boxes = RandomBoxes<float>(5000);
+
+		PMath::BVH bvh;
+		PMath::Build(bvh, boxes.data(), boxes.size());
+
+		// Every primitive is referenced by exactly one leaf.
+		std::vector<int> refs(boxes.size(), 0);
+		for (const auto& n : bvh.nodes)
+		{
+			if (n.IsLeaf())
+			{
+				EXPECT_LE(n.count, PMath::BVH::MaxLeafSize);
+				for (Phanes::Core::Types::uint32 p = n.first; p < n.first + n.count; p++)
+				{
+					refs[bvh.indices[p]]++;
+				}
+			}
+		}
+		EXPECT_EQ(std::count(refs.begin(), refs.end(), 1), (long)boxes.size());
+
+		CheckBVH(bvh, boxes);
+
+		// Serial builds give the same tree.
+		PMath::BVH serial;
+		PMath::Build(serial, boxes.data(), boxes.size(), 1);
+		EXPECT_EQ(serial.indices, bvh.indices);
+		EXPECT_EQ(serial.nodes.size(), bvh.nodes.size());
+
+		// Refit after moving every box.
+		for (size_t i = 0; i < boxes.size(); i++)
+		{
+			PMath::Vector3 offset((float)(i % 7), (float)(i % 3) * -2.0f, 1.0f);
+			boxes[i] = PMath::AABB(boxes[i].min + offset, boxes[i].max + offset);
+		}
+
+		PMath::Refit(bvh, boxes.data());
+		CheckBVH(bvh, boxes);
+
+		// Empty and coincident primitives
+		PMath::BVH empty;
+		PMath::Build(empty, boxes.data(), 0);
+		float tMax = 1.0f;
+		EXPECT_FALSE(PMath::RayCast(empty, PMath::TRay<float, false>(PMath::Vector3(0.0f, 0.0f, 1.0f), PMath::Vector3(0.0f)), tMax, [](Phanes::Core::Types::uint32, float&) { return true; }));
+
+		std::vector<PMath::AABB> same(100, PMath::AABB(PMath::Vector3(1.0f), PMath::Vector3(2.0f)));
+		PMath::BVH stacked;
+		PMath::Build(stacked, same.data(), same.size());
+		CheckBVH(stacked, same);
+	}
+
+	TEST(BVH, DoubleTests)
+	{
+		std::vector<PMath::AABBd> boxes = RandomBoxes<double>(700);
+
+		PMath::BVHd bvh;
+		PMath::Build(bvh, boxes.data(), boxes.size());
+		CheckBVH(bvh, boxes);
+	}
+} // namespace BVHTests
+
+namespace SpatialHashGridTests
+{
+	TEST(SpatialHashGrid, BuildQueryTests)
+	{
+		// Cells, including the cell boundaries, the clamped range and NaN.
+		std::vector<PMath::Vector3Reg> cp = { PMath::Vector3Reg(0.0f, -0.5f, 4.0f), PMath::Vector3Reg(-4.0f, 3.99f, -4.01f), PMath::Vector3Reg(1.0e30f, -1.0e30f, std::numeric_limits<float>::quiet_NaN()) };
+		std::vector<PMath::IntVector3Reg> cc(cp.size());
+		PMath::PositionToCell(cc.data(), cp.data(), cp.size(), 0.25f);
+
+		EXPECT_TRUE(cc[0] == PMath::IntVector3Reg(0, -1, 1));
+		EXPECT_TRUE(cc[1] == PMath::IntVector3Reg(-1, 0, -2));
+		EXPECT_TRUE(cc[2] == PMath::IntVector3Reg((1 << 20) - 1, -(1 << 20), -(1 << 20)));
+		EXPECT_EQ(cc[0].w, 0);
+		EXPECT_TRUE(PMath::PositionToCell(PMath::Vector3(-4.0f, 3.99f, -4.01f), 0.25f) == PMath::IntVector3(-1, 0, -2));
+
+		std::vector<PMath::Vector3Reg> ps;
+		Phanes::Core::Types::uint32 seed = 12345;
+		auto rnd = [&seed]() { seed = seed * 1664525u + 1013904223u; return (float)(seed >> 8) / (float)(1u << 24) * 100.0f - 50.0f; };
+
+		for (int i = 0; i < 5000; i++)
+		{
+			float x = rnd(), y = rnd(), z = rnd();
+			ps.emplace_back(x, y, z);
+		}
+
+		PMath::SpatialHashGrid grid;
+		PMath::Build(grid, ps.data(), ps.size(), 4.0f);
+
+		ASSERT_EQ(grid.indices.size(), ps.size());
+		EXPECT_EQ(grid.cellStart.back(), ps.size());
+		EXPECT_TRUE(std::is_sorted(grid.keys.begin(), grid.keys.end()));
+
+		std::vector<int> seen(ps.size(), 0);
+		for (Phanes::Core::Types::uint32 i : grid.indices)
+		{
+			seen[i]++;
+		}
+		EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+
+		for (size_t i = 0; i < ps.size(); i += 7)
+		{
+			PMath::SpatialHashRange r = PMath::Find(grid, PMath::PositionToCell(ps[i], grid.invCellSize));
+			EXPECT_TRUE(std::find(grid.indices.begin() + r.begin, grid.indices.begin() + r.end, (Phanes::Core::Types::uint32)i) != grid.indices.begin() + r.end);
+		}
+		EXPECT_EQ(PMath::Find(grid, PMath::IntVector3Reg(100, 100, 100)).Size(), 0);
+
+		// Box: exactly the points of the cells overlapping the box, one range per row.
+		PMath::AABBReg box(PMath::Vector3Reg(-10.0f, -3.0f, 5.0f), PMath::Vector3Reg(9.0f, 6.0f, 13.0f));
+		std::vector<PMath::SpatialHashRange> ranges;
+		size_t n = PMath::QueryRanges(grid, box, ranges);
+		EXPECT_LE(ranges.size(), 3 * 3);
+
+		PMath::IntVector3Reg lo = PMath::PositionToCell(box.min, grid.invCellSize);
+		PMath::IntVector3Reg hi = PMath::PositionToCell(box.max, grid.invCellSize);
+
+		std::vector<int> found(ps.size(), 0);
+		for (const PMath::SpatialHashRange& r : ranges)
+		{
+			for (Phanes::Core::Types::uint32 j = r.begin; j < r.end; j++)
+			{
+				found[grid.indices[j]]++;
+			}
+		}
+
+		size_t expected = 0;
+		for (size_t i = 0; i < ps.size(); i++)
+		{
+			PMath::IntVector3Reg c = PMath::PositionToCell(ps[i], grid.invCellSize);
+			bool inside = c.x >= lo.x && c.x <= hi.x && c.y >= lo.y && c.y <= hi.y && c.z >= lo.z && c.z <= hi.z;
+
+			expected += inside;
+			EXPECT_EQ(found[i], inside ? 1 : 0);
+		}
+		EXPECT_EQ(n, expected);
+
+		// Sphere: every point inside is reported once, and fewer candidates than the bounding box.
+		PMath::SphereReg sphere(PMath::Vector3Reg(3.0f, -7.0f, 1.0f), 9.0f);
+		ranges.clear();
+		n = PMath::QueryRanges(grid, sphere, ranges);
+
+		std::fill(found.begin(), found.end(), 0);
+		for (const PMath::SpatialHashRange& r : ranges)
+		{
+			for (Phanes::Core::Types::uint32 j = r.begin; j < r.end; j++)
+			{
+				found[grid.indices[j]]++;
+			}
+		}
+
+		std::vector<PMath::SpatialHashRange> boxRanges;
+		size_t nb = PMath::QueryRanges(grid, PMath::AABBReg(sphere.center - PMath::Vector3Reg(9.0f), sphere.center + PMath::Vector3Reg(9.0f)), boxRanges);
+		EXPECT_LT(n, nb);
+
+		for (size_t i = 0; i < ps.size(); i++)
+		{
+			EXPECT_LE(found[i], 1);
+
+			if (PMath::SqrMagnitude(ps[i] - sphere.center) <= 81.0f)
+			{
+				EXPECT_EQ(found[i], 1);
+			}
+		}
+
+		// Rebuild with less points, and empty.
+		PMath::Build(grid, ps.data(), 10, 4.0f);
+		EXPECT_EQ(grid.indices.size(), 10);
+		EXPECT_EQ(grid.cellStart.back(), 10);
+
+		PMath::Build(grid, ps.data(), 0, 4.0f);
+		ranges.clear();
+		EXPECT_EQ(PMath::QueryRanges(grid, box, ranges), 0);
+		EXPECT_TRUE(ranges.empty());
+
+		// Double positions give the same cells.
+		std::vector<PMath::Vector3Regd> pd;
+		for (const PMath::Vector3Reg& p : ps)
+		{
+			pd.emplace_back((double)p.x, (double)p.y, (double)p.z);
+		}
+
+		PMath::SpatialHashGridd gridd;
+		PMath::Build(gridd, pd.data(), pd.size(), 4.0);
+		PMath::Build(grid, ps.data(), ps.size(), 4.0f);
+
+		EXPECT_TRUE(gridd.keys == grid.keys);
+		EXPECT_TRUE(gridd.indices == grid.indices);
+	}
+} // namespace SpatialHashGridTests
+
 namespace Misc
 {
 
@@ -1610,6 +3353,467 @@ namespace Misc
 										PMath::Point4(4.0f, -1.0f, 3.0f, -5.0f)),
 						11.224972f);
 	}
+
+	TEST(Constexpr, FunctionTests)
+	{
+		// Evaluated on the scalar path at compile time, must match the SIMD path at runtime.
+		constexpr PMath::Vector2Reg a2 = PMath::Vector2Reg(1.0, 2.0) * 3.0 - PMath::Vector2Reg(0.5, 0.5);
+		constexpr PMath::Vector3Reg a3 = PMath::CrossP(PMath::Vector3Reg(1.0f, 0.0f, 0.0f), PMath::Vector3Reg(0.0f, 1.0f, 0.0f)) + 2.0f;
+		constexpr PMath::Vector4Reg a4 = PMath::Vector4Reg(1.0f, 2.0f, 3.0f, 4.0f) / PMath::Vector4Reg(2.0f);
+
+		static_assert(a2.x == 2.5 && a2.y == 5.5);
+		static_assert(a3 == PMath::Vector3Reg(2.0f, 2.0f, 3.0f));
+		static_assert(PMath::DotP(a4, a4) == 7.5f);
+
+		constexpr PMath::Matrix4Reg m4(2.0f, 0.0f, 0.0f, 1.0f,
+									   0.0f, 3.0f, 0.0f, 2.0f,
+									   0.0f, 0.0f, 4.0f, 3.0f,
+									   0.0f, 0.0f, 0.0f, 1.0f);
+		constexpr PMath::Matrix4Reg p4 = m4 * PMath::Transpose(m4);
+		constexpr PMath::Vector4Reg v4 = m4 * PMath::Vector4Reg(1.0f, 1.0f, 1.0f, 1.0f);
+
+		static_assert(PMath::Determinant(m4) == 24.0f);
+		static_assert(p4(0, 0) == 5.0f && p4(1, 1) == 13.0f && p4(0, 3) == 1.0f);
+		static_assert(v4 == PMath::Vector4Reg(3.0f, 5.0f, 7.0f, 1.0f));
+
+		constexpr PMath::Matrix3Regd m3(1.0, 2.0, 3.0,
+										0.0, 1.0, 4.0,
+										5.0, 6.0, 0.0);
+		static_assert(PMath::Determinant(m3) == 1.0);
+		static_assert((m3 * PMath::Vector3Regd(1.0, 1.0, 1.0)).z == 11.0);
+
+		// Same values on the runtime path.
+		PMath::Matrix4Reg rm4 = m4;
+		EXPECT_TRUE(rm4 * PMath::Transpose(rm4) == p4);
+		EXPECT_FLOAT_EQ(PMath::Determinant(rm4), 24.0f);
+		EXPECT_TRUE(rm4 * PMath::Vector4Reg(1.0f, 1.0f, 1.0f, 1.0f) == v4);
+		EXPECT_TRUE(PMath::CrossP(PMath::Vector3Reg(1.0f, 0.0f, 0.0f), PMath::Vector3Reg(0.0f, 1.0f, 0.0f)) + 2.0f == a3);
+
+		PMath::Matrix3Regd rm3 = m3;
+		EXPECT_DOUBLE_EQ(PMath::Determinant(rm3), 1.0);
+	}
+
+	TEST(FastMath, ErrorBounds)
+	{
+		auto ulp = [](float a, float b) {
+			Phanes::Core::Types::int32 ia, ib;
+			std::memcpy(&ia, &a, 4);
+			std::memcpy(&ib, &b, 4);
+			return std::abs((Phanes::Core::Types::int64)ia - ib);
+		};
+
+		// [1, 4) covers every mantissa of both exponent parities, which is all the estimate tables depend on.
+		Phanes::Core::Types::int64 rsqrtEst = 0, rsqrt = 0, rcpEst = 0, rcp = 0;
+		for (Phanes::Core::Types::uint32 bits = 0x3F800000u; bits < 0x40800000u; bits += 61)
+		{
+			float x;
+			std::memcpy(&x, &bits, 4);
+			float invSqrt = (float)(1.0 / std::sqrt((double)x));
+			float recip = (float)(1.0 / (double)x);
+
+			rsqrtEst = std::max(rsqrtEst, ulp(PMath::FastInvSqrt<false>(x), invSqrt));
+			rsqrt = std::max(rsqrt, ulp(PMath::FastInvSqrt(x), invSqrt));
+			rcpEst = std::max(rcpEst, ulp(PMath::FastRecip<false>(x), recip));
+			rcp = std::max(rcp, ulp(PMath::FastRecip(x), recip));
+		}
+
+		// Against Normalize / Magnitude of the same backend.
+		Phanes::Core::Types::int64 normEst = 0, norm = 0, magEst = 0, soa = 0;
+		std::vector<PMath::Vector3Reg> vs;
+		for (int i = 1; i < 2000; i++)
+		{
+			PMath::Vector3Reg v(std::sin(i * 0.37f) * (1 + i % 97), std::cos(i * 1.3f) * (1 + i % 13), std::sin(i * 2.1f) + 0.01f * i);
+			vs.push_back(v);
+			PMath::Vector3Reg n0 = PMath::FastNormalize<false>(v);
+			PMath::Vector3Reg n1 = PMath::FastNormalize(v);
+			PMath::Vector3Reg n = PMath::Normalize(v);
+
+			normEst = std::max({ normEst, ulp(n0.x, n.x), ulp(n0.y, n.y), ulp(n0.z, n.z) });
+			norm = std::max({ norm, ulp(n1.x, n.x), ulp(n1.y, n.y), ulp(n1.z, n.z) });
+			magEst = std::max(magEst, ulp(PMath::FastMagnitude<false>(v), PMath::Magnitude(v)));
+			EXPECT_FLOAT_EQ(PMath::FastMagnitude(v), PMath::Magnitude(v));
+		}
+
+		PMath::Vector3SoA sv, sn, sf;
+		PMath::Gather(sv, vs.data(), vs.size());
+		PMath::Normalize(sn, sv);
+		PMath::FastNormalize(sf, sv);
+		for (size_t i = 0; i < vs.size(); i++)
+		{
+			soa = std::max({ soa, ulp(sf.x[i], sn.x[i]), ulp(sf.y[i], sn.y[i]), ulp(sf.z[i], sn.z[i]) });
+		}
+
+		std::cout << "[ FastMath ] max ULP (estimate / refined): rsqrt " << rsqrtEst << " / " << rsqrt << ", rcp " << rcpEst << " / " << rcp
+				  << ", normalize " << normEst << " / " << norm << ", magnitude " << magEst << " / 0" << ", SoA normalize - / " << soa << std::endl;
+
+		// Documented bounds of FastInvSqrt and FastRecip, the vectors add the rounding of the dot product.
+		EXPECT_LE(rsqrtEst, 6144);
+		EXPECT_LE(rcpEst, 6144);
+		EXPECT_LE(rsqrt, 4);
+		EXPECT_LE(rcp, 4);
+		EXPECT_LE(normEst, 6144 + 2);
+		EXPECT_LE(norm, 4 + 2);
+		EXPECT_LE(magEst, 6144 + 2);
+		EXPECT_LE(soa, 4 + 2);
+
+		// Zero vectors stay zero, like Normalize.
+		EXPECT_TRUE(PMath::FastNormalize(PMath::Vector3Reg(0.0f, 0.0f, 0.0f)) == PMath::Vector3Reg(0.0f, 0.0f, 0.0f));
+		EXPECT_FLOAT_EQ(PMath::FastMagnitude(PMath::Vector4Reg(0.0f, 0.0f, 0.0f, 0.0f)), 0.0f);
+		EXPECT_NEAR(PMath::FastMagnitude(PMath::Vector4Reg(1.0f, 2.0f, 2.0f, 4.0f)), 5.0f, 5.0f * P_FLT_INAC);
+
+		PMath::Vector3Regd vd(1.0, 2.0, 2.0);
+		EXPECT_DOUBLE_EQ(PMath::FastMagnitude(vd), 3.0);
+		EXPECT_DOUBLE_EQ(PMath::FastNormalizeV(vd).z, 2.0 / 3.0);
+
+		PMath::Plane pl(0.0f, 3.0f, 4.0f, 10.0f);
+		PMath::PlaneFastNormalizeV(pl);
+		EXPECT_NEAR(pl.y, 0.6f, P_FLT_INAC);
+		EXPECT_NEAR(pl.z, 0.8f, P_FLT_INAC);
+		EXPECT_NEAR(pl.d, 2.0f, P_FLT_INAC);
+
+		// d aliases the padding of the normal and must survive the scaling.
+		PMath::Plane pl1(0.0f, 3.0f, 4.0f, 10.0f);
+		PMath::PlaneNormalizeV(pl1);
+		EXPECT_NEAR(pl1.d, 2.0f, P_FLT_INAC);
+	}
+
+	TEST(Transcendental, ErrorBounds)
+	{
+		auto ulp = [](float a, float b) {
+			Phanes::Core::Types::int32 ia, ib;
+			std::memcpy(&ia, &a, 4);
+			std::memcpy(&ib, &b, 4);
+			return std::abs((Phanes::Core::Types::int64)ia - ib);
+		};
+		auto ulpd = [](double a, double b) {
+			Phanes::Core::Types::int64 ia, ib;
+			std::memcpy(&ia, &a, 8);
+			std::memcpy(&ib, &b, 8);
+			return std::abs(ia - ib);
+		};
+
+		// Odd length, so the vector kernels run their tail as well.
+		std::vector<float> v(4099), s(v.size()), c(v.size()), s1(v.size()), c1(v.size());
+		std::vector<double> vd(v.size()), sd(v.size()), cd(v.size());
+		for (size_t i = 0; i < v.size(); i++)
+		{
+			v[i] = ((float)i - 2049.0f) * 0.731f;
+			vd[i] = ((double)i - 2049.0) * 0.731;
+		}
+
+		PMath::Sin<float>(s, v);
+		PMath::Cos<float>(c, v);
+		PMath::SinCos<float>(s1, c1, v);
+		PMath::Sin<double>(sd, vd);
+		PMath::Cos<double>(cd, vd);
+
+		// Against the double result, so libm's own rounding does not count.
+		Phanes::Core::Types::int64 sinErr = 0, cosErr = 0, sinErrD = 0, cosErrD = 0;
+		for (size_t i = 0; i < v.size(); i++)
+		{
+			sinErr = std::max({ sinErr, ulp(s[i], (float)std::sin((double)v[i])), ulp(s1[i], s[i]) });
+			cosErr = std::max({ cosErr, ulp(c[i], (float)std::cos((double)v[i])), ulp(c1[i], c[i]) });
+			sinErrD = std::max(sinErrD, ulpd(sd[i], std::sin(vd[i])));
+			cosErrD = std::max(cosErrD, ulpd(cd[i], std::cos(vd[i])));
+		}
+
+		std::cout << "[ Transcendental ] max ULP: sin " << sinErr << ", cos " << cosErr << ", sin (double) " << sinErrD << ", cos (double) " << cosErrD << std::endl;
+
+		EXPECT_LE(sinErr, 2);
+		EXPECT_LE(cosErr, 2);
+		EXPECT_LE(sinErrD, 2);
+		EXPECT_LE(cosErrD, 2);
+
+		// Shorter result spans stop the batch, the elements behind them stay untouched.
+		std::vector<float> ts(v.size(), 42.0f), tc(v.size(), 42.0f);
+		PMath::Sin<float>(std::span(ts).first(13), v);
+		PMath::SinCos<float>(std::span(ts).first(21), std::span(tc).first(9), v);
+
+		EXPECT_TRUE(std::equal(ts.begin(), ts.begin() + 9, s.begin()));
+		EXPECT_TRUE(std::equal(tc.begin(), tc.begin() + 9, c.begin()));
+		EXPECT_TRUE(std::all_of(ts.begin() + 13, ts.end(), [](float x) { return x == 42.0f; }));
+		EXPECT_TRUE(std::all_of(tc.begin() + 9, tc.end(), [](float x) { return x == 42.0f; }));
+
+		// Large angles, mixed with small ones in the same vectors. Beyond the fast range the elements go to libm.
+		std::vector<float> vl = { 8000.5f, -8191.0f, 1.0e4f, -3.0f, 123456.7f, 1.0e6f, -1.0e6f, 0.5f, 3.3e7f, 1.0e8f, -7.7e7f };
+		std::vector<double> vld = { 9.9e5, -3.0, 1.0e6 * 1.5, 1.0e8, -1.0e8, 0.25, 1.0e12, -2.5e12, 1.0e4, 5.0e7, 3.0e15 };
+		std::vector<float> sl(vl.size()), cl(vl.size()), il(vl);
+		std::vector<double> sld(vld.size()), cld(vld.size());
+
+		PMath::SinCos<float>(sl, cl, vl);
+		PMath::Sin<float>(il, il);
+		PMath::SinCos<double>(sld, cld, vld);
+
+		for (size_t i = 0; i < vl.size(); i++)
+		{
+			EXPECT_LE(std::abs(sl[i]), 1.0f);
+			EXPECT_LE(std::abs(cl[i]), 1.0f);
+			EXPECT_LE(ulp(sl[i], (float)std::sin((double)vl[i])), 2);
+			EXPECT_LE(ulp(cl[i], (float)std::cos((double)vl[i])), 2);
+			EXPECT_EQ(il[i], sl[i]);
+
+			EXPECT_LE(std::abs(sld[i]), 1.0);
+			EXPECT_LE(std::abs(cld[i]), 1.0);
+			EXPECT_LE(ulpd(sld[i], std::sin(vld[i])), 2);
+			EXPECT_LE(ulpd(cld[i], std::cos(vld[i])), 2);
+		}
+
+		// Angle and the euler constructor go through acos / sincos of the same backend.
+		PMath::Vector3Reg a(1.0f, 2.0f, -0.5f), b(-3.0f, 0.25f, 4.0f);
+		EXPECT_NEAR(PMath::Angle(a, b), std::acos(PMath::DotP(a, b) / (PMath::Magnitude(a) * PMath::Magnitude(b))), P_FLT_INAC);
+		EXPECT_NEAR(PMath::Angle(PMath::Vector3Regd(1.0, 0.0, 0.0), PMath::Vector3Regd(0.0, 1.0, 0.0)), P_PI * 0.5, P_FLT_INAC);
+
+		for (int i = 0; i < 64; i++)
+		{
+			PMath::Vector3 e(i * 0.173f - 5.0f, i * 0.057f - 1.5f, i * -0.311f + 7.0f);
+			PMath::QuaternionReg q(PMath::Vector3Reg(e.x, e.y, e.z));
+			PMath::Quaternion r(e);
+			EXPECT_NEAR(q.x, r.x, P_FLT_INAC);
+			EXPECT_NEAR(q.y, r.y, P_FLT_INAC);
+			EXPECT_NEAR(q.z, r.z, P_FLT_INAC);
+			EXPECT_NEAR(q.w, r.w, P_FLT_INAC);
+		}
+
+#if P_INTRINSICS >= P_INTRINSICS_SSE
+		// Edge values of the register functions: the span API above only reaches sin / cos.
+		alignas(16) float o[4];
+		_mm_store_ps(o, PMath::SIMD::vec4_atan2(_mm_setr_ps(1.0f, -1.0f, 0.0f, -2.0f), _mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f)));
+		EXPECT_LE(ulp(o[0], (float)std::atan2(1.0, 1.0)), 3);
+		EXPECT_LE(ulp(o[1], (float)std::atan2(-1.0, -1.0)), 3);
+		EXPECT_LE(ulp(o[2], (float)P_PI), 3);
+		EXPECT_LE(ulp(o[3], (float)(-P_PI * 0.5)), 3);
+
+		_mm_store_ps(o, PMath::SIMD::vec4_acos(_mm_setr_ps(1.0f, -1.0f, 0.5f, -0.25f)));
+		EXPECT_FLOAT_EQ(o[0], 0.0f);
+		EXPECT_LE(ulp(o[1], (float)P_PI), 4);
+		EXPECT_LE(ulp(o[2], (float)std::acos(0.5)), 4);
+		EXPECT_LE(ulp(o[3], (float)std::acos(-0.25)), 4);
+
+		// Sweeps for the documented bounds, against the double result like sin / cos above. The worst known inputs go first.
+		Phanes::Core::Types::int64 atanErr = 0, acosErr = 0, atan2Err = 0;
+		for (int i = -65536; i <= 65536; i += 4)
+		{
+			__m128 x = _mm_setr_ps(i * 3.1e-5f, i * 1.7e-3f, i * 0.37f, i == -65536 ? -0.445772976f : i * 1.1e-6f);
+			__m128 c = _mm_setr_ps(i / 65536.0f, i / 65536.0f * 0.9999f, (i + 1) * 1.3e-6f, i == -65536 ? 0.914613426f : i * 1.52e-5f);
+
+			alignas(16) float xs[4], cs[4], oa[4], oc[4], o2[4];
+			_mm_store_ps(xs, x);
+			_mm_store_ps(cs, c);
+			_mm_store_ps(oa, PMath::SIMD::vec4_atan(x));
+			_mm_store_ps(oc, PMath::SIMD::vec4_acos(c));
+			_mm_store_ps(o2, PMath::SIMD::vec4_atan2(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 3, 2, 1))));
+
+			for (int k = 0; k < 4; k++)
+			{
+				atanErr = std::max(atanErr, ulp(oa[k], (float)std::atan((double)xs[k])));
+				acosErr = std::max(acosErr, ulp(oc[k], (float)std::acos((double)cs[k])));
+				atan2Err = std::max(atan2Err, ulp(o2[k], (float)std::atan2((double)xs[k], (double)xs[(k + 1) & 3])));
+			}
+		}
+
+		std::cout << "[ Transcendental ] max ULP: atan " << atanErr << ", acos " << acosErr << ", atan2 " << atan2Err << std::endl;
+
+		EXPECT_LE(atanErr, 3);
+		EXPECT_LE(acosErr, 4);
+		EXPECT_LE(atan2Err, 3);
+
+		// Signed zeros: pi is picked by the sign bit of x, so acos(-0) stays in [0, pi].
+		_mm_store_ps(o, PMath::SIMD::vec4_atan2(_mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f), _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f)));
+		EXPECT_LE(ulp(o[0], (float)std::atan2(1.0, -0.0)), 3);
+		EXPECT_LE(ulp(o[1], (float)std::atan2(-1.0, -0.0)), 3);
+		EXPECT_LE(ulp(o[2], (float)std::atan2(1.0, 0.0)), 3);
+		EXPECT_LE(ulp(o[3], (float)std::atan2(-1.0, 0.0)), 3);
+
+		_mm_store_ps(o, PMath::SIMD::vec4_atan2(_mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f), _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f)));
+		EXPECT_EQ(o[0], std::atan2(0.0f, -0.0f));
+		EXPECT_EQ(o[1], std::atan2(-0.0f, -0.0f));
+		EXPECT_TRUE(o[2] == 0.0f && !std::signbit(o[2]));
+		EXPECT_TRUE(o[3] == 0.0f && std::signbit(o[3]));
+
+		_mm_store_ps(o, PMath::SIMD::vec4_acos(_mm_setr_ps(-0.0f, 0.0f, -1e-30f, 1e-30f)));
+		for (int k = 0; k < 4; k++)
+		{
+			EXPECT_LE(ulp(o[k], (float)(P_PI * 0.5)), 3);
+		}
+
+		_mm_store_ps(o, PMath::SIMD::vec4_exp(_mm_setr_ps(0.0f, 1.0f, -100.0f, 100.0f)));
+		EXPECT_FLOAT_EQ(o[0], 1.0f);
+		EXPECT_LE(ulp(o[1], (float)std::exp(1.0)), 2);
+		EXPECT_LE(ulp(o[2], (float)std::exp(-100.0)), 2);
+		EXPECT_TRUE(std::isinf(o[3]));
+
+		_mm_store_ps(o, PMath::SIMD::vec4_log(_mm_setr_ps(1.0f, 1e-40f, 0.0f, -1.0f)));
+		EXPECT_FLOAT_EQ(o[0], 0.0f);
+		EXPECT_LE(ulp(o[1], (float)std::log((double)1e-40f)), 2);
+		EXPECT_TRUE(std::isinf(o[2]) && o[2] < 0.0f);
+		EXPECT_TRUE(std::isnan(o[3]));
+
+		_mm_store_ps(o, PMath::SIMD::vec4_pow(_mm_setr_ps(2.0f, 9.0f, 0.0f, 3.0f), _mm_setr_ps(10.0f, 0.5f, 0.0f, -2.0f)));
+		EXPECT_LE(ulp(o[0], 1024.0f), 16);
+		EXPECT_LE(ulp(o[1], 3.0f), 4);
+		EXPECT_FLOAT_EQ(o[2], 1.0f);
+		EXPECT_LE(ulp(o[3], 1.0f / 9.0f), 4);
+#endif
+
+#if P_INTRINSICS >= P_INTRINSICS_AVX
+		alignas(32) double od[4];
+		_mm256_store_pd(od, PMath::SIMD::vec4d_atan2(_mm256_setr_pd(1.0, -1.0, 0.0, -0.0), _mm256_setr_pd(-0.0, -0.0, -0.0, -0.0)));
+		EXPECT_LE(ulpd(od[0], std::atan2(1.0, -0.0)), 3);
+		EXPECT_LE(ulpd(od[1], std::atan2(-1.0, -0.0)), 3);
+		EXPECT_EQ(od[2], std::atan2(0.0, -0.0));
+		EXPECT_EQ(od[3], std::atan2(-0.0, -0.0));
+
+		_mm256_store_pd(od, PMath::SIMD::vec4d_acos(_mm256_setr_pd(-0.0, 0.0, -1e-300, 1e-300)));
+		for (int k = 0; k < 4; k++)
+		{
+			EXPECT_LE(ulpd(od[k], P_PI * 0.5), 3);
+		}
+
+#endif
+	}
+
+	TEST(Expression, LazyTests)
+	{
+		// Element-wise expressions equal the eager operators bit for bit (FMA contraction aside, see Expression.hpp).
+		PMath::Vector4Reg a(1.5f, -2.0f, 0.3f, 4.0f), b(0.25f, 7.0f, -1.1f, 2.0f), c(3.0f, 0.1f, 5.0f, -8.0f);
+		float s = 2.5f, t = -0.7f;
+
+		PMath::Vector4Reg r = PMath::Lazy(a) * s + PMath::Lazy(b) * t - c;
+		EXPECT_TRUE(r == a * s + b * t - c);
+
+		r = (PMath::Lazy(a) - b) / c * 3.0f + 1.0f;
+		EXPECT_TRUE(r == (a - b) / c * 3.0f + 1.0f);
+
+		r = 2.0f - PMath::Lazy(a) / 3.0f;
+		EXPECT_TRUE(r == 2.0f - a / 3.0f);
+
+		PMath::Vector4 u(1.5f, -2.0f, 0.3f, 4.0f), w(0.25f, 7.0f, -1.1f, 2.0f);
+		PMath::Vector4 ru = PMath::Lazy(u) / 3.0f + w * PMath::Lazy(u);
+		EXPECT_TRUE(ru == u / 3.0f + w * u);
+
+		PMath::Vector3Reg a3(1.5f, -2.0f, 0.3f), b3(0.25f, 7.0f, -1.1f);
+		PMath::Vector3Reg r3 = (PMath::Lazy(a3) + b3) * 0.5f - a3 / 7.0f;
+		PMath::Vector3Reg e3 = (a3 + b3) * 0.5f - a3 / 7.0f;
+		EXPECT_TRUE(r3 == e3);
+
+		PMath::Vector3 u3(1.5f, -2.0f, 0.3f), w3(0.25f, 7.0f, -1.1f);
+		PMath::Vector3 ru3 = PMath::Evaluate(PMath::Lazy(u3) * w3 - 1.0f);
+		EXPECT_TRUE(ru3 == u3 * w3 - 1.0f);
+		EXPECT_FLOAT_EQ(ru3.w, 0.0f);
+
+		PMath::Vector4Regd ad(1.5, -2.0, 0.3, 4.0), bd(0.25, 7.0, -1.1, 2.0);
+		PMath::Vector4Regd rd = PMath::Lazy(ad) * 0.1 + bd / 3.0;
+		EXPECT_TRUE(rd == ad * 0.1 + bd / 3.0);
+
+		// Matrix chains, right to left. Small integers keep the products exact.
+		PMath::Matrix4Reg A(1, 2, 0, 1, 0, 1, 3, 0, 2, 0, 1, 0, 0, 0, 0, 1);
+		PMath::Matrix4Reg B(0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 1);
+		PMath::Matrix4Reg C(2, 0, 0, 0, 0, 2, 0, 3, 0, 0, 2, 0, 1, 1, 1, 1);
+		PMath::Vector4Reg v(1.0f, -2.0f, 0.5f, 1.0f);
+
+		PMath::Matrix4Reg m = PMath::Lazy(A) * B * C;
+		EXPECT_TRUE(m == A * B * C);
+
+		m = A * (PMath::Lazy(B) * C) * A;
+		EXPECT_TRUE(m == A * B * C * A);
+
+		PMath::Vector4Reg p = PMath::Lazy(A) * B * C * v;
+		EXPECT_TRUE(p == A * B * C * v);
+
+		PMath::Matrix3 A3(1, 2, 0, 0, 1, 3, 2, 0, 1), B3(0, 1, 0, 1, 0, 0, 0, 0, 2);
+		PMath::Matrix3 m3 = B3 * PMath::Lazy(A3) * B3;
+		EXPECT_TRUE(m3 == B3 * A3 * B3);
+	}
+
+	TEST(Format, ToStringTests)
+	{
+		EXPECT_EQ(PMath::ToString(PMath::Vector2(1.5f, -2.0f)), "(1.500000, -2.000000)");
+		EXPECT_EQ(PMath::ToString(PMath::Vector3Reg(1.5f, -2.0f, 0.25f)), "(1.500000, -2.000000, 0.250000)");
+		EXPECT_EQ(PMath::ToString(PMath::IntVector3(1, -20, 300)), "(1, -20, 300)");
+		EXPECT_EQ(PMath::ToString(PMath::Matrix2(1.0f, 2.0f, 3.0f, 4.0f)), "([1.000000, 2.000000], [3.000000, 4.000000])");
+		EXPECT_EQ(PMath::ToString(PMath::Plane(0.0f, 1.0f, 0.0f, -2.0f)), "(0.000000, 1.000000, 0.000000, -2.000000)");
+		EXPECT_EQ(PMath::ToString(PMath::Quaternion(0.0f, 0.0f, 0.0f, 1.0f)), "(0.000000, 0.000000, 0.000000, 1.000000)");
+
+		// Rows, like before, and the same digits as std::to_string.
+		PMath::Matrix4d m(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 1e300);
+		std::string s = PMath::ToString(m);
+		EXPECT_EQ(s.substr(0, 46), "([1.000000, 2.000000, 3.000000, 4.000000], [5.");
+		EXPECT_EQ(s.substr(s.size() - std::to_string(1e300).size() - 2), std::to_string(1e300) + "])");
+	}
+
+	TEST(Format, FormatterTests)
+	{
+		// Same fmt as MathFormat.hpp, so the test covers SPDLOG_USE_STD_FORMAT builds as well.
+#ifdef SPDLOG_USE_STD_FORMAT
+		namespace pfmt = std;
+#else
+		namespace pfmt = fmt;
+#endif
+
+		PMath::Vector3Reg v(1.5f, -2.0f, 0.25f);
+		PMath::IntVector3 iv(1, -20, 300);
+		PMath::Matrix4 m(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.5f);
+		PMath::Plane pl(0.0f, 1.0f, 0.0f, -2.0f);
+		PMath::Quaternion q(0.0f, 0.0f, 0.0f, 1.0f);
+
+		// "{}" is the ToString layout.
+		EXPECT_EQ(pfmt::format("{}", v), PMath::ToString(v));
+		EXPECT_EQ(pfmt::format("{}", iv), PMath::ToString(iv));
+		EXPECT_EQ(pfmt::format("{}", m), PMath::ToString(m));
+		EXPECT_EQ(pfmt::format("{}", pl), PMath::ToString(pl));
+		EXPECT_EQ(pfmt::format("{}", q), PMath::ToString(q));
+
+		// The spec applies to every component.
+		EXPECT_EQ(pfmt::format("{:.3f}", v), "(1.500, -2.000, 0.250)");
+		EXPECT_EQ(pfmt::format("{:>4}", iv), "(   1,  -20,  300)");
+		EXPECT_EQ(pfmt::format("{:.3f}", m), "([1.000, 2.000, 3.000, 4.000], [5.000, 6.000, 7.000, 8.000], [9.000, 10.000, 11.000, 12.000], [13.000, 14.000, 15.000, 16.500])");
+		EXPECT_EQ(pfmt::format("{:.3f}", pl), "(0.000, 1.000, 0.000, -2.000)");
+		EXPECT_EQ(pfmt::format("{:.3f}", q), "(0.000, 0.000, 0.000, 1.000)");
+		EXPECT_EQ(pfmt::format("p = {:.1e} at {}", PMath::Vector2d(1500.0, -0.25), PMath::IntVector2(3, 4)), "p = (1.5e+03, -2.5e-01) at (3, 4)");
+	}
+
+#if P_SIMD_DISPATCH
+	TEST(SIMD, DispatchTests)
+	{
+		EXPECT_GE(PMath::SIMD::GetSIMDLevel(), P_INTRINSICS_SSE);
+		EXPECT_LE(PMath::SIMD::GetSIMDLevel(), PMath::SIMD::DetectSIMDLevel());
+
+		PMath::Vector3Reg v[13];
+		PMath::IntVector4Reg iv[13];
+		for (int i = 0; i < 13; i++)
+		{
+			v[i] = PMath::Vector3Reg(0.5f * i, -1.0f * i, 3.0f);
+			iv[i] = PMath::IntVector4Reg(i, -i, 3, 7);
+		}
+
+		PMath::Vector3SoA v0;
+		PMath::Gather(v0, v, 13);
+
+		// Every tier the host supports must give the same results.
+		for (int level = P_INTRINSICS_SSE; level <= PMath::SIMD::DetectSIMDLevel(); level++)
+		{
+			PMath::SIMD::SetSIMDLevel(level);
+			EXPECT_EQ(PMath::SIMD::GetSIMDLevel(), level);
+
+			PMath::Vector3SoA r;
+			float s[13];
+			PMath::IntVector4Reg ir[13];
+
+			PMath::Add(r, v0, v0);
+			PMath::DotP(s, v0, v0);
+			PMath::BatchMul(ir, iv, iv, 13);
+
+			for (int i = 0; i < 13; i++)
+			{
+				EXPECT_FLOAT_EQ(r.y[i], 2.0f * v[i].y);
+				EXPECT_FLOAT_EQ(s[i], v[i].x * v[i].x + v[i].y * v[i].y + v[i].z * v[i].z);
+				EXPECT_TRUE(ir[i] == PMath::IntVector4Reg(i * i, i * i, 9, 49));
+			}
+		}
+
+		PMath::SIMD::SetSIMDLevel(PMath::SIMD::DefaultSIMDLevel());
+	}
+#endif
 } // namespace Misc
 
 namespace Plane
@@ -1619,8 +3823,239 @@ namespace Plane
 		PMath::Plane pl1(3.0f / 5.4772255750f, -2.0f / 5.4772255750f, -3.0f / 5.4772255750f, 4.0f);
 		PMath::Plane pl2 = PMath::Plane(-0.526316f, -0.442105f, -0.726316f, 6.0f);
 	}
+
+	TEST(Plane, TransformTests)
+	{
+		// z = 1, rotated onto -y, scaled and moved by 5 along y: -y = -3
+		PMath::Transformf t(PMath::FromAxisAngle(PMath::Vector3(1.0f, 0.0f, 0.0f), P_PI_FLT / 2.0f), PMath::Vector3(0.0f, 5.0f, 0.0f), PMath::Vector3(2.0f, 2.0f, 2.0f));
+		PMath::Plane pl0 = PMath::Transform(PMath::Plane(0.0f, 0.0f, 1.0f, 1.0f), t);
+		EXPECT_NEAR(pl0.x, 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(pl0.y, -1.0f, P_FLT_INAC);
+		EXPECT_NEAR(pl0.z, 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(pl0.d, -3.0f, P_FLT_INAC);
+
+		// Non-uniform scale: transformed points stay on the transformed plane.
+		PMath::TransformReg tr(PMath::Normalize(PMath::QuaternionReg(1.0f, -2.0f, 0.5f, 3.0f)), PMath::Vector3Reg(1.0f, 2.0f, 3.0f), PMath::Vector3Reg(2.0f, 1.0f, 0.5f));
+		PMath::PlaneReg pl1(0.0f, 0.6f, 0.8f, 2.0f);
+		PMath::PlaneReg pl2 = pl1;
+		PMath::TransformV(pl2, tr);
+
+		PMath::Vector3Reg p = PMath::TransformPoint(tr, PMath::Vector3Reg(4.0f, 2.0f, 1.0f));
+		EXPECT_NEAR(pl2.x * p.x + pl2.y * p.y + pl2.z * p.z, pl2.d, P_FLT_INAC_LARGE);
+		EXPECT_NEAR(pl2.x * pl2.x + pl2.y * pl2.y + pl2.z * pl2.z, 1.0f, P_FLT_INAC);
+
+		PMath::Transformf tf(PMath::Quaternion(tr.rotation.x, tr.rotation.y, tr.rotation.z, tr.rotation.w), PMath::Vector3(1.0f, 2.0f, 3.0f), PMath::Vector3(2.0f, 1.0f, 0.5f));
+		PMath::Plane pl3 = PMath::Transform(PMath::Plane(0.0f, 0.6f, 0.8f, 2.0f), tf);
+		EXPECT_NEAR(pl3.x, pl2.x, P_FLT_INAC);
+		EXPECT_NEAR(pl3.y, pl2.y, P_FLT_INAC);
+		EXPECT_NEAR(pl3.z, pl2.z, P_FLT_INAC);
+		EXPECT_NEAR(pl3.d, pl2.d, P_FLT_INAC_LARGE);
+	}
+
+	TEST(Plane, IntersectTests)
+	{
+		PMath::Plane x(1.0f, 0.0f, 0.0f, 2.0f);
+		PMath::Plane y(0.0f, 1.0f, 0.0f, 3.0f);
+		PMath::Plane z(0.0f, 0.0f, 1.0f, -1.0f);
+
+		std::optional<PMath::TLine<float>> l = PMath::PlanesIntersect2(x, y);
+		ASSERT_TRUE(l.has_value());
+		EXPECT_TRUE(l->direction == PMath::Vector3(0.0f, 0.0f, 1.0f));
+		EXPECT_TRUE(l->base == PMath::Vector3(2.0f, 3.0f, 0.0f));
+		EXPECT_FALSE(PMath::PlanesIntersect2(x, PMath::Plane(1.0f, 0.0f, 0.0f, -4.0f)).has_value());
+
+		std::optional<PMath::Vector3> p = PMath::PlanesIntersect3(x, y, z);
+		ASSERT_TRUE(p.has_value());
+		EXPECT_TRUE(*p == PMath::Vector3(2.0f, 3.0f, -1.0f));
+
+		PMath::Plane tilted(0.6f, 0.8f, 0.0f, 5.0f);
+		p = PMath::PlanesIntersect3(tilted, y, z);
+		ASSERT_TRUE(p.has_value());
+		EXPECT_NEAR(PMath::PointDistance(tilted, *p), 0.0f, P_FLT_INAC);
+		EXPECT_NEAR(p->y, 3.0f, P_FLT_INAC);
+		EXPECT_NEAR(p->z, -1.0f, P_FLT_INAC);
+
+		Phanes::Ref<PMath::Vector3> pr = Phanes::MakeRef<PMath::Vector3>();
+		EXPECT_TRUE(PMath::PlanesIntersect3(tilted, y, z, pr));
+		EXPECT_TRUE(*pr == *p);
+
+		// Ray parameter is in units of the direction.
+		PMath::TRay<float, false> r(PMath::Vector3(1.0f, 1.0f, 1.0f), PMath::Vector3(0.0f, 0.0f, 2.0f));
+		PMath::PlaneHit h = PMath::RayIntersect(x, r);
+		EXPECT_TRUE(h.hit);
+		EXPECT_NEAR(h.t, 2.0f, P_FLT_INAC);
+		EXPECT_TRUE(h.point == PMath::Vector3(2.0f, 2.0f, 4.0f));
+
+		EXPECT_FALSE(PMath::RayIntersect(z, r));
+		EXPECT_TRUE(PMath::LineIntersect(z, PMath::TLine<float>(r.direction, r.origin)));
+		EXPECT_FALSE(PMath::RayIntersect(x, PMath::TRay<float, false>(PMath::Vector3(0.0f, 1.0f, 0.0f), r.origin)));
+
+		std::vector<PMath::TRay<float, false>> rays = { r, PMath::TRay<float, false>(PMath::Vector3(-1.0f, 0.0f, 0.0f), r.origin), PMath::TRay<float, false>(PMath::Vector3(0.5f, 0.0f, 0.0f), r.origin) };
+		std::vector<PMath::PlaneHit> hits(rays.size());
+		EXPECT_EQ(PMath::RayIntersect(x, rays, hits), 2);
+		EXPECT_TRUE(hits[0].hit && !hits[1].hit && hits[2].hit);
+		EXPECT_NEAR(hits[2].t, 4.0f, P_FLT_INAC);
+
+		Phanes::Ref<PMath::Vector3> rp = Phanes::MakeRef<PMath::Vector3>();
+		EXPECT_TRUE(PMath::RayIntersect(x, rays[2], rp));
+		EXPECT_TRUE(*rp == hits[2].point);
+	}
 } // namespace Plane
 
+namespace Archive
+{
+	TEST(Archive, ReadWriteTests)
+	{
+		std::string path = testing::TempDir() + "phanes_math_archive_test.pmar";
+
+		std::vector<PMath::Vector3Reg> vs;
+		std::vector<PMath::Matrix4Reg> ms;
+		std::vector<PMath::Plane> pls;
+		std::vector<PMath::Vector2d> v2s;
+
+		for (int i = 0; i < 100; i++)
+		{
+			vs.emplace_back(1.0f * i, 2.0f * i, -3.0f * i);
+			ms.push_back(PMath::Matrix4Reg(1.0f + i, 5.0f, 3.0f, 4.0f, 2.0f, 6.0f - i, 4.0f, 1.0f, 2.0f, -3.0f, 5.0f, 3.0f, 8.0f, -4.0f, 6.0f, -2.0f + i));
+			pls.emplace_back(0.0f, 1.0f, 0.0f, 0.5f * i);
+			v2s.emplace_back(0.25 * i, -0.5 * i);
+		}
+
+		{
+			PMath::ArchiveWriter w;
+			ASSERT_TRUE(w.Open(path.c_str()));
+
+			EXPECT_TRUE(w.WriteArray("positions", vs.data(), vs.size()));
+			EXPECT_TRUE(w.WriteArray("transforms", ms.data(), ms.size()));
+
+			// Streamed in chunks.
+			EXPECT_TRUE(w.Begin<PMath::Plane>("planes"));
+			EXPECT_FALSE(w.Begin<PMath::Plane>("nested"));
+			EXPECT_FALSE(w.Write(vs.data(), 1));
+			EXPECT_TRUE(w.Write(pls.data(), 60));
+			EXPECT_TRUE(w.Write(pls.data() + 60, 40));
+			EXPECT_TRUE(w.End());
+
+			EXPECT_TRUE(w.WriteArray("uv", v2s.data(), v2s.size()));
+			EXPECT_FALSE(w.Begin<PMath::Plane>("a name that is longer than the thirty one characters"));
+
+			EXPECT_TRUE(w.Close());
+			EXPECT_FALSE(w.IsOpen());
+		}
+
+		PMath::MappedArchive a;
+		ASSERT_TRUE(a.Open(path.c_str()));
+		ASSERT_EQ(a.Size(), 4);
+		EXPECT_STREQ(a.Name(2), "planes");
+		EXPECT_EQ(a.Count(2), 100);
+
+		std::span<const PMath::Matrix4Reg> m = a.Get<PMath::Matrix4Reg>("transforms");
+		ASSERT_EQ(m.size(), ms.size());
+		EXPECT_EQ((uintptr_t)m.data() % alignof(PMath::Matrix4Reg), 0);
+		EXPECT_EQ(std::memcmp(m.data(), ms.data(), ms.size() * sizeof(PMath::Matrix4Reg)), 0);
+
+		std::span<const PMath::Vector3Reg> v = a.Get<PMath::Vector3Reg>("positions");
+		ASSERT_EQ(v.size(), vs.size());
+		EXPECT_TRUE(v[42] == vs[42]);
+
+		std::span<const PMath::Plane> pl = a.Get<PMath::Plane>("planes");
+		ASSERT_EQ(pl.size(), pls.size());
+		EXPECT_EQ(std::memcmp(pl.data(), pls.data(), pls.size() * sizeof(PMath::Plane)), 0);
+
+		// Wrong type, wrong precision or missing.
+		EXPECT_TRUE(a.Get<PMath::Vector4>("positions").empty());
+		EXPECT_TRUE(a.Get<PMath::Vector3d>("positions").empty());
+		EXPECT_TRUE(a.Get<PMath::Vector3Reg>("velocities").empty());
+
+		// Aligned and unaligned types share the layout.
+		EXPECT_EQ(a.Get<PMath::Matrix4>("transforms").size(), ms.size());
+
+		// TVector2<double> has a different stride with SSE, Read converts.
+		std::vector<PMath::Vector2Regd> uv;
+		ASSERT_TRUE(a.Read("uv", uv));
+		ASSERT_EQ(uv.size(), v2s.size());
+		EXPECT_EQ(uv[10].x, 2.5);
+		EXPECT_EQ(uv[10].y, -5.0);
+		EXPECT_EQ(a.Get<PMath::Vector2Regd>("uv").size(), sizeof(PMath::Vector2Regd) == sizeof(PMath::Vector2d) ? v2s.size() : 0);
+
+		a.Close();
+
+		// Same file with the byte order swapped.
+		std::vector<char> bytes;
+		{
+			std::FILE* f = std::fopen(path.c_str(), "rb");
+			ASSERT_NE(f, nullptr);
+			std::fseek(f, 0, SEEK_END);
+			bytes.resize((size_t)std::ftell(f));
+			std::fseek(f, 0, SEEK_SET);
+			ASSERT_EQ(std::fread(bytes.data(), 1, bytes.size(), f), bytes.size());
+			std::fclose(f);
+		}
+
+		using namespace Phanes::Core::Math::Detail;
+
+		archive_header h;
+		std::memcpy(&h, bytes.data(), sizeof(h));
+
+		std::vector<archive_entry> es(h.count);
+		std::memcpy(es.data(), bytes.data() + h.directory, h.count * sizeof(archive_entry));
+
+		for (archive_entry& e : es)
+		{
+			archive_swap(bytes.data() + e.offset, e.count * e.stride, e.componentSize);
+
+			e.offset = archive_swap(e.offset);
+			e.count = archive_swap(e.count);
+			e.stride = archive_swap(e.stride);
+			e.type = archive_swap(e.type);
+		}
+
+		std::memcpy(bytes.data() + h.directory, es.data(), es.size() * sizeof(archive_entry));
+
+		h.endian = (archive_native_endian == archive_endian::Little) ? archive_endian::Big : archive_endian::Little;
+		h.version = archive_swap(h.version);
+		h.count = archive_swap(h.count);
+		h.directory = archive_swap(h.directory);
+		std::memcpy(bytes.data(), &h, sizeof(h));
+
+		{
+			std::FILE* f = std::fopen(path.c_str(), "wb");
+			ASSERT_NE(f, nullptr);
+			std::fwrite(bytes.data(), 1, bytes.size(), f);
+			std::fclose(f);
+		}
+
+		ASSERT_TRUE(a.Open(path.c_str()));
+		EXPECT_FALSE(a.IsNative());
+		EXPECT_TRUE(a.Get<PMath::Matrix4Reg>("transforms").empty());
+
+		std::vector<PMath::Matrix4Reg> m2;
+		ASSERT_TRUE(a.Read("transforms", m2));
+		ASSERT_EQ(m2.size(), ms.size());
+		EXPECT_TRUE(m2[7] == ms[7]);
+
+		std::vector<PMath::Vector2d> uv2;
+		ASSERT_TRUE(a.Read("uv", uv2));
+		EXPECT_EQ(uv2[10].x, 2.5);
+		EXPECT_EQ(uv2[10].y, -5.0);
+
+		a.Close();
+
+		// Not an archive.
+		bytes[0] = 'X';
+		{
+			std::FILE* f = std::fopen(path.c_str(), "wb");
+			ASSERT_NE(f, nullptr);
+			std::fwrite(bytes.data(), 1, bytes.size(), f);
+			std::fclose(f);
+		}
+
+		EXPECT_FALSE(a.Open(path.c_str()));
+		std::remove(path.c_str());
+		EXPECT_FALSE(a.Open(path.c_str()));
+	}
+} // namespace Archive
+
 int main(int argc, char** argv)
 {
 	::testing::InitGoogleTest(&argc, argv);
@@ -11,10 +11,15 @@ ARCH = "x86_64"
 -- SSE4: SSE
 -- AVX: AVX
 -- AVX2: AVX2
+-- Runtime dispatch: Dispatch (SSE4 baseline, batch kernels pick SSE/AVX/AVX2 on startup)
 -- No SSE: FPU
 -- None: Automatically detect SSE during build
 SSE = "None"
 
+-- FMA3 (Haswell / Zen and newer): adds -mfma to AVX and AVX2 builds, which enables P_FMA__ (see Platform.h).
+-- Ignored for the other SSE options, Dispatch has to stay on the SSE baseline.
+FMA = false
+
 phanesRoot = path.getabsolute(".")
 phanesBin = path.join(phanesRoot, "bin")
 phanesInt = path.join(phanesRoot, ".int")
@@ -34,7 +39,10 @@ debugger("gdb")
 startproject("MathTestFPU")
 configurations({ "Debug", "Release" })
 
-function linux_sse()
+-- mode overrides the global SSE option, e.g. for projects built once per backend.
+function linux_sse(mode)
+	local SSE = mode or SSE
+
 	if SSE == "SSE" then
 		defines({ "P_SSE__" })
 		buildoptions({ "-msse4", "-msse2", "-msse3" })
@@ -43,13 +51,23 @@ function linux_sse()
 		buildoptions({ "-mavx", "-msse4", "-msse2", "-msse3" })
 	elseif SSE == "AVX2" then
 		defines({ "P_AVX2__" })
-		buildoptions({ "-mavx2", "-mavx", "-msse4", "-msse2", "-msse3" })
+		-- Every AVX2 CPU has F16C, which enables P_F16C__ (see Platform.h).
+		buildoptions({ "-mavx2", "-mf16c", "-mavx", "-msse4", "-msse2", "-msse3" })
+	elseif SSE == "Dispatch" then
+		defines({ "P_SIMD_DISPATCH" })
+		buildoptions({ "-msse4", "-msse2", "-msse3" })
 	elseif SSE == "FPU" then
 		defines({ "P_FORCE_FPU" })
 	end
+
+	if FMA and (SSE == "AVX" or SSE == "AVX2") then
+		-- Only the kernels fuse (P_FMA__): GCC would otherwise contract any a * b + c, which breaks exact results
+		-- like CrossP(v, v) == 0 and the singularity tests of the inverses.
+		buildoptions({ "-mfma", "-ffp-contract=off" })
+	end
 end
 
-function boilerplate()
+function boilerplate(sse)
 	language("C++")
 
 	location(phanesBuildFiles .. "/%{prj.name}")
@@ -59,7 +77,7 @@ function boilerplate()
 	if PLATFORM == "linux" then
 		defines({ "P_LINUX_BUILD" })
 		buildoptions({ "-Wall", "-Wextra", "-Werror" })
-		linux_sse()
+		linux_sse(sse)
 		buildoptions({ "-Wno-unused-parameter", "-fms-extensions" })
 	end
 
@@ -126,3 +144,4 @@ newaction({
 include(phanesRoot .. "/Engine/Source/Runtime/Core/premake5.lua")
 include(phanesRoot .. "/DevPlayground/premake5.lua")
 include(PhanesRuntime .. "/Core/Tests/Math/MathTestFPU/premake5.lua")
+include(PhanesRuntime .. "/Core/Tests/Math/MathBench/premake5.lua")